@@ -18,6 +18,7 @@ using namespace unum;
 
 using add_result_t = typename index_dense_t::add_result_t;
 using search_result_t = typename index_dense_t::search_result_t;
+using range_search_result_t = typename index_dense_t::range_search_result_t;
 using labeling_result_t = typename index_dense_t::labeling_result_t;
 
 static_assert(std::is_same<usearch_key_t, index_dense_t::vector_key_t>::value, "Type mismatch between C and C++");
@@ -76,13 +77,14 @@ usearch_scalar_kind_t scalar_kind_to_c(scalar_kind_t kind) {
     }
 }
 
-add_result_t add_(index_dense_t* index, usearch_key_t key, void const* vector, scalar_kind_t kind) {
+add_result_t add_(index_dense_t* index, usearch_key_t key, void const* vector, scalar_kind_t kind,
+                  std::size_t thread = index_dense_t::any_thread()) {
     switch (kind) {
-    case scalar_kind_t::f32_k: return index->add(key, (f32_t const*)vector);
-    case scalar_kind_t::f64_k: return index->add(key, (f64_t const*)vector);
-    case scalar_kind_t::f16_k: return index->add(key, (f16_t const*)vector);
-    case scalar_kind_t::i8_k: return index->add(key, (i8_t const*)vector);
-    case scalar_kind_t::b1x8_k: return index->add(key, (b1x8_t const*)vector);
+    case scalar_kind_t::f32_k: return index->add(key, (f32_t const*)vector, thread);
+    case scalar_kind_t::f64_k: return index->add(key, (f64_t const*)vector, thread);
+    case scalar_kind_t::f16_k: return index->add(key, (f16_t const*)vector, thread);
+    case scalar_kind_t::i8_k: return index->add(key, (i8_t const*)vector, thread);
+    case scalar_kind_t::b1x8_k: return index->add(key, (b1x8_t const*)vector, thread);
     default: return add_result_t{}.failed("Unknown scalar kind!");
     }
 }
@@ -100,22 +102,64 @@ std::size_t get_(index_dense_t* index, usearch_key_t key, size_t count, void* ve
 
 template <typename predicate_at = dummy_predicate_t>
 search_result_t search_(index_dense_t* index, void const* vector, scalar_kind_t kind, size_t n,
-                        predicate_at&& predicate = predicate_at{}) {
+                        predicate_at&& predicate = predicate_at{}, std::size_t thread = index_dense_t::any_thread()) {
     switch (kind) {
     case scalar_kind_t::f32_k:
-        return index->filtered_search((f32_t const*)vector, n, std::forward<predicate_at>(predicate));
+        return index->filtered_search((f32_t const*)vector, n, std::forward<predicate_at>(predicate), thread);
     case scalar_kind_t::f64_k:
-        return index->filtered_search((f64_t const*)vector, n, std::forward<predicate_at>(predicate));
+        return index->filtered_search((f64_t const*)vector, n, std::forward<predicate_at>(predicate), thread);
     case scalar_kind_t::f16_k:
-        return index->filtered_search((f16_t const*)vector, n, std::forward<predicate_at>(predicate));
+        return index->filtered_search((f16_t const*)vector, n, std::forward<predicate_at>(predicate), thread);
     case scalar_kind_t::i8_k:
-        return index->filtered_search((i8_t const*)vector, n, std::forward<predicate_at>(predicate));
+        return index->filtered_search((i8_t const*)vector, n, std::forward<predicate_at>(predicate), thread);
     case scalar_kind_t::b1x8_k:
-        return index->filtered_search((b1x8_t const*)vector, n, std::forward<predicate_at>(predicate));
+        return index->filtered_search((b1x8_t const*)vector, n, std::forward<predicate_at>(predicate), thread);
     default: return search_result_t().failed("Unknown scalar kind!");
     }
 }
 
+template <typename callback_at>
+range_search_result_t range_search_(index_dense_t* index, void const* vector, scalar_kind_t kind,
+                                    usearch_distance_t radius, size_t n, callback_at&& callback) {
+    switch (kind) {
+    case scalar_kind_t::f32_k: return index->range_search((f32_t const*)vector, radius, callback, n);
+    case scalar_kind_t::f64_k: return index->range_search((f64_t const*)vector, radius, callback, n);
+    case scalar_kind_t::f16_k: return index->range_search((f16_t const*)vector, radius, callback, n);
+    case scalar_kind_t::i8_k: return index->range_search((i8_t const*)vector, radius, callback, n);
+    case scalar_kind_t::b1x8_k: return index->range_search((b1x8_t const*)vector, radius, callback, n);
+    default: return range_search_result_t().failed("Unknown scalar kind!");
+    }
+}
+
+/**
+ *  @brief  Prepares the index for a batch on the given number of threads, growing the capacity,
+ *          if needed, to fit the additional vectors, and returns the number of threads to use.
+ */
+std::size_t reserve_batch_(index_dense_t* index, std::size_t additions, std::size_t threads, usearch_error_t* error) {
+    if (!threads)
+        threads = std::thread::hardware_concurrency();
+    index_limits_t limits = index->limits();
+    bool const fits = index->size() + additions <= limits.members && threads <= limits.concurrency();
+    if (fits)
+        return threads;
+
+    // Grow geometrically, so that a sequence of small batches doesn't reallocate every time
+    if (index->size() + additions > limits.members)
+        limits.members = ceil2(index->size() + additions);
+    limits.threads_add = (std::max)(limits.threads_add, threads);
+    limits.threads_search = (std::max)(limits.threads_search, threads);
+    if (!index->reserve(limits)) {
+        *error = "Out of memory!";
+        return 0;
+    }
+    return threads;
+}
+
+/// @brief Default stride between consecutive vectors of the given scalar kind, when packed densely.
+std::size_t vector_stride_(index_dense_t* index, scalar_kind_t kind) {
+    return divide_round_up<CHAR_BIT>(index->dimensions() * bits_per_scalar(kind));
+}
+
 extern "C" {
 
 USEARCH_EXPORT char const* usearch_version(void) {
@@ -289,6 +333,37 @@ USEARCH_EXPORT size_t usearch_memory_usage(usearch_index_t index, usearch_error_
     return reinterpret_cast<index_dense_t*>(index)->memory_usage();
 }
 
+USEARCH_EXPORT void usearch_instrumentation(usearch_index_t index, usearch_instrumentation_t* instrumentation,
+                                            usearch_error_t* error) {
+    USEARCH_ASSERT(index && instrumentation && error && "Missing arguments");
+    index_instrumentation_t native = reinterpret_cast<index_dense_t*>(index)->instrumentation();
+    static_assert(index_instrumentation_t::levels() == sizeof(instrumentation->hops_per_level) / sizeof(size_t),
+                  "Type mismatch between C and C++");
+    static_assert(log2_histogram_t::buckets() == sizeof(instrumentation->hops) / sizeof(uint64_t),
+                  "Type mismatch between C and C++");
+
+    instrumentation->enabled = native.enabled;
+    for (size_t level = 0; level != index_instrumentation_t::levels(); ++level)
+        instrumentation->hops_per_level[level] = native.hops_per_level[level];
+    instrumentation->missed_candidates = native.missed_candidates;
+    instrumentation->reused_candidates = native.reused_candidates;
+    instrumentation->distance_nanoseconds = native.distance_nanoseconds;
+    instrumentation->node_lock_waits = native.node_lock_waits;
+    instrumentation->node_lock_wait_nanoseconds = native.node_lock_wait_nanoseconds;
+    instrumentation->lookup_lock_waits = native.lookup_lock_waits;
+    instrumentation->lookup_lock_wait_nanoseconds = native.lookup_lock_wait_nanoseconds;
+    for (size_t bucket = 0; bucket != log2_histogram_t::buckets(); ++bucket) {
+        instrumentation->latency_nanoseconds[bucket] = native.latency_nanoseconds.count(bucket);
+        instrumentation->hops[bucket] = native.hops.count(bucket);
+        instrumentation->computed_distances[bucket] = native.computed_distances.count(bucket);
+    }
+}
+
+USEARCH_EXPORT void usearch_reset_instrumentation(usearch_index_t index, usearch_error_t* error) {
+    USEARCH_ASSERT(index && error && "Missing arguments");
+    reinterpret_cast<index_dense_t*>(index)->reset_instrumentation();
+}
+
 USEARCH_EXPORT char const* usearch_hardware_acceleration(usearch_index_t index, usearch_error_t* error) {
     USEARCH_ASSERT(index && error && "Missing arguments");
     return reinterpret_cast<index_dense_t*>(index)->metric().isa_name();
@@ -342,6 +417,39 @@ USEARCH_EXPORT void usearch_add(
         *error = result.error.release();
 }
 
+USEARCH_EXPORT void usearch_add_many(                                                             //
+    usearch_index_t index, size_t count, usearch_key_t const* keys, size_t keys_stride,          //
+    void const* vectors, size_t vectors_stride, usearch_scalar_kind_t vector_kind, size_t threads, //
+    usearch_error_t* error) {
+
+    USEARCH_ASSERT(index && keys && vectors && error && "Missing arguments");
+    index_dense_t* index_ = reinterpret_cast<index_dense_t*>(index);
+    scalar_kind_t kind = scalar_kind_to_cpp(vector_kind);
+    threads = reserve_batch_(index_, count, threads, error);
+    if (!threads)
+        return;
+
+    byte_t const* keys_bytes = reinterpret_cast<byte_t const*>(keys);
+    byte_t const* vectors_bytes = reinterpret_cast<byte_t const*>(vectors);
+    keys_stride = keys_stride ? keys_stride : sizeof(usearch_key_t);
+    vectors_stride = vectors_stride ? vectors_stride : vector_stride_(index_, kind);
+
+    std::atomic<char const*> atomic_error{nullptr};
+    executor_default_t{threads}.dynamic(count, [&](std::size_t thread, std::size_t task) {
+        // Strided keys may be misaligned, so they are copied out instead of being dereferenced in place
+        usearch_key_t key;
+        std::memcpy(&key, keys_bytes + task * keys_stride, sizeof(key));
+        add_result_t result = add_(index_, key, vectors_bytes + task * vectors_stride, kind, thread);
+        if (!result) {
+            atomic_error = result.error.release();
+            return false;
+        }
+        return true;
+    });
+    if (char const* message = atomic_error.load())
+        *error = message;
+}
+
 USEARCH_EXPORT bool usearch_contains(usearch_index_t index, usearch_key_t key, usearch_error_t*) {
     USEARCH_ASSERT(index && "Missing arguments");
     return reinterpret_cast<index_dense_t*>(index)->contains(key);
@@ -367,6 +475,44 @@ USEARCH_EXPORT size_t usearch_search(
     return result.dump_to(found_keys, found_distances);
 }
 
+USEARCH_EXPORT size_t usearch_search_many(                                           //
+    usearch_index_t index, size_t queries_count,                                     //
+    void const* queries, size_t queries_stride, usearch_scalar_kind_t query_kind,  //
+    size_t count, size_t threads,                                                    //
+    usearch_key_t* keys, usearch_distance_t* distances, size_t* found_counts, usearch_error_t* error) {
+
+    USEARCH_ASSERT(index && queries && keys && distances && error && "Missing arguments");
+    index_dense_t* index_ = reinterpret_cast<index_dense_t*>(index);
+    scalar_kind_t kind = scalar_kind_to_cpp(query_kind);
+    threads = reserve_batch_(index_, 0, threads, error);
+    if (!threads)
+        return 0;
+
+    byte_t const* queries_bytes = reinterpret_cast<byte_t const*>(queries);
+    queries_stride = queries_stride ? queries_stride : vector_stride_(index_, kind);
+
+    std::atomic<char const*> atomic_error{nullptr};
+    std::atomic<std::size_t> found_total{0};
+    executor_default_t{threads}.dynamic(queries_count, [&](std::size_t thread, std::size_t task) {
+        search_result_t result =
+            search_(index_, queries_bytes + task * queries_stride, kind, count, dummy_predicate_t{}, thread);
+        if (!result) {
+            atomic_error = result.error.release();
+            return false;
+        }
+        std::size_t found = result.dump_to(keys + task * count, distances + task * count);
+        if (found_counts)
+            found_counts[task] = found;
+        found_total += found;
+        return true;
+    });
+    if (char const* message = atomic_error.load()) {
+        *error = message;
+        return 0;
+    }
+    return found_total.load();
+}
+
 USEARCH_EXPORT size_t usearch_filtered_search(                                 //
     usearch_index_t index,                                                     //
     void const* query, usearch_scalar_kind_t query_kind, size_t results_limit, //
@@ -385,6 +531,54 @@ USEARCH_EXPORT size_t usearch_filtered_search(                                 /
     return result.dump_to(found_keys, found_distances);
 }
 
+USEARCH_EXPORT size_t usearch_range_search(                                              //
+    usearch_index_t index,                                                              //
+    void const* query, usearch_scalar_kind_t query_kind,                                //
+    usearch_distance_t radius, size_t results_limit,                                    //
+    usearch_key_t* found_keys, usearch_distance_t* found_distances, usearch_error_t* error) {
+
+    USEARCH_ASSERT(index && query && error && "Missing arguments");
+    index_dense_t* index_ = reinterpret_cast<index_dense_t*>(index);
+
+    // Keep the closest `results_limit` matches in a max-heap, preallocated, as the callback can't throw
+    using match_t = std::pair<usearch_distance_t, usearch_key_t>;
+    std::size_t const heap_limit = (std::min)(results_limit, index_->size());
+    std::vector<match_t> matches;
+    try {
+        matches.reserve(heap_limit);
+    } catch (std::bad_alloc const&) {
+        *error = "Out of memory!";
+        return 0;
+    }
+    if (!heap_limit)
+        return 0;
+
+    range_search_result_t result = range_search_(
+        index_, query, scalar_kind_to_cpp(query_kind), radius, std::numeric_limits<std::size_t>::max(),
+        [&](usearch_key_t key, usearch_distance_t distance) noexcept {
+            if (matches.size() != heap_limit) {
+                matches.emplace_back(distance, key);
+                std::push_heap(matches.begin(), matches.end());
+            } else if (distance < matches.front().first) {
+                std::pop_heap(matches.begin(), matches.end());
+                matches.back() = {distance, key};
+                std::push_heap(matches.begin(), matches.end());
+            }
+        });
+    if (!result) {
+        *error = result.error.release();
+        return 0;
+    }
+
+    std::sort_heap(matches.begin(), matches.end());
+    for (size_t i = 0; i != matches.size(); ++i) {
+        found_keys[i] = matches[i].second;
+        if (found_distances)
+            found_distances[i] = matches[i].first;
+    }
+    return matches.size();
+}
+
 USEARCH_EXPORT size_t usearch_get(                          //
     usearch_index_t index, usearch_key_t key, size_t count, //
     void* vectors, usearch_scalar_kind_t kind, usearch_error_t*) {
@@ -1,6 +1,7 @@
 #include <errno.h>
 #include <stdio.h> // `remove`
 #include <stdlib.h>
+#include <string.h> // `memcpy`
 #include <sys/stat.h>
 
 #include "usearch.h"
@@ -158,6 +159,186 @@ void test_find_vector(size_t const collection_size, size_t const dimensions) {
     printf("Test: Find Vector - PASSED\n");
 }
 
+/**
+ *  This test verifies the range search, reporting all the vectors within a given distance from the query. It adds
+ *  vectors to the index, and for each of them searches with the distance to its farthest kANN match as the radius,
+ *  checking that the matches are sorted and stay within the radius, and that the limit on their number keeps
+ *  the closest ones.
+ */
+void test_range_search(size_t const collection_size, size_t const dimensions) {
+    printf("Test: Range Search... %zu vectors, %zu dimensions \n", collection_size, dimensions);
+
+    usearch_error_t error = NULL;
+    usearch_init_options_t opts = create_options(dimensions);
+    usearch_index_t index = usearch_init(&opts, &error);
+    usearch_reserve(index, collection_size, &error);
+
+    // Create result buffers
+    usearch_key_t* keys = (usearch_key_t*)malloc(collection_size * sizeof(usearch_key_t));
+    float* distances = (float*)malloc(collection_size * sizeof(float));
+    ASSERT(keys && distances, "Failed to allocate memory");
+
+    // Add vectors
+    float* data = create_vectors(collection_size, dimensions);
+    for (size_t i = 0; i < collection_size; ++i) {
+        usearch_key_t key = i;
+        usearch_add(index, key, data + i * dimensions, usearch_scalar_f32_k, &error);
+        ASSERT(!error, error);
+    }
+
+    // Search within the distance to the farthest of the top matches
+    size_t const wanted = collection_size < 10 ? collection_size : 10;
+    for (size_t i = 0; i < collection_size; i++) {
+        size_t found_count =
+            usearch_search(index, data + i * dimensions, usearch_scalar_f32_k, wanted, keys, distances, &error);
+        ASSERT(!error, error);
+        ASSERT(found_count >= 1, "Vector is missing");
+        float radius = distances[found_count - 1];
+
+        found_count = usearch_range_search(index, data + i * dimensions, usearch_scalar_f32_k, radius,
+                                           collection_size, keys, distances, &error);
+        ASSERT(!error, error);
+        ASSERT(found_count >= 1 && found_count <= collection_size, "Vector is missing");
+        for (size_t j = 0; j < found_count; ++j) {
+            ASSERT(distances[j] <= radius, "Match is out of range");
+            ASSERT(j == 0 || distances[j - 1] <= distances[j], "Matches aren't sorted");
+        }
+
+        // Limit the number of matches, keeping the closest ones
+        float const closest_distance = distances[0];
+        found_count = usearch_range_search(index, data + i * dimensions, usearch_scalar_f32_k, radius, 1, keys,
+                                           distances, &error);
+        ASSERT(!error, error);
+        ASSERT(found_count == 1, "Too many matches");
+        ASSERT(distances[0] == closest_distance, "Not the closest match");
+    }
+
+    free(data);
+    free(keys);
+    free(distances);
+    usearch_free(index, &error);
+    printf("Test: Range Search - PASSED\n");
+}
+
+/**
+ *  This test adds a batch of vectors with strided keys on multiple threads, without reserving the capacity upfront,
+ *  and checks that the multi-threaded batch search finds the same neighbors as searching one query at a time.
+ */
+void test_add_search_many(size_t const collection_size, size_t const dimensions) {
+    printf("Test: Add & Search Many... %zu vectors, %zu dimensions \n", collection_size, dimensions);
+
+    usearch_error_t error = NULL;
+    usearch_init_options_t opts = create_options(dimensions);
+    usearch_index_t index = usearch_init(&opts, &error);
+    ASSERT(!error, error);
+
+    // Interleave the keys with unrelated data, to exercise the strides
+    usearch_key_t* keys_and_padding = (usearch_key_t*)malloc(collection_size * 2 * sizeof(usearch_key_t));
+    ASSERT(keys_and_padding, "Failed to allocate memory");
+    for (size_t i = 0; i < collection_size; ++i)
+        keys_and_padding[i * 2] = i, keys_and_padding[i * 2 + 1] = ~(usearch_key_t)0;
+
+    float* data = create_vectors(collection_size, dimensions);
+    usearch_add_many(index, collection_size, keys_and_padding, 2 * sizeof(usearch_key_t), data, 0,
+                     usearch_scalar_f32_k, 4, &error);
+    ASSERT(!error, error);
+    ASSERT(usearch_size(index, &error) == collection_size, "Batch addition is incomplete");
+    for (size_t i = 0; i < collection_size; ++i)
+        ASSERT(usearch_contains(index, (usearch_key_t)i, &error), "Vector is missing");
+
+    size_t const wanted = 10;
+    usearch_key_t* keys = (usearch_key_t*)malloc(collection_size * wanted * sizeof(usearch_key_t));
+    usearch_distance_t* distances = (usearch_distance_t*)malloc(collection_size * wanted * sizeof(usearch_distance_t));
+    size_t* counts = (size_t*)malloc(collection_size * sizeof(size_t));
+    ASSERT(keys && distances && counts, "Failed to allocate memory");
+    size_t found_total = usearch_search_many(index, collection_size, data, dimensions * sizeof(float),
+                                             usearch_scalar_f32_k, wanted, 4, keys, distances, counts, &error);
+    ASSERT(!error, error);
+
+    size_t counts_total = 0;
+    for (size_t i = 0; i < collection_size; ++i) {
+        usearch_key_t single_keys[10];
+        usearch_distance_t single_distances[10];
+        size_t found = usearch_search(index, data + i * dimensions, usearch_scalar_f32_k, wanted, single_keys,
+                                      single_distances, &error);
+        ASSERT(!error, error);
+        ASSERT(found == counts[i], "Batch search found a different number of matches");
+        for (size_t j = 0; j < found; ++j)
+            ASSERT(single_keys[j] == keys[i * wanted + j], "Batch search found different matches");
+        counts_total += counts[i];
+    }
+    ASSERT(found_total == counts_total, "Total number of matches is wrong");
+
+    // Keys packed with a one-byte tag, and misaligned for every record but the first one
+    size_t const record_size = sizeof(usearch_key_t) + 1;
+    unsigned char* records = (unsigned char*)malloc(collection_size * record_size);
+    ASSERT(records, "Failed to allocate memory");
+    for (size_t i = 0; i < collection_size; ++i) {
+        usearch_key_t key = collection_size + i;
+        memcpy(records + i * record_size, &key, sizeof(key));
+        records[i * record_size + sizeof(key)] = 0xFF;
+    }
+    usearch_add_many(index, collection_size, (usearch_key_t const*)records, record_size, data, 0,
+                     usearch_scalar_f32_k, 4, &error);
+    ASSERT(!error, error);
+    for (size_t i = 0; i < collection_size; ++i)
+        ASSERT(usearch_contains(index, (usearch_key_t)(collection_size + i), &error), "Packed key is missing");
+    free(records);
+
+    free(counts);
+    free(distances);
+    free(keys);
+    free(data);
+    free(keys_and_padding);
+    usearch_free(index, &error);
+    printf("Test: Add & Search Many - PASSED\n");
+}
+
+/**
+ *  This test exports the search instrumentation. If the library was compiled with it, every search must be counted
+ *  in the latency histogram and expand at least one node on the base level, otherwise all the counters stay zeroed.
+ */
+void test_instrumentation(size_t const collection_size, size_t const dimensions) {
+    printf("Test: Instrumentation... %zu vectors, %zu dimensions \n", collection_size, dimensions);
+
+    usearch_error_t error = NULL;
+    usearch_init_options_t opts = create_options(dimensions);
+    usearch_index_t index = usearch_init(&opts, &error);
+    usearch_reserve(index, collection_size, &error);
+
+    // Add and find the vectors
+    usearch_key_t keys[10];
+    float distances[10];
+    float* data = create_vectors(collection_size, dimensions);
+    for (size_t i = 0; i < collection_size; ++i) {
+        usearch_add(index, i, data + i * dimensions, usearch_scalar_f32_k, &error);
+        ASSERT(!error, error);
+    }
+    usearch_reset_instrumentation(index, &error);
+    ASSERT(!error, error);
+    for (size_t i = 0; i < collection_size; ++i) {
+        usearch_search(index, data + i * dimensions, usearch_scalar_f32_k, 10, keys, distances, &error);
+        ASSERT(!error, error);
+    }
+
+    usearch_instrumentation_t instrumentation;
+    usearch_instrumentation(index, &instrumentation, &error);
+    ASSERT(!error, error);
+    uint64_t queries = 0;
+    for (size_t bucket = 0; bucket < 64; ++bucket)
+        queries += instrumentation.latency_nanoseconds[bucket];
+    if (instrumentation.enabled) {
+        ASSERT(queries == collection_size, "Queries are missing");
+        ASSERT(instrumentation.hops_per_level[0] >= collection_size, "Hops are missing");
+    } else {
+        ASSERT(queries == 0 && instrumentation.hops_per_level[0] == 0, "Instrumentation must be compiled out");
+    }
+
+    free(data);
+    usearch_free(index, &error);
+    printf("Test: Instrumentation - PASSED\n");
+}
+
 /**
  *  This test checks the ability of the index to handle multiple vectors associated with the same key. It initializes
  *  the index with the multi-option enabled, reserves space, and adds multiple vectors with the same key. The test then
@@ -373,6 +554,9 @@ int main(int argc, char const* argv[]) {
             test_init(collection_sizes[index], dimensions[jdx]);
             test_add_vector(collection_sizes[index], dimensions[jdx]);
             test_find_vector(collection_sizes[index], dimensions[jdx]);
+            test_range_search(collection_sizes[index], dimensions[jdx]);
+            test_add_search_many(collection_sizes[index], dimensions[jdx]);
+            test_instrumentation(collection_sizes[index], dimensions[jdx]);
             test_get_vector(collection_sizes[index], dimensions[jdx]);
             test_remove_vector(collection_sizes[index], dimensions[jdx]);
             test_save_load(collection_sizes[index], dimensions[jdx]);
@@ -97,6 +97,44 @@ USEARCH_EXPORT typedef struct usearch_init_options_t {
     bool multi;
 } usearch_init_options_t;
 
+/**
+ *  @brief  Search instrumentation, aggregated across all the threads. Stays zeroed, unless the library
+ *          is compiled with `USEARCH_USE_INSTRUMENTATION`. Every histogram has 64 logarithmic buckets,
+ *          where the bucket `i` counts the values in the `[2^(i-1), 2^i)` range.
+ */
+USEARCH_EXPORT typedef struct usearch_instrumentation_t {
+    /**
+     *  @brief Whether the instrumentation was compiled in.
+     */
+    bool enabled;
+    /**
+     *  @brief Number of expanded nodes on the first 16 levels, deeper ones are accumulated in the last.
+     */
+    size_t hops_per_level[16];
+    /**
+     *  @brief Neighbors scored for the first time in a traversal, and ones skipped as already visited.
+     */
+    size_t missed_candidates;
+    size_t reused_candidates;
+    /**
+     *  @brief Time spent in the distance kernels.
+     */
+    size_t distance_nanoseconds;
+    /**
+     *  @brief Number of contended acquisitions of the graph nodes and keys lookup locks, and the time waited.
+     */
+    size_t node_lock_waits;
+    size_t node_lock_wait_nanoseconds;
+    size_t lookup_lock_waits;
+    size_t lookup_lock_wait_nanoseconds;
+    /**
+     *  @brief Distributions of the per-query latency, expanded nodes, and computed distances.
+     */
+    uint64_t latency_nanoseconds[64];
+    uint64_t hops[64];
+    uint64_t computed_distances[64];
+} usearch_instrumentation_t;
+
 /**
  *  @brief Retrieves the version of the library.
  *  @return The version of the library.
@@ -126,6 +164,22 @@ USEARCH_EXPORT void usearch_free(usearch_index_t index, usearch_error_t* error);
  */
 USEARCH_EXPORT size_t usearch_memory_usage(usearch_index_t index, usearch_error_t* error);
 
+/**
+ *  @brief Exports the search instrumentation counters and histograms.
+ *  @param[in] index The handle to the USearch index to inspect.
+ *  @param[out] instrumentation The structure to fill, zeroed if the instrumentation is compiled out.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_instrumentation(usearch_index_t index, usearch_instrumentation_t* instrumentation,
+                                            usearch_error_t* error);
+
+/**
+ *  @brief Zeroes the search instrumentation counters and histograms, while no searches are running.
+ *  @param[in] index The handle to the USearch index to reset.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_reset_instrumentation(usearch_index_t index, usearch_error_t* error);
+
 /**
  *  @brief Reports the SIMD capabilities used by the index on the current CPU.
  *  @param[in] index The handle to the USearch index to be queried.
@@ -313,6 +367,26 @@ USEARCH_EXPORT void usearch_add(              //
     usearch_index_t index, usearch_key_t key, //
     void const* vector, usearch_scalar_kind_t vector_kind, usearch_error_t* error);
 
+/**
+ *  @brief  Adds a batch of vectors with their keys to the index, using multiple threads.
+ *          Grows the capacity of the index, if needed, so no prior `usearch_reserve` is required.
+ *          Must not be called concurrently with other operations on the same index.
+ *
+ *  @param[inout] index The handle to the USearch index to be populated.
+ *  @param[in] count Number of vectors and keys in the batch.
+ *  @param[in] keys Pointer to the first key.
+ *  @param[in] keys_stride Number of bytes between consecutive keys, or zero for a contiguous array.
+ *  @param[in] vectors Pointer to the first vector.
+ *  @param[in] vectors_stride Number of bytes between consecutive vectors, or zero for a dense matrix.
+ *  @param[in] vector_kind The scalar type used in the vectors data.
+ *  @param[in] threads Number of threads to use, or zero for all available cores.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_add_many(                                                   //
+    usearch_index_t index, size_t count, usearch_key_t const* keys, size_t keys_stride, //
+    void const* vectors, size_t vectors_stride, usearch_scalar_kind_t vector_kind,      //
+    size_t threads, usearch_error_t* error);
+
 /**
  *  @brief Checks if the index contains a vector with a specific key.
  *  @param[in] index The handle to the USearch index to be queried.
@@ -347,6 +421,29 @@ USEARCH_EXPORT size_t usearch_search(                                         //
     void const* query_vector, usearch_scalar_kind_t query_kind, size_t count, //
     usearch_key_t* keys, usearch_distance_t* distances, usearch_error_t* error);
 
+/**
+ *  @brief  Performs k-Approximate Nearest Neighbors (kANN) Search for a batch of queries, using multiple threads.
+ *          Must not be called concurrently with other operations on the same index.
+ *
+ *  @param[in] index The handle to the USearch index to be queried.
+ *  @param[in] queries_count Number of query vectors in the batch.
+ *  @param[in] queries Pointer to the first query vector.
+ *  @param[in] queries_stride Number of bytes between consecutive queries, or zero for a dense matrix.
+ *  @param[in] query_kind The scalar type used in the query vectors data.
+ *  @param[in] count Upper bound on the number of neighbors to search for every query, the "k" in "kANN".
+ *  @param[in] threads Number of threads to use, or zero for all available cores.
+ *  @param[out] keys Output matrix of `queries_count` rows, each with `count` nearest neighbors keys.
+ *  @param[out] distances Output matrix of `queries_count` rows, each with `count` distances to nearest neighbors.
+ *  @param[out] found_counts @b Optional output buffer for `queries_count` numbers of matches found per query.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return Total number of found matches across all queries.
+ */
+USEARCH_EXPORT size_t usearch_search_many(                                         //
+    usearch_index_t index, size_t queries_count,                                   //
+    void const* queries, size_t queries_stride, usearch_scalar_kind_t query_kind, //
+    size_t count, size_t threads,                                                  //
+    usearch_key_t* keys, usearch_distance_t* distances, size_t* found_counts, usearch_error_t* error);
+
 /**
  *  @brief  Performs k-Approximate Nearest Neighbors (kANN) Search for closest vectors to query,
  *          predicated on a custom function that returns `true` for vectors to be included.
@@ -368,6 +465,26 @@ USEARCH_EXPORT size_t usearch_filtered_search(                                //
     int (*filter)(usearch_key_t key, void* filter_state), void* filter_state, //
     usearch_key_t* keys, usearch_distance_t* distances, usearch_error_t* error);
 
+/**
+ *  @brief  Finds all the vectors within the `radius` from the query in a single traversal,
+ *          instead of repeating the kANN Search with a growing `count`.
+ *
+ *  @param[in] index The handle to the USearch index to be queried.
+ *  @param[in] query_vector Pointer to the query vector data.
+ *  @param[in] query_kind The scalar type used in the query vector data.
+ *  @param[in] radius Upper bound on the distance to the matches, inclusive.
+ *  @param[in] count Upper bound on the number of matches, of which only the closest ones are kept.
+ *  @param[out] keys Output buffer for up to `count` matches keys, sorted by the distance.
+ *  @param[out] distances Output buffer for up to `count` distances to matches.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return Number of found matches. If equal to `count`, there may be more of them within the `radius`.
+ */
+USEARCH_EXPORT size_t usearch_range_search(                     //
+    usearch_index_t index,                                      //
+    void const* query_vector, usearch_scalar_kind_t query_kind, //
+    usearch_distance_t radius, size_t count,                    //
+    usearch_key_t* keys, usearch_distance_t* distances, usearch_error_t* error);
+
 /**
  *  @brief Retrieves the vector associated with the given key from the index.
  *  @param[in] index The handle to the USearch index to be queried.
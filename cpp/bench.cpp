@@ -27,11 +27,13 @@
 #include <sys/stat.h> // `stat`
 
 #include <algorithm>
+#include <chrono> // `std::chrono::high_resolution_clock`
 #include <csignal>
 #include <cstdio>
 #include <iostream>  // `std::cerr`
 #include <numeric>   // `std::iota`
 #include <stdexcept> // `std::invalid_argument`
+#include <sstream>   // `std::istringstream`
 #include <string>    // `std::to_string`
 #include <thread>    // `std::thread::hardware_concurrency()`
 #include <variant>   // `std::monostate`
@@ -210,6 +212,36 @@ char const* getenv_or(char const* name, char const* default_) { return getenv(na
 
 using timestamp_t = std::chrono::time_point<std::chrono::high_resolution_clock>;
 
+timestamp_t now() noexcept { return std::chrono::high_resolution_clock::now(); }
+std::uint64_t nanoseconds_since(timestamp_t start) noexcept {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now() - start).count());
+}
+double seconds_since(timestamp_t start) noexcept { return nanoseconds_since(start) / 1e9; }
+
+/// @brief Per-operation latency distribution, in microseconds.
+struct latency_percentiles_t {
+    double p50{};
+    double p95{};
+    double p99{};
+    double p999{};
+};
+
+/// @brief Sorts the measured nanoseconds in-place to pick the percentiles.
+latency_percentiles_t latency_percentiles(std::vector<std::uint64_t>& nanoseconds) {
+    latency_percentiles_t result;
+    if (nanoseconds.empty())
+        return result;
+    std::sort(nanoseconds.begin(), nanoseconds.end());
+    auto at = [&](double quantile) {
+        return nanoseconds[static_cast<std::size_t>(quantile * (nanoseconds.size() - 1))] / 1e3;
+    };
+    result.p50 = at(0.5);
+    result.p95 = at(0.95);
+    result.p99 = at(0.99);
+    result.p999 = at(0.999);
+    return result;
+}
+
 struct running_stats_printer_t {
     std::size_t total{};
     std::atomic<std::size_t> progress{};
@@ -287,7 +319,7 @@ void index_many(index_at& index, std::size_t n, vector_id_at const* ids, real_at
 template <typename index_at, typename vector_id_at, typename real_at>
 void search_many( //
     index_at& index, std::size_t n, real_at const* vectors, std::size_t dims, std::size_t wanted, vector_id_at* ids,
-    real_at* distances) {
+    real_at* distances, std::uint64_t* latencies) {
 
     std::string name = "Search " + std::to_string(wanted);
     running_stats_printer_t printer{n, name.c_str()};
@@ -301,32 +333,45 @@ void search_many( //
         config.thread = omp_get_thread_num();
 #endif
         float_span_t vector{vectors + dims * i, dims};
+        timestamp_t start = now();
         index.search(vector, wanted, config.thread).dump_to(ids + wanted * i, distances + wanted * i);
+        latencies[i] = nanoseconds_since(start);
         printer.progress++;
         if (config.thread == 0)
             printer.refresh();
     }
 }
 
+/**
+ *  @brief  Constructs the index, if requested, and evaluates the search speed, recall, and join quality.
+ *  @return Seconds spent on construction, or zero if the index was already constructed.
+ */
 template <typename dataset_at, typename index_at> //
-static void single_shot(dataset_at& dataset, index_at& index, bool construct = true) {
+static double single_shot(dataset_at& dataset, index_at& index, bool construct = true) {
     using distance_t = typename index_at::distance_t;
     constexpr default_key_t missing_key = std::numeric_limits<default_key_t>::max();
 
     std::printf("\n");
     std::printf("------------\n");
+    double construction_seconds = 0;
     if (construct) {
         // Perform insertions, evaluate speed
         std::vector<default_key_t> ids(dataset.vectors_count());
         std::iota(ids.begin(), ids.end(), 0);
+        timestamp_t start = now();
         index_many(index, dataset.vectors_count(), ids.data(), dataset.vector(0), dataset.dimensions());
+        construction_seconds = seconds_since(start);
     }
 
     // Perform search, evaluate speed
     std::vector<default_key_t> found_neighbors(dataset.queries_count() * dataset.neighborhood_size());
     std::vector<distance_t> found_distances(dataset.queries_count() * dataset.neighborhood_size());
+    std::vector<std::uint64_t> latencies(dataset.queries_count());
     search_many(index, dataset.queries_count(), dataset.query(0), dataset.dimensions(), dataset.neighborhood_size(),
-                found_neighbors.data(), found_distances.data());
+                found_neighbors.data(), found_distances.data(), latencies.data());
+    latency_percentiles_t latency = latency_percentiles(latencies);
+    std::printf("Latency p50 %.1f us, p95 %.1f us, p99 %.1f us, p99.9 %.1f us\n", //
+                latency.p50, latency.p95, latency.p99, latency.p999);
 
     // Evaluate search quality
     std::size_t recall_at_1 = 0, recall_full = 0;
@@ -375,6 +420,172 @@ static void single_shot(dataset_at& dataset, index_at& index, bool construct = t
 
     std::printf("------------\n");
     std::printf("\n");
+    return construction_seconds;
+}
+
+/// @brief Search quality and speed for one combination of the search parameters.
+struct search_point_t {
+    std::size_t threads{};
+    std::size_t expansion{};
+    double queries_per_second{};
+    double recall_at_1{};
+    double recall_at_k{};
+    latency_percentiles_t latency{};
+    /// @brief No other point has both higher recall and higher throughput.
+    bool pareto{};
+};
+
+/**
+ *  @brief  Evaluates the search with the given ::expansion on exactly ::threads threads.
+ *          Uses STL threads rather than OpenMP, as the latter may be dynamically adjusting the team size.
+ */
+template <typename dataset_at, typename index_at> //
+search_point_t search_point(dataset_at& dataset, index_at& index, std::size_t threads, std::size_t expansion) {
+    using distance_t = typename index_at::distance_t;
+    constexpr default_key_t missing_key = std::numeric_limits<default_key_t>::max();
+    std::size_t const queries = dataset.queries_count();
+    std::size_t const wanted = dataset.neighborhood_size();
+
+    std::vector<default_key_t> found_neighbors(queries * wanted, missing_key);
+    std::vector<distance_t> found_distances(queries * wanted);
+    std::vector<std::uint64_t> latencies(queries);
+
+    index.change_expansion_search(expansion);
+    executor_stl_t executor(threads);
+    timestamp_t start = now();
+    executor.fixed(queries, [&](std::size_t thread, std::size_t i) {
+        timestamp_t query_start = now();
+        index.search(dataset.query(i), wanted, thread)
+            .dump_to(found_neighbors.data() + wanted * i, found_distances.data() + wanted * i);
+        latencies[i] = nanoseconds_since(query_start);
+    });
+    double seconds = seconds_since(start);
+
+    // The share of the ground-truth top-1 ranked first, and of the ground-truth top-k found anywhere in top-k
+    std::size_t matched_first = 0, matched_any = 0;
+    for (std::size_t i = 0; i != queries; ++i) {
+        auto expected = dataset.neighborhood(i);
+        default_key_t const* received = found_neighbors.data() + i * wanted;
+        matched_first += received[0] == default_key_t{expected[0]};
+        for (std::size_t j = 0; j != wanted; ++j)
+            matched_any += contains(received, received + wanted, default_key_t{expected[j]});
+    }
+
+    search_point_t result;
+    result.threads = threads;
+    result.expansion = expansion;
+    result.queries_per_second = queries / seconds;
+    result.recall_at_1 = matched_first * 1.0 / queries;
+    result.recall_at_k = matched_any * 1.0 / (queries * wanted);
+    result.latency = latency_percentiles(latencies);
+    return result;
+}
+
+/**
+ *  @brief  Evaluates every combination of the thread counts and `expansion_search` values,
+ *          printing the resulting recall-vs-throughput curve and marking its Pareto frontier.
+ */
+template <typename dataset_at, typename index_at> //
+std::vector<search_point_t> sweep(                //
+    dataset_at& dataset, index_at& index,         //
+    std::vector<std::size_t> const& threads, std::vector<std::size_t> const& expansions) {
+
+    std::size_t const default_expansion = index.config().expansion_search;
+    std::vector<search_point_t> points;
+    for (std::size_t threads_count : threads)
+        for (std::size_t expansion : expansions)
+            points.push_back(search_point(dataset, index, threads_count, expansion));
+    index.change_expansion_search(default_expansion);
+
+    for (search_point_t& point : points)
+        point.pareto = std::none_of(points.begin(), points.end(), [&](search_point_t const& other) {
+            return other.recall_at_k >= point.recall_at_k && other.queries_per_second >= point.queries_per_second &&
+                   (other.recall_at_k > point.recall_at_k || other.queries_per_second > point.queries_per_second);
+        });
+
+    std::printf("\n");
+    std::printf("Sweep, marking the Pareto frontier with *\n");
+    std::printf("%8s %10s %12s %9s %9s %10s %10s %10s %10s\n", "Threads", "Expansion", "QPS", "Recall@1", "Recall@k",
+                "p50 us", "p95 us", "p99 us", "p99.9 us");
+    for (search_point_t const& point : points)
+        std::printf("%8zu %10zu %12.0f %8.2f%% %8.2f%% %10.1f %10.1f %10.1f %10.1f %s\n", point.threads,
+                    point.expansion, point.queries_per_second, point.recall_at_1 * 100, point.recall_at_k * 100,
+                    point.latency.p50, point.latency.p95, point.latency.p99, point.latency.p999,
+                    point.pareto ? "*" : "");
+    std::printf("\n");
+    return points;
+}
+
+/// @brief Throughput and latency of one kind of operations in a mixed workload.
+struct operation_stats_t {
+    std::size_t count{};
+    double per_second{};
+    latency_percentiles_t latency{};
+};
+
+struct mixed_workload_t {
+    std::size_t threads{};
+    double seconds{};
+    operation_stats_t search{};
+    operation_stats_t add{};
+    operation_stats_t remove{};
+};
+
+/**
+ *  @brief  Runs concurrent searches, insertions, and removals, in a 7:2:1 proportion.
+ *          Every query vector is used once, either searched or inserted under a new key,
+ *          and every removal deletes the key inserted by the previous task.
+ */
+template <typename dataset_at, typename index_at> //
+mixed_workload_t mixed_workload(dataset_at& dataset, index_at& index, std::size_t threads) {
+    enum class operation_t { search_k, add_k, remove_k };
+    auto operation = [](std::size_t task) {
+        std::size_t const slice = task % 10;
+        return slice < 7 ? operation_t::search_k : slice < 9 ? operation_t::add_k : operation_t::remove_k;
+    };
+
+    std::size_t const tasks = dataset.queries_count();
+    std::size_t const wanted = dataset.neighborhood_size();
+    default_key_t const first_new_key = static_cast<default_key_t>(dataset.vectors_count());
+    index.reserve(index_limits_t(index.size() + tasks, threads));
+
+    std::vector<std::uint64_t> latencies(tasks);
+    executor_stl_t executor(threads);
+    timestamp_t start = now();
+    executor.fixed(tasks, [&](std::size_t thread, std::size_t i) {
+        timestamp_t task_start = now();
+        switch (operation(i)) {
+        case operation_t::search_k: index.search(dataset.query(i), wanted, thread); break;
+        case operation_t::add_k: index.add(first_new_key + i, dataset.query(i), thread); break;
+        case operation_t::remove_k: index.remove(first_new_key + i - 1); break;
+        }
+        latencies[i] = nanoseconds_since(task_start);
+    });
+
+    mixed_workload_t result;
+    result.threads = threads;
+    result.seconds = seconds_since(start);
+    auto summarize = [&](operation_t kind, operation_stats_t& stats) {
+        std::vector<std::uint64_t> kind_latencies;
+        for (std::size_t i = 0; i != tasks; ++i)
+            if (operation(i) == kind)
+                kind_latencies.push_back(latencies[i]);
+        stats.count = kind_latencies.size();
+        stats.per_second = stats.count / result.seconds;
+        stats.latency = latency_percentiles(kind_latencies);
+        std::printf("%-8s %10zu ops %12.0f ops/s, p50 %.1f us, p95 %.1f us, p99 %.1f us, p99.9 %.1f us\n",
+                    kind == operation_t::search_k ? "Search" : kind == operation_t::add_k ? "Add" : "Remove",
+                    stats.count, stats.per_second, stats.latency.p50, stats.latency.p95, stats.latency.p99,
+                    stats.latency.p999);
+    };
+
+    std::printf("\n");
+    std::printf("Mixed workload on %zu threads, %.3f s\n", threads, result.seconds);
+    summarize(operation_t::search_k, result.search);
+    summarize(operation_t::add_k, result.add);
+    summarize(operation_t::remove_k, result.remove);
+    std::printf("\n");
+    return result;
 }
 
 void handler(int sig) {
@@ -433,6 +644,11 @@ struct args_t {
     std::size_t vectors_to_skip = 0;
     std::size_t vectors_to_take = 0;
 
+    std::string sweep_threads;
+    std::string sweep_expansion;
+    std::string path_json;
+    bool mixed = false;
+
     bool help = false;
 
     bool big = false;
@@ -479,6 +695,118 @@ struct args_t {
     }
 };
 
+/// @brief Parses a comma-separated list of positive integers, like "1,4,16".
+std::vector<std::size_t> parse_list(std::string const& text) noexcept(false) {
+    std::vector<std::size_t> result;
+    std::istringstream stream(text);
+    for (std::string item; std::getline(stream, item, ',');) {
+        std::size_t value = std::stoul(item);
+        if (!value)
+            throw std::invalid_argument("Sweep values must be positive: " + text);
+        result.push_back(value);
+    }
+    return result;
+}
+
+struct bench_report_t {
+    double construction_seconds{};
+    double save_seconds{};
+    double load_seconds{};
+    double view_seconds{};
+    std::vector<search_point_t> sweep;
+    /// @brief Only populated if `threads` is non-zero.
+    mixed_workload_t mixed;
+};
+
+std::string json_string(std::string const& text) {
+    std::string result = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\')
+            result += '\\';
+        result += c;
+    }
+    return result + "\"";
+}
+
+void json_latency(std::FILE* file, latency_percentiles_t const& latency) {
+    std::fprintf(file, "{\"p50\": %.3f, \"p95\": %.3f, \"p99\": %.3f, \"p999\": %.3f}", //
+                 latency.p50, latency.p95, latency.p99, latency.p999);
+}
+
+void json_operation(std::FILE* file, char const* name, operation_stats_t const& stats) {
+    std::fprintf(file, "      \"%s\": {\"count\": %zu, \"per_second\": %.3f, \"latency_us\": ", name, stats.count,
+                 stats.per_second);
+    json_latency(file, stats.latency);
+    std::fprintf(file, "}");
+}
+
+/// @brief Exports the report for automated comparisons between releases, with latencies in microseconds.
+template <typename index_at, typename dataset_at> //
+void write_json(std::string const& path, args_t const& args, dataset_at const& dataset, index_at const& index,
+                bench_report_t const& report) noexcept(false) {
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (!file)
+        throw std::runtime_error("Failed to open the JSON report file: " + path);
+
+    std::fprintf(file, "{\n");
+    std::fprintf(file, "  \"dataset\": {\n");
+    std::fprintf(file, "    \"vectors\": %s,\n", json_string(args.path_vectors).c_str());
+    std::fprintf(file, "    \"queries\": %s,\n", json_string(args.path_queries).c_str());
+    std::fprintf(file, "    \"neighbors\": %s,\n", json_string(args.path_neighbors).c_str());
+    std::fprintf(file, "    \"dimensions\": %zu,\n", dataset.dimensions());
+    std::fprintf(file, "    \"vectors_count\": %zu,\n", dataset.vectors_count());
+    std::fprintf(file, "    \"queries_count\": %zu,\n", dataset.queries_count());
+    std::fprintf(file, "    \"neighborhood_size\": %zu\n", dataset.neighborhood_size());
+    std::fprintf(file, "  },\n");
+
+    std::fprintf(file, "  \"index\": {\n");
+    std::fprintf(file, "    \"version\": \"%d.%d.%d\",\n", USEARCH_VERSION_MAJOR, USEARCH_VERSION_MINOR,
+                 USEARCH_VERSION_PATCH);
+    std::fprintf(file, "    \"metric\": \"%s\",\n", metric_kind_name(args.metric()));
+    std::fprintf(file, "    \"quantization\": \"%s\",\n", scalar_kind_name(args.quantization()));
+    std::fprintf(file, "    \"hardware_acceleration\": \"%s\",\n", index.metric().isa_name());
+    std::fprintf(file, "    \"connectivity\": %zu,\n", index.config().connectivity);
+    std::fprintf(file, "    \"expansion_add\": %zu,\n", index.config().expansion_add);
+    std::fprintf(file, "    \"expansion_search\": %zu,\n", index.config().expansion_search);
+    std::fprintf(file, "    \"threads\": %zu\n", args.threads);
+    std::fprintf(file, "  },\n");
+
+    std::fprintf(file, "  \"construction_seconds\": %.6f,\n", report.construction_seconds);
+    std::fprintf(file, "  \"startup\": {\"save_seconds\": %.6f, \"load_seconds\": %.6f, \"view_seconds\": %.6f},\n",
+                 report.save_seconds, report.load_seconds, report.view_seconds);
+
+    std::fprintf(file, "  \"sweep\": [");
+    for (std::size_t i = 0; i != report.sweep.size(); ++i) {
+        search_point_t const& point = report.sweep[i];
+        std::fprintf(file, "%s\n    {\"threads\": %zu, \"expansion\": %zu, \"queries_per_second\": %.3f, ",
+                     i ? "," : "", point.threads, point.expansion, point.queries_per_second);
+        std::fprintf(file, "\"recall_at_1\": %.6f, \"recall_at_k\": %.6f, \"pareto\": %s, \"latency_us\": ",
+                     point.recall_at_1, point.recall_at_k, point.pareto ? "true" : "false");
+        json_latency(file, point.latency);
+        std::fprintf(file, "}");
+    }
+    std::fprintf(file, "%s],\n", report.sweep.empty() ? "" : "\n  ");
+
+    if (report.mixed.threads) {
+        std::fprintf(file, "  \"mixed\": {\n");
+        std::fprintf(file, "    \"threads\": %zu,\n", report.mixed.threads);
+        std::fprintf(file, "    \"seconds\": %.6f,\n", report.mixed.seconds);
+        std::fprintf(file, "    \"operations\": {\n");
+        json_operation(file, "search", report.mixed.search);
+        std::fprintf(file, ",\n");
+        json_operation(file, "add", report.mixed.add);
+        std::fprintf(file, ",\n");
+        json_operation(file, "remove", report.mixed.remove);
+        std::fprintf(file, "\n");
+        std::fprintf(file, "    }\n");
+        std::fprintf(file, "  }\n");
+    } else
+        std::fprintf(file, "  \"mixed\": null\n");
+    std::fprintf(file, "}\n");
+    std::fclose(file);
+    std::printf("Saved the JSON report to: %s\n", path.c_str());
+}
+
 template <typename index_at, typename dataset_at> //
 void run_punned(dataset_at& dataset, args_t const& args, index_config_t config, index_limits_t limits) {
 
@@ -494,14 +822,42 @@ void run_punned(dataset_at& dataset, args_t const& args, index_config_t config,
     std::printf("-- Hardware acceleration: %s\n", index.metric().isa_name());
     std::printf("Will benchmark in-memory\n");
 
-    single_shot(dataset, index, true);
+    bench_report_t report;
+    report.construction_seconds = single_shot(dataset, index, true);
+    if (!args.sweep_threads.empty() || !args.sweep_expansion.empty()) {
+        std::vector<std::size_t> threads = parse_list(args.sweep_threads);
+        std::vector<std::size_t> expansions = parse_list(args.sweep_expansion);
+        if (threads.empty())
+            threads.push_back(args.threads);
+        if (expansions.empty())
+            expansions.push_back(index.config().expansion_search);
+        report.sweep = sweep(dataset, index, threads, expansions);
+    }
+
+    timestamp_t start = now();
     index.save(args.path_output.c_str());
+    report.save_seconds = seconds_since(start);
+
+    // Mutates the index, so must follow the serialization, and be undone by reloading it
+    if (args.mixed)
+        report.mixed = mixed_workload(dataset, index, args.threads);
+
+    start = now();
+    index.load(args.path_output.c_str());
+    report.load_seconds = seconds_since(start);
+    std::printf("Loaded in %.3f s\n", report.load_seconds);
 
     std::printf("Will benchmark an on-disk view\n");
 
+    start = now();
     index_at index_view = index.fork().index;
     index_view.view(args.path_output.c_str());
+    report.view_seconds = seconds_since(start);
+    std::printf("Viewed in %.3f s\n", report.view_seconds);
     single_shot(dataset, index_view, false);
+
+    if (!args.path_json.empty())
+        write_json(args.path_json, args, dataset, index, report);
 }
 
 template <typename index_at, typename dataset_at> //
@@ -541,6 +897,10 @@ int main(int argc, char** argv) {
         (option("--expansion-search") & value("integer", args.expansion_search)).doc("Affects search depth"),
         (option("--rows-skip") & value("integer", args.vectors_to_skip)).doc("Number of vectors to skip"),
         (option("--rows-take") & value("integer", args.vectors_to_take)).doc("Number of vectors to take"),
+        (option("--sweep-threads") & value("list", args.sweep_threads)).doc("Thread counts to sweep, like 1,4,16"),
+        (option("--sweep-expansion") & value("list", args.sweep_expansion)).doc("Search depths to sweep, like 16,64"),
+        (option("--mixed").set(args.mixed)).doc("Benchmark concurrent insertions, searches, and removals"),
+        (option("--json") & value("path", args.path_json)).doc("Machine-readable report output path"),
         ( //
             option("-f16", "--f16quant").set(args.quantize_f16).doc("Enable `f16_t` quantization") |
             option("-i8", "--i8quant").set(args.quantize_i8).doc("Enable `i8_t` quantization") |
@@ -596,6 +956,8 @@ int main(int argc, char** argv) {
     index_dense_config_t config(args.connectivity, args.expansion_add, args.expansion_search);
     index_limits_t limits;
     limits.threads_add = limits.threads_search = args.threads;
+    for (std::size_t threads : parse_list(args.sweep_threads))
+        limits.threads_search = (std::max)(limits.threads_search, threads);
     limits.members = dataset.vectors_count();
 
     std::printf("- Index: \n");
@@ -6,8 +6,11 @@
  */
 #include <algorithm>     // `std::shuffle`
 #include <cassert>       // `assert`
+#include <fstream>       // `std::ifstream`
+#include <iterator>      // `std::istreambuf_iterator`
 #include <random>        // `std::default_random_engine`
 #include <stdexcept>     // `std::terminate`
+#include <thread>        // `std::thread`
 #include <unordered_map> // `std::unordered_map`
 #include <vector>        // `std::vector`
 
@@ -18,6 +21,10 @@
 #include <usearch/index_dense.hpp>
 #include <usearch/index_plugins.hpp>
 
+#if USEARCH_USE_CUDA
+#include <usearch/index_gpu.cuh>
+#endif
+
 using namespace unum::usearch;
 using namespace unum;
 
@@ -458,6 +465,70 @@ void test_absurd(std::size_t dimensions, std::size_t connectivity, std::size_t e
     }
 }
 
+/**
+ * Exact search "accelerator" for the `exact_search_t`, that sorts all of the distances on the host,
+ * counting the offloaded requests. Declines every request, if `declining` is set.
+ */
+struct exact_search_brute_force_t {
+    bool declining = false;
+    std::size_t offloaded = 0;
+
+    static bool search(                                                                    //
+        void* state, metric_punned_t const& metric,                                        //
+        byte_t const* dataset_data, std::size_t dataset_count, std::size_t dataset_stride, //
+        byte_t const* queries_data, std::size_t queries_count, std::size_t queries_stride, //
+        std::size_t wanted, exact_offset_and_distance_t* results) {
+
+        exact_search_brute_force_t& device = *static_cast<exact_search_brute_force_t*>(state);
+        if (device.declining)
+            return false;
+
+        std::vector<exact_offset_and_distance_t> candidates(dataset_count);
+        for (std::size_t query_idx = 0; query_idx != queries_count; ++query_idx) {
+            byte_t const* query = queries_data + query_idx * queries_stride;
+            for (std::size_t dataset_idx = 0; dataset_idx != dataset_count; ++dataset_idx) {
+                candidates[dataset_idx].offset = static_cast<std::uint32_t>(dataset_idx);
+                candidates[dataset_idx].distance =
+                    static_cast<float>(metric(dataset_data + dataset_idx * dataset_stride, query));
+            }
+            std::stable_sort(candidates.begin(), candidates.end(),
+                             [](exact_offset_and_distance_t a, exact_offset_and_distance_t b) {
+                                 return a.distance < b.distance;
+                             });
+            exact_offset_and_distance_t* query_results = results + query_idx * wanted;
+            for (std::size_t i = 0; i != wanted; ++i) {
+                bool present = i < dataset_count;
+                query_results[i].offset = present ? candidates[i].offset : std::numeric_limits<std::uint32_t>::max();
+                query_results[i].distance = present ? candidates[i].distance : std::numeric_limits<float>::max();
+            }
+        }
+        device.offloaded++;
+        return true;
+    }
+
+    exact_search_device_t device() noexcept {
+        exact_search_device_t hook;
+        hook.search = &exact_search_brute_force_t::search;
+        hook.state = this;
+        return hook;
+    }
+};
+
+/**
+ * Compares the distances of two exact search results, that may only differ in the order of ties.
+ */
+bool exact_search_results_match(exact_search_results_t const& a, exact_search_results_t const& b, float tolerance) {
+    if (a.size() != b.size() || a.dimensions() != b.dimensions())
+        return false;
+    for (std::size_t query_idx = 0; query_idx != a.size(); ++query_idx)
+        for (std::size_t i = 0; i != a.dimensions(); ++i) {
+            float expected = a.at(query_idx)[i].distance, actual = b.at(query_idx)[i].distance;
+            if (std::fabs(expected - actual) > tolerance * (1 + std::fabs(expected)))
+                return false;
+        }
+    return true;
+}
+
 /**
  * Tests the exact search functionality over a dataset of vectors, @b wigthout constructing the index.
  *
@@ -486,6 +557,2183 @@ void test_exact_search(std::size_t dataset_count, std::size_t queries_count, std
 
     for (std::size_t i = 0; i < results.size(); ++i)
         assert(results.at(i)[0].offset == i); // Validate the top match
+
+    // The tiled multi-threaded search must match the naive sorting of all distances
+    executor_default_t executor;
+    auto parallel_results = search(                                               //
+        (byte_t const*)dataset.data(), dataset_count, dimensions * sizeof(float), //
+        (byte_t const*)dataset.data(), queries_count, dimensions * sizeof(float), //
+        wanted_count, metric, executor);
+    expect(parallel_results.size() == queries_count);
+
+    std::vector<float> expected_distances(dataset_count);
+    for (std::size_t query_idx = 0; query_idx != queries_count; ++query_idx) {
+        byte_t const* query = (byte_t const*)(dataset.data() + query_idx * dimensions);
+        for (std::size_t dataset_idx = 0; dataset_idx != dataset_count; ++dataset_idx)
+            expected_distances[dataset_idx] =
+                static_cast<float>(metric((byte_t const*)(dataset.data() + dataset_idx * dimensions), query));
+        std::sort(expected_distances.begin(), expected_distances.end());
+
+        auto query_results = parallel_results.at(query_idx);
+        for (std::size_t i = 0; i != wanted_count; ++i)
+            expect(i < dataset_count ? query_results[i].distance == expected_distances[i]
+                                     : query_results[i].offset == std::numeric_limits<std::uint32_t>::max());
+    }
+
+    // Declined requests fall back to the CPU, while the accepted ones are returned as computed by the device
+    exact_search_brute_force_t brute_force;
+    for (bool declining : {true, false}) {
+        brute_force.declining = declining;
+        exact_search_t offloaded(brute_force.device());
+        auto offloaded_results = offloaded(                                           //
+            (byte_t const*)dataset.data(), dataset_count, dimensions * sizeof(float), //
+            (byte_t const*)dataset.data(), queries_count, dimensions * sizeof(float), //
+            wanted_count, metric, executor);
+        expect(brute_force.offloaded == (declining ? 0u : 1u));
+        expect(exact_search_results_match(parallel_results, offloaded_results, 0));
+    }
+
+#if USEARCH_USE_CUDA
+    // Without a device, the GPU backend provides an empty hook, and the search stays on the CPU
+    gpu_exact_search_t gpu;
+    exact_search_t gpu_search(gpu.device());
+    expect(bool(gpu) == bool(gpu_search.device()));
+    for (metric_kind_t kind : {metric_kind_t::cos_k, metric_kind_t::ip_k, metric_kind_t::l2sq_k}) {
+        metric_punned_t kind_metric(dimensions, kind);
+        auto expected_results = search(                                               //
+            (byte_t const*)dataset.data(), dataset_count, dimensions * sizeof(float), //
+            (byte_t const*)dataset.data(), queries_count, dimensions * sizeof(float), //
+            wanted_count, kind_metric, executor);
+        auto gpu_results = gpu_search(                                                //
+            (byte_t const*)dataset.data(), dataset_count, dimensions * sizeof(float), //
+            (byte_t const*)dataset.data(), queries_count, dimensions * sizeof(float), //
+            wanted_count, kind_metric, executor);
+        expect(exact_search_results_match(expected_results, gpu_results, 1e-4f));
+    }
+#endif
+}
+
+/**
+ * Tests the one-to-many, many-to-one, and many-to-many distance kernels of the type-punned metric,
+ * comparing them to the pairwise evaluations for every built-in metric kind.
+ *
+ * @param dimensions Number of dimensions each vector should have.
+ */
+void test_batched_metrics(std::size_t dimensions) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(0.1f, 1.0f);
+    std::size_t const count = 100;
+    std::vector<float> dataset(count * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+    std::vector<byte_t const*> vectors(count);
+    for (std::size_t i = 0; i != count; ++i)
+        vectors[i] = (byte_t const*)(dataset.data() + i * dimensions);
+
+    for (metric_kind_t kind : {metric_kind_t::ip_k, metric_kind_t::cos_k, metric_kind_t::l2sq_k,
+                               metric_kind_t::pearson_k, metric_kind_t::divergence_k}) {
+        metric_punned_t metric(dimensions, kind, scalar_kind_t::f32_k);
+        expect(bool(metric));
+
+        std::vector<distance_punned_t> one_to_many(count), many_to_one(count), tile(count * count);
+        metric(vectors[0], vectors.data(), count, one_to_many.data());
+        for (std::size_t j = 0; j != count; ++j)
+            expect(one_to_many[j] == metric(vectors[0], vectors[j]));
+
+        metric(vectors.data(), count, vectors[0], many_to_one.data());
+        for (std::size_t i = 0; i != count; ++i)
+            expect(many_to_one[i] == metric(vectors[i], vectors[0]));
+
+        metric(vectors.data(), count, vectors.data(), count, tile.data());
+        for (std::size_t i = 0; i != count; ++i)
+            for (std::size_t j = 0; j != count; ++j)
+                expect(tile[i * count + j] == metric(vectors[i], vectors[j]));
+    }
+}
+
+/**
+ * Tests batched search over an index, comparing it to the results of individual queries.
+ *
+ * As the batched traversal visits the same nodes in the same order, the results and the number of
+ * computed distances must match exactly.
+ *
+ * @param collection_size Number of vectors to be indexed and queried.
+ * @param dimensions Number of dimensions each vector should have.
+ */
+void test_search_batch(std::size_t collection_size, std::size_t dimensions) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+    using distance_t = typename index_t::distance_t;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    metric_punned_t metric(dimensions, metric_kind_t::cos_k, scalar_kind_t::f32_k);
+    index_t index = index_t::make(metric);
+    executor_default_t executor;
+    index.reserve({collection_size, executor.size()});
+    executor.fixed(collection_size, [&](std::size_t thread, std::size_t task) {
+        index.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions, thread);
+    });
+
+    std::size_t const wanted = 10;
+    std::vector<vector_key_t> batch_keys(collection_size * wanted);
+    std::vector<distance_t> batch_distances(collection_size * wanted);
+    std::vector<std::size_t> batch_counts(collection_size);
+    auto batch_result = index.search_batch(dataset.data(), collection_size, wanted, batch_keys.data(),
+                                           batch_distances.data(), batch_counts.data(), executor);
+    expect(bool(batch_result));
+    expect(batch_result.count == collection_size);
+
+    std::vector<vector_key_t> single_keys(wanted);
+    std::vector<distance_t> single_distances(wanted);
+    std::size_t single_computed_distances = 0;
+    for (std::size_t i = 0; i != collection_size; ++i) {
+        auto single_result = index.search(dataset.data() + i * dimensions, wanted);
+        std::size_t single_count = single_result.dump_to(single_keys.data(), single_distances.data());
+        single_computed_distances += single_result.computed_distances;
+        expect(batch_counts[i] == single_count);
+        expect(std::equal(single_keys.begin(), single_keys.begin() + single_count, batch_keys.begin() + i * wanted));
+    }
+
+    // Sharing the neighbors lists must not cost extra distances, so the queries that settled aren't re-scored
+    expect(batch_result.computed_distances == single_computed_distances);
+
+    // Asking for nothing must still report an empty result for every query
+    std::fill(batch_counts.begin(), batch_counts.end(), wanted);
+    batch_result = index.search_batch(dataset.data(), collection_size, 0, batch_keys.data(), batch_distances.data(),
+                                      batch_counts.data(), executor);
+    expect(bool(batch_result));
+    expect(std::all_of(batch_counts.begin(), batch_counts.end(), [](std::size_t count) { return count == 0; }));
+}
+
+/**
+ * Tests product-quantized storage, comparing approximate and reranked search to the original vectors.
+ *
+ * Checks that the codes are much smaller than the vectors, that most vectors are found by their own
+ * query after reranking, and that the codebooks survive serialization.
+ *
+ * @param collection_size Number of vectors to be indexed and queried.
+ * @param dimensions Number of dimensions each vector should have.
+ * @param subspaces Number of one-byte codes per vector.
+ */
+void test_product_quantization(std::size_t collection_size, std::size_t dimensions, std::size_t subspaces,
+                               metric_kind_t metric_kind) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    metric_punned_t metric(dimensions, metric_kind, scalar_kind_t::f32_k);
+    index_t index = index_t::make(metric);
+    executor_pool_t executor;
+    auto misconfigured = index.quantize(dataset.data(), collection_size, dimensions + 1);
+    expect(!misconfigured);
+    misconfigured.error.release();
+    expect(bool(index.quantize(dataset.data(), collection_size, subspaces, 8, executor)));
+    expect(index.quantized());
+    expect(index.bytes_per_stored_vector() == subspaces);
+
+    index.reserve({collection_size, executor.size()});
+    executor.fixed(collection_size, [&](std::size_t thread, std::size_t task) {
+        index.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions, thread);
+    });
+    expect(index.size() == collection_size);
+
+    // Quantization can't be changed after insertions
+    auto late = index.quantize(dataset.data(), collection_size, subspaces);
+    expect(!late);
+    late.error.release();
+
+    // Reconstructed vectors are approximate, but closer to the original than to most others
+    std::vector<float> reconstructed(dimensions);
+    expect(index.get(0, reconstructed.data()));
+    byte_t const* original = reinterpret_cast<byte_t const*>(dataset.data());
+    byte_t const* neighbor = reinterpret_cast<byte_t const*>(dataset.data() + dimensions);
+    expect(metric(reinterpret_cast<byte_t const*>(reconstructed.data()), original) < metric(neighbor, original));
+
+    std::size_t const wanted = 10;
+    auto source = [&](vector_key_t key) { return reinterpret_cast<byte_t const*>(dataset.data() + key * dimensions); };
+    std::size_t found_approximate = 0, found_reranked = 0;
+    for (std::size_t i = 0; i != collection_size; ++i) {
+        float const* query = dataset.data() + i * dimensions;
+        found_approximate += index.search(query, wanted).contains(static_cast<vector_key_t>(i));
+        auto reranked = index.search_reranked(query, wanted, wanted * 8, source);
+        expect(reranked.size() == (std::min)(wanted, collection_size));
+        found_reranked += reranked.size() && reranked[0].member.key == static_cast<vector_key_t>(i);
+    }
+    expect(found_reranked >= found_approximate * 9 / 10);
+    expect(found_reranked * 10 >= collection_size * 9);
+
+    // Check the codebooks are preserved through serialization
+    expect(bool(index.save("tmp.usearch")));
+    index_t loaded = index_t::make(metric);
+    expect(bool(loaded.load("tmp.usearch")));
+    expect(loaded.quantized());
+    expect(loaded.size() == collection_size);
+    index_t viewed = index_t::make(metric);
+    expect(bool(viewed.view("tmp.usearch")));
+    expect(viewed.quantized());
+    for (std::size_t i = 0; i != (std::min)(collection_size, std::size_t(100)); ++i) {
+        float const* query = dataset.data() + i * dimensions;
+        auto original_result = index.search(query, wanted);
+        std::vector<vector_key_t> original_keys(wanted), loaded_keys(wanted), viewed_keys(wanted);
+        std::size_t original_count = original_result.dump_to(original_keys.data());
+        expect(loaded.search(query, wanted).dump_to(loaded_keys.data()) == original_count);
+        expect(viewed.search(query, wanted).dump_to(viewed_keys.data()) == original_count);
+        expect(original_keys == loaded_keys);
+        expect(original_keys == viewed_keys);
+    }
+}
+
+/**
+ * Tests two-stage search, traversing the graph with `i8_t` vectors and reranking with `f32_t` copies.
+ *
+ * Checks that reranked distances are exact and recall doesn't degrade compared to `i8_t`-only
+ * search, and that the copies survive serialization, copying, and compaction.
+ *
+ * @param collection_size Number of vectors to be indexed and queried.
+ * @param dimensions Number of dimensions each vector should have.
+ */
+void test_two_stage_search(std::size_t collection_size, std::size_t dimensions) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+    using distance_t = typename index_t::distance_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    metric_punned_t metric(dimensions, metric_kind_t::cos_k, scalar_kind_t::i8_k);
+    metric_punned_t rerank_metric(dimensions, metric_kind_t::cos_k, scalar_kind_t::f32_k);
+    index_t index = index_t::make(metric);
+    expect(index.enable_rerank(rerank_metric));
+    expect(index.reranked());
+
+    executor_pool_t executor;
+    index.reserve({collection_size, executor.size()});
+    executor.fixed(collection_size, [&](std::size_t thread, std::size_t task) {
+        index.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions, thread);
+    });
+    expect(!index.enable_rerank(rerank_metric));
+
+    // Collect the exact answers by brute force in full precision
+    std::size_t const wanted = 10;
+    auto recall = [&](index_t const& tested) {
+        std::size_t found = 0;
+        for (std::size_t i = 0; i != collection_size; ++i) {
+            float const* query = dataset.data() + i * dimensions;
+            auto result = tested.search(query, wanted);
+            for (std::size_t j = 0; j != result.size(); ++j) {
+                vector_key_t key = result[j].member.key;
+                distance_t exact = rerank_metric(reinterpret_cast<byte_t const*>(query),
+                                                 reinterpret_cast<byte_t const*>(dataset.data() + key * dimensions));
+                expect(tested.rerank_factor() == 0 || std::abs(result[j].distance - exact) < 1e-5f);
+            }
+            found += result.contains(static_cast<vector_key_t>(i));
+        }
+        return found;
+    };
+
+    std::size_t found_reranked = recall(index);
+    index.change_rerank_factor(0);
+    std::size_t found_approximate = recall(index);
+    index.change_rerank_factor(4);
+    expect(found_reranked >= found_approximate);
+
+    // External sources must produce the same results as the internal copies
+    auto source = [&](vector_key_t key) { return reinterpret_cast<byte_t const*>(dataset.data() + key * dimensions); };
+    for (std::size_t i = 0; i != (std::min)(collection_size, std::size_t(100)); ++i) {
+        float const* query = dataset.data() + i * dimensions;
+        std::vector<vector_key_t> internal_keys(wanted), external_keys(wanted);
+        std::size_t internal_count = index.search(query, wanted).dump_to(internal_keys.data());
+        std::size_t external_count = index.search_reranked(query, wanted, 0, source).dump_to(external_keys.data());
+        expect(internal_count == external_count);
+        expect(internal_keys == external_keys);
+    }
+
+    // Check the copies survive serialization, copies, and compaction
+    expect(bool(index.save("tmp.usearch")));
+    index_t loaded = index_t::make(metric);
+    expect(bool(loaded.load("tmp.usearch")));
+    expect(loaded.reranked());
+    expect(recall(loaded) == found_reranked);
+    index_t viewed = index_t::make(metric);
+    expect(bool(viewed.view("tmp.usearch")));
+    expect(viewed.reranked());
+    expect(recall(viewed) == found_reranked);
+
+    auto copy_result = index.copy();
+    expect(bool(copy_result));
+    expect(recall(copy_result.index) == found_reranked);
+    expect(bool(index.compact()));
+    expect(recall(index) == found_reranked);
+}
+
+/**
+ * Tests breadth-first nodes reordering, comparing the search results before and after relabeling.
+ *
+ * Reordering doesn't change the graph topology, so the results must match, and all the vectors
+ * must remain reachable by their keys, even if some of the entries were removed.
+ *
+ * @param collection_size Number of vectors to be indexed and queried.
+ * @param dimensions Number of dimensions each vector should have.
+ */
+void test_reorder(std::size_t collection_size, std::size_t dimensions) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    index_t index = index_t::make(metric);
+    executor_pool_t executor;
+    index.reserve({collection_size, executor.size()});
+    executor.fixed(collection_size, [&](std::size_t thread, std::size_t task) {
+        index.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions, thread);
+    });
+    for (std::size_t task = 0; task < collection_size; task += 7)
+        index.remove(static_cast<vector_key_t>(task));
+
+    std::size_t const wanted = 10;
+    auto search_all = [&](index_t const& tested) {
+        std::vector<vector_key_t> keys(collection_size * wanted);
+        for (std::size_t i = 0; i != collection_size; ++i)
+            tested.search(dataset.data() + i * dimensions, wanted).dump_to(keys.data() + i * wanted);
+        return keys;
+    };
+    std::vector<vector_key_t> keys_before = search_all(index);
+    expect(bool(index.reorder()));
+    expect(search_all(index) == keys_before);
+
+    std::vector<float> reconstructed(dimensions);
+    for (std::size_t task = 0; task != collection_size; ++task) {
+        bool removed = task % 7 == 0;
+        expect(index.contains(static_cast<vector_key_t>(task)) != removed);
+        if (removed)
+            continue;
+        expect(index.get(static_cast<vector_key_t>(task), reconstructed.data()));
+        expect(std::equal(reconstructed.begin(), reconstructed.end(), dataset.data() + task * dimensions));
+    }
+
+    // The layout must be preserved by serialization, and reproducible on load
+    expect(bool(index.save("tmp.usearch")));
+    index_t viewed = index_t::make(metric);
+    expect(bool(viewed.view("tmp.usearch")));
+    expect(search_all(viewed) == keys_before);
+    index_t loaded = index_t::make(metric);
+    index_dense_serialization_config_t config;
+    config.reorder = true;
+    expect(bool(loaded.load("tmp.usearch", config)));
+    expect(loaded.size() == index.size());
+    expect(search_all(loaded) == keys_before);
+
+    // Vectors owned by the user must still be referenced, rather than copied, after reordering
+    index_dense_config_t external_config;
+    external_config.exclude_vectors = true;
+    index_t external = index_t::make(metric, external_config);
+    std::vector<float> external_dataset = dataset;
+    external.reserve(collection_size);
+    for (std::size_t task = 0; task != collection_size; ++task)
+        external.add(static_cast<vector_key_t>(task), external_dataset.data() + task * dimensions, 0, false);
+    expect(bool(external.reorder()));
+    std::size_t const changed = collection_size - 1;
+    external_dataset[changed * dimensions] += 1;
+    expect(external.get(static_cast<vector_key_t>(changed), reconstructed.data()));
+    expect(reconstructed[0] == external_dataset[changed * dimensions]);
+}
+
+/**
+ * Tests storing vectors inside of the graph nodes, comparing against the default separate layout.
+ *
+ * The graph construction is deterministic for a single thread, so both layouts must produce the
+ * same results, surviving serialization, compaction, and the updates of removed entries.
+ *
+ * @param collection_size Number of vectors to be indexed and queried.
+ * @param dimensions Number of dimensions each vector should have.
+ */
+void test_colocated_vectors(std::size_t collection_size, std::size_t dimensions) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    index_dense_config_t config;
+    config.colocate_vectors = true;
+    index_t separate = index_t::make(metric);
+    index_t colocated = index_t::make(metric, config);
+    for (index_t* index : {&separate, &colocated}) {
+        index->reserve(collection_size);
+        for (std::size_t task = 0; task != collection_size; ++task)
+            index->add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions);
+        for (std::size_t task = 0; task < collection_size; task += 7)
+            index->remove(static_cast<vector_key_t>(task));
+    }
+    expect(colocated.config().colocate_vectors);
+
+    std::size_t const wanted = 10;
+    auto search_all = [&](index_t const& tested) {
+        std::vector<vector_key_t> keys(collection_size * wanted);
+        for (std::size_t i = 0; i != collection_size; ++i)
+            tested.search(dataset.data() + i * dimensions, wanted).dump_to(keys.data() + i * wanted);
+        return keys;
+    };
+    auto expect_vectors = [&](index_t const& tested) {
+        std::vector<float> reconstructed(dimensions);
+        for (std::size_t task = 0; task != collection_size; ++task) {
+            bool removed = task % 7 == 0;
+            expect(tested.contains(static_cast<vector_key_t>(task)) != removed);
+            if (removed)
+                continue;
+            expect(tested.get(static_cast<vector_key_t>(task), reconstructed.data()));
+            expect(std::equal(reconstructed.begin(), reconstructed.end(), dataset.data() + task * dimensions));
+        }
+    };
+    std::vector<vector_key_t> keys_expected = search_all(separate);
+    expect(search_all(colocated) == keys_expected);
+    expect_vectors(colocated);
+
+    // The layout flag is serialized, so a default-constructed index must pick it up
+    expect(bool(colocated.save("tmp.usearch")));
+    index_t loaded = index_t::make(metric);
+    expect(bool(loaded.load("tmp.usearch")));
+    expect(loaded.config().colocate_vectors);
+    expect(search_all(loaded) == keys_expected);
+    expect_vectors(loaded);
+    index_t viewed = index_t::make(metric);
+    expect(bool(viewed.view("tmp.usearch")));
+    expect(search_all(viewed) == keys_expected);
+    expect_vectors(viewed);
+
+    auto copy_result = colocated.copy();
+    expect(bool(copy_result));
+    expect(search_all(copy_result.index) == keys_expected);
+    expect_vectors(copy_result.index);
+
+    expect(bool(colocated.reorder()));
+    expect(search_all(colocated) == keys_expected);
+    expect_vectors(colocated);
+    expect(bool(colocated.compact()));
+    expect_vectors(colocated);
+
+    // Removed slots are reused, and their vectors must be overwritten in place
+    for (std::size_t task = 0; task < collection_size; task += 7)
+        expect(bool(loaded.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions)));
+    std::vector<float> reconstructed(dimensions);
+    for (std::size_t task = 0; task != collection_size; ++task) {
+        expect(loaded.get(static_cast<vector_key_t>(task), reconstructed.data()));
+        expect(std::equal(reconstructed.begin(), reconstructed.end(), dataset.data() + task * dimensions));
+    }
+
+    // Quantized codes are co-located instead of the full vectors
+    if (collection_size < 256)
+        return;
+    index_t quantized = index_t::make(metric, config);
+    auto quantization = quantized.quantize(dataset.data(), collection_size, dimensions / 4);
+    expect(bool(quantization));
+    quantized.reserve(collection_size);
+    for (std::size_t task = 0; task != collection_size; ++task)
+        quantized.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions);
+    expect(quantized.config().vector_bytes == quantized.bytes_per_stored_vector());
+    std::size_t self_recall = 0;
+    for (std::size_t task = 0; task != collection_size; ++task)
+        self_recall += quantized.search(dataset.data() + task * dimensions, wanted).contains(task);
+    expect(self_recall > collection_size / 2);
+    expect(bool(quantized.save("tmp.usearch")));
+    index_t quantized_loaded = index_t::make(metric);
+    expect(bool(quantized_loaded.load("tmp.usearch")));
+    std::size_t loaded_recall = 0;
+    for (std::size_t task = 0; task != collection_size; ++task)
+        loaded_recall += quantized_loaded.search(dataset.data() + task * dimensions, wanted).contains(task);
+    expect(loaded_recall == self_recall);
+}
+
+/**
+ * Tests the built-in software-pipelined prefetching, which must never affect the search results.
+ *
+ * @param collection_size Number of vectors to be indexed and queried.
+ * @param dimensions Number of dimensions each vector should have.
+ */
+void test_prefetch(std::size_t collection_size, std::size_t dimensions) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    metric_punned_t metric(dimensions, metric_kind_t::cos_k, scalar_kind_t::f32_k);
+    index_t index = index_t::make(metric);
+    expect(index.prefetch_depth() == default_prefetch_depth());
+    executor_pool_t executor;
+    index.reserve({collection_size, executor.size()});
+    executor.fixed(collection_size, [&](std::size_t thread, std::size_t task) {
+        index.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions, thread);
+    });
+
+    std::size_t const wanted = 10;
+    auto search_all = [&] {
+        std::vector<vector_key_t> keys(collection_size * wanted);
+        for (std::size_t i = 0; i != collection_size; ++i)
+            index.search(dataset.data() + i * dimensions, wanted).dump_to(keys.data() + i * wanted);
+        return keys;
+    };
+    index.change_prefetch_depth(0);
+    std::vector<vector_key_t> keys_expected = search_all();
+    for (std::size_t depth : {1, 4, 1000}) {
+        index.change_prefetch_depth(depth);
+        expect(search_all() == keys_expected);
+    }
+}
+
+/**
+ * Tests viewing the index in the disk-resident mode, that changes only the prefetching policy,
+ * so the results must match the in-memory index with both separate and co-located vectors.
+ *
+ * @param collection_size Number of vectors to be indexed and queried.
+ * @param dimensions Number of dimensions each vector should have.
+ */
+void test_disk_resident(std::size_t collection_size, std::size_t dimensions) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    for (bool colocate : {false, true}) {
+        index_dense_config_t config;
+        config.colocate_vectors = colocate;
+        index_t index = index_t::make(metric, config);
+        index.reserve(collection_size);
+        for (std::size_t task = 0; task != collection_size; ++task)
+            index.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions);
+        expect(bool(index.save("tmp.usearch")));
+
+        index_dense_serialization_config_t serialization_config;
+        serialization_config.disk_resident = true;
+        index_t viewed = index_t::make(metric);
+        expect(bool(viewed.view("tmp.usearch", 0, serialization_config)));
+        expect(viewed.size() == collection_size);
+
+        std::size_t const wanted = 10;
+        std::vector<vector_key_t> expected_keys(wanted), found_keys(wanted);
+        for (std::size_t i = 0; i != collection_size; ++i) {
+            float const* query = dataset.data() + i * dimensions;
+            std::size_t expected_count = index.search(query, wanted).dump_to(expected_keys.data());
+            std::size_t found_count = viewed.search(query, wanted).dump_to(found_keys.data());
+            expect(found_count == expected_count);
+            expect(std::equal(found_keys.begin(), found_keys.begin() + found_count, expected_keys.begin()));
+        }
+    }
+}
+
+/**
+ * Tests the optimistic insertion mode and the sharded keys lookup under concurrent construction.
+ *
+ * Single-threaded optimistic updates never conflict, so they must reproduce the default graph,
+ * while the concurrent ones must keep every entry reachable by its key.
+ *
+ * @param collection_size Number of vectors to be indexed and queried.
+ * @param dimensions Number of dimensions each vector should have.
+ */
+void test_optimistic_insertion(std::size_t collection_size, std::size_t dimensions) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    index_dense_config_t config;
+    config.optimistic_insertion = true;
+    index_t pessimistic = index_t::make(metric);
+    index_t optimistic = index_t::make(metric, config);
+    for (index_t* index : {&pessimistic, &optimistic}) {
+        index->reserve(collection_size);
+        for (std::size_t task = 0; task != collection_size; ++task)
+            index->add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions);
+    }
+
+    std::size_t const wanted = 10;
+    std::vector<vector_key_t> expected_keys(wanted), found_keys(wanted);
+    for (std::size_t i = 0; i != collection_size; ++i) {
+        float const* query = dataset.data() + i * dimensions;
+        std::size_t expected_count = pessimistic.search(query, wanted).dump_to(expected_keys.data());
+        std::size_t found_count = optimistic.search(query, wanted).dump_to(found_keys.data());
+        expect(found_count == expected_count);
+        expect(std::equal(found_keys.begin(), found_keys.begin() + found_count, expected_keys.begin()));
+    }
+
+    // Concurrent construction, touching many shards of the keys lookup at once
+    index_t concurrent = index_t::make(metric, config);
+    executor_pool_t executor;
+    concurrent.reserve({collection_size, executor.size()});
+    executor.fixed(collection_size, [&](std::size_t thread, std::size_t task) {
+        concurrent.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions, thread);
+    });
+    expect(concurrent.size() == collection_size);
+
+    std::vector<float> reconstructed(dimensions);
+    std::size_t self_recall = 0;
+    for (std::size_t task = 0; task != collection_size; ++task) {
+        vector_key_t key = static_cast<vector_key_t>(task);
+        expect(concurrent.contains(key));
+        expect(concurrent.count(key) == 1);
+        expect(concurrent.get(key, reconstructed.data()));
+        expect(std::equal(reconstructed.begin(), reconstructed.end(), dataset.data() + task * dimensions));
+        self_recall += concurrent.search(dataset.data() + task * dimensions, wanted).contains(key);
+    }
+    expect(self_recall * 10 >= collection_size * 9);
+
+    // Operations spanning multiple shards
+    std::vector<vector_key_t> exported(collection_size);
+    concurrent.export_keys(exported.data(), 0, collection_size);
+    std::sort(exported.begin(), exported.end());
+    for (std::size_t task = 0; task != collection_size; ++task)
+        expect(exported[task] == static_cast<vector_key_t>(task));
+    if (collection_size < 2)
+        return;
+    vector_key_t renamed = static_cast<vector_key_t>(collection_size);
+    expect(concurrent.rename(0, renamed).completed == 1);
+    expect(!concurrent.contains(0) && concurrent.contains(renamed));
+    expect(concurrent.distance_between(renamed, 1).count == 1);
+    vector_key_t removed[2] = {renamed, 1};
+    expect(concurrent.remove(removed, removed + 2).completed == 2);
+    expect(!concurrent.contains(renamed) && !concurrent.contains(1));
+
+    // The moved-from index keeps an empty, but usable, keys lookup
+    index_t moved = std::move(concurrent);
+    expect(moved.contains(2));
+    expect(!concurrent.contains(2) && concurrent.count(2) == 0);
+    concurrent.export_keys(exported.data(), 0, collection_size);
+}
+
+/**
+ * Tests the sharded container against a single index over the same dataset.
+ *
+ * Checks that every key lands in exactly one shard, that the merged exact results match
+ * the single index, and that shards can be saved, reloaded, and compacted one at a time.
+ *
+ * @param collection_size Number of vectors to be indexed and queried.
+ * @param dimensions Number of dimensions each vector should have.
+ */
+void test_sharded(std::size_t collection_size, std::size_t dimensions) {
+    using index_t = index_dense_sharded_t;
+    using vector_key_t = typename index_t::vector_key_t;
+    using distance_t = typename index_t::distance_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    std::size_t const shards_count = 4;
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    index_t sharded = index_t::make(metric, shards_count);
+    index_dense_t single = index_dense_t::make(metric);
+    expect(sharded && sharded.shards_count() == shards_count);
+
+    executor_default_t executor;
+    expect(sharded.reserve({collection_size, executor.size()}));
+    single.reserve(collection_size);
+    executor.fixed(collection_size, [&](std::size_t thread, std::size_t task) {
+        sharded.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions, thread);
+    });
+    for (std::size_t task = 0; task != collection_size; ++task)
+        single.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions);
+    expect(sharded.size() == collection_size);
+
+    std::size_t shards_total = 0;
+    for (std::size_t shard_idx = 0; shard_idx != shards_count; ++shard_idx)
+        shards_total += sharded.shard(shard_idx).size();
+    expect(shards_total == collection_size);
+    for (std::size_t task = 0; task != collection_size; ++task) {
+        vector_key_t key = static_cast<vector_key_t>(task);
+        expect(sharded.contains(key) && sharded.count(key) == 1);
+        expect(sharded.shard(sharded.shard_of(key)).contains(key));
+    }
+
+    // Small collections are searched exhaustively, so the merged results must match the single index
+    std::size_t const wanted = 10;
+    std::vector<vector_key_t> expected_keys(wanted), found_keys(wanted);
+    std::vector<distance_t> expected_distances(wanted), found_distances(wanted);
+    std::size_t self_recall = 0;
+    for (std::size_t task = 0; task != collection_size; ++task) {
+        float const* query = dataset.data() + task * dimensions;
+        typename index_t::search_result_t merged = sharded.search(query, wanted, executor);
+        expect(bool(merged));
+        expect(merged.size() == (std::min)(wanted, collection_size));
+        self_recall += merged.contains(static_cast<vector_key_t>(task));
+        std::size_t found_count = merged.dump_to(found_keys.data(), found_distances.data());
+        expect(std::is_sorted(found_distances.begin(), found_distances.begin() + found_count));
+        if (collection_size > wanted * shards_count)
+            continue;
+        std::size_t expected_count =
+            single.search(query, wanted).dump_to(expected_keys.data(), expected_distances.data());
+        expect(found_count == expected_count);
+        expect(std::equal(found_distances.begin(), found_distances.begin() + found_count, expected_distances.begin()));
+    }
+    expect(self_recall * 10 >= collection_size * 9);
+
+    // Replace an entry in place, keeping a single entry under its key
+    if (collection_size > 1) {
+        std::vector<float> reconstructed(dimensions);
+        expect(bool(sharded.update(0, dataset.data() + dimensions)));
+        expect(sharded.count(0) == 1 && sharded.size() == collection_size);
+        expect(sharded.get(0, reconstructed.data()) == 1);
+        expect(std::equal(reconstructed.begin(), reconstructed.end(), dataset.data() + dimensions));
+        expect(bool(sharded.update(0, dataset.data())));
+    }
+
+    // Remove a few entries, save and reload a single shard, then compact it alone
+    for (std::size_t task = 0; task < collection_size; task += 3)
+        expect(sharded.remove(static_cast<vector_key_t>(task)).completed == 1);
+    std::size_t remaining = sharded.size();
+    expect(bool(sharded.save_shard(0, "tmp.usearch")));
+    expect(bool(sharded.load_shard(0, "tmp.usearch")));
+    expect(sharded.size() == remaining);
+    expect(bool(sharded.shard(0).compact()));
+    expect(bool(sharded.save_shard(1, "tmp.usearch")));
+    expect(bool(sharded.view_shard(1, "tmp.usearch")));
+    expect(sharded.size() == remaining);
+    for (std::size_t task = 0; task != collection_size; ++task) {
+        vector_key_t key = static_cast<vector_key_t>(task);
+        if (sharded.shard_of(key) == 0)
+            expect(sharded.contains(key) == (task % 3 != 0));
+    }
+}
+
+/**
+ * Tests the compile-time specialized dense index against the type-punned one.
+ *
+ * Both use the same kernel, so they must build identical graphs and produce identical results,
+ * and the files written by one must be readable by the other.
+ *
+ * @param collection_size Number of vectors to be indexed and queried.
+ */
+void test_typed_index(std::size_t collection_size) {
+    constexpr std::size_t dimensions = 16;
+    using typed_t = index_dense_typed_gt<f32_t, metric_l2sq_gt<f32_t>, dimensions>;
+    using vector_key_t = typename typed_t::vector_key_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    typed_t typed = typed_t::make();
+    index_dense_t punned = index_dense_t::make(metric_punned_t(dimensions, metric_kind_t::l2sq_k));
+    expect(bool(typed) && bool(punned));
+    typed.reserve(collection_size);
+    punned.reserve(collection_size);
+    for (std::size_t task = 0; task != collection_size; ++task) {
+        expect(bool(typed.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions)));
+        expect(bool(punned.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions)));
+    }
+    expect(typed.size() == collection_size);
+
+    std::size_t const wanted = 10;
+    std::vector<vector_key_t> expected_keys(wanted), found_keys(wanted);
+    auto expect_same_results = [&](index_dense_t const& expected_index) {
+        for (std::size_t task = 0; task != collection_size; ++task) {
+            float const* query = dataset.data() + task * dimensions;
+            std::size_t expected_count = expected_index.search(query, wanted).dump_to(expected_keys.data());
+            std::size_t found_count = typed.search(query, wanted).dump_to(found_keys.data());
+            expect(found_count == expected_count);
+            expect(std::equal(found_keys.begin(), found_keys.begin() + found_count, expected_keys.begin()));
+        }
+    };
+    expect_same_results(punned);
+
+    // Files are interchangeable in both directions
+    expect(bool(typed.save("tmp.usearch")));
+    index_dense_t reloaded = index_dense_t::make("tmp.usearch");
+    expect(reloaded.size() == collection_size);
+    expect_same_results(reloaded);
+    expect(bool(punned.save("tmp.usearch")));
+    expect(bool(typed.load("tmp.usearch")));
+    expect_same_results(punned);
+
+    // Incompatible specializations must refuse the file
+    using other_t = index_dense_typed_gt<f32_t, metric_l2sq_gt<f32_t>, dimensions * 2>;
+    other_t other = other_t::make();
+    serialization_result_t mismatch = other.load("tmp.usearch");
+    expect(!mismatch);
+    expect(other.size() == 0);
+    mismatch.error.release();
+}
+
+/**
+ * Tests multi-threaded serialization with positional file I/O against the sequential streams.
+ *
+ * Both paths must produce byte-identical files, and an index loaded from multiple threads
+ * must keep its keys, free slots, and search results, with separate and co-located vectors.
+ *
+ * @param collection_size Number of vectors to be indexed.
+ * @param dimensions Number of dimensions per vector.
+ */
+void test_parallel_serialization(std::size_t collection_size, std::size_t dimensions) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    auto read_file = [](char const* path) {
+        std::ifstream stream(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    };
+
+    executor_default_t executor;
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    for (bool colocate : {false, true}) {
+        index_dense_config_t config;
+        config.colocate_vectors = colocate;
+        index_t index = index_t::make(metric, config);
+        index.reserve(collection_size);
+        for (std::size_t task = 0; task != collection_size; ++task)
+            index.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions);
+        for (std::size_t task = 0; task < collection_size; task += 7)
+            index.remove(static_cast<vector_key_t>(task));
+
+        expect(bool(index.save("tmp.usearch")));
+        expect(bool(index.save("tmp-parallel.usearch", {}, dummy_progress_t{}, executor)));
+        std::string sequential_bytes = read_file("tmp.usearch");
+        expect(sequential_bytes.size() == index.serialized_length());
+        expect(sequential_bytes == read_file("tmp-parallel.usearch"));
+
+        index_t loaded = index_t::make(metric, config);
+        expect(bool(loaded.load("tmp-parallel.usearch", {}, dummy_progress_t{}, executor)));
+        expect(loaded.size() == index.size());
+        std::vector<float> reconstructed(dimensions);
+        std::vector<vector_key_t> expected_keys(10), found_keys(10);
+        for (std::size_t task = 0; task != collection_size; ++task) {
+            vector_key_t key = static_cast<vector_key_t>(task);
+            expect(loaded.contains(key) == index.contains(key));
+            if (!index.contains(key))
+                continue;
+            expect(loaded.get(key, reconstructed.data()) == 1);
+            expect(std::equal(reconstructed.begin(), reconstructed.end(), dataset.data() + task * dimensions));
+            std::size_t expected_count = index.search(reconstructed.data(), 10).dump_to(expected_keys.data());
+            std::size_t found_count = loaded.search(reconstructed.data(), 10).dump_to(found_keys.data());
+            expect(found_count == expected_count);
+            expect(std::equal(found_keys.begin(), found_keys.begin() + found_count, expected_keys.begin()));
+        }
+
+        // Removed slots must be reused after the reload
+        if (collection_size) {
+            std::size_t const capacity = loaded.capacity();
+            expect(bool(loaded.add(static_cast<vector_key_t>(collection_size), dataset.data())));
+            expect(loaded.capacity() == capacity);
+        }
+    }
+    std::remove("tmp-parallel.usearch");
+}
+
+/**
+ * Tests the snapshot and write-ahead log persistence of `index_dense_journaled_gt`.
+ *
+ * Reopening must reproduce the same contents, whether they come from the log alone, from a compacted
+ * snapshot with a fresh log, from a log with a torn tail, or from a stale log replayed over a newer snapshot,
+ * even if the latter renames a key and reuses the old one.
+ *
+ * @param collection_size Number of vectors to be indexed.
+ * @param dimensions Number of dimensions per vector.
+ */
+void test_journaled_index(std::size_t collection_size, std::size_t dimensions) {
+    using index_t = index_dense_journaled_t;
+    using vector_key_t = typename index_t::vector_key_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    char const* snapshot_path = "tmp.usearch";
+    char const* log_path = "tmp.usearch.log";
+    std::remove(snapshot_path);
+    std::remove(log_path);
+    auto read_file = [](char const* path) {
+        std::ifstream stream(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    };
+    auto write_file = [](char const* path, std::string const& content) {
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        stream.write(content.data(), static_cast<std::streamsize>(content.size()));
+    };
+
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    index_t index = index_t::make(metric);
+    expect(bool(index));
+    expect(bool(index.open(snapshot_path, log_path)));
+    index.reserve(collection_size * 2);
+    for (std::size_t task = 0; task != collection_size; ++task)
+        expect(bool(index.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions)));
+    for (std::size_t task = 0; task < collection_size; task += 5)
+        expect(bool(index.remove(static_cast<vector_key_t>(task))));
+    for (std::size_t task = 1; task < collection_size; task += 5)
+        expect(bool(index.rename(static_cast<vector_key_t>(task), static_cast<vector_key_t>(task + collection_size))));
+    expect(bool(index.checkpoint()));
+
+    std::vector<float> expected(dimensions), found(dimensions);
+    auto expect_same_contents = [&](index_t const& other) {
+        expect(other.size() == index.size());
+        for (std::size_t task = 0; task != collection_size * 2; ++task) {
+            vector_key_t key = static_cast<vector_key_t>(task);
+            expect(other.contains(key) == index.contains(key));
+            if (!index.contains(key))
+                continue;
+            expect(other.get(key, found.data()) == 1 && index.get(key, expected.data()) == 1);
+            expect(found == expected);
+        }
+    };
+    auto reopen = [&]() {
+        index_t other = index_t::make(metric);
+        expect(bool(other.open(snapshot_path, log_path)));
+        expect_same_contents(other);
+        return other;
+    };
+
+    // Without a snapshot everything comes from the log
+    reopen();
+
+    // Compact, leaving a small log on top of the snapshot
+    std::string stale_log = read_file(log_path);
+    expect(bool(index.compact()));
+    expect(index.log_bytes() == 0);
+    for (std::size_t task = 2; task < collection_size; task += 5)
+        expect(bool(index.remove(static_cast<vector_key_t>(task))));
+    expect(bool(index.checkpoint()));
+    expect(collection_size < 3 || index.log_bytes() != 0);
+    reopen();
+
+    // Half-written trailing record is dropped, and the log is immediately compacted
+    std::string current_log = read_file(log_path);
+    write_file(log_path, current_log + current_log.substr(index_t::log_head_bytes(), 10));
+    index_t recovered = reopen();
+    expect(recovered.log_bytes() == 0);
+
+    // Crash between replacing the snapshot and truncating the log replays idempotently
+    write_file(log_path, stale_log + current_log.substr(index_t::log_head_bytes()));
+    reopen();
+
+    recovered = index_t{};
+    std::remove(snapshot_path);
+    std::remove(log_path);
+    if (collection_size < 2)
+        return;
+
+    // Renaming a key and reusing the old one, replayed over a snapshot that already reflects both
+    index = index_t::make(metric);
+    expect(bool(index.open(snapshot_path, log_path)));
+    index.reserve(collection_size);
+    float const* vector_a = dataset.data();
+    float const* vector_b = dataset.data() + dimensions;
+    expect(bool(index.add(1, vector_a)));
+    expect(bool(index.compact()));
+    expect(bool(index.rename(1, 2)));
+    expect(bool(index.add(1, vector_b)));
+    expect(bool(index.checkpoint()));
+    std::string renaming_log = read_file(log_path);
+    expect(bool(index.compact()));
+    write_file(log_path, renaming_log);
+    {
+        index_t other = index_t::make(metric);
+        expect(bool(other.open(snapshot_path, log_path)));
+        expect(other.size() == 2);
+        expect(other.get(2, found.data()) == 1 && std::equal(found.begin(), found.end(), vector_a));
+        expect(other.get(1, found.data()) == 1 && std::equal(found.begin(), found.end(), vector_b));
+    }
+    index = index_t{};
+    std::remove(snapshot_path);
+    std::remove(log_path);
+}
+
+/**
+ * Tests point-in-time snapshots of dense indexes.
+ *
+ * A snapshot must serialize the very same bytes, that a regular save would have produced at the moment it
+ * was taken, even if members get added, removed, renamed, or written into reused slots meanwhile,
+ * sequentially or from a concurrent thread.
+ *
+ * @param collection_size Number of vectors to be indexed.
+ * @param dimensions Number of dimensions per vector.
+ * @param colocate_vectors Whether the vectors are stored next to the graph nodes.
+ */
+void test_snapshots(std::size_t collection_size, std::size_t dimensions, bool colocate_vectors) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * 3 * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    index_dense_config_t config;
+    config.colocate_vectors = colocate_vectors;
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    index_t index = index_t::make(metric, config);
+    expect(bool(index));
+    expect(index.reserve(index_limits_t(collection_size * 3, 2)));
+    for (std::size_t task = 0; task != collection_size; ++task)
+        expect(bool(index.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions)));
+    for (std::size_t task = 0; task < collection_size; task += 3)
+        expect(bool(index.remove(static_cast<vector_key_t>(task))));
+
+    std::string reference, saved;
+    expect(bool(index.save_to_stream([&](void const* buffer, std::size_t length) {
+        reference.append(static_cast<char const*>(buffer), length);
+        return true;
+    })));
+    auto save_snapshot = [&](index_t::snapshot_t const& snapshot) {
+        saved.clear();
+        expect(bool(snapshot.save_to_stream([&](void const* buffer, std::size_t length) {
+            saved.append(static_cast<char const*>(buffer), length);
+            return true;
+        })));
+    };
+
+    // Mutate sequentially, reusing the removed slots first
+    {
+        index_t::snapshot_t snapshot = index.snapshot();
+        expect(bool(snapshot));
+        expect(!index.snapshot());
+        expect(snapshot.slots() == collection_size);
+        for (std::size_t task = collection_size; task != collection_size * 2; ++task)
+            expect(bool(index.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions)));
+        for (std::size_t task = 1; task < collection_size; task += 3)
+            expect(bool(index.remove(static_cast<vector_key_t>(task))));
+        for (std::size_t task = 2; task < collection_size; task += 3)
+            expect(bool(index.rename(static_cast<vector_key_t>(task), //
+                                     static_cast<vector_key_t>(task + collection_size * 3))));
+        save_snapshot(snapshot);
+        expect(saved == reference);
+    }
+
+    // Mutate from another thread, while the snapshot is being saved
+    reference.clear();
+    expect(bool(index.save_to_stream([&](void const* buffer, std::size_t length) {
+        reference.append(static_cast<char const*>(buffer), length);
+        return true;
+    })));
+    {
+        index_t::snapshot_t snapshot = index.snapshot();
+        expect(bool(snapshot));
+        std::thread writer([&] {
+            for (std::size_t task = collection_size * 2; task != collection_size * 3; ++task) {
+                vector_key_t key = static_cast<vector_key_t>(task);
+                expect(bool(index.add(key, dataset.data() + task * dimensions, 1)));
+                if (task % 2)
+                    expect(bool(index.remove(key - 1)));
+            }
+        });
+        save_snapshot(snapshot);
+        writer.join();
+        expect(saved == reference);
+    }
+
+    // The snapshot must be loadable like any other file, holding the state after the sequential changes
+    std::size_t offset = 0;
+    index_t loaded = index_t::make(metric, config);
+    expect(bool(loaded.load_from_stream([&](void* buffer, std::size_t length) {
+        if (offset + length > saved.size())
+            return false;
+        std::memcpy(buffer, saved.data() + offset, length);
+        offset += length;
+        return true;
+    })));
+    expect(offset == saved.size());
+    std::vector<float> found(dimensions);
+    auto expect_vector = [&](std::size_t key, std::size_t task) {
+        expect(loaded.get(static_cast<vector_key_t>(key), found.data()) == 1);
+        expect(std::equal(found.begin(), found.end(), dataset.data() + task * dimensions));
+    };
+    for (std::size_t task = 0; task != collection_size; ++task) {
+        expect(!loaded.contains(static_cast<vector_key_t>(task)));
+        if (task % 3 == 2)
+            expect_vector(task + collection_size * 3, task);
+    }
+    for (std::size_t task = collection_size; task != collection_size * 2; ++task)
+        expect_vector(task, task);
+    expect(!loaded.contains(static_cast<vector_key_t>(collection_size * 2)));
+}
+
+/**
+ * Tests the in-place repair of the graph on removals.
+ *
+ * With `repair_on_remove`, fewer links must lead to the removed entries, than with plain tombstones,
+ * and a full `consolidate` pass, running next to concurrent insertions, must leave none of them,
+ * while every remaining entry stays reachable by its own vector.
+ *
+ * @param collection_size Number of vectors to be indexed.
+ * @param dimensions Number of dimensions per vector.
+ */
+void test_removal_repair(std::size_t collection_size, std::size_t dimensions) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * 2 * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    auto build = [&](bool repair_on_remove) {
+        index_dense_config_t config;
+        config.repair_on_remove = repair_on_remove;
+        index_t index = index_t::make(metric, config);
+        expect(index.reserve(index_limits_t(collection_size * 2, 2)));
+        for (std::size_t task = 0; task != collection_size; ++task)
+            expect(bool(index.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions)));
+        for (std::size_t task = 0; task < collection_size; task += 3)
+            expect(bool(index.remove(static_cast<vector_key_t>(task))));
+        return index;
+    };
+    auto dead_links = [](index_t const& index) {
+        index_t::copy_result_t copy = index.copy();
+        expect(bool(copy));
+        return copy.index.isolate().pruned_edges;
+    };
+
+    index_t tombstoned = build(false);
+    index_t repaired = build(true);
+    expect(dead_links(repaired) <= dead_links(tombstoned));
+    expect(collection_size < 1000 || dead_links(repaired) < dead_links(tombstoned));
+
+    // Consolidate in small steps, while another thread keeps inserting
+    std::thread writer([&] {
+        for (std::size_t task = collection_size; task != collection_size * 2; ++task)
+            expect(bool(repaired.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions)));
+    });
+    for (std::size_t step = 0; step != 8; ++step)
+        expect(bool(repaired.consolidate(collection_size / 4 + 1)));
+    writer.join();
+    for (std::size_t passes = 0; passes != 8 && repaired.consolidate(collection_size * 2).pruned_edges; ++passes)
+        continue;
+    expect(repaired.consolidate(collection_size * 2).pruned_edges == 0);
+    expect(dead_links(repaired) == 0);
+
+    // Every remaining entry must still be found by its own vector
+    std::size_t found_count = 0, expected_count = 0;
+    for (std::size_t task = 0; task != collection_size * 2; ++task) {
+        if (!repaired.contains(static_cast<vector_key_t>(task)))
+            continue;
+        ++expected_count;
+        index_t::search_result_t result = repaired.search(dataset.data() + task * dimensions, 1);
+        expect(bool(result));
+        found_count += result.size() && result[0].member.key == static_cast<vector_key_t>(task);
+    }
+    expect(found_count * 100 >= expected_count * 95);
+}
+
+/**
+ * Tests the concurrent reuse of the removed entries' nodes.
+ *
+ * Every insertion after a removal updates a node still reachable through its old links,
+ * so the concurrent updates must not wait for each other's nodes, and must keep the entries findable.
+ *
+ * @param collection_size Number of vectors to be indexed.
+ * @param dimensions Number of dimensions per vector.
+ * @param threads_count Number of threads updating the nodes at once.
+ */
+void test_concurrent_reuse(std::size_t collection_size, std::size_t dimensions, std::size_t threads_count) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    index_t index = index_t::make(metric);
+    expect(index.reserve(index_limits_t(collection_size, threads_count)));
+    executor_default_t executor(threads_count);
+    auto add_every_other = [&](std::size_t first) {
+        std::atomic<std::size_t> failures{0};
+        executor.dynamic(collection_size / 2, [&](std::size_t thread, std::size_t task) {
+            std::size_t row = task * 2 + first;
+            failures += !index.add(static_cast<vector_key_t>(row), dataset.data() + row * dimensions, thread);
+            return true;
+        });
+        expect(failures.load() == 0);
+    };
+    add_every_other(0);
+    add_every_other(1);
+
+    for (std::size_t round = 0; round != 4; ++round) {
+        for (std::size_t row = round % 2; row < collection_size; row += 2)
+            expect(bool(index.remove(static_cast<vector_key_t>(row))));
+        add_every_other(round % 2);
+        expect(index.size() == collection_size / 2 * 2);
+    }
+
+    std::size_t found_count = 0;
+    for (std::size_t row = 0; row != collection_size / 2 * 2; ++row) {
+        index_t::search_result_t result = index.search(dataset.data() + row * dimensions, 1);
+        expect(bool(result));
+        found_count += result.size() && result[0].member.key == static_cast<vector_key_t>(row);
+    }
+    expect(found_count * 100 >= collection_size / 2 * 2 * 95);
+}
+
+/**
+ * Tests reserving less than the slots in use, as the removed entries keep theirs.
+ *
+ * Reserving for the entries left after removals, plus a few new ones, must neither drop the nodes
+ * and vectors past that count, nor stop the following insertions from reusing the removed slots.
+ *
+ * @param dimensions Number of dimensions per vector.
+ */
+void test_reserve_after_removals(std::size_t dimensions) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+
+    std::size_t const collection_size = 100;
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::size_t const added_size = collection_size / 2;
+    std::vector<float> dataset((collection_size + added_size) * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    index_t index = index_t::make(metric);
+    expect(index.reserve(collection_size));
+    for (std::size_t row = 0; row != collection_size; ++row)
+        expect(bool(index.add(static_cast<vector_key_t>(row), dataset.data() + row * dimensions)));
+    for (std::size_t row = 0; row != collection_size * 3 / 4; ++row)
+        expect(bool(index.remove(static_cast<vector_key_t>(row))));
+
+    // Ask for fewer slots than there are, growing the thread contexts to force a reallocation
+    expect(index.reserve(index_limits_t(index.size() + 1, 4)));
+    expect(index.capacity() >= collection_size);
+    for (std::size_t row = collection_size; row != collection_size + added_size; ++row)
+        expect(bool(index.add(static_cast<vector_key_t>(row), dataset.data() + row * dimensions)));
+
+    std::vector<float> vector(dimensions);
+    for (std::size_t row = collection_size * 3 / 4; row != collection_size + added_size; ++row) {
+        expect(index.get(static_cast<vector_key_t>(row), vector.data()) == 1);
+        expect(std::equal(vector.begin(), vector.end(), dataset.data() + row * dimensions));
+        index_t::search_result_t result = index.search(dataset.data() + row * dimensions, 1);
+        expect(bool(result) && result.size() == 1);
+        expect(result[0].member.key == static_cast<vector_key_t>(row));
+    }
+}
+
+/**
+ * Tests the filter-aware search over a precomputed set of slots.
+ *
+ * Covers both the exhaustive scan of tiny allowed sets and the graph traversal of larger ones,
+ * checking that only the allowed entries are returned, that the results are complete,
+ * and that the recall is close to the exact search over the allowed set.
+ *
+ * @param collection_size Number of vectors to be indexed.
+ * @param dimensions Number of dimensions per vector.
+ */
+void test_filtered_search(std::size_t collection_size, std::size_t dimensions) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+    using distance_t = typename index_t::distance_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    index_t index = index_t::make(metric);
+    expect(index.reserve(index_limits_t(collection_size, 1)));
+    for (std::size_t task = 0; task != collection_size; ++task)
+        expect(bool(index.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions)));
+
+    std::size_t const wanted = 10;
+    for (std::size_t period : {100, 5}) {
+        std::vector<vector_key_t> allowed_keys;
+        for (std::size_t task = 1; task < collection_size; task += period)
+            allowed_keys.push_back(static_cast<vector_key_t>(task));
+        index_t::filter_t filter = index.make_filter(allowed_keys.begin(), allowed_keys.end());
+        expect(bool(filter));
+        expect(filter.count == allowed_keys.size());
+
+        std::size_t found_count = 0, expected_count = 0;
+        for (std::size_t query = 0; query < collection_size; query += 7) {
+            float const* query_vector = dataset.data() + query * dimensions;
+            std::vector<std::pair<distance_t, vector_key_t>> exact;
+            for (vector_key_t key : allowed_keys)
+                exact.emplace_back(metric(reinterpret_cast<byte_t const*>(query_vector),
+                                          reinterpret_cast<byte_t const*>(dataset.data() + key * dimensions)),
+                                   key);
+            std::sort(exact.begin(), exact.end());
+            std::size_t const expected = (std::min)(wanted, exact.size());
+
+            index_t::search_result_t result = index.search(query_vector, wanted, filter);
+            expect(bool(result));
+            expect(result.size() == expected);
+            for (std::size_t i = 0; i != result.size(); ++i) {
+                vector_key_t key = result[i].member.key;
+                expect(key % period == 1 % period);
+                for (std::size_t j = 0; j != expected; ++j)
+                    found_count += exact[j].second == key;
+            }
+            expected_count += expected;
+        }
+        expect(found_count * 10 >= expected_count * 9);
+    }
+
+    // Removed entries must not be returned, even if the filter predates the removal
+    if (collection_size < 2)
+        return;
+    std::vector<vector_key_t> allowed_keys = {0, 1};
+    index_t::filter_t filter = index.make_filter(allowed_keys.begin(), allowed_keys.end());
+    expect(bool(index.remove(static_cast<vector_key_t>(0))));
+    index_t::search_result_t result = index.search(dataset.data(), wanted, filter);
+    expect(bool(result));
+    expect(result.size() == 1 && result[0].member.key == 1);
+
+    // Nor the entries of other keys, reusing the slots of the removed ones
+    expect(bool(index.add(static_cast<vector_key_t>(collection_size), dataset.data())));
+    result = index.search(dataset.data(), wanted, filter);
+    expect(bool(result));
+    expect(result.size() == 1 && result[0].member.key == 1);
+}
+
+/**
+ * Tests the range search, streaming all the entries within a radius from the query.
+ *
+ * Compares the reported entries against the exhaustive scan, checking that none of them is out of range
+ * or reported twice, that the limit on their number is respected, and that removed entries are skipped.
+ *
+ * @param collection_size Number of vectors to be indexed.
+ * @param dimensions Number of dimensions per vector.
+ */
+void test_range_search(std::size_t collection_size, std::size_t dimensions) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+    using distance_t = typename index_t::distance_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    index_t index = index_t::make(metric);
+    expect(index.reserve(index_limits_t(collection_size, 1)));
+    for (std::size_t task = 0; task != collection_size; ++task)
+        expect(bool(index.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions)));
+    for (std::size_t task = 3; task < collection_size; task += 10)
+        expect(bool(index.remove(static_cast<vector_key_t>(task))));
+
+    std::size_t found_count = 0, expected_count = 0;
+    for (std::size_t query = 0; query < collection_size; query += 7) {
+        float const* query_vector = dataset.data() + query * dimensions;
+        std::vector<distance_t> exact_distances;
+        for (std::size_t task = 0; task != collection_size; ++task)
+            if (task % 10 != 3 || task < 3)
+                exact_distances.push_back(metric(reinterpret_cast<byte_t const*>(query_vector),
+                                                 reinterpret_cast<byte_t const*>(dataset.data() + task * dimensions)));
+        std::sort(exact_distances.begin(), exact_distances.end());
+        distance_t radius = exact_distances[(std::min)(exact_distances.size(), std::size_t(20)) - 1];
+        std::size_t const expected = std::upper_bound(exact_distances.begin(), exact_distances.end(), radius) -
+                                     exact_distances.begin();
+
+        for (bool exact : {false, true}) {
+            std::vector<vector_key_t> keys;
+            auto callback = [&](vector_key_t key, distance_t distance) {
+                expect(distance <= radius);
+                expect(key % 10 != 3 || key < 3);
+                keys.push_back(key);
+            };
+            index_t::range_search_result_t result =
+                index.range_search(query_vector, radius, callback, collection_size, index.any_thread(), exact);
+            expect(bool(result));
+            expect(result.count == keys.size());
+            std::sort(keys.begin(), keys.end());
+            expect(std::unique(keys.begin(), keys.end()) == keys.end());
+            if (exact)
+                expect(keys.size() == expected);
+            else
+                found_count += keys.size(), expected_count += expected;
+        }
+
+        // Stop early once enough entries are found
+        std::size_t limited_count = 0;
+        index_t::range_search_result_t limited = index.range_search(
+            query_vector, radius, [&](vector_key_t, distance_t) { ++limited_count; }, 2);
+        expect(bool(limited));
+        expect(limited_count == (std::min)(expected, std::size_t(2)) && limited.count == limited_count);
+    }
+    expect(found_count * 100 >= expected_count * 95);
+}
+
+/**
+ * Tests the search instrumentation, which must account for every query when compiled in,
+ * and stay zeroed when compiled out with the default `USEARCH_USE_INSTRUMENTATION=0`.
+ *
+ * @param collection_size Number of vectors to be indexed.
+ * @param dimensions Number of dimensions per vector.
+ */
+void test_instrumentation(std::size_t collection_size, std::size_t dimensions) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    index_t index = index_t::make(metric);
+    expect(index.reserve(index_limits_t(collection_size, 1)));
+    for (std::size_t task = 0; task != collection_size; ++task)
+        expect(bool(index.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions)));
+
+    index.reset_instrumentation();
+    for (std::size_t task = 0; task != collection_size; ++task)
+        expect(bool(index.search(dataset.data() + task * dimensions, 10)));
+
+    index_instrumentation_t instrumentation = index.instrumentation();
+    expect(instrumentation.enabled == bool(USEARCH_USE_INSTRUMENTATION));
+    if (instrumentation.enabled) {
+        expect(instrumentation.latency_nanoseconds.total() == collection_size);
+        expect(instrumentation.hops.total() == collection_size);
+        expect(instrumentation.computed_distances.total() == collection_size);
+        expect(instrumentation.hops_per_level[0] >= collection_size);
+        expect(instrumentation.latency_nanoseconds.percentile(0.5) <=
+               instrumentation.latency_nanoseconds.percentile(0.99));
+        if (collection_size > 1)
+            expect(instrumentation.missed_candidates > 0);
+
+        // Batched, filtered, and range searches are accounted for too
+        std::vector<vector_key_t> keys(collection_size * 10);
+        std::vector<distance_punned_t> distances(collection_size * 10);
+        std::vector<std::size_t> counts(collection_size);
+        expect(bool(index.search_batch(dataset.data(), collection_size, 10, keys.data(), distances.data(),
+                                       counts.data())));
+        std::vector<vector_key_t> allowed_keys = {0};
+        index_t::filter_t filter = index.make_filter(allowed_keys.begin(), allowed_keys.end());
+        expect(bool(index.search(dataset.data(), 10, filter)));
+        expect(bool(index.range_search(dataset.data(), 1.f, [](vector_key_t, distance_punned_t) {})));
+        instrumentation = index.instrumentation();
+        expect(instrumentation.latency_nanoseconds.total() == collection_size * 2 + 2);
+        expect(instrumentation.hops.total() == collection_size * 2 + 2);
+
+        index.reset_instrumentation();
+        instrumentation = index.instrumentation();
+    }
+    expect(instrumentation.latency_nanoseconds.total() == 0);
+    expect(instrumentation.hops_per_level[0] == 0);
+    expect(instrumentation.missed_candidates == 0 && instrumentation.distance_nanoseconds == 0);
+}
+
+/**
+ * Tests the bulk construction of a static collection against the incremental one.
+ *
+ * Checks that every key and vector is retrievable, that the graph is as searchable as the incremental
+ * one, that a non-empty index or duplicate keys are rejected, and that quantized indexes fall back
+ * to the incremental construction.
+ *
+ * @param collection_size Number of vectors to be indexed.
+ * @param dimensions Number of dimensions per vector.
+ */
+void test_bulk_build(std::size_t collection_size, std::size_t dimensions) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+    std::vector<vector_key_t> keys(collection_size);
+    for (std::size_t task = 0; task != collection_size; ++task)
+        keys[task] = static_cast<vector_key_t>(task * 3 + 1);
+
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    executor_default_t executor;
+    index_t incremental = index_t::make(metric);
+    expect(incremental.reserve({collection_size, executor.size()}));
+    executor.fixed(collection_size, [&](std::size_t thread, std::size_t task) {
+        incremental.add(keys[task], dataset.data() + task * dimensions, thread);
+    });
+
+    // Let the bulk construction reserve the memory on its own
+    index_t bulk = index_t::make(metric);
+    auto built = bulk.build(keys.data(), dataset.data(), collection_size, executor);
+    expect(bool(built));
+    expect(built.new_size == collection_size);
+    expect(bulk.size() == collection_size);
+    expect(bulk.capacity() >= collection_size);
+
+    std::size_t const wanted = 10;
+    std::vector<float> reconstructed(dimensions);
+    std::size_t bulk_recall = 0, incremental_recall = 0;
+    for (std::size_t task = 0; task != collection_size; ++task) {
+        float const* vector = dataset.data() + task * dimensions;
+        expect(bulk.contains(keys[task]));
+        expect(bulk.count(keys[task]) == 1);
+        expect(bulk.get(keys[task], reconstructed.data()));
+        expect(std::equal(reconstructed.begin(), reconstructed.end(), vector));
+        bulk_recall += bulk.search(vector, wanted).contains(keys[task]);
+        incremental_recall += incremental.search(vector, wanted).contains(keys[task]);
+    }
+    expect(bulk_recall * 10 >= collection_size * 9);
+    expect(bulk_recall * 20 >= incremental_recall * 19);
+
+    // Every node must stay linked within the connectivity limits
+    auto stats = bulk.stats();
+    expect(stats.nodes == collection_size);
+    expect(stats.edges <= stats.max_edges);
+    if (collection_size > 1)
+        expect(stats.edges >= collection_size);
+
+    // The index remains mutable afterwards
+    vector_key_t const extra_key = static_cast<vector_key_t>(collection_size * 3 + 2);
+    expect(bulk.reserve(collection_size + 1));
+    expect(bool(bulk.add(extra_key, dataset.data())));
+    expect(bulk.contains(extra_key));
+    auto rebuilt = bulk.build(keys.data(), dataset.data(), collection_size, executor);
+    expect(!rebuilt);
+    rebuilt.error.release();
+
+    // Duplicate keys are rejected unless the index is a multi-index
+    if (collection_size > 1) {
+        std::vector<vector_key_t> duplicates(collection_size, keys[0]);
+        index_t unique = index_t::make(metric);
+        auto duplicated = unique.build(duplicates.data(), dataset.data(), collection_size, executor);
+        expect(!duplicated);
+        duplicated.error.release();
+        expect(unique.size() == 0);
+
+        index_dense_config_t multi_config;
+        multi_config.multi = true;
+        index_t multi = index_t::make(metric, multi_config);
+        expect(bool(multi.build(duplicates.data(), dataset.data(), collection_size, executor)));
+        expect(multi.count(keys[0]) == collection_size);
+    }
+
+    // Product-quantized indexes need lookup tables for every query, so they are built incrementally
+    if (collection_size >= 256) {
+        index_t quantized = index_t::make(metric);
+        expect(bool(quantized.quantize(dataset.data(), collection_size, 4, 8, executor)));
+        expect(bool(quantized.build(keys.data(), dataset.data(), collection_size, executor)));
+        expect(quantized.size() == collection_size);
+        for (std::size_t task = 0; task != collection_size; ++task)
+            expect(quantized.contains(keys[task]));
+    }
+}
+
+/**
+ * Tests merging two indexes, reusing their graphs instead of re-inserting the vectors.
+ *
+ * Checks that every entry of both indexes is retrievable and searchable after the merge,
+ * that removed entries stay removed, that colliding keys and mismatching metrics are rejected,
+ * that an interrupted merge leaves only the old entries visible, and that two serialized indexes
+ * can be merged into a new file.
+ *
+ * @param collection_size Number of vectors in each of the merged indexes.
+ * @param dimensions Number of dimensions per vector.
+ */
+void test_merge(std::size_t collection_size, std::size_t dimensions) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(2 * collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    executor_default_t executor;
+    index_t first = index_t::make(metric);
+    index_t second = index_t::make(metric);
+    expect(first.reserve({collection_size, executor.size()}));
+    expect(second.reserve({collection_size, executor.size()}));
+    executor.fixed(collection_size, [&](std::size_t thread, std::size_t task) {
+        first.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions, thread);
+        std::size_t other_task = collection_size + task;
+        second.add(static_cast<vector_key_t>(other_task), dataset.data() + other_task * dimensions, thread);
+    });
+
+    // Removed entries of the second index must not be revived
+    vector_key_t const removed_key = static_cast<vector_key_t>(2 * collection_size - 1);
+    if (collection_size > 1)
+        expect(second.remove(removed_key).completed == 1);
+    std::size_t const merged_size = first.size() + second.size();
+
+    expect(bool(first.save("tmp-merge-first.usearch")));
+    expect(bool(second.save("tmp-merge-second.usearch")));
+
+    // Colliding keys and different metrics are rejected before anything is modified
+    index_t colliding = index_t::make(metric);
+    expect(colliding.reserve(1));
+    expect(bool(colliding.add(0, dataset.data())));
+    auto collided = colliding.merge(first, executor);
+    expect(!collided);
+    collided.error.release();
+    expect(colliding.size() == 1);
+    index_t mismatching = index_t::make(metric_punned_t(dimensions, metric_kind_t::cos_k, scalar_kind_t::f32_k));
+    auto mismatched = mismatching.merge(first, executor);
+    expect(!mismatched);
+    mismatched.error.release();
+    index_t rerank_cos = index_t::make(metric), rerank_ip = index_t::make(metric);
+    expect(rerank_cos.enable_rerank(metric_punned_t(dimensions, metric_kind_t::cos_k, scalar_kind_t::f32_k)));
+    expect(rerank_ip.enable_rerank(metric_punned_t(dimensions, metric_kind_t::ip_k, scalar_kind_t::f32_k)));
+    expect(rerank_ip.reserve(1));
+    expect(bool(rerank_ip.add(0, dataset.data())));
+    auto mismatched_rerank = rerank_cos.merge(rerank_ip, executor);
+    expect(!mismatched_rerank);
+    mismatched_rerank.error.release();
+
+    // An interrupted merge keeps the copied entries unpublished, and the old ones searchable
+    index_t interrupted = index_t::make(metric);
+    expect(interrupted.reserve({collection_size + 1, executor.size()}));
+    expect(bool(interrupted.add(0, dataset.data())));
+    auto stopped = interrupted.merge(second, executor, [](std::size_t, std::size_t) { return false; });
+    expect(!stopped);
+    stopped.error.release();
+    expect(interrupted.size() == 1);
+    expect(interrupted.contains(0) && interrupted.count(0) == 1);
+    for (std::size_t task = collection_size; task != 2 * collection_size; ++task)
+        expect(!interrupted.contains(static_cast<vector_key_t>(task)));
+    auto searched_interrupted = interrupted.search(dataset.data(), 10);
+    expect(searched_interrupted.size() == 1 && searched_interrupted[0].member.key == 0);
+    expect(bool(interrupted.add(1, dataset.data() + dimensions)));
+    expect(interrupted.size() == 2 && interrupted.contains(1));
+
+    auto check = [&](index_t& merged) {
+        expect(merged.size() == merged_size);
+        std::vector<float> reconstructed(dimensions);
+        std::size_t self_recall = 0, searched = 0;
+        for (std::size_t task = 0; task != 2 * collection_size; ++task) {
+            vector_key_t key = static_cast<vector_key_t>(task);
+            float const* vector = dataset.data() + task * dimensions;
+            if (collection_size > 1 && key == removed_key) {
+                expect(!merged.contains(key));
+                continue;
+            }
+            expect(merged.contains(key));
+            expect(merged.count(key) == 1);
+            expect(merged.get(key, reconstructed.data()));
+            expect(std::equal(reconstructed.begin(), reconstructed.end(), vector));
+            self_recall += merged.search(vector, 10).contains(key);
+            ++searched;
+        }
+        expect(self_recall * 10 >= searched * 9);
+    };
+
+    // In-memory merge, viewing the other index straight from disk
+    index_t viewed = index_t::make(metric);
+    expect(bool(viewed.view("tmp-merge-second.usearch")));
+    auto merged = first.merge(viewed, executor);
+    expect(bool(merged));
+    expect(merged.new_size == 2 * collection_size);
+    check(first);
+
+    // The merged index remains mutable, and reuses the removed slots
+    if (collection_size > 1) {
+        expect(bool(first.add(removed_key, dataset.data() + (2 * collection_size - 1) * dimensions)));
+        expect(first.contains(removed_key));
+        expect(bool(first.remove(removed_key)));
+    }
+
+    // File-to-file merge
+    auto merged_files = index_t::merge("tmp-merge-first.usearch", "tmp-merge-second.usearch",
+                                       "tmp-merge-output.usearch", executor);
+    expect(bool(merged_files));
+    index_t loaded = index_t::make(metric);
+    expect(bool(loaded.load("tmp-merge-output.usearch")));
+    check(loaded);
+
+    std::remove("tmp-merge-first.usearch");
+    std::remove("tmp-merge-second.usearch");
+    std::remove("tmp-merge-output.usearch");
+}
+
+/**
+ * Tests the huge pages and NUMA placement of the allocators, and the per-node replicas of viewed files.
+ *
+ * Every placement must fall back to regular pages where unsupported, yielding usable memory,
+ * and the placed indexes and replicas must behave exactly like the regular ones.
+ *
+ * @param collection_size Number of vectors in the index.
+ * @param dimensions Number of dimensions per vector.
+ */
+void test_memory_placement(std::size_t collection_size, std::size_t dimensions) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+
+    std::size_t const nodes = numa_nodes_count();
+    std::size_t const local_node = numa_node_current();
+    expect(nodes >= 1);
+    expect(local_node < nodes);
+
+    for (huge_pages_t huge_pages : {huge_pages_t::none_k, huge_pages_t::transparent_k, huge_pages_t::explicit_2mb_k,
+                                    huge_pages_t::explicit_1gb_k}) {
+        for (numa_policy_t numa_policy :
+             {numa_policy_t::default_k, numa_policy_t::interleave_k, numa_policy_t::bind_k}) {
+            memory_placement_t placement;
+            placement.huge_pages = huge_pages;
+            placement.numa_policy = numa_policy;
+            placement.numa_node = local_node;
+
+            page_allocator_t pages(placement);
+            byte_t* page = pages.allocate(1);
+            expect(page != nullptr);
+            std::memset(page, 0xAB, page_allocator_t::page_size());
+            pages.deallocate(page, 1);
+
+            memory_mapping_allocator_gt<64> tape(placement);
+            std::size_t const bytes = 1000;
+            byte_t* first = tape.allocate(bytes);
+            byte_t* second = tape.allocate(bytes);
+            expect(first && second);
+            expect(reinterpret_cast<std::uintptr_t>(second) % 64 == 0);
+            std::memset(first, 1, bytes);
+            std::memset(second, 2, bytes);
+            expect(first[bytes - 1] == 1 && second[0] == 2);
+            expect(tape.total_allocated() % pages.granularity() == 0);
+            expect(memory_mapping_allocator_gt<64>(tape).placement().huge_pages == huge_pages);
+        }
+    }
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    index_dense_config_t config;
+    config.placement.huge_pages = huge_pages_t::transparent_k;
+    config.placement.numa_policy = numa_policy_t::interleave_k;
+    index_t index = index_t::make(metric, config);
+    expect(index.reserve(collection_size));
+    for (std::size_t task = 0; task != collection_size; ++task)
+        expect(bool(index.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions)));
+    expect(bool(index.save("tmp-placement.usearch")));
+
+    // Every replica is a private copy of the file, placed on the chosen node
+    memory_placement_t replica_placement;
+    replica_placement.huge_pages = huge_pages_t::explicit_2mb_k;
+    replica_placement.numa_policy = numa_policy_t::bind_k;
+    replica_placement.numa_node = local_node;
+    std::vector<index_t> replicas;
+    for (std::size_t node = 0; node != nodes; ++node) {
+        replica_placement.numa_node = node;
+        replicas.push_back(index_t::make(metric));
+        expect(bool(replicas.back().view(memory_mapped_file_t("tmp-placement.usearch", replica_placement))));
+    }
+    std::remove("tmp-placement.usearch");
+
+    index_t& local = replicas[local_node];
+    expect(local.size() == collection_size);
+    std::vector<float> reconstructed(dimensions);
+    for (std::size_t task = 0; task != collection_size; ++task) {
+        vector_key_t key = static_cast<vector_key_t>(task);
+        float const* vector = dataset.data() + task * dimensions;
+        expect(local.get(key, reconstructed.data()));
+        expect(std::equal(reconstructed.begin(), reconstructed.end(), vector));
+        auto expected = index.search(vector, 5);
+        auto found = local.search(vector, 5);
+        expect(found.size() == expected.size());
+        for (std::size_t i = 0; i != found.size(); ++i)
+            expect(found[i].member.key == expected[i].member.key);
+    }
+
+    // Copies and compactions keep the placement of the original
+    auto copy = index.copy();
+    expect(bool(copy));
+    expect(copy.index.config().placement.numa_policy == numa_policy_t::interleave_k);
+    expect(copy.index.size() == collection_size);
+    if (collection_size > 1) {
+        expect(bool(copy.index.remove(0)));
+        expect(bool(copy.index.compact()));
+        expect(copy.index.size() == collection_size - 1);
+        expect(copy.index.contains(1));
+    }
+}
+
+/**
+ * Tests the compressed base-level neighbors lists, comparing every kind of search against the
+ * regular layout, for loaded and viewed indexes, and checking that saving and copying expands them back.
+ *
+ * @param collection_size Number of vectors in the index.
+ * @param dimensions Number of dimensions per vector.
+ * @param colocate_vectors Whether the vectors are stored inside of the graph nodes.
+ */
+template <typename index_at>
+void test_compressed_neighbors(std::size_t collection_size, std::size_t dimensions, bool colocate_vectors) {
+    using index_t = index_at;
+    using vector_key_t = typename index_t::vector_key_t;
+    using distance_t = typename index_t::distance_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    index_dense_config_t config;
+    config.colocate_vectors = colocate_vectors;
+    index_t index = index_t::make(metric, config);
+    expect(index.reserve(index_limits_t(collection_size, 1)));
+    for (std::size_t task = 0; task != collection_size; ++task)
+        expect(bool(index.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions)));
+    expect(bool(index.reorder()));
+    expect(bool(index.save("tmp-compressed.usearch")));
+
+    std::vector<vector_key_t> allowed_keys;
+    for (std::size_t task = 0; task < collection_size; task += 5)
+        allowed_keys.push_back(static_cast<vector_key_t>(task));
+    auto filter = index.make_filter(allowed_keys.begin(), allowed_keys.end());
+    expect(bool(filter));
+
+    // The packed lists must be decoded into exactly the same graph
+    auto expect_same_searches = [&](index_t const& compressed) {
+        expect(compressed.size() == collection_size);
+        for (std::size_t query = 0; query < collection_size; query += 3) {
+            float const* query_vector = dataset.data() + query * dimensions;
+            auto expected = index.search(query_vector, 10);
+            auto found = compressed.search(query_vector, 10);
+            expect(found.size() == expected.size());
+            for (std::size_t i = 0; i != found.size(); ++i)
+                expect(found[i].member.key == expected[i].member.key);
+
+            auto expected_filtered = index.search(query_vector, 5, filter);
+            auto found_filtered = compressed.search(query_vector, 5, filter);
+            expect(found_filtered.size() == expected_filtered.size());
+            for (std::size_t i = 0; i != found_filtered.size(); ++i)
+                expect(found_filtered[i].member.key == expected_filtered[i].member.key);
+
+            distance_t const radius = expected[expected.size() - 1].distance;
+            std::size_t expected_count = 0, found_count = 0;
+            index.range_search(query_vector, radius, [&](vector_key_t, distance_t) { ++expected_count; });
+            compressed.range_search(query_vector, radius, [&](vector_key_t, distance_t) { ++found_count; });
+            expect(found_count == expected_count);
+        }
+    };
+
+    for (bool viewed : {false, true}) {
+        index_t compressed = index_t::make(metric, config);
+        expect(viewed ? bool(compressed.view("tmp-compressed.usearch"))
+                      : bool(compressed.load("tmp-compressed.usearch")));
+        typename index_t::stats_t const stats_before = compressed.stats();
+        std::size_t const serialized_before = compressed.serialized_length();
+
+        typename index_t::compression_result_t result = compressed.compress();
+        expect(bool(result));
+        expect(compressed.is_compressed());
+        expect(result.compressed_bytes < result.uncompressed_bytes);
+        typename index_t::stats_t const stats_after = compressed.stats();
+        expect(stats_after.edges == stats_before.edges);
+        expect(stats_after.allocated_bytes < stats_before.allocated_bytes);
+        expect(compressed.serialized_length() == serialized_before);
+        expect(bool(compressed.compress()));
+        expect_same_searches(compressed);
+
+        // No more insertions or compactions
+        std::vector<float> reconstructed(dimensions);
+        expect(compressed.get(0, reconstructed.data()));
+        expect(std::equal(reconstructed.begin(), reconstructed.end(), dataset.data()));
+        auto added = compressed.add(static_cast<vector_key_t>(collection_size), dataset.data());
+        expect(!added);
+        added.error.release();
+        auto compacted = compressed.compact();
+        expect(!compacted);
+        compacted.error.release();
+
+        // Saved files and copies are back in the regular layout
+        expect(bool(compressed.save("tmp-compressed-copy.usearch")));
+        index_t reloaded = index_t::make(metric, config);
+        expect(bool(reloaded.load("tmp-compressed-copy.usearch")));
+        expect(!reloaded.is_compressed());
+        expect_same_searches(reloaded);
+        auto copy = compressed.copy();
+        expect(bool(copy));
+        expect(!copy.index.is_compressed());
+        expect_same_searches(copy.index);
+        expect(copy.index.reserve(collection_size + 1));
+        expect(bool(copy.index.add(static_cast<vector_key_t>(collection_size), dataset.data())));
+    }
+    std::remove("tmp-compressed.usearch");
+    std::remove("tmp-compressed-copy.usearch");
+}
+
+/**
+ * Tests the adaptive early termination of searches, and the calibration of the search schedule.
+ *
+ * Checks that a generous patience or distance ratio doesn't change the results, that aggressive
+ * criteria only save distance computations, and that the calibrated schedule holds the target recall.
+ *
+ * @param collection_size Number of vectors to be indexed.
+ * @param dimensions Number of dimensions per vector.
+ */
+void test_adaptive_search(std::size_t collection_size, std::size_t dimensions) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    executor_default_t executor;
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    index_t index = index_t::make(metric);
+    expect(index.reserve(index_limits_t(collection_size, executor.size())));
+    for (std::size_t task = 0; task != collection_size; ++task)
+        expect(bool(index.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions)));
+
+    // Half of the entries, too many to be scanned exhaustively by the filtered search
+    std::vector<vector_key_t> allowed_keys;
+    for (std::size_t task = 0; task < collection_size; task += 2)
+        allowed_keys.push_back(static_cast<vector_key_t>(task));
+    index_t::filter_t filter = index.make_filter(allowed_keys.begin(), allowed_keys.end());
+    expect(bool(filter));
+
+    std::size_t const wanted = 10;
+    auto search_all = [&](std::vector<vector_key_t>& keys, std::size_t& computed_distances, bool filtered) {
+        keys.assign(collection_size * wanted, index.free_key());
+        computed_distances = 0;
+        for (std::size_t task = 0; task != collection_size; ++task) {
+            float const* vector = dataset.data() + task * dimensions;
+            auto result = filtered ? index.search(vector, wanted, filter) : index.search(vector, wanted);
+            expect(bool(result));
+            result.dump_to(keys.data() + task * wanted);
+            computed_distances += result.computed_distances;
+        }
+    };
+    float const range_radius = 0.5f * static_cast<float>(dimensions);
+    auto range_counts = [&] {
+        std::vector<std::size_t> counts(collection_size);
+        for (std::size_t task = 0; task != collection_size; ++task)
+            counts[task] =
+                index.range_search(dataset.data() + task * dimensions, range_radius, [](vector_key_t, float) {})
+                    .count;
+        return counts;
+    };
+
+    std::vector<vector_key_t> static_keys, adaptive_keys, static_filtered_keys, adaptive_filtered_keys;
+    std::size_t static_cost = 0, adaptive_cost = 0, static_filtered_cost = 0, adaptive_filtered_cost = 0;
+    search_all(static_keys, static_cost, false);
+    search_all(static_filtered_keys, static_filtered_cost, true);
+    std::vector<std::size_t> static_range_counts = range_counts();
+
+    // Criteria, that never trigger, must not change anything
+    index.change_patience_search(collection_size * 4);
+    index.change_distance_ratio_search(1e9);
+    search_all(adaptive_keys, adaptive_cost, false);
+    expect(adaptive_keys == static_keys);
+    expect(adaptive_cost == static_cost);
+    search_all(adaptive_filtered_keys, adaptive_filtered_cost, true);
+    expect(adaptive_filtered_keys == static_filtered_keys);
+    expect(adaptive_filtered_cost == static_filtered_cost);
+
+    // Aggressive criteria stop earlier, but every vector should still find itself
+    index.change_patience_search(1);
+    index.change_distance_ratio_search(1);
+    search_all(adaptive_keys, adaptive_cost, false);
+    expect(adaptive_cost <= static_cost);
+    std::size_t found_themselves = 0;
+    for (std::size_t task = 0; task != collection_size; ++task)
+        found_themselves += adaptive_keys[task * wanted] == static_cast<vector_key_t>(task);
+    expect(found_themselves >= collection_size * 9 / 10);
+
+    // The filtered search stops earlier too, still returning only the allowed entries
+    search_all(adaptive_filtered_keys, adaptive_filtered_cost, true);
+    expect(adaptive_filtered_cost <= static_filtered_cost);
+    expect(collection_size < 1000 || adaptive_filtered_cost < static_filtered_cost);
+    std::size_t found_allowed = 0;
+    for (std::size_t task = 0; task < collection_size; task += 2)
+        found_allowed += adaptive_filtered_keys[task * wanted] == static_cast<vector_key_t>(task);
+    for (vector_key_t key : adaptive_filtered_keys)
+        expect(key == index.free_key() || key % 2 == 0);
+    expect(found_allowed >= (collection_size + 1) / 2 * 9 / 10);
+
+    // The range search must still report everything within the radius
+    expect(range_counts() == static_range_counts);
+
+    // Calibrate on a sample, that is a part of the dataset
+    std::size_t const sample_size = (std::min)(collection_size, std::size_t(100));
+    std::vector<float const*> sample(sample_size);
+    for (std::size_t i = 0; i != sample_size; ++i)
+        sample[i] = dataset.data() + (i * collection_size / sample_size) * dimensions;
+    index_dense_calibration_config_t config;
+    config.wanted = wanted;
+    config.target_recall = 0.9;
+    config.max_expansion = 256;
+    auto calibrated = index.calibrate(sample.begin(), sample.end(), config, executor);
+    expect(bool(calibrated));
+    expect(calibrated.schedules > 0);
+    expect(calibrated.recall >= config.target_recall);
+    expect(calibrated.expansion >= wanted && calibrated.expansion <= config.max_expansion);
+    expect(index.expansion_search() == calibrated.expansion);
+    expect(index.patience_search() == calibrated.patience);
+    expect(index.distance_ratio_search() == calibrated.distance_ratio);
+
+    // An empty sample can't be calibrated on, and doesn't change the schedule
+    auto empty = index.calibrate(sample.begin(), sample.begin(), config, executor);
+    expect(!empty);
+    empty.error.release();
+    expect(index.expansion_search() == calibrated.expansion);
+}
+
+/**
+ * Submits many small jobs of every kind to the given pool, checking their results.
+ */
+void test_executor_pool_jobs(executor_pool_t& executor, std::size_t threads_count, bool pin_threads) {
+    expect(executor.size() == threads_count);
+
+    for (std::size_t tasks : {0, 1, 2, 7, 100, 10000}) {
+        std::vector<std::atomic<std::size_t>> visits(tasks);
+        for (std::size_t repetition = 0; repetition != 10; ++repetition)
+            executor.fixed(tasks, [&](std::size_t thread, std::size_t task) {
+                expect(thread < threads_count);
+                visits[task]++;
+            });
+        for (std::atomic<std::size_t>& counter : visits)
+            expect(counter.load() == 10);
+    }
+
+    std::atomic<std::size_t> executed(0);
+    executor.dynamic(10000, [&](std::size_t, std::size_t task) {
+        executed++;
+        return task != 0;
+    });
+    expect(executed.load() >= 1 && executed.load() <= 10000);
+
+    std::vector<std::atomic<std::size_t>> threads_visits(threads_count);
+    executor.parallel([&](std::size_t thread) { threads_visits[thread]++; });
+    for (std::atomic<std::size_t>& counter : threads_visits)
+        expect(counter.load() == 1);
+
+    // Exceptions from any thread must reach the caller, leaving the pool usable
+    for (std::size_t throwing_task : {std::size_t(0), std::size_t(9999)}) {
+        bool caught = false;
+        try {
+            executor.fixed(10000, [&](std::size_t, std::size_t task) {
+                if (task == throwing_task)
+                    throw std::runtime_error("task failed");
+            });
+        } catch (std::runtime_error const&) {
+            caught = true;
+        }
+        expect(caught);
+    }
+    bool caught = false;
+    try {
+        executor.parallel([&](std::size_t thread) {
+            if (thread + 1 == threads_count)
+                throw std::runtime_error("thread failed");
+        });
+    } catch (std::runtime_error const&) {
+        caught = true;
+    }
+    expect(caught);
+    executed = 0;
+    executor.fixed(100, [&](std::size_t, std::size_t) { executed++; });
+    expect(executed.load() == 100);
+
+#if defined(USEARCH_DEFINED_LINUX)
+    // The workers inherit the affinity of the constructing thread, unless pinned to a single core
+    cpu_set_t caller_affinity;
+    expect(pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &caller_affinity) == 0);
+    std::vector<cpu_set_t> threads_affinities(threads_count);
+    executor.parallel([&](std::size_t thread) {
+        pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &threads_affinities[thread]);
+    });
+    expect(CPU_EQUAL(&caller_affinity, &threads_affinities[0]));
+    for (std::size_t thread = 1; thread < threads_count; ++thread)
+        expect(pin_threads ? CPU_COUNT(&threads_affinities[thread]) == 1
+                           : CPU_EQUAL(&caller_affinity, &threads_affinities[thread]));
+#else
+    (void)pin_threads;
+#endif
+}
+
+/**
+ * Tests the persistent work-stealing executor, submitting many small jobs to the same pool.
+ *
+ * Checks that every task is executed exactly once, that early stopping in `dynamic` is respected,
+ * and that `parallel` reaches every thread. With pinning, checks that only the workers are pinned,
+ * and the affinity of the submitting thread is left intact.
+ *
+ * @param threads_count Number of threads in the pool.
+ * @param pin_threads Whether to pin the worker threads to separate cores.
+ */
+void test_executor_pool(std::size_t threads_count, bool pin_threads) {
+#if defined(USEARCH_DEFINED_LINUX)
+    cpu_set_t caller_affinity;
+    expect(pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &caller_affinity) == 0);
+#endif
+    {
+        executor_pool_t executor(threads_count, pin_threads);
+        test_executor_pool_jobs(executor, threads_count, pin_threads);
+    }
+#if defined(USEARCH_DEFINED_LINUX)
+    cpu_set_t remaining_affinity;
+    expect(pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &remaining_affinity) == 0);
+    expect(CPU_EQUAL(&caller_affinity, &remaining_affinity));
+#endif
+}
+
+/**
+ * Tests the persistent executor driving an index, comparing the batched search it parallelizes
+ * to the one parallelized by the default executor.
+ *
+ * @param collection_size Number of vectors to be indexed and queried.
+ */
+void test_executor_pool_search(std::size_t collection_size) {
+    using index_t = index_dense_t;
+    using vector_key_t = typename index_t::vector_key_t;
+    using distance_t = typename index_t::distance_t;
+
+    std::size_t const dimensions = 16;
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.0, 1.0);
+    std::vector<float> dataset(collection_size * dimensions);
+    std::generate(dataset.begin(), dataset.end(), [&] { return dis(gen); });
+
+    executor_pool_t pool;
+    executor_default_t executor;
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    index_t index = index_t::make(metric);
+    index.reserve({collection_size, (std::max)(pool.size(), executor.size())});
+    pool.fixed(collection_size, [&](std::size_t thread, std::size_t task) {
+        index.add(static_cast<vector_key_t>(task), dataset.data() + task * dimensions, thread);
+    });
+    expect(index.size() == collection_size);
+
+    std::size_t const wanted = 5;
+    std::vector<vector_key_t> pool_keys(collection_size * wanted), default_keys(collection_size * wanted);
+    std::vector<distance_t> pool_distances(collection_size * wanted), default_distances(collection_size * wanted);
+    std::vector<std::size_t> pool_counts(collection_size), default_counts(collection_size);
+    expect(bool(index.search_batch(dataset.data(), collection_size, wanted, pool_keys.data(), pool_distances.data(),
+                                   pool_counts.data(), pool)));
+    expect(bool(index.search_batch(dataset.data(), collection_size, wanted, default_keys.data(),
+                                   default_distances.data(), default_counts.data(), executor)));
+    expect(pool_counts == default_counts);
+    expect(pool_keys == default_keys);
 }
 
 /**
@@ -636,11 +2884,23 @@ int main(int, char**) {
     // Exact search without constructing indexes.
     // Great for validating the distance functions.
     std::printf("Testing exact search\n");
-    for (std::size_t dataset_count : {10, 100})
+    for (std::size_t dataset_count : {10, 100, 20000})
         for (std::size_t queries_count : {1, 10})
-            for (std::size_t wanted_count : {1, 5})
+            for (std::size_t wanted_count : {1, 5, 50})
                 test_exact_search(dataset_count, queries_count, wanted_count);
 
+    // Batched distance kernels behind the type-punned metric
+    std::printf("Testing batched metrics\n");
+    for (std::size_t dimensions : {3, 16, 97})
+        test_batched_metrics(dimensions);
+
+    // Persistent thread-pool, reused across many small jobs
+    std::printf("Testing work-stealing executor\n");
+    for (std::size_t threads_count : {1, 2, 3, 16})
+        for (bool pin_threads : {false, true})
+            test_executor_pool(threads_count, pin_threads);
+    test_executor_pool_search(1000);
+
     // Make sure the initializers and the algorithms can work with inadequately small values.
     // Be warned - this combinatorial explosion of tests produces close to __500'000__ tests!
     std::printf("Testing absurd index configs\n");
@@ -662,6 +2922,129 @@ int main(int, char**) {
             test_cosine<float, std::int64_t, uint40_t>(collection_size, dimensions);
         }
 
+    // Batched search must match individual queries
+    std::printf("Testing batched search\n");
+    for (std::size_t collection_size : {1, 100, 2000})
+        test_search_batch(collection_size, 32);
+
+    // Compact product-quantized vectors with optional reranking
+    std::printf("Testing product quantization\n");
+    for (metric_kind_t metric_kind : {metric_kind_t::l2sq_k, metric_kind_t::cos_k})
+        for (std::size_t subspaces : {4, 8})
+            test_product_quantization(2000, 32, subspaces, metric_kind);
+
+    // Traversal over compact vectors with reranking over the full-precision copies
+    std::printf("Testing two-stage search\n");
+    for (std::size_t collection_size : {10, 1000})
+        test_two_stage_search(collection_size, 64);
+
+    // Breadth-first relabeling for better memory locality
+    std::printf("Testing nodes reordering\n");
+    for (std::size_t collection_size : {1, 10, 1000})
+        test_reorder(collection_size, 16);
+
+    // Vectors stored inside of the graph nodes
+    std::printf("Testing co-located vectors\n");
+    for (std::size_t collection_size : {1, 10, 1000})
+        test_colocated_vectors(collection_size, 16);
+
+    // Software-pipelined prefetching of the upcoming candidates
+    std::printf("Testing prefetching\n");
+    for (std::size_t collection_size : {1, 10, 1000})
+        test_prefetch(collection_size, 32);
+
+    // Viewing files larger than RAM
+    std::printf("Testing disk-resident indexes\n");
+    for (std::size_t collection_size : {1, 10, 1000})
+        test_disk_resident(collection_size, 32);
+
+    // Concurrent construction with optimistic reverse links
+    std::printf("Testing optimistic insertion\n");
+    for (std::size_t collection_size : {1, 10, 1000})
+        test_optimistic_insertion(collection_size, 16);
+
+    // Independent shards with a merged top-k
+    std::printf("Testing sharded indexes\n");
+    for (std::size_t collection_size : {1, 10, 1000})
+        test_sharded(collection_size, 16);
+
+    // Metric kernels inlined at compile-time
+    std::printf("Testing compile-time specialized indexes\n");
+    for (std::size_t collection_size : {1, 10, 1000})
+        test_typed_index(collection_size);
+
+    // Positional file I/O from multiple threads
+    std::printf("Testing parallel serialization\n");
+    for (std::size_t collection_size : {1, 10, 1000, 20000})
+        test_parallel_serialization(collection_size, 16);
+
+    // Snapshots with write-ahead logs
+    std::printf("Testing journaled indexes\n");
+    for (std::size_t collection_size : {1, 10, 1000})
+        test_journaled_index(collection_size, 16);
+
+    // Point-in-time snapshots, saved while the index keeps changing
+    std::printf("Testing snapshots\n");
+    for (std::size_t collection_size : {1, 10, 1000})
+        for (bool colocate_vectors : {false, true})
+            test_snapshots(collection_size, 16, colocate_vectors);
+
+    // Deletions repairing the graph in-place, instead of leaving tombstones
+    std::printf("Testing removal repairs\n");
+    for (std::size_t collection_size : {1, 10, 1000, 5000})
+        test_removal_repair(collection_size, 16);
+
+    // Insertions reusing the nodes of the removed entries from several threads at once
+    std::printf("Testing concurrent node reuse\n");
+    for (std::size_t collection_size : {10, 1000, 10000})
+        for (std::size_t threads_count : {1, 4})
+            test_concurrent_reuse(collection_size, 16, threads_count);
+    test_reserve_after_removals(16);
+
+    // Filter-aware search over precomputed sets of slots, like the entries of a single tenant
+    std::printf("Testing filter-aware search\n");
+    for (std::size_t collection_size : {1, 10, 1000, 5000})
+        test_filtered_search(collection_size, 16);
+
+    // Range search, finding everything within a radius in a single traversal
+    std::printf("Testing range search\n");
+    for (std::size_t collection_size : {1, 10, 1000, 5000})
+        test_range_search(collection_size, 16);
+
+    // Per-query counters and latency histograms, compiled out by default
+    std::printf("Testing instrumentation\n");
+    for (std::size_t collection_size : {1, 10, 1000})
+        test_instrumentation(collection_size, 16);
+
+    // Static collections linked in batches, instead of one vector at a time
+    std::printf("Testing bulk construction\n");
+    for (std::size_t collection_size : {1, 2, 10, 1000, 5000})
+        test_bulk_build(collection_size, 16);
+
+    // Merging graphs, only searching for the links between them
+    std::printf("Testing merging\n");
+    for (std::size_t collection_size : {1, 2, 10, 1000, 5000})
+        test_merge(collection_size, 16);
+
+    // Stopping converged searches early, and tuning the schedule for a target recall
+    std::printf("Testing adaptive search\n");
+    for (std::size_t collection_size : {1, 10, 1000, 5000})
+        test_adaptive_search(collection_size, 16);
+
+    // Huge pages, NUMA placement, and per-node replicas
+    std::printf("Testing memory placement\n");
+    for (std::size_t collection_size : {1, 10, 1000})
+        test_memory_placement(collection_size, 16);
+
+    // Delta-encoded base-level neighbors lists of immutable indexes
+    std::printf("Testing compressed neighbors lists\n");
+    for (std::size_t collection_size : {1, 10, 1000}) {
+        for (bool colocate_vectors : {false, true}) {
+            test_compressed_neighbors<index_dense_t>(collection_size, 16, colocate_vectors);
+            test_compressed_neighbors<index_dense_gt<default_key_t, uint40_t>>(collection_size, 16, colocate_vectors);
+        }
+    }
+
     // Test with binaty vectors
     std::printf("Testing binary vectors\n");
     for (std::size_t connectivity : {3, 13, 50})
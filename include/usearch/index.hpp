@@ -54,6 +54,10 @@
 #define USEARCH_USE_OPENMP 0
 #endif
 
+#if !defined(USEARCH_USE_INSTRUMENTATION)
+#define USEARCH_USE_INSTRUMENTATION 0
+#endif
+
 // OS-specific includes
 #if defined(USEARCH_DEFINED_WINDOWS)
 #define _USE_MATH_DEFINES
@@ -70,12 +74,18 @@
 #include <unistd.h>   // `open`, `close`
 #endif
 
+#if defined(USEARCH_DEFINED_LINUX)
+#include <sys/syscall.h> // `SYS_mbind`, `SYS_getcpu`
+#endif
+
 // STL includes
 #include <algorithm> // `std::sort_heap`
 #include <atomic>    // `std::atomic`
 #include <bitset>    // `std::bitset`
+#include <chrono>    // `std::chrono::steady_clock`
 #include <climits>   // `CHAR_BIT`
 #include <cmath>     // `std::sqrt`
+#include <cstdio>    // `std::fopen`
 #include <cstring>   // `std::memset`
 #include <iterator>  // `std::reverse_iterator`
 #include <mutex>     // `std::unique_lock` - replacement candidate
@@ -118,6 +128,13 @@
 #define usearch_noexcept_m
 #endif
 
+// Instrumentation, compiled out entirely unless `USEARCH_USE_INSTRUMENTATION` is set
+#if USEARCH_USE_INSTRUMENTATION
+#define usearch_instrument_m(...) __VA_ARGS__
+#else
+#define usearch_instrument_m(...)
+#endif
+
 extern "C" {
 /// @brief  Helper function to simplify debugging - trace just one symbol - `__usearch_raise_runtime_error`.
 ///         Assuming the `extern C` block, the name won't be mangled.
@@ -505,6 +522,70 @@ template <typename allocator_at = std::allocator<byte_t>> class bitset_gt {
 
 using bitset_t = bitset_gt<>;
 
+/// @brief  Monotonic timestamp for the instrumentation, in nanoseconds.
+inline std::uint64_t instrumentation_nanoseconds() noexcept {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                          std::chrono::steady_clock::now().time_since_epoch())
+                                          .count());
+}
+
+/**
+ *  @brief  Lock-free histogram with logarithmic buckets, where the bucket `i` counts the values
+ *          in the `[2^(i-1), 2^i)` range, and the bucket zero counts the zeros.
+ *          Copying produces a relaxed snapshot of the counters.
+ */
+class log2_histogram_t {
+  public:
+    static constexpr std::size_t buckets() { return 64; }
+
+  private:
+    std::atomic<std::uint64_t> counts_[64];
+
+    static std::size_t bucket_(std::uint64_t value) noexcept {
+        std::size_t bucket = 0;
+        for (; value && bucket + 1 != buckets(); value >>= 1)
+            ++bucket;
+        return bucket;
+    }
+
+  public:
+    log2_histogram_t() noexcept { reset(); }
+    log2_histogram_t(log2_histogram_t const& other) noexcept { *this = other; }
+    log2_histogram_t& operator=(log2_histogram_t const& other) noexcept {
+        for (std::size_t i = 0; i != buckets(); ++i)
+            counts_[i].store(other.count(i), std::memory_order_relaxed);
+        return *this;
+    }
+
+    void reset() noexcept {
+        for (std::size_t i = 0; i != buckets(); ++i)
+            counts_[i].store(0, std::memory_order_relaxed);
+    }
+
+    void record(std::uint64_t value) noexcept { counts_[bucket_(value)].fetch_add(1, std::memory_order_relaxed); }
+    std::uint64_t count(std::size_t bucket) const noexcept { return counts_[bucket].load(std::memory_order_relaxed); }
+
+    std::uint64_t total() const noexcept {
+        std::uint64_t result = 0;
+        for (std::size_t i = 0; i != buckets(); ++i)
+            result += count(i);
+        return result;
+    }
+
+    /// @brief Upper bound of the bucket containing the ::quantile, like `0.99` for the p99.
+    std::uint64_t percentile(double quantile) const noexcept {
+        std::uint64_t const total_count = total();
+        std::uint64_t const threshold = static_cast<std::uint64_t>(quantile * static_cast<double>(total_count));
+        std::uint64_t passed = 0;
+        for (std::size_t i = 0; i != buckets(); ++i) {
+            passed += count(i);
+            if (passed > threshold || passed == total_count)
+                return i ? (std::uint64_t(1) << i) - 1 : 0;
+        }
+        return 0;
+    }
+};
+
 /**
  *  @brief  Similar to `std::priority_queue`, but allows raw access to underlying
  *          memory, in case you want to shuffle it or sort. Good for collections
@@ -1019,7 +1100,7 @@ class ring_gt {
     size_t size() const noexcept {
         if (empty_)
             return 0;
-        else if (head_ >= tail_)
+        else if (head_ > tail_)
             return head_ - tail_;
         else
             return capacity_ - (tail_ - head_);
@@ -1106,6 +1187,10 @@ constexpr std::size_t default_expansion_add() { return 128; }
 /// > It is called `ef` in the paper.
 constexpr std::size_t default_expansion_search() { return 64; }
 
+/// @brief Number of neighbors, whose vectors are requested ahead of the one being scored.
+/// Large enough to cover the DRAM latency with a few distance computations.
+constexpr std::size_t default_prefetch_depth() { return 4; }
+
 constexpr std::size_t default_allocator_entry_bytes() { return 64; }
 
 /**
@@ -1124,6 +1209,12 @@ struct index_config_t {
     /// > It is called `M0` in the paper.
     std::size_t connectivity_base = default_connectivity() * 2;
 
+    /// @brief Number of bytes reserved in every node right after the base level neighbors,
+    /// to co-locate the vector with the links and avoid an extra indirection. Zero by default.
+    /// > Nodes are packed back to back, so the vector is only aligned as well as the preceding bytes allow.
+    /// > It isn't part of the serialized header, so it must be set before loading or viewing.
+    std::size_t vector_bytes = 0;
+
     inline index_config_t() = default;
     inline index_config_t(std::size_t c) noexcept
         : connectivity(c ? c : default_connectivity()), connectivity_base(c ? c * 2 : default_connectivity() * 2) {}
@@ -1150,6 +1241,28 @@ struct index_update_config_t {
 
     /// @brief Optional thread identifier for multi-threaded construction.
     std::size_t thread = 0;
+
+    /// @brief Runs the heuristic for the reverse links without holding the neighbor's lock,
+    /// committing only if its neighbors list didn't change meanwhile. Reduces contention on hubs.
+    bool optimistic = false;
+
+    /// @brief Number of neighbors to prefetch ahead of the one being scored, same as for `index_search_config_t`.
+    std::size_t prefetch_depth = 0;
+};
+
+struct index_build_config_t {
+    /// @brief Hyper-parameter controlling the quality of indexing, same as for `index_update_config_t`.
+    std::size_t expansion = default_expansion_add();
+
+    /// @brief Number of nodes linked concurrently, relative to the number of already linked ones.
+    /// Nodes of the same batch can't see each other, so smaller ratios produce slightly better graphs.
+    double batch_ratio = 0.1;
+
+    /// @brief Upper bound on the batch size, limiting the temporary memory usage.
+    std::size_t batch_limit = 1u << 18;
+
+    /// @brief Number of neighbors to prefetch ahead of the one being scored, same as for `index_search_config_t`.
+    std::size_t prefetch_depth = 0;
 };
 
 struct index_search_config_t {
@@ -1163,6 +1276,56 @@ struct index_search_config_t {
 
     /// @brief Brute-forces exhaustive search over all entries in the index.
     bool exact = false;
+
+    /// @brief Number of neighbors to prefetch ahead of the one being scored.
+    /// Zero passes the whole neighbors list to the `prefetch_at` callback at once.
+    std::size_t prefetch_depth = 0;
+
+    /// @brief In `filtered_search()`, the fraction of the index below which the allowed set is scanned
+    /// exhaustively instead of traversing the graph.
+    double brute_force_selectivity = 0.01;
+
+    /// @brief Adaptive early termination: stops the base layer traversal once the `wanted` closest
+    /// results haven't improved for this many expansions in a row. Zero disables it.
+    std::size_t patience = 0;
+
+    /// @brief Adaptive early termination: stops the base layer traversal once the closest unexpanded
+    /// candidate is this many times further than the `wanted`-th result. Zero disables it.
+    /// Only applies to positive distances, so metrics like `ip_k` should rely on the ::patience.
+    double distance_ratio = 0;
+};
+
+/**
+ *  @brief  Snapshot of the search instrumentation, aggregated across all the threads.
+ *          Stays zeroed unless compiled with `USEARCH_USE_INSTRUMENTATION`.
+ */
+struct index_instrumentation_t {
+    /// @brief Number of levels tracked separately, deeper ones are accumulated in the last.
+    static constexpr std::size_t levels() { return 16; }
+
+    /// @brief Whether the instrumentation was compiled in.
+    bool enabled = USEARCH_USE_INSTRUMENTATION;
+
+    /// @brief Number of expanded nodes on every level of the graph, across all the searches.
+    std::size_t hops_per_level[16] = {};
+    /// @brief Neighbors seen for the first time in a traversal, which had to be fetched and scored.
+    std::size_t missed_candidates = 0;
+    /// @brief Neighbors skipped, as they were already visited in the same traversal.
+    std::size_t reused_candidates = 0;
+    /// @brief Time spent in the distance kernels.
+    std::size_t distance_nanoseconds = 0;
+
+    /// @brief Number of node lock acquisitions that had to wait, and the time they waited.
+    std::size_t node_lock_waits = 0;
+    std::size_t node_lock_wait_nanoseconds = 0;
+    /// @brief Same for the keys lookup mutex, only reported by `index_dense_gt`.
+    std::size_t lookup_lock_waits = 0;
+    std::size_t lookup_lock_wait_nanoseconds = 0;
+
+    /// @brief Distributions of the per-query latency, expanded nodes, and computed distances.
+    log2_histogram_t latency_nanoseconds;
+    log2_histogram_t hops;
+    log2_histogram_t computed_distances;
 };
 
 struct index_cluster_config_t {
@@ -1333,6 +1496,55 @@ struct has_reset_gt<check_at, return_at(args_at...)> {
  */
 template <typename at> constexpr bool has_reset() { return has_reset_gt<at, void()>::value; }
 
+template <typename metric_at, typename value_at, typename entry_at, typename distance_at> struct has_many_to_one_gt {
+  private:
+    template <typename at>
+    static constexpr auto check(at*) -> typename std::is_same< //
+        decltype(std::declval<at>()(std::declval<value_at const*>(), std::size_t{}, std::declval<entry_at>(),
+                                    std::declval<distance_at*>())),
+        void>::type;
+    template <typename> static constexpr std::false_type check(...);
+
+    typedef decltype(check<metric_at>(0)) type;
+
+  public:
+    static constexpr bool value = type::value;
+};
+
+/**
+ *  @brief  Checks if a metric can score several values against the same entry in one call:
+ *          `void operator()(value_at const* values, std::size_t count, entry_at entry, distance_at* results)`.
+ */
+template <typename metric_at, typename value_at, typename entry_at, typename distance_at>
+constexpr bool has_many_to_one() {
+    return has_many_to_one_gt<typename std::decay<metric_at>::type, value_at, entry_at, distance_at>::value;
+}
+
+template <typename metric_at, typename value_at, typename batch_at, typename distance_at> struct has_one_to_many_gt {
+  private:
+    template <typename at>
+    static constexpr auto check(at*) -> typename std::is_same< //
+        decltype(std::declval<at>()(std::declval<value_at const&>(), std::declval<batch_at const&>(),
+                                    std::declval<distance_at*>())),
+        void>::type;
+    template <typename> static constexpr std::false_type check(...);
+
+    typedef decltype(check<metric_at>(0)) type;
+
+  public:
+    static constexpr bool value = type::value;
+};
+
+/**
+ *  @brief  Checks if a metric can score one value against a batch of entries in one call:
+ *          `void operator()(value_at value, batch_at const& entries, distance_at* results)`,
+ *          where the batch has `size()` and an `operator[]` returning entries.
+ */
+template <typename metric_at, typename value_at, typename batch_at, typename distance_at>
+constexpr bool has_one_to_many() {
+    return has_one_to_many_gt<typename std::decay<metric_at>::type, value_at, batch_at, distance_at>::value;
+}
+
 struct serialization_result_t {
     error_t error;
 
@@ -1439,17 +1651,436 @@ class input_file_t {
     }
 };
 
+/**
+ *  @brief  Binary file handle for @b positional reads and writes, shared by many threads.
+ *
+ *  Unlike the `input_file_t` and `output_file_t`, it doesn't keep a shared cursor for
+ *  the bulk of the I/O, so independent threads can fetch or dump disjoint byte ranges
+ *  concurrently, using `pread` and `pwrite` on POSIX, or `OVERLAPPED` I/O on Windows.
+ *  The sequential `read` and `write` calls still advance the `tell()` cursor,
+ *  for the small variable-length parts of the serialized representation.
+ *
+ * This class raises no exceptions and corresponds errors through `serialization_result_t`.
+ * The class automatically closes the file when the object is destroyed.
+ */
+class positional_file_t {
+    char const* path_ = nullptr;
+    bool writable_ = false;
+    std::size_t cursor_ = 0;
+#if defined(USEARCH_DEFINED_WINDOWS)
+    HANDLE handle_ = INVALID_HANDLE_VALUE;
+#else
+    int descriptor_ = -1;
+#endif
+
+  public:
+    /// @brief Upper bound on the number of bytes moved per thread with one system call.
+    static constexpr std::size_t chunk_bytes() { return 1024 * 1024; }
+
+    positional_file_t(char const* path, bool writable) noexcept : path_(path), writable_(writable) {}
+    ~positional_file_t() noexcept { close(); }
+    positional_file_t(positional_file_t&& other) noexcept
+        : path_(exchange(other.path_, nullptr)), writable_(other.writable_), cursor_(exchange(other.cursor_, 0)),
+#if defined(USEARCH_DEFINED_WINDOWS)
+          handle_(exchange(other.handle_, INVALID_HANDLE_VALUE))
+#else
+          descriptor_(exchange(other.descriptor_, -1))
+#endif
+    {
+    }
+    positional_file_t& operator=(positional_file_t&& other) noexcept {
+        std::swap(path_, other.path_);
+        std::swap(writable_, other.writable_);
+        std::swap(cursor_, other.cursor_);
+#if defined(USEARCH_DEFINED_WINDOWS)
+        std::swap(handle_, other.handle_);
+#else
+        std::swap(descriptor_, other.descriptor_);
+#endif
+        return *this;
+    }
+
+#if defined(USEARCH_DEFINED_WINDOWS)
+    explicit operator bool() const noexcept { return handle_ != INVALID_HANDLE_VALUE; }
+#else
+    explicit operator bool() const noexcept { return descriptor_ >= 0; }
+#endif
+
+    std::size_t tell() const noexcept { return cursor_; }
+    void seek_to(std::size_t offset) noexcept { cursor_ = offset; }
+
+    serialization_result_t open_if_not() noexcept {
+        serialization_result_t result;
+        if (*this)
+            return result;
+#if defined(USEARCH_DEFINED_WINDOWS)
+        if (writable_)
+            handle_ = CreateFile(path_, GENERIC_WRITE, 0, 0, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, 0);
+        else
+            handle_ = CreateFile(path_, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+        if (handle_ == INVALID_HANDLE_VALUE)
+            return result.failed("Opening file failed!");
+#else
+        descriptor_ = writable_ ? ::open(path_, O_WRONLY | O_CREAT | O_TRUNC, 0644) : ::open(path_, O_RDONLY);
+        if (descriptor_ < 0)
+            return result.failed(std::strerror(errno));
+#endif
+        cursor_ = 0;
+        return result;
+    }
+
+    void close() noexcept {
+#if defined(USEARCH_DEFINED_WINDOWS)
+        if (handle_ != INVALID_HANDLE_VALUE)
+            CloseHandle(exchange(handle_, INVALID_HANDLE_VALUE));
+#else
+        if (descriptor_ >= 0)
+            ::close(exchange(descriptor_, -1));
+#endif
+    }
+
+    /// @brief Reads exactly @p length bytes starting at @p offset, without touching the cursor.
+    serialization_result_t read_at(void* begin, std::size_t length, std::size_t offset) const noexcept {
+        serialization_result_t result;
+        char const* error = transfer_at_(begin, length, offset, false);
+        if (error)
+            return result.failed(error);
+        return result;
+    }
+
+    /// @brief Writes exactly @p length bytes starting at @p offset, without touching the cursor.
+    serialization_result_t write_at(void const* begin, std::size_t length, std::size_t offset) const noexcept {
+        serialization_result_t result;
+        char const* error = transfer_at_(const_cast<void*>(begin), length, offset, true);
+        if (error)
+            return result.failed(error);
+        return result;
+    }
+
+    serialization_result_t read(void* begin, std::size_t length) noexcept {
+        serialization_result_t result = read_at(begin, length, cursor_);
+        cursor_ += result ? length : 0;
+        return result;
+    }
+
+    serialization_result_t write(void const* begin, std::size_t length) noexcept {
+        serialization_result_t result = write_at(begin, length, cursor_);
+        cursor_ += result ? length : 0;
+        return result;
+    }
+
+    /**
+     *  @brief  Dumps @p count variable-length pieces back-to-back starting at the cursor, in parallel.
+     *
+     *  Consecutive pieces are grouped into chunks of up to `chunk_bytes()`, staged in a per-thread
+     *  buffer and written with a single system call. Pieces larger than that are written directly.
+     *
+     *  @param[in] piece Callback returning the `span_gt<byte_t>` of the piece with the given index.
+     *  @param[in] progress Callback receiving `processed` and `count`, only called from the first thread.
+     */
+    template <typename piece_at, typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t>
+    serialization_result_t write_pieces(std::size_t count, piece_at&& piece, executor_at&& executor = {},
+                                        progress_at&& progress = {}) noexcept {
+        return transfer_pieces_(count, piece, executor, progress, true);
+    }
+
+    /**
+     *  @brief  Symmetric to `write_pieces`, fills @p count pre-allocated pieces from the cursor onwards.
+     */
+    template <typename piece_at, typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t>
+    serialization_result_t read_pieces(std::size_t count, piece_at&& piece, executor_at&& executor = {},
+                                       progress_at&& progress = {}) noexcept {
+        return transfer_pieces_(count, piece, executor, progress, false);
+    }
+
+  private:
+    /// @brief Loops until all bytes are moved, as positional calls may be partial. Returns an error or `nullptr`.
+    char const* transfer_at_(void* begin, std::size_t length, std::size_t offset, bool writing) const noexcept {
+        byte_t* bytes = reinterpret_cast<byte_t*>(begin);
+        while (length) {
+#if defined(USEARCH_DEFINED_WINDOWS)
+            OVERLAPPED overlapped{};
+            overlapped.Offset = static_cast<DWORD>(offset & 0xFFFFFFFFull);
+            overlapped.OffsetHigh = static_cast<DWORD>(static_cast<std::uint64_t>(offset) >> 32);
+            DWORD step = static_cast<DWORD>((std::min<std::size_t>)(length, 1ull << 30));
+            DWORD moved = 0;
+            BOOL succeeded = writing ? WriteFile(handle_, bytes, step, &moved, &overlapped)
+                                     : ReadFile(handle_, bytes, step, &moved, &overlapped);
+            if (!succeeded)
+                return writing ? "Writing file failed!" : "Reading file failed!";
+#else
+            ssize_t moved = writing ? ::pwrite(descriptor_, bytes, length, static_cast<off_t>(offset))
+                                    : ::pread(descriptor_, bytes, length, static_cast<off_t>(offset));
+            if (moved < 0 && errno == EINTR)
+                continue;
+            if (moved < 0)
+                return std::strerror(errno);
+#endif
+            if (moved == 0)
+                return "End of file reached!";
+            bytes += moved;
+            length -= static_cast<std::size_t>(moved);
+            offset += static_cast<std::size_t>(moved);
+        }
+        return nullptr;
+    }
+
+    template <typename piece_at, typename executor_at, typename progress_at>
+    serialization_result_t transfer_pieces_(std::size_t count, piece_at& piece, executor_at& executor,
+                                            progress_at& progress, bool writing) noexcept {
+
+        serialization_result_t result;
+        if (!count)
+            return result;
+
+        // Split the pieces into chunks, remembering the first piece and the file offset of each
+        std::size_t chunks_count = 0;
+        for (std::size_t i = 0, chunk_length = 0; i != count; ++i) {
+            std::size_t length = piece(i).size();
+            if (!i || chunk_length + length > chunk_bytes())
+                ++chunks_count, chunk_length = 0;
+            chunk_length += length;
+        }
+        buffer_gt<std::size_t> chunk_firsts(chunks_count + 1);
+        buffer_gt<std::size_t> chunk_offsets(chunks_count + 1);
+        buffer_gt<byte_t> staging(executor.size() * chunk_bytes());
+        if (!chunk_firsts || !chunk_offsets || !staging)
+            return result.failed("Out of memory");
+        for (std::size_t i = 0, chunk_idx = 0, chunk_length = 0, offset = cursor_; i != count; ++i) {
+            std::size_t length = piece(i).size();
+            if (!i || chunk_length + length > chunk_bytes())
+                chunk_firsts[chunk_idx] = i, chunk_offsets[chunk_idx] = offset, ++chunk_idx, chunk_length = 0;
+            chunk_length += length;
+            offset += length;
+            chunk_offsets[chunks_count] = offset;
+        }
+        chunk_firsts[chunks_count] = count;
+
+        std::atomic<char const*> error{nullptr};
+        std::atomic<std::size_t> processed{0};
+        executor.dynamic(chunks_count, [&](std::size_t thread, std::size_t chunk_idx) {
+            std::size_t first = chunk_firsts[chunk_idx], last = chunk_firsts[chunk_idx + 1];
+            std::size_t offset = chunk_offsets[chunk_idx], length = chunk_offsets[chunk_idx + 1] - offset;
+            char const* failure = nullptr;
+            if (last - first == 1) {
+                failure = transfer_at_(piece(first).data(), length, offset, writing);
+            } else {
+                byte_t* stage = staging.data() + thread * chunk_bytes();
+                if (writing)
+                    for (std::size_t i = first, shift = 0; i != last; shift += piece(i).size(), ++i)
+                        std::memcpy(stage + shift, piece(i).data(), piece(i).size());
+                failure = transfer_at_(stage, length, offset, writing);
+                if (!writing && !failure)
+                    for (std::size_t i = first, shift = 0; i != last; shift += piece(i).size(), ++i)
+                        std::memcpy(piece(i).data(), stage + shift, piece(i).size());
+            }
+            if (failure)
+                error.store(failure);
+            std::size_t done = processed.fetch_add(last - first) + last - first;
+            if (thread == 0 && !progress(done, count))
+                error.store("Terminated by user");
+            return error.load() == nullptr;
+        });
+
+        if (char const* failure = error.load())
+            return result.failed(failure);
+        cursor_ = chunk_offsets[chunks_count];
+        return result;
+    }
+};
+
+/**
+ *  @brief  Kind of pages backing the anonymous memory. Randomly traversed graphs of
+ *          many gigabytes miss the TLB on almost every hop with regular 4 KB pages.
+ */
+enum class huge_pages_t {
+    none_k = 0,     ///< Regular pages.
+    transparent_k,  ///< Regular pages, advised to be collapsed into huge pages by the kernel.
+    explicit_2mb_k, ///< Pages from the reserved 2 MB pool, falling back to `transparent_k`.
+    explicit_1gb_k, ///< Pages from the reserved 1 GB pool, falling back to `transparent_k`.
+};
+
+/**
+ *  @brief  Distribution of the anonymous memory across the NUMA nodes.
+ */
+enum class numa_policy_t {
+    default_k = 0, ///< Pages land on the node of the thread touching them first.
+    interleave_k,  ///< Pages are spread round-robin across all the nodes.
+    bind_k,        ///< Pages land on `memory_placement_t::numa_node`.
+};
+
+/**
+ *  @brief  Placement of the anonymous memory pages, applied on a best-effort basis,
+ *          so that unsupported requests fall back to regular pages. Only affects Linux.
+ */
+struct memory_placement_t {
+    huge_pages_t huge_pages = huge_pages_t::none_k;
+    numa_policy_t numa_policy = numa_policy_t::default_k;
+    std::size_t numa_node = 0;
+
+    bool is_default() const noexcept {
+        return huge_pages == huge_pages_t::none_k && numa_policy == numa_policy_t::default_k;
+    }
+};
+
+/**
+ *  @brief  Number of NUMA nodes in the system, or one, if it can't be determined.
+ *          The topology is read once per process, as it's queried on every interleaved allocation.
+ */
+inline std::size_t numa_nodes_count() noexcept {
+#if defined(USEARCH_DEFINED_LINUX)
+    static std::size_t const count = []() noexcept -> std::size_t {
+        // The file lists ranges like "0-3" or "0,2-3", and the last number is the highest node.
+        std::FILE* file = std::fopen("/sys/devices/system/node/online", "r");
+        if (!file)
+            return 1;
+        std::size_t highest = 0, current = 0;
+        for (int character = std::fgetc(file); character != EOF; character = std::fgetc(file)) {
+            if (character >= '0' && character <= '9')
+                current = current * 10 + static_cast<std::size_t>(character - '0');
+            else
+                highest = current, current = 0;
+        }
+        std::fclose(file);
+        return (std::max)(highest, current) + 1;
+    }();
+    return count;
+#else
+    return 1;
+#endif
+}
+
+/**
+ *  @brief  NUMA node of the core the calling thread is running on, to pick the closest replica.
+ */
+inline std::size_t numa_node_current() noexcept {
+#if defined(USEARCH_DEFINED_LINUX) && defined(SYS_getcpu)
+    unsigned cpu = 0, node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+        return node;
+#endif
+    return 0;
+}
+
+/**
+ *  @brief  Allocates whole pages directly from the OS, following the given `memory_placement_t`.
+ *          Stateless, except for the placement, so allocations can be freed by any copy.
+ */
+class page_allocator_t {
+    memory_placement_t placement_{};
+
+  public:
+    static constexpr std::size_t page_size() { return 4096; }
+
+    page_allocator_t() = default;
+    explicit page_allocator_t(memory_placement_t placement) noexcept : placement_(placement) {}
+
+    memory_placement_t placement() const noexcept { return placement_; }
+
+    /**
+     *  @brief  Granularity of allocations, that are rounded up to the whole huge pages,
+     *          if those are explicitly requested. Those can't be partially unmapped.
+     */
+    std::size_t granularity() const noexcept {
+        switch (placement_.huge_pages) {
+        case huge_pages_t::explicit_2mb_k: return 2ul << 20;
+        case huge_pages_t::explicit_1gb_k: return 1ul << 30;
+        default: return page_size();
+        }
+    }
+
+    /**
+     *  @brief Allocates an @b uninitialized block of memory of the specified size.
+     *  @param count_bytes The number of bytes to allocate.
+     *  @return A pointer to the allocated memory block, or `nullptr` if allocation fails.
+     */
+    byte_t* allocate(std::size_t count_bytes) const noexcept {
+        count_bytes = divide_round_up(count_bytes, granularity()) * granularity();
+#if defined(USEARCH_DEFINED_WINDOWS)
+        return (byte_t*)(::VirtualAlloc(NULL, count_bytes, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+#else
+        void* result = MAP_FAILED;
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+        // The reserved pools are often empty, in which case the mapping fails right away
+        if (granularity() != page_size()) {
+            int size_flag = placement_.huge_pages == huge_pages_t::explicit_2mb_k ? (21 << MAP_HUGE_SHIFT)
+                                                                                  : (30 << MAP_HUGE_SHIFT);
+            result = mmap(NULL, count_bytes, PROT_WRITE | PROT_READ,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | size_flag, -1, 0);
+        }
+#endif
+        if (result == MAP_FAILED) {
+            result = mmap(NULL, count_bytes, PROT_WRITE | PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (result == MAP_FAILED)
+                return nullptr;
+#if defined(MADV_HUGEPAGE)
+            if (placement_.huge_pages != huge_pages_t::none_k)
+                madvise(result, count_bytes, MADV_HUGEPAGE);
+#endif
+        }
+        bind_(result, count_bytes);
+        return (byte_t*)result;
+#endif
+    }
+
+    void deallocate(byte_t* page_pointer, std::size_t count_bytes) const noexcept {
+#if defined(USEARCH_DEFINED_WINDOWS)
+        ::VirtualFree(page_pointer, 0, MEM_RELEASE);
+#else
+        count_bytes = divide_round_up(count_bytes, granularity()) * granularity();
+        munmap(page_pointer, count_bytes);
+#endif
+    }
+
+  private:
+    /**
+     *  @brief  Applies the NUMA policy to the untouched pages, so that they are placed on their first access.
+     *          Issues the system call directly, not to depend on `libnuma`.
+     */
+    void bind_(void* pages, std::size_t count_bytes) const noexcept {
+#if defined(USEARCH_DEFINED_LINUX) && defined(SYS_mbind)
+        constexpr int mpol_bind_k = 2, mpol_interleave_k = 3; // From `<linux/mempolicy.h>`
+        constexpr std::size_t mask_bits_k = 1024, bits_per_word_k = sizeof(unsigned long) * CHAR_BIT;
+        unsigned long mask[mask_bits_k / bits_per_word_k] = {};
+        int mode;
+        switch (placement_.numa_policy) {
+        case numa_policy_t::interleave_k: {
+            std::size_t const nodes = (std::min)(numa_nodes_count(), mask_bits_k);
+            for (std::size_t node = 0; node != nodes; ++node)
+                mask[node / bits_per_word_k] |= 1ul << (node % bits_per_word_k);
+            mode = mpol_interleave_k;
+        } break;
+        case numa_policy_t::bind_k:
+            if (placement_.numa_node >= mask_bits_k)
+                return;
+            mask[placement_.numa_node / bits_per_word_k] |= 1ul << (placement_.numa_node % bits_per_word_k);
+            mode = mpol_bind_k;
+            break;
+        default: return;
+        }
+        // The kernel historically ignores the last bit of `maxnode`, so we pass one more
+        syscall(SYS_mbind, pages, count_bytes, mode, &mask[0], mask_bits_k + 1, 0u);
+#else
+        (void)pages, (void)count_bytes;
+#endif
+    }
+};
+
 /**
  *  @brief  Represents a memory-mapped file or a pre-allocated anonymous memory region.
  *
  *  This class provides a convenient way to memory-map a file and access its contents as a block of
  *  memory. The class handles platform-specific memory-mapping operations on Windows, Linux, and MacOS.
  *  The class automatically closes the file when the object is destroyed.
+ *
+ *  If a non-default `memory_placement_t` is passed, the file is read into a private replica instead,
+ *  as the shared page cache can't be placed on a specific NUMA node or backed by huge pages.
  */
 class memory_mapped_file_t {
-    char const* path_{}; /**< The path to the file to be memory-mapped. */
-    void* ptr_{};        /**< A pointer to the memory-mapping. */
-    size_t length_{};    /**< The length of the memory-mapped file in bytes. */
+    char const* path_{};              /**< The path to the file to be memory-mapped. */
+    void* ptr_{};                     /**< A pointer to the memory-mapping. */
+    size_t length_{};                 /**< The length of the memory-mapped file in bytes. */
+    memory_placement_t placement_{}; /**< The placement of the private replica, if any. */
 
 #if defined(USEARCH_DEFINED_WINDOWS)
     HANDLE file_handle_{};    /**< The file handle on Windows. */
@@ -1466,10 +2097,12 @@ class memory_mapped_file_t {
 
     memory_mapped_file_t() noexcept {}
     memory_mapped_file_t(char const* path) noexcept : path_(path) {}
+    memory_mapped_file_t(char const* path, memory_placement_t placement) noexcept
+        : path_(path), placement_(placement) {}
     ~memory_mapped_file_t() noexcept { close(); }
     memory_mapped_file_t(memory_mapped_file_t&& other) noexcept
         : path_(exchange(other.path_, nullptr)), ptr_(exchange(other.ptr_, nullptr)),
-          length_(exchange(other.length_, 0)),
+          length_(exchange(other.length_, 0)), placement_(other.placement_),
 #if defined(USEARCH_DEFINED_WINDOWS)
           file_handle_(exchange(other.file_handle_, nullptr)), mapping_handle_(exchange(other.mapping_handle_, nullptr))
 #else
@@ -1484,6 +2117,7 @@ class memory_mapped_file_t {
         std::swap(path_, other.path_);
         std::swap(ptr_, other.ptr_);
         std::swap(length_, other.length_);
+        std::swap(placement_, other.placement_);
 #if defined(USEARCH_DEFINED_WINDOWS)
         std::swap(file_handle_, other.file_handle_);
         std::swap(mapping_handle_, other.mapping_handle_);
@@ -1540,6 +2174,9 @@ class memory_mapped_file_t {
             return result.failed(std::strerror(errno));
         }
 
+        if (!placement_.is_default())
+            return open_replica_(descriptor, static_cast<std::size_t>(file_stat.st_size));
+
         // Map the entire file
         byte_t* file = (byte_t*)mmap(NULL, file_stat.st_size, PROT_READ, MAP_SHARED, descriptor, 0);
         if (file == MAP_FAILED) {
@@ -1566,22 +2203,82 @@ class memory_mapped_file_t {
         mapping_handle_ = nullptr;
         file_handle_ = nullptr;
 #else
-        munmap(ptr_, length_);
-        ::close(file_descriptor_);
+        if (placement_.is_default()) {
+            munmap(ptr_, length_);
+            ::close(file_descriptor_);
+        } else if (ptr_)
+            page_allocator_t(placement_).deallocate(data(), length_);
         file_descriptor_ = 0;
 #endif
         ptr_ = nullptr;
         length_ = 0;
     }
-};
 
-struct index_serialized_header_t {
-    std::uint64_t size = 0;
-    std::uint64_t connectivity = 0;
-    std::uint64_t connectivity_base = 0;
-    std::uint64_t max_level = 0;
-    std::uint64_t entry_slot = 0;
-};
+    /**
+     *  @brief  Disables the kernel read-ahead for the mapped file. Random accesses to files larger
+     *          than RAM would otherwise pull in and evict many pages that are never used.
+     */
+    void advise_random() noexcept {
+#if !defined(USEARCH_DEFINED_WINDOWS)
+        if (path_ && ptr_ && placement_.is_default())
+            madvise(ptr_, length_, MADV_RANDOM);
+#endif
+    }
+
+    /**
+     *  @brief  Asks the kernel to asynchronously read the pages of a mapped range into the page cache,
+     *          so that the following accesses don't block on synchronous page faults.
+     *          Requests from multiple threads overlap, keeping the storage queues busy.
+     */
+    static void advise_willneed(void const* begin, std::size_t length) noexcept {
+#if !defined(USEARCH_DEFINED_WINDOWS)
+        static std::size_t const page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        std::uintptr_t const first = reinterpret_cast<std::uintptr_t>(begin) & ~(page_size - 1);
+        std::uintptr_t const last = reinterpret_cast<std::uintptr_t>(begin) + length;
+        madvise(reinterpret_cast<void*>(first), static_cast<std::size_t>(last - first), MADV_WILLNEED);
+#else
+        (void)begin, (void)length;
+#endif
+    }
+
+  private:
+#if !defined(USEARCH_DEFINED_WINDOWS)
+    /**
+     *  @brief  Reads the whole file into the anonymous pages allocated with the `placement_`,
+     *          taking ownership of the ::descriptor and closing it.
+     */
+    serialization_result_t open_replica_(int descriptor, std::size_t length) noexcept {
+        serialization_result_t result;
+        byte_t* replica = page_allocator_t(placement_).allocate(length);
+        if (!replica) {
+            ::close(descriptor);
+            return result.failed("Allocating the replica failed!");
+        }
+        for (std::size_t offset = 0; offset != length;) {
+            ssize_t read_bytes = ::pread(descriptor, replica + offset, length - offset, static_cast<off_t>(offset));
+            if (read_bytes <= 0) {
+                char const* message = read_bytes ? std::strerror(errno) : "End of file reached!";
+                page_allocator_t(placement_).deallocate(replica, length);
+                ::close(descriptor);
+                return result.failed(message);
+            }
+            offset += static_cast<std::size_t>(read_bytes);
+        }
+        ::close(descriptor);
+        ptr_ = replica;
+        length_ = length;
+        return result;
+    }
+#endif
+};
+
+struct index_serialized_header_t {
+    std::uint64_t size = 0;
+    std::uint64_t connectivity = 0;
+    std::uint64_t connectivity_base = 0;
+    std::uint64_t max_level = 0;
+    std::uint64_t entry_slot = 0;
+};
 
 using default_key_t = std::uint64_t;
 using default_slot_t = std::uint32_t;
@@ -1753,6 +2450,23 @@ class index_gt {
     using member_iterator_t = member_iterator_gt<member_ref_t, index_gt>;
     using member_citerator_t = member_iterator_gt<member_cref_t, index_gt const>;
 
+    /**
+     *  @brief  Non-owning batch of gathered slots, addressed like an array of `member_citerator_t`.
+     *          Passed to metrics, that can score one value against many entries in a single call.
+     */
+    class members_batch_t {
+        index_gt const* index_{};
+        compressed_slot_t const* slots_{};
+        std::size_t count_{};
+
+      public:
+        members_batch_t(index_gt const& index, compressed_slot_t const* slots, std::size_t count) noexcept
+            : index_(&index), slots_(slots), count_(count) {}
+
+        std::size_t size() const noexcept { return count_; }
+        member_citerator_t operator[](std::size_t i) const noexcept { return index_->citerator_at(slots_[i]); }
+    };
+
     // STL compatibility:
     using value_type = vector_key_t;
     using allocator_type = dynamic_allocator_t;
@@ -1800,6 +2514,9 @@ class index_gt {
         double inverse_log_connectivity{};
         std::size_t neighbors_bytes{};
         std::size_t neighbors_base_bytes{};
+        /// @brief Bytes of the base-level list stored inside of every node, zero once those are `compress`-ed.
+        std::size_t node_base_bytes{};
+        std::size_t vector_bytes{};
     };
     /// @brief A space-efficient internal data-structure used in graph traversal queues.
     struct candidate_t {
@@ -1807,11 +2524,35 @@ class index_gt {
         compressed_slot_t slot;
         inline bool operator<(candidate_t other) const noexcept { return distance < other.distance; }
     };
+    /// @brief Tracks the closest known member for one of the queries in a batch.
+    struct batch_entry_t {
+        std::size_t query;
+        std::size_t slot;
+        distance_t distance;
+        bool pending; //< The neighbors of `slot` are yet to be scored against this query on the current level
+    };
+
+    /// @brief An atomic counter, wrapped to be stored in a `buffer_gt` without clashing with `std::destroy_at`.
+    struct atomic_counter_t {
+        std::atomic<std::size_t> value;
+    };
+
+    /// @brief A link to be added from `target` back to `source` on the given `level`.
+    struct reverse_link_t {
+        compressed_slot_t source;
+        compressed_slot_t target;
+        distance_t distance;
+        level_t level;
+    };
 
     using candidates_view_t = span_gt<candidate_t const>;
     using candidates_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<candidate_t>;
     using top_candidates_t = sorted_buffer_gt<candidate_t, std::less<candidate_t>, candidates_allocator_t>;
     using next_candidates_t = max_heap_gt<candidate_t, std::less<candidate_t>, candidates_allocator_t>;
+    using slots_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<compressed_slot_t>;
+    using bytes_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<byte_t>;
+    using offsets_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<std::size_t>;
+    using reverse_links_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<reverse_link_t>;
 
     /**
      *  @brief  A loosely-structured handle for every node. One such node is created for every member.
@@ -1878,6 +2619,19 @@ class index_gt {
             misaligned_store<compressed_slot_t>(tape_ + shift(n), slot);
             misaligned_store<neighbors_count_t>(tape_, n + 1);
         }
+        /// @brief  Keeps only the slots matching the @p predicate in their order, returning the number dropped.
+        template <typename predicate_at> std::size_t retain(predicate_at&& predicate) noexcept {
+            neighbors_count_t n = misaligned_load<neighbors_count_t>(tape_);
+            neighbors_count_t kept = 0;
+            for (neighbors_count_t i = 0; i != n; ++i) {
+                compressed_slot_t slot = misaligned_load<compressed_slot_t>(tape_ + shift(i));
+                if (predicate(slot))
+                    misaligned_store<compressed_slot_t>(tape_ + shift(kept++), slot);
+            }
+            std::memset(tape_ + shift(kept), 0, shift(n) - shift(kept));
+            misaligned_store<neighbors_count_t>(tape_, kept);
+            return n - kept;
+        }
     };
 
     /**
@@ -1889,10 +2643,47 @@ class index_gt {
         top_candidates_t top_candidates{};
         next_candidates_t next_candidates{};
         visits_hash_set_t visits{};
+        buffer_gt<compressed_slot_t, slots_allocator_t> neighbors_snapshot{};
+        /// @brief  Copy of the links of a node being updated, to form the reverse links without its lock.
+        buffer_gt<compressed_slot_t, slots_allocator_t> updated_neighbors{};
+        /// @brief  Room for two base-level lists, decoded by the searches of a `compress`-ed index.
+        buffer_gt<byte_t, bytes_allocator_t> decoded_neighbors{};
         std::default_random_engine level_generator{};
         std::size_t iteration_cycles{};
         std::size_t computed_distances_count{};
 
+#if USEARCH_USE_INSTRUMENTATION
+        /// @brief  Counters written only by the owning thread with relaxed stores,
+        ///         so that `instrumentation()` can read them at any time without locked instructions.
+        struct instruments_t {
+            std::atomic<std::size_t> hops_per_level[index_instrumentation_t::levels()];
+            std::atomic<std::size_t> missed_candidates;
+            std::atomic<std::size_t> reused_candidates;
+            std::atomic<std::size_t> distance_nanoseconds;
+
+            instruments_t() noexcept { reset(); }
+            void reset() noexcept {
+                for (std::atomic<std::size_t>& hops : hops_per_level)
+                    hops.store(0, std::memory_order_relaxed);
+                missed_candidates.store(0, std::memory_order_relaxed);
+                reused_candidates.store(0, std::memory_order_relaxed);
+                distance_nanoseconds.store(0, std::memory_order_relaxed);
+            }
+
+            static void bump(std::atomic<std::size_t>& counter, std::size_t delta) noexcept {
+                counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+            }
+            void hop(std::size_t level) noexcept {
+                bump(hops_per_level[(std::min)(level, index_instrumentation_t::levels() - 1)], 1);
+            }
+            void miss(std::size_t count = 1) noexcept { bump(missed_candidates, count); }
+            void reuse(std::size_t count = 1) noexcept { bump(reused_candidates, count); }
+            void time(std::uint64_t started) noexcept {
+                bump(distance_nanoseconds, static_cast<std::size_t>(instrumentation_nanoseconds() - started));
+            }
+        } instruments;
+#endif
+
         template <typename value_at, typename metric_at, typename entry_at> //
         inline distance_t measure(value_at const& first, entry_at const& second, metric_at&& metric) noexcept {
             static_assert( //
@@ -1900,7 +2691,10 @@ class index_gt {
                 "Unexpected type");
 
             computed_distances_count++;
-            return metric(first, second);
+            usearch_instrument_m(std::uint64_t const started = instrumentation_nanoseconds());
+            distance_t result = metric(first, second);
+            usearch_instrument_m(instruments.time(started));
+            return result;
         }
 
         template <typename metric_at, typename entry_at> //
@@ -1910,7 +2704,67 @@ class index_gt {
                 "Unexpected type");
 
             computed_distances_count++;
-            return metric(first, second);
+            usearch_instrument_m(std::uint64_t const started = instrumentation_nanoseconds());
+            distance_t result = metric(first, second);
+            usearch_instrument_m(instruments.time(started));
+            return result;
+        }
+
+        /// @brief  Scores several values against the same entry, loading it once.
+        ///         Forwards to a batched metric overload if one is available.
+        template <typename value_at, typename metric_at, typename entry_at> //
+        inline void measure_many(value_at const* firsts, std::size_t count, entry_at const& second, metric_at&& metric,
+                                 distance_t* results) noexcept {
+            static_assert( //
+                std::is_same<entry_at, member_cref_t>::value || std::is_same<entry_at, member_citerator_t>::value,
+                "Unexpected type");
+
+            computed_distances_count += count;
+            using batched_t =
+                std::integral_constant<bool, has_many_to_one<metric_at, value_at, entry_at, distance_t>()>;
+            usearch_instrument_m(std::uint64_t const started = instrumentation_nanoseconds());
+            measure_many_(firsts, count, second, metric, results, batched_t{});
+            usearch_instrument_m(instruments.time(started));
+        }
+
+        /// @brief  Scores the same value against a batch of entries, dispatching once per batch.
+        ///         Forwards to a one-to-many metric overload if one is available.
+        template <typename value_at, typename metric_at, typename batch_at> //
+        inline void measure_batch(value_at const& first, batch_at const& seconds, metric_at&& metric,
+                                  distance_t* results) noexcept {
+            computed_distances_count += seconds.size();
+            using batched_t =
+                std::integral_constant<bool, has_one_to_many<metric_at, value_at, batch_at, distance_t>()>;
+            usearch_instrument_m(std::uint64_t const started = instrumentation_nanoseconds());
+            measure_batch_(first, seconds, metric, results, batched_t{});
+            usearch_instrument_m(instruments.time(started));
+        }
+
+      private:
+        template <typename value_at, typename metric_at, typename batch_at> //
+        inline void measure_batch_(value_at const& first, batch_at const& seconds, metric_at& metric,
+                                   distance_t* results, std::true_type) noexcept {
+            metric(first, seconds, results);
+        }
+
+        template <typename value_at, typename metric_at, typename batch_at> //
+        inline void measure_batch_(value_at const& first, batch_at const& seconds, metric_at& metric,
+                                   distance_t* results, std::false_type) noexcept {
+            for (std::size_t i = 0; i != seconds.size(); ++i)
+                results[i] = metric(first, seconds[i]);
+        }
+
+        template <typename value_at, typename metric_at, typename entry_at> //
+        inline void measure_many_(value_at const* firsts, std::size_t count, entry_at const& second, metric_at& metric,
+                                  distance_t* results, std::true_type) noexcept {
+            metric(firsts, count, second, results);
+        }
+
+        template <typename value_at, typename metric_at, typename entry_at> //
+        inline void measure_many_(value_at const* firsts, std::size_t count, entry_at const& second, metric_at& metric,
+                                  distance_t* results, std::false_type) noexcept {
+            for (std::size_t i = 0; i != count; ++i)
+                results[i] = metric(firsts[i], second);
         }
     };
 
@@ -1923,6 +2777,10 @@ class index_gt {
     precomputed_constants_t pre_{};
     memory_mapped_file_t viewed_file_{};
 
+    /// @brief  Base-level neighbors lists packed by `compress`, and their offsets per slot with a trailing end.
+    buffer_gt<byte_t, bytes_allocator_t> compressed_neighbors_{};
+    buffer_gt<std::size_t, offsets_allocator_t> compressed_offsets_{};
+
     /// @brief  Number of "slots" available for `node_t` objects. Equals to @b `limits_.members`.
     usearch_align_m mutable std::atomic<std::size_t> nodes_capacity_{};
 
@@ -1952,14 +2810,50 @@ class index_gt {
     /// @brief  Array of thread-specific buffers for temporary data.
     mutable buffer_gt<context_t, contexts_allocator_t> contexts_{};
 
+#if USEARCH_USE_INSTRUMENTATION
+    /// @brief  Shared instrumentation, only updated on contention or once per query.
+    mutable std::atomic<std::size_t> node_lock_waits_{0};
+    mutable std::atomic<std::size_t> node_lock_wait_nanoseconds_{0};
+    mutable log2_histogram_t latency_histogram_{};
+    mutable log2_histogram_t hops_histogram_{};
+    mutable log2_histogram_t distances_histogram_{};
+#endif
+
+    /// @brief  Point-in-time state of the graph, kept consistent by copying nodes aside before they change.
+    struct snapshot_state_t {
+        std::size_t size{};
+        level_t max_level{};
+        std::size_t entry_slot{};
+        /// @brief  Either the live node, or its preserved copy, for every slot below `size`.
+        /// Only accessed under the node locks, so it needn't be atomic.
+        buffer_gt<byte_t*> nodes{};
+        /// @brief  Set if a node couldn't be preserved, invalidating the snapshot.
+        std::atomic<bool> failed{false};
+        std::mutex tape_mutex{};
+        tape_allocator_t tape{};
+    };
+
+    /// @brief  The active snapshot, if any, shared with all the writers.
+    std::atomic<snapshot_state_t*> snapshot_{nullptr};
+
   public:
     std::size_t connectivity() const noexcept { return config_.connectivity; }
     std::size_t capacity() const noexcept { return nodes_capacity_; }
     std::size_t size() const noexcept { return nodes_count_; }
     std::size_t max_level() const noexcept { return nodes_count_ ? static_cast<std::size_t>(max_level_) : 0; }
     index_config_t const& config() const noexcept { return config_; }
+
+    /**
+     *  @brief Pointer to the `config().vector_bytes` co-located with the node in the given ::slot.
+     *         Invalidated by `compact()`, `reorder()`, `copy()`, and serialization.
+     */
+    byte_t* vector_at(std::size_t slot) const noexcept { return node_vector_(node_at_(slot)); }
+
+    /// @brief Memory range of the node in the given ::slot, including the neighbors on all of its levels.
+    span_gt<byte_t> node_bytes_at(std::size_t slot) const noexcept { return node_bytes_(node_at_(slot)); }
     index_limits_t const& limits() const noexcept { return limits_; }
-    bool is_immutable() const noexcept { return bool(viewed_file_); }
+    bool is_immutable() const noexcept { return bool(viewed_file_) || is_compressed(); }
+    bool is_compressed() const noexcept { return bool(compressed_offsets_); }
 
     /**
      *  @section Exceptions
@@ -2006,8 +2900,17 @@ class index_gt {
 
         // Now all is left - is to allocate new `node_t` instances and populate
         // the `other.nodes_` array into it.
-        for (std::size_t i = 0; i != nodes_count_; ++i)
-            other.nodes_[i] = other.node_make_copy_(node_bytes_(nodes_[i]));
+        for (std::size_t i = 0; i != nodes_count_; ++i) {
+            if (!is_compressed()) {
+                other.nodes_[i] = other.node_make_copy_(node_bytes_(nodes_[i]));
+                continue;
+            }
+            // Compressed lists are expanded back, so that the copy is mutable
+            span_bytes_t node_bytes = other.node_malloc_(nodes_[i].level());
+            if (node_bytes)
+                node_export_(i, node_bytes.data());
+            other.nodes_[i] = node_t{node_bytes.data()};
+        }
 
         other.nodes_count_ = nodes_count_.load();
         other.max_level_ = max_level_;
@@ -2042,6 +2945,7 @@ class index_gt {
      *  Will keep the number of available threads/contexts the same as it was.
      */
     void clear() noexcept {
+        snapshot_end();
         if (!has_reset<tape_allocator_t>()) {
             std::size_t n = nodes_count_;
             for (std::size_t i = 0; i != n; ++i)
@@ -2051,6 +2955,11 @@ class index_gt {
         nodes_count_ = 0;
         max_level_ = -1;
         entry_slot_ = 0u;
+
+        // Without any nodes, the regular layout can be restored
+        compressed_neighbors_ = {};
+        compressed_offsets_ = {};
+        pre_.node_base_bytes = pre_.neighbors_base_bytes;
     }
 
     /**
@@ -2069,7 +2978,7 @@ class index_gt {
         limits_ = index_limits_t{0, 0};
         nodes_capacity_ = 0;
         viewed_file_ = memory_mapped_file_t{};
-        tape_allocator_ = {};
+        tape_allocator_ = tape_allocator_t(tape_allocator_);
     }
 
     /**
@@ -2082,11 +2991,14 @@ class index_gt {
         std::swap(tape_allocator_, other.tape_allocator_);
         std::swap(pre_, other.pre_);
         std::swap(viewed_file_, other.viewed_file_);
+        std::swap(compressed_neighbors_, other.compressed_neighbors_);
+        std::swap(compressed_offsets_, other.compressed_offsets_);
         std::swap(max_level_, other.max_level_);
         std::swap(entry_slot_, other.entry_slot_);
         std::swap(nodes_, other.nodes_);
         std::swap(nodes_mutexes_, other.nodes_mutexes_);
         std::swap(contexts_, other.contexts_);
+        snapshot_ = other.snapshot_.exchange(snapshot_.load());
 
         // Non-atomic parts.
         std::size_t capacity_copy = nodes_capacity_;
@@ -2103,6 +3015,8 @@ class index_gt {
      */
     bool reserve(index_limits_t limits) usearch_noexcept_m {
 
+        // Never drop the nodes in use, even if asked for less, like by the count of the entries left after removals
+        limits.members = (std::max)(limits.members, size());
         if (limits.threads_add <= limits_.threads_add          //
             && limits.threads_search <= limits_.threads_search //
             && limits.members <= limits_.members)
@@ -2113,6 +3027,8 @@ class index_gt {
         buffer_gt<context_t, contexts_allocator_t> new_contexts(limits.threads());
         if (!new_nodes || !new_contexts || !new_mutexes)
             return false;
+        if (is_compressed() && !reserve_decoded_neighbors_(new_contexts))
+            return false;
 
         // Move the nodes info, and deallocate previous buffers.
         if (nodes_)
@@ -2144,6 +3060,57 @@ class index_gt {
         }
     };
 
+    struct range_search_result_t {
+        error_t error{};
+        std::size_t count{};
+        std::size_t visited_members{};
+        std::size_t computed_distances{};
+
+        explicit operator bool() const noexcept { return !error; }
+        range_search_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+    };
+
+    struct repair_result_t {
+        error_t error{};
+        std::size_t repaired_links{};
+        std::size_t computed_distances{};
+
+        explicit operator bool() const noexcept { return !error; }
+        repair_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+    };
+
+    struct build_result_t {
+        error_t error{};
+        std::size_t new_size{};
+        std::size_t visited_members{};
+        std::size_t computed_distances{};
+
+        explicit operator bool() const noexcept { return !error; }
+        build_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+    };
+
+    struct merge_result_t {
+        error_t error{};
+        std::size_t new_size{};
+        std::size_t visited_members{};
+        std::size_t computed_distances{};
+
+        explicit operator bool() const noexcept { return !error; }
+        merge_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+    };
+
     /// @brief  Describes a matched search result, augmenting `member_cref_t`
     ///         contents with `distance` to the query object.
     struct match_t {
@@ -2319,6 +3286,11 @@ class index_gt {
             return result.failed("Out of memory!");
         if (!next.reserve(config.expansion))
             return result.failed("Out of memory!");
+        if (config.optimistic && context.neighbors_snapshot.size() < connectivity_max) {
+            context.neighbors_snapshot = buffer_gt<compressed_slot_t, slots_allocator_t>(connectivity_max);
+            if (!context.neighbors_snapshot)
+                return result.failed("Out of memory!");
+        }
 
         // Determining how much memory to allocate for the node depends on the target level
         std::unique_lock<std::mutex> new_level_lock(global_mutex_);
@@ -2434,127 +3406,872 @@ class index_gt {
             return result.failed("Out of memory!");
         if (!next.reserve(config.expansion))
             return result.failed("Out of memory!");
+        if (config.optimistic && context.neighbors_snapshot.size() < connectivity_max) {
+            context.neighbors_snapshot = buffer_gt<compressed_slot_t, slots_allocator_t>(connectivity_max);
+            if (!context.neighbors_snapshot)
+                return result.failed("Out of memory!");
+        }
+        if (context.updated_neighbors.size() < connectivity_max) {
+            context.updated_neighbors = buffer_gt<compressed_slot_t, slots_allocator_t>(connectivity_max);
+            if (!context.updated_neighbors)
+                return result.failed("Out of memory!");
+        }
 
-        node_lock_t new_lock = node_lock_(old_slot);
+        // Descend to the level of the node before locking it, as the greedy search may pass through it
         node_t node = node_at_(old_slot);
-
         level_t node_level = node.level();
-        span_bytes_t node_bytes = node_bytes_(node);
-        std::memset(node_bytes.data(), 0, node_bytes.size());
-        node.level(node_level);
+        level_t entry_level = (std::min)(node_level, max_level_);
+        std::size_t entry_slot = search_for_one_(value, metric, prefetch, entry_slot_, max_level_, entry_level,
+                                                 context, config.prefetch_depth);
+
+        // Unlike a new node, this one stays reachable through its old incoming links, so its lock is
+        // only held for a moment, or two concurrent updates could wait for each other's nodes forever
+        {
+            node_lock_t node_lock = node_lock_(old_slot);
+            snapshot_preserve_(old_slot);
+
+            // The links of the node are about to be reset, so enter its neighborhood through one of its neighbors
+            while (entry_slot == old_slot && entry_level >= 0) {
+                for (compressed_slot_t neighbor_slot : neighbors_(node, entry_level))
+                    if (neighbor_slot != old_slot) {
+                        entry_slot = neighbor_slot;
+                        break;
+                    }
+                if (entry_slot == old_slot)
+                    --entry_level;
+            }
+
+            // Reset the links, but keep the head read by the concurrent searches and the co-located vector, if any
+            span_bytes_t node_bytes = node_bytes_(node);
+            std::size_t const vector_offset = node_vector_(node) - node_bytes.data();
+            std::memset(node_bytes.data() + node_head_bytes_(), 0, vector_offset - node_head_bytes_());
+            std::memset(node_bytes.data() + vector_offset + pre_.vector_bytes, 0,
+                        node_bytes.size() - vector_offset - pre_.vector_bytes);
+        }
 
         // Pull stats
         result.computed_distances = context.computed_distances_count;
         result.visited_members = context.iteration_cycles;
 
-        connect_node_across_levels_(                       //
-            value, metric, prefetch,                       //
-            old_slot, entry_slot_, max_level_, node_level, //
-            config, context);
-        node.key(key);
+        if (entry_slot != old_slot)
+            connect_node_across_levels_(                        //
+                value, metric, prefetch,                        //
+                old_slot, entry_slot, entry_level, entry_level, //
+                config, context, false);
 
         // Normalize stats
         result.computed_distances = context.computed_distances_count - result.computed_distances;
         result.visited_members = context.iteration_cycles - result.visited_members;
         result.slot = old_slot;
 
+        node_lock_t node_lock = node_lock_(old_slot);
+        node.key(key);
         callback(at(old_slot));
         return result;
     }
 
     /**
-     *  @brief Searches for the closest elements to the given ::query. Thread-safe.
+     *  @brief  Constructs the whole graph at once from a static collection, when all of it is known upfront.
+     *          Much faster than a sequence of `add()` calls, but must not overlap with any other operation.
      *
-     *  @param[in] query Content that will be compared against other entries in the index.
-     *  @param[in] wanted The upper bound for the number of results to return.
-     *  @param[in] config Configuration options for this specific operation.
-     *  @param[in] predicate Optional filtering predicate for `member_cref_t`.
-     *  @return Smart object referencing temporary memory. Valid until next `search()`, `add()`, or `cluster()`.
+     *  Assigns the levels to all the nodes in advance, and links them in the descending order of their levels,
+     *  in batches growing with the graph. Every node in a batch searches the already linked part of the graph
+     *  and forms its outgoing links without any locks, as nothing else is modified meanwhile. The reverse links
+     *  are then grouped by their target, so every affected node runs the pruning heuristic just once per batch.
+     *
+     *  @param[in] keys Random-access collection of ::count keys, defining the order of the slots.
+     *  @param[in] values Callable returning the content for a `member_citerator_t`, like in `compact()`.
+     *  @param[in] metric Callable object measuring distance between the entries, like in `add()`.
+     *  @param[in] callback Called for every `member_ref_t` before the linking starts, from multiple threads.
+     *  @param[in] executor Thread-pool to execute the job in parallel.
+     *  @param[in] progress Callback to report the execution progress.
      */
-    template <                                     //
-        typename value_at,                         //
-        typename metric_at,                        //
-        typename predicate_at = dummy_predicate_t, //
-        typename prefetch_at = dummy_prefetch_t    //
-        >
-    search_result_t search(                        //
-        value_at&& query,                          //
-        std::size_t wanted,                        //
-        metric_at&& metric,                        //
-        index_search_config_t config = {},         //
-        predicate_at&& predicate = predicate_at{}, //
-        prefetch_at&& prefetch = prefetch_at{}) const usearch_noexcept_m {
-
-        // Someone is gonna fuzz this, so let's make sure we cover the basics
-        if (!wanted)
-            return search_result_t{};
-
-        // Expansion factor set to zero is equivalent to the default value
-        if (!config.expansion)
-            config.expansion = default_expansion_search();
+    template <typename keys_at, typename values_at, typename metric_at, //
+              typename callback_at = dummy_callback_t,                  //
+              typename executor_at = dummy_executor_t,                  //
+              typename progress_at = dummy_progress_t,                  //
+              typename prefetch_at = dummy_prefetch_t>
+    build_result_t build(                                                               //
+        keys_at&& keys, std::size_t count, values_at&& values, metric_at&& metric,      //
+        index_build_config_t config = {}, callback_at&& callback = callback_at{},       //
+        executor_at&& executor = executor_at{}, progress_at&& progress = progress_at{}, //
+        prefetch_at&& prefetch = prefetch_at{}) usearch_noexcept_m {
 
-        context_t& context = contexts_[config.thread];
-        top_candidates_t& top = context.top_candidates;
-        search_result_t result{*this, top};
-        if (!nodes_count_)
+        build_result_t result;
+        if (is_immutable())
+            return result.failed("Can't add to an immutable index");
+        if (size())
+            return result.failed("Bulk construction requires an empty index");
+        if (count > capacity())
+            return result.failed("Reserve capacity ahead of insertions!");
+        if (executor.size() > contexts_.size())
+            return result.failed("Reserve thread contexts for every executor thread!");
+        if (!count)
             return result;
 
-        // Go down the level, tracking only the closest match
-        result.computed_distances = context.computed_distances_count;
-        result.visited_members = context.iteration_cycles;
-
-        if (config.exact) {
-            if (!top.reserve(wanted))
-                return result.failed("Out of memory!");
-            search_exact_(query, metric, predicate, wanted, context);
-        } else {
-            next_candidates_t& next = context.next_candidates;
-            std::size_t expansion = (std::max)(config.expansion, wanted);
-            usearch_assert_m(expansion > 0, "Expansion factor can't be a zero!");
-            if (!next.reserve(expansion))
+        std::size_t const connectivity_max = (std::max)(config_.connectivity_base, config_.connectivity);
+        std::size_t const top_limit = (std::max)(connectivity_max + 1, config.expansion);
+        std::size_t computed_distances = 0, visited_members = 0;
+        for (std::size_t i = 0; i != executor.size(); ++i) {
+            context_t& context = contexts_[i];
+            if (!context.top_candidates.reserve(top_limit) || !context.next_candidates.reserve(config.expansion))
                 return result.failed("Out of memory!");
-            if (!top.reserve(expansion))
+            computed_distances += context.computed_distances_count;
+            visited_members += context.iteration_cycles;
+        }
+
+        // Allocate all the nodes, linking them in the descending order of their levels,
+        // like `compact()` lays them out, so the entry point is known from the start
+        buffer_gt<compressed_slot_t, slots_allocator_t> order(count);
+        buffer_gt<atomic_counter_t> incoming_counts(count);
+        if (!order || !incoming_counts)
+            return result.failed("Out of memory!");
+        for (std::size_t slot = 0; slot != count; ++slot) {
+            level_t level = choose_random_level_(contexts_[0].level_generator);
+            node_t node = node_make_(keys[slot], level);
+            if (!node) {
+                nodes_count_ = slot;
+                clear();
                 return result.failed("Out of memory!");
+            }
+            nodes_[slot] = node;
+            nodes_count_ = slot + 1;
+            if (!slot || level > max_level_)
+                max_level_ = level, entry_slot_ = slot;
+        }
+        buffer_gt<std::size_t> levels_counts(static_cast<std::size_t>(max_level_) + 1);
+        if (!levels_counts) {
+            clear();
+            return result.failed("Out of memory!");
+        }
+        std::fill(levels_counts.begin(), levels_counts.end(), std::size_t(0));
+        for (std::size_t slot = 0; slot != count; ++slot)
+            ++levels_counts[node_at_(slot).level()];
+        for (std::size_t level = max_level_ + 1, offset = 0; level != 0; --level)
+            offset += exchange(levels_counts[level - 1], offset);
+        for (std::size_t slot = 0; slot != count; ++slot)
+            order[levels_counts[node_at_(slot).level()]++] = static_cast<compressed_slot_t>(slot);
+        result.new_size = count;
 
-            std::size_t closest_slot = search_for_one_(query, metric, prefetch, entry_slot_, max_level_, 0, context);
+        // Progress status
+        std::atomic<bool> do_tasks{true};
+        std::atomic<std::size_t> processed{0};
+        std::size_t const total = 2 * count;
 
-            // For bottom layer we need a more optimized procedure
-            if (!search_to_find_in_base_(query, metric, predicate, prefetch, closest_slot, expansion, context))
-                return result.failed("Out of memory!");
+        executor.dynamic(count, [&](std::size_t thread_idx, std::size_t slot) {
+            callback(at(slot));
+            ++processed;
+            if (thread_idx == 0)
+                do_tasks = progress(processed.load(), total);
+            return do_tasks.load();
+        });
+
+        if (!do_tasks.load()) {
+            clear();
+            return result.failed("Construction was interrupted");
         }
 
-        top.sort_ascending();
-        top.shrink(wanted);
+        // Reverse links are grouped by their target with a counting semi-sort
+        for (std::size_t slot = 0; slot != count; ++slot)
+            incoming_counts[slot].value.store(0, std::memory_order_relaxed);
+
+        ++processed; // The entry point has nothing to link to
+        for (std::size_t batch_begin = 1; batch_begin < count && do_tasks.load();) {
+            std::size_t batch_size = static_cast<std::size_t>(config.batch_ratio * static_cast<double>(batch_begin));
+            batch_size = (std::min)((std::max)(batch_size, std::size_t(1)), config.batch_limit);
+            batch_size = (std::min)(batch_size, count - batch_begin);
+            compressed_slot_t const* batch = order.data() + batch_begin;
+            if (!build_batch_(batch, batch_size, values, metric, config, incoming_counts, executor, prefetch)) {
+                clear();
+                return result.failed("Out of memory!");
+            }
+
+            processed += batch_size;
+            batch_begin += batch_size;
+            do_tasks = progress(processed.load(), total);
+        }
+        if (!do_tasks.load()) {
+            clear();
+            return result.failed("Construction was interrupted");
+        }
 
         // Normalize stats
-        result.computed_distances = context.computed_distances_count - result.computed_distances;
-        result.visited_members = context.iteration_cycles - result.visited_members;
-        result.count = top.size();
+        for (std::size_t i = 0; i != executor.size(); ++i) {
+            computed_distances -= contexts_[i].computed_distances_count;
+            visited_members -= contexts_[i].iteration_cycles;
+        }
+        result.computed_distances = static_cast<std::size_t>(0) - computed_distances;
+        result.visited_members = static_cast<std::size_t>(0) - visited_members;
         return result;
     }
 
     /**
-     *  @brief Identifies the closest cluster to the given ::query. Thread-safe.
+     *  @brief  Appends all the nodes of the ::other graph after the existing ones, keeping their links,
+     *          and cross-links the two graphs, instead of inserting the nodes one by one.
+     *          Must not overlap with any other operation on either index.
      *
-     *  @param[in] query Content that will be compared against other entries in the index.
-     *  @param[in] level The index level to target. Higher means lower resolution.
-     *  @param[in] config Configuration options for this specific operation.
-     *  @param[in] predicate Optional filtering predicate for `member_cref_t`.
-     *  @return Smart object referencing temporary memory. Valid until next `search()`, `add()`, or `cluster()`.
+     *  The copied slots are shifted by the current `size()`. Every copied node searches the old graph,
+     *  while every old node searches the copied one, both starting from their own entry points, so the two
+     *  searches never cross into the graph being updated. The cross candidates and the existing neighbors
+     *  are then pruned together with the usual heuristic, and the surviving links between the two graphs
+     *  get their reverse links, just like in `build`, as they are essential for navigating both ways.
+     *  If interrupted, the index remains valid and searchable from the old entry point, but the copied nodes
+     *  may be unreachable.
+     *
+     *  @param[in] other Source graph with identical connectivity and co-located vector size, may be a view.
+     *  @param[in] values Callable returning the content for a `member_citerator_t` in the merged index.
+     *  @param[in] metric Callable object measuring distance between the entries of the merged index.
+     *  @param[in] expansion Search depth for the cross-links, similar to `index_update_config_t::expansion`.
+     *  @param[in] callback Called for every copied `member_ref_t` before the linking starts, from multiple threads.
+     *  @param[in] executor Thread-pool to execute the job in parallel.
+     *  @param[in] progress Callback to report the execution progress.
      */
-    template <                                     //
-        typename value_at,                         //
-        typename metric_at,                        //
-        typename predicate_at = dummy_predicate_t, //
-        typename prefetch_at = dummy_prefetch_t    //
-        >
-    cluster_result_t cluster(                      //
-        value_at&& query,                          //
-        std::size_t level,                         //
-        metric_at&& metric,                        //
-        index_cluster_config_t config = {},        //
-        predicate_at&& predicate = predicate_at{}, //
-        prefetch_at&& prefetch = prefetch_at{}) const noexcept {
+    template <typename values_at, typename metric_at,  //
+              typename callback_at = dummy_callback_t, //
+              typename executor_at = dummy_executor_t, //
+              typename progress_at = dummy_progress_t, //
+              typename prefetch_at = dummy_prefetch_t>
+    merge_result_t merge(                                                                          //
+        index_gt const& other, values_at&& values, metric_at&& metric,                             //
+        std::size_t expansion = default_expansion_add(), callback_at&& callback = callback_at{}, //
+        executor_at&& executor = executor_at{}, progress_at&& progress = progress_at{},            //
+        prefetch_at&& prefetch = prefetch_at{}) usearch_noexcept_m {
+
+        merge_result_t result;
+        std::size_t const offset = size();
+        std::size_t const other_size = other.size();
+        result.new_size = offset + other_size;
+        if (is_immutable())
+            return result.failed("Can't add to an immutable index");
+        if (&other == this)
+            return result.failed("Can't merge an index with itself");
+        if (other.is_compressed())
+            return result.failed("Can't merge a compressed index");
+        if (config_.connectivity != other.config_.connectivity ||
+            config_.connectivity_base != other.config_.connectivity_base ||
+            pre_.vector_bytes != other.pre_.vector_bytes)
+            return result.failed("Can't merge indexes with different connectivity or co-located vectors");
+        if (result.new_size > capacity())
+            return result.failed("Reserve capacity ahead of insertions!");
+        if (executor.size() > contexts_.size())
+            return result.failed("Reserve thread contexts for every executor thread!");
+        if (!other_size)
+            return result;
+
+        std::size_t const connectivity_max = (std::max)(config_.connectivity_base, config_.connectivity);
+        std::size_t const top_limit = (std::max)(connectivity_max + 1, expansion) + connectivity_max;
+        std::size_t computed_distances = 0, visited_members = 0;
+        for (std::size_t i = 0; i != executor.size(); ++i) {
+            context_t& context = contexts_[i];
+            if (!context.top_candidates.reserve(top_limit) || !context.next_candidates.reserve(expansion))
+                return result.failed("Out of memory!");
+            computed_distances += context.computed_distances_count;
+            visited_members += context.iteration_cycles;
+        }
+
+        // Every copied node keeps aside up to `connectivity_max` candidates per level of the old graph
+        level_t const old_max_level = max_level_;
+        std::size_t const old_entry_slot = entry_slot_;
+        buffer_gt<std::size_t> offsets(offset ? other_size + 1 : 1);
+        if (!offsets)
+            return result.failed("Out of memory!");
+        offsets[0] = 0;
+        for (std::size_t i = 0; offset && i != other_size; ++i) {
+            level_t levels = (std::min)(level_t(other.node_at_(i).level()), old_max_level) + 1;
+            offsets[i + 1] = offsets[i] + static_cast<std::size_t>(levels) * connectivity_max;
+        }
+        buffer_gt<candidate_t, candidates_allocator_t> candidates(offsets[offsets.size() - 1]);
+        buffer_gt<neighbors_count_t> candidates_counts(offset ? offsets[offsets.size() - 1] / connectivity_max : 0);
+        if (offset && (!candidates || !candidates_counts))
+            return result.failed("Out of memory!");
+
+        // Allocations are serial, so the copies are packed in the order of the slots
+        for (std::size_t i = 0; i != other_size; ++i) {
+            node_t node = node_make_copy_(other.node_bytes_(other.node_at_(i)));
+            if (!node) {
+                for (std::size_t j = 0; j != i; ++j)
+                    node_free_(offset + j);
+                return result.failed("Out of memory!");
+            }
+            nodes_[offset + i] = node;
+        }
+        nodes_count_ = result.new_size;
+        if (!offset || other.max_level_ > old_max_level)
+            max_level_ = other.max_level_, entry_slot_ = other.entry_slot_ + offset;
+
+        // On failure the old graph stays reachable from its own entry point
+        auto failed = [&](char const* message) {
+            if (offset)
+                max_level_ = old_max_level, entry_slot_ = old_entry_slot;
+            return result.failed(message);
+        };
+
+        // Progress status
+        std::atomic<bool> do_tasks{true};
+        std::atomic<std::size_t> processed{0};
+        std::size_t const total = 2 * offset + 4 * other_size;
+        auto report = [&](std::size_t thread_idx) {
+            ++processed;
+            if (thread_idx == 0)
+                do_tasks = progress(processed.load(), total);
+            return do_tasks.load();
+        };
+
+        // Shift the links of the copied nodes
+        executor.dynamic(other_size, [&](std::size_t thread_idx, std::size_t i) {
+            node_t node = node_at_(offset + i);
+            for (level_t level = 0; level <= node.level(); ++level)
+                for (misaligned_ref_gt<compressed_slot_t> neighbor : neighbors_(node, level))
+                    neighbor = static_cast<compressed_slot_t>(compressed_slot_t(neighbor) + offset);
+            callback(at(offset + i));
+            return report(thread_idx);
+        });
+        if (!do_tasks.load())
+            return failed("Merge was interrupted");
+        if (!offset)
+            return result;
+
+        // Search the old graph for every copied node, while neither is modified
+        std::atomic<bool> succeeded{true};
+        executor.dynamic(other_size, [&](std::size_t thread_idx, std::size_t i) {
+            context_t& context = contexts_[thread_idx];
+            std::size_t const slot = offset + i;
+            auto value = values[citerator_at(slot)];
+            level_t const target_level = (std::min)(level_t(node_at_(slot).level()), old_max_level);
+            std::size_t closest_slot = search_for_one_( //
+                value, metric, prefetch,                //
+                old_entry_slot, old_max_level, target_level, context);
+            for (level_t level = target_level; level >= 0; --level) {
+                if (!search_to_insert_(value, metric, prefetch, closest_slot, slot, level, expansion, context)) {
+                    succeeded = false;
+                    return false;
+                }
+                top_candidates_t& top = context.top_candidates;
+                std::size_t const region = offsets[i] / connectivity_max + static_cast<std::size_t>(level);
+                std::size_t const count = (std::min)(top.size(), connectivity_max);
+                std::memcpy(candidates.data() + region * connectivity_max, top.data(), count * sizeof(candidate_t));
+                candidates_counts[region] = static_cast<neighbors_count_t>(count);
+                closest_slot = top.data()[0].slot;
+            }
+            return report(thread_idx);
+        });
+        if (!succeeded.load())
+            return failed("Out of memory!");
+        if (!do_tasks.load())
+            return failed("Merge was interrupted");
+
+        // Search the copied graph for every old node, updating the old nodes right away
+        std::size_t const other_entry_slot = other.entry_slot_ + offset;
+        executor.dynamic(offset, [&](std::size_t thread_idx, std::size_t slot) {
+            context_t& context = contexts_[thread_idx];
+            auto value = values[citerator_at(slot)];
+            level_t const target_level = (std::min)(level_t(node_at_(slot).level()), other.max_level_);
+            std::size_t closest_slot = search_for_one_( //
+                value, metric, prefetch,                //
+                other_entry_slot, other.max_level_, target_level, context);
+            for (level_t level = target_level; level >= 0; --level) {
+                if (!search_to_insert_(value, metric, prefetch, closest_slot, slot, level, expansion, context)) {
+                    succeeded = false;
+                    return false;
+                }
+                top_candidates_t& top = context.top_candidates;
+                closest_slot = top.data()[0].slot;
+                top.shrink(connectivity_max);
+                merge_neighbors_(metric, slot, level, context);
+            }
+            return report(thread_idx);
+        });
+        if (!succeeded.load())
+            return failed("Out of memory!");
+        if (!do_tasks.load())
+            return failed("Merge was interrupted");
+
+        // Update the copied nodes
+        executor.dynamic(other_size, [&](std::size_t thread_idx, std::size_t i) {
+            context_t& context = contexts_[thread_idx];
+            top_candidates_t& top = context.top_candidates;
+            std::size_t const slot = offset + i;
+            level_t const target_level = (std::min)(level_t(node_at_(slot).level()), old_max_level);
+            for (level_t level = target_level; level >= 0; --level) {
+                std::size_t const region = offsets[i] / connectivity_max + static_cast<std::size_t>(level);
+                candidate_t const* region_candidates = candidates.data() + region * connectivity_max;
+                top.clear();
+                for (std::size_t j = 0; j != candidates_counts[region]; ++j)
+                    top.insert_reserved(candidate_t{region_candidates[j]});
+                merge_neighbors_(metric, slot, level, context);
+            }
+            return report(thread_idx);
+        });
+        if (!do_tasks.load())
+            return failed("Merge was interrupted");
+
+        // Every link between the two graphs only exists in one direction so far
+        std::size_t const new_size = result.new_size;
+        buffer_gt<std::size_t> links_offsets(new_size + 1);
+        buffer_gt<std::size_t> links_counts(new_size);
+        buffer_gt<atomic_counter_t> incoming_counts(new_size);
+        buffer_gt<compressed_slot_t, slots_allocator_t> targets(new_size);
+        if (!links_offsets || !links_counts || !incoming_counts || !targets)
+            return failed("Out of memory!");
+        links_offsets[0] = 0;
+        for (std::size_t slot = 0; slot != new_size; ++slot) {
+            node_t node = node_at_(slot);
+            std::size_t node_links = 0;
+            for (level_t level = 0; level <= node.level(); ++level)
+                node_links += neighbors_(node, level).size();
+            links_offsets[slot + 1] = links_offsets[slot] + node_links;
+            incoming_counts[slot].value.store(0, std::memory_order_relaxed);
+        }
+        buffer_gt<reverse_link_t, reverse_links_allocator_t> links(links_offsets[new_size]);
+        if (!links)
+            return failed("Out of memory!");
+
+        std::atomic<std::size_t> targets_count{0};
+        executor.dynamic(new_size, [&](std::size_t thread_idx, std::size_t slot) {
+            context_t& context = contexts_[thread_idx];
+            node_t node = node_at_(slot);
+            reverse_link_t* node_links = links.data() + links_offsets[slot];
+            std::size_t node_links_count = 0;
+            for (level_t level = 0; level <= node.level(); ++level) {
+                for (compressed_slot_t target : neighbors_(node, level)) {
+                    if ((target < offset) == (slot < offset))
+                        continue;
+                    distance_t distance = context.measure(citerator_at(slot), citerator_at(target), metric);
+                    node_links[node_links_count++] = {static_cast<compressed_slot_t>(slot), target, distance, level};
+                    if (incoming_counts[target].value.fetch_add(1, std::memory_order_relaxed) == 0)
+                        targets[targets_count.fetch_add(1, std::memory_order_relaxed)] = target;
+                }
+            }
+            links_counts[slot] = node_links_count;
+            return report(thread_idx);
+        });
+        if (!do_tasks.load())
+            return failed("Merge was interrupted");
+        if (!link_reverse_(links.data(), links_offsets.data(), links_counts.data(), new_size, targets.data(),
+                           targets_count.load(), metric, incoming_counts, executor))
+            return failed("Out of memory!");
+
+        // Normalize stats
+        for (std::size_t i = 0; i != executor.size(); ++i) {
+            computed_distances -= contexts_[i].computed_distances_count;
+            visited_members -= contexts_[i].iteration_cycles;
+        }
+        result.computed_distances = static_cast<std::size_t>(0) - computed_distances;
+        result.visited_members = static_cast<std::size_t>(0) - visited_members;
+        return result;
+    }
+
+    /**
+     *  @brief Searches for the closest elements to the given ::query. Thread-safe.
+     *
+     *  @param[in] query Content that will be compared against other entries in the index.
+     *  @param[in] wanted The upper bound for the number of results to return.
+     *  @param[in] config Configuration options for this specific operation.
+     *  @param[in] predicate Optional filtering predicate for `member_cref_t`.
+     *  @return Smart object referencing temporary memory. Valid until next `search()`, `add()`, or `cluster()`.
+     */
+    template <                                     //
+        typename value_at,                         //
+        typename metric_at,                        //
+        typename predicate_at = dummy_predicate_t, //
+        typename prefetch_at = dummy_prefetch_t    //
+        >
+    search_result_t search(                        //
+        value_at&& query,                          //
+        std::size_t wanted,                        //
+        metric_at&& metric,                        //
+        index_search_config_t config = {},         //
+        predicate_at&& predicate = predicate_at{}, //
+        prefetch_at&& prefetch = prefetch_at{}) const usearch_noexcept_m {
+
+        // Someone is gonna fuzz this, so let's make sure we cover the basics
+        if (!wanted)
+            return search_result_t{};
+        usearch_instrument_m(std::uint64_t const started = instrumentation_nanoseconds());
+
+        // Expansion factor set to zero is equivalent to the default value
+        if (!config.expansion)
+            config.expansion = default_expansion_search();
+
+        context_t& context = contexts_[config.thread];
+        top_candidates_t& top = context.top_candidates;
+        search_result_t result{*this, top};
+        if (!nodes_count_)
+            return result;
+
+        // Go down the level, tracking only the closest match
+        result.computed_distances = context.computed_distances_count;
+        result.visited_members = context.iteration_cycles;
+
+        if (config.exact) {
+            if (!top.reserve(wanted))
+                return result.failed("Out of memory!");
+            search_exact_(query, metric, predicate, wanted, context);
+        } else {
+            next_candidates_t& next = context.next_candidates;
+            std::size_t expansion = (std::max)(config.expansion, wanted);
+            usearch_assert_m(expansion > 0, "Expansion factor can't be a zero!");
+            if (!next.reserve(expansion))
+                return result.failed("Out of memory!");
+            if (!top.reserve(expansion))
+                return result.failed("Out of memory!");
+
+            std::size_t closest_slot = search_for_one_(query, metric, prefetch, entry_slot_, max_level_, 0, context,
+                                                       config.prefetch_depth);
+
+            // For bottom layer we need a more optimized procedure
+            if (!search_to_find_in_base_(query, metric, predicate, prefetch, closest_slot, expansion, context,
+                                         config.prefetch_depth, wanted, config.patience, config.distance_ratio))
+                return result.failed("Out of memory!");
+        }
+
+        top.sort_ascending();
+        top.shrink(wanted);
+
+        // Normalize stats
+        result.computed_distances = context.computed_distances_count - result.computed_distances;
+        result.visited_members = context.iteration_cycles - result.visited_members;
+        result.count = top.size();
+        usearch_instrument_m(instrument_query_(started, result.visited_members, result.computed_distances));
+        return result;
+    }
+
+    /**
+     *  @brief Searches for the closest elements among the members of a precomputed ::allowed set. Thread-safe.
+     *
+     *  Unlike a plain `search()` with a predicate, the traversal only scores the allowed members, and bridges
+     *  over the rejected ones by looking at their own neighbors, so selective filters don't disconnect the graph.
+     *  When the allowed set is smaller than `config.brute_force_selectivity` of the index, or the traversal
+     *  can't find enough matches, falls back to an exhaustive scan of the allowed set.
+     *
+     *  @param[in] query Content that will be compared against other entries in the index.
+     *  @param[in] wanted The upper bound for the number of results to return.
+     *  @param[in] allowed Set of slots, like a `bitset_gt`, exposing a `test(std::size_t)` member.
+     *  @param[in] allowed_count Number of slots in the ::allowed set, used to pick the strategy.
+     *  @param[in] config Configuration options for this specific operation.
+     *  @param[in] predicate Optional filtering predicate for `member_cref_t`, applied on top of ::allowed.
+     *  @return Smart object referencing temporary memory. Valid until next `search()`, `add()`, or `cluster()`.
+     */
+    template <                                     //
+        typename value_at,                         //
+        typename metric_at,                        //
+        typename allowed_at,                       //
+        typename predicate_at = dummy_predicate_t, //
+        typename prefetch_at = dummy_prefetch_t    //
+        >
+    search_result_t filtered_search(               //
+        value_at&& query,                          //
+        std::size_t wanted,                        //
+        metric_at&& metric,                        //
+        allowed_at const& allowed,                 //
+        std::size_t allowed_count,                 //
+        index_search_config_t config = {},         //
+        predicate_at&& predicate = predicate_at{}, //
+        prefetch_at&& prefetch = prefetch_at{}) const usearch_noexcept_m {
+
+        if (!wanted)
+            return search_result_t{};
+        usearch_instrument_m(std::uint64_t const started = instrumentation_nanoseconds());
+        if (!config.expansion)
+            config.expansion = default_expansion_search();
+
+        context_t& context = contexts_[config.thread];
+        top_candidates_t& top = context.top_candidates;
+        search_result_t result{*this, top};
+        if (!nodes_count_ || !allowed_count)
+            return result;
+
+        result.computed_distances = context.computed_distances_count;
+        result.visited_members = context.iteration_cycles;
+
+        auto is_allowed = [&](member_cref_t const& member) noexcept {
+            return allowed.test(member.slot) && predicate(member);
+        };
+
+        std::size_t const expected = (std::min)(wanted, allowed_count);
+        bool exact = config.exact || allowed_count <= config.brute_force_selectivity * size();
+        if (!exact) {
+            next_candidates_t& next = context.next_candidates;
+            std::size_t expansion = (std::max)(config.expansion, wanted);
+            if (!next.reserve(expansion))
+                return result.failed("Out of memory!");
+            if (!top.reserve(expansion))
+                return result.failed("Out of memory!");
+
+            // The upper levels are too sparse to be filtered, so only the base layer respects the ::allowed set
+            std::size_t closest_slot = search_for_one_(query, metric, prefetch, entry_slot_, max_level_, 0, context,
+                                                       config.prefetch_depth);
+            if (!search_to_find_in_filtered_base_(query, metric, is_allowed, prefetch, closest_slot, expansion,
+                                                  context, wanted, config.patience, config.distance_ratio))
+                return result.failed("Out of memory!");
+
+            // The allowed members may be unreachable even through the rejected ones
+            exact = top.size() < expected;
+        }
+
+        if (exact) {
+            if (!top.reserve(wanted))
+                return result.failed("Out of memory!");
+            search_exact_(query, metric, is_allowed, wanted, context);
+        }
+
+        top.sort_ascending();
+        top.shrink(wanted);
+
+        // Normalize stats
+        result.computed_distances = context.computed_distances_count - result.computed_distances;
+        result.visited_members = context.iteration_cycles - result.visited_members;
+        result.count = top.size();
+        usearch_instrument_m(instrument_query_(started, result.visited_members, result.computed_distances));
+        return result;
+    }
+
+    /**
+     *  @brief Streams all the elements within the ::radius from the ::query into a ::callback. Thread-safe.
+     *
+     *  Unlike repeated `search()` calls with a growing `wanted`, traverses the graph only once, continuing
+     *  to expand the candidates as long as they fall within the ::radius. The matches are reported in the
+     *  order of discovery, not sorted by distance.
+     *
+     *  @param[in] query Content that will be compared against other entries in the index.
+     *  @param[in] radius The upper bound for the distance of the reported elements, inclusive.
+     *  @param[in] callback Callable object receiving a `member_cref_t` and its `distance_t` to the ::query.
+     *  @param[in] max_count The upper bound for the number of reported elements, after which the search stops.
+     *  @param[in] config Configuration options for this specific operation. The `patience` and `distance_ratio`
+     *                    are ignored, as they would cut off the matches within the ::radius.
+     *  @param[in] predicate Optional filtering predicate for `member_cref_t`.
+     */
+    template <                                     //
+        typename value_at,                         //
+        typename metric_at,                        //
+        typename callback_at,                      //
+        typename predicate_at = dummy_predicate_t, //
+        typename prefetch_at = dummy_prefetch_t    //
+        >
+    range_search_result_t range_search(            //
+        value_at&& query,                          //
+        distance_t radius,                         //
+        metric_at&& metric,                        //
+        callback_at&& callback,                    //
+        std::size_t max_count = std::numeric_limits<std::size_t>::max(),
+        index_search_config_t config = {},         //
+        predicate_at&& predicate = predicate_at{}, //
+        prefetch_at&& prefetch = prefetch_at{}) const usearch_noexcept_m {
+
+        range_search_result_t result;
+        if (!max_count || !nodes_count_)
+            return result;
+        usearch_instrument_m(std::uint64_t const started = instrumentation_nanoseconds());
+        if (!config.expansion)
+            config.expansion = default_expansion_search();
+
+        context_t& context = contexts_[config.thread];
+        result.computed_distances = context.computed_distances_count;
+        result.visited_members = context.iteration_cycles;
+
+        auto report = [&](compressed_slot_t slot, distance_t distance) {
+            member_cref_t member{node_at_(slot).ckey(), slot};
+            if (distance > radius || !predicate(member))
+                return false;
+            callback(member, distance);
+            return ++result.count == max_count;
+        };
+
+        if (config.exact) {
+            for (std::size_t i = 0; i != size(); ++i)
+                if (report(static_cast<compressed_slot_t>(i), context.measure(query, citerator_at(i), metric)))
+                    break;
+        } else {
+            if (!context.next_candidates.reserve(config.expansion))
+                return result.failed("Out of memory!");
+            if (!context.top_candidates.reserve(config.expansion))
+                return result.failed("Out of memory!");
+
+            std::size_t closest_slot = search_for_one_(query, metric, prefetch, entry_slot_, max_level_, 0, context,
+                                                       config.prefetch_depth);
+            if (!search_to_find_in_range_(query, metric, report, prefetch, closest_slot, radius, config.expansion,
+                                          context))
+                return result.failed("Out of memory!");
+        }
+
+        // Normalize stats
+        result.computed_distances = context.computed_distances_count - result.computed_distances;
+        result.visited_members = context.iteration_cycles - result.visited_members;
+        usearch_instrument_m(instrument_query_(started, result.visited_members, result.computed_distances));
+        return result;
+    }
+
+    /**
+     *  @brief Recomputes the distances for the results of the last `search()` in the same thread,
+     *         reordering them and keeping only the closest. Useful to refine approximate distances
+     *         produced by a cheaper @b quantized metric with a more accurate one. Thread-safe.
+     *
+     *  @param[in] query Content that will be compared against the previously found entries.
+     *  @param[in] wanted The upper bound for the number of results to keep.
+     *  @param[in] metric Callable object measuring distance between ::query and stored members.
+     *  @param[in] config Configuration options, only the `thread` is used.
+     *  @return Smart object referencing temporary memory. Valid until next `search()`, `add()`, or `cluster()`.
+     */
+    template <typename value_at, typename metric_at>
+    search_result_t rescore(                //
+        value_at&& query,                   //
+        std::size_t wanted,                 //
+        metric_at&& metric,                 //
+        index_search_config_t config = {}) const usearch_noexcept_m {
+
+        context_t& context = contexts_[config.thread];
+        top_candidates_t& top = context.top_candidates;
+        search_result_t result{*this, top};
+        result.computed_distances = context.computed_distances_count;
+
+        candidate_t* top_ordered = top.data();
+        for (std::size_t i = 0; i != top.size(); ++i)
+            top_ordered[i].distance = context.measure(query, citerator_at(top_ordered[i].slot), metric);
+        std::sort(top_ordered, top_ordered + top.size());
+        top.shrink(wanted);
+
+        result.computed_distances = context.computed_distances_count - result.computed_distances;
+        result.count = top.size();
+        return result;
+    }
+
+    struct search_batch_result_t {
+        error_t error{};
+        /** @brief  Number of queries answered. */
+        std::size_t count{};
+        /** @brief  Number of graph nodes traversed, across all queries. */
+        std::size_t visited_members{};
+        /** @brief  Number of times the distances were computed, across all queries. */
+        std::size_t computed_distances{};
+
+        explicit operator bool() const noexcept { return !error; }
+        search_batch_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+    };
+
+    /**
+     *  @brief  Searches for the closest elements to every one of the given ::queries. Thread-safe.
+     *          Descends through the upper levels for all queries together: queries that reach the
+     *          same node share one pass over its neighbors list, and every loaded neighbor is scored
+     *          against all of them at once. The base level is then traversed for each query.
+     *
+     *  @param[in] queries Random-access container or iterator of values, like `byte_t const* const*`.
+     *  @param[in] queries_count The number of queries to process.
+     *  @param[in] wanted The upper bound for the number of results to return per query.
+     *  @param[in] callback Receives `(std::size_t query_idx, search_result_t const&)` for every query.
+     *              The result references the thread-local buffers until the callback returns.
+     *  @param[in] config Configuration options for this specific operation.
+     *  @param[in] predicate Optional filtering predicate for `member_cref_t`.
+     */
+    template <                                     //
+        typename queries_at,                       //
+        typename metric_at,                        //
+        typename callback_at,                      //
+        typename predicate_at = dummy_predicate_t, //
+        typename prefetch_at = dummy_prefetch_t    //
+        >
+    search_batch_result_t search_batch(            //
+        queries_at&& queries,                      //
+        std::size_t queries_count,                 //
+        std::size_t wanted,                        //
+        metric_at&& metric,                        //
+        callback_at&& callback,                    //
+        index_search_config_t config = {},         //
+        predicate_at&& predicate = predicate_at{}, //
+        prefetch_at&& prefetch = prefetch_at{}) const usearch_noexcept_m {
+
+        using value_t = typename std::decay<decltype(queries[0])>::type;
+        using values_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<value_t>;
+        using entries_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<batch_entry_t>;
+        using distances_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<distance_t>;
+
+        search_batch_result_t result;
+        if (!wanted || !queries_count)
+            return result;
+
+        // Expansion factor set to zero is equivalent to the default value
+        if (!config.expansion)
+            config.expansion = default_expansion_search();
+
+        context_t& context = contexts_[config.thread];
+        top_candidates_t& top = context.top_candidates;
+        next_candidates_t& next = context.next_candidates;
+        std::size_t expansion = (std::max)(config.expansion, wanted);
+        std::size_t const computed_distances_before = context.computed_distances_count;
+        std::size_t const visited_members_before = context.iteration_cycles;
+
+        buffer_gt<batch_entry_t, entries_allocator_t> entries(queries_count);
+        buffer_gt<value_t, values_allocator_t> values(queries_count);
+        buffer_gt<distance_t, distances_allocator_t> distances(queries_count);
+        if (!entries || !values || !distances)
+            return result.failed("Out of memory!");
+        if (!next.reserve(expansion) || !top.reserve(expansion))
+            return result.failed("Out of memory!");
+
+        // Exhaustive search has no shared structure to exploit
+        usearch_instrument_m(std::uint64_t const batch_started = instrumentation_nanoseconds());
+        if (nodes_count_ && !config.exact)
+            search_for_many_(queries, queries_count, entries.data(), values.data(), distances.data(), metric,
+                             prefetch, entry_slot_, max_level_, 0, context);
+        usearch_instrument_m(std::size_t const descent_hops = context.iteration_cycles - visited_members_before);
+        usearch_instrument_m(std::size_t const descent_distances =
+                                 context.computed_distances_count - computed_distances_before);
+
+        for (std::size_t query_idx = 0; query_idx != queries_count; ++query_idx) {
+            // The shared descent is timed with the first query, but its hops and distances are spread across all
+            usearch_instrument_m(std::uint64_t const query_started =
+                                     query_idx ? instrumentation_nanoseconds() : batch_started);
+            usearch_instrument_m(std::size_t const query_hops_before = context.iteration_cycles);
+            usearch_instrument_m(std::size_t const query_distances_before = context.computed_distances_count);
+            search_result_t query_result{*this, top};
+            if (nodes_count_) {
+                if (config.exact)
+                    search_exact_(queries[query_idx], metric, predicate, wanted, context);
+                else if (!search_to_find_in_base_(queries[query_idx], metric, predicate, prefetch,
+                                                  entries[query_idx].slot, expansion, context, config.prefetch_depth,
+                                                  wanted, config.patience, config.distance_ratio))
+                    return result.failed("Out of memory!");
+                top.sort_ascending();
+                top.shrink(wanted);
+                query_result.count = top.size();
+            }
+            usearch_instrument_m(instrument_query_(
+                query_started, context.iteration_cycles - query_hops_before + descent_hops / queries_count,
+                context.computed_distances_count - query_distances_before + descent_distances / queries_count));
+            callback(query_idx, query_result);
+            result.count++;
+        }
+
+        // Normalize stats
+        result.computed_distances = context.computed_distances_count - computed_distances_before;
+        result.visited_members = context.iteration_cycles - visited_members_before;
+        return result;
+    }
+
+    /**
+     *  @brief Identifies the closest cluster to the given ::query. Thread-safe.
+     *
+     *  @param[in] query Content that will be compared against other entries in the index.
+     *  @param[in] level The index level to target. Higher means lower resolution.
+     *  @param[in] config Configuration options for this specific operation.
+     *  @param[in] predicate Optional filtering predicate for `member_cref_t`.
+     *  @return Smart object referencing temporary memory. Valid until next `search()`, `add()`, or `cluster()`.
+     */
+    template <                                     //
+        typename value_at,                         //
+        typename metric_at,                        //
+        typename predicate_at = dummy_predicate_t, //
+        typename prefetch_at = dummy_prefetch_t    //
+        >
+    cluster_result_t cluster(                      //
+        value_at&& query,                          //
+        std::size_t level,                         //
+        metric_at&& metric,                        //
+        index_cluster_config_t config = {},        //
+        predicate_at&& predicate = predicate_at{}, //
+        prefetch_at&& prefetch = prefetch_at{}) const noexcept {
 
         context_t& context = contexts_[config.thread];
         cluster_result_t result;
@@ -2599,12 +4316,12 @@ class index_gt {
         for (std::size_t i = 0; i != size(); ++i) {
             node_t node = node_at_(i);
             std::size_t max_edges = node.level() * config_.connectivity + config_.connectivity_base;
-            std::size_t edges = 0;
-            for (level_t level = 0; level <= node.level(); ++level)
+            std::size_t edges = neighbors_base_count_(i);
+            for (level_t level = 1; level <= node.level(); ++level)
                 edges += neighbors_(node, level).size();
 
             ++result.nodes;
-            result.allocated_bytes += node_bytes_(node).size();
+            result.allocated_bytes += node_bytes_(node).size() + compressed_neighbors_bytes_(i);
             result.edges += edges;
             result.max_edges += max_edges;
         }
@@ -2614,15 +4331,20 @@ class index_gt {
     stats_t stats(std::size_t level) const noexcept {
         stats_t result{};
 
-        std::size_t neighbors_bytes = !level ? pre_.neighbors_base_bytes : pre_.neighbors_bytes;
+        std::size_t neighbors_bytes = !level ? pre_.node_base_bytes + pre_.vector_bytes : pre_.neighbors_bytes;
         for (std::size_t i = 0; i != size(); ++i) {
             node_t node = node_at_(i);
             if (static_cast<std::size_t>(node.level()) < level)
                 continue;
 
             ++result.nodes;
-            result.edges += neighbors_(node, level).size();
-            result.allocated_bytes += node_head_bytes_() + neighbors_bytes;
+            if (level) {
+                result.edges += neighbors_(node, level).size();
+                result.allocated_bytes += node_head_bytes_() + neighbors_bytes;
+            } else {
+                result.edges += neighbors_base_count_(i);
+                result.allocated_bytes += node_head_bytes_() + neighbors_bytes + compressed_neighbors_bytes_(i);
+            }
         }
 
         std::size_t max_edges_per_node = level ? config_.connectivity_base : config_.connectivity;
@@ -2637,8 +4359,9 @@ class index_gt {
             node_t node = node_at_(i);
 
             stats_per_level[0].nodes++;
-            stats_per_level[0].edges += neighbors_(node, 0).size();
-            stats_per_level[0].allocated_bytes += pre_.neighbors_base_bytes + head_bytes;
+            stats_per_level[0].edges += neighbors_base_count_(i);
+            stats_per_level[0].allocated_bytes +=
+                pre_.node_base_bytes + compressed_neighbors_bytes_(i) + pre_.vector_bytes + head_bytes;
 
             level_t node_level = static_cast<level_t>(node.level());
             for (level_t l = 1; l <= (std::min)(node_level, static_cast<level_t>(max_level)); ++l) {
@@ -2672,7 +4395,7 @@ class index_gt {
      */
     std::size_t memory_usage(std::size_t allocator_entry_bytes = default_allocator_entry_bytes()) const noexcept {
         std::size_t total = 0;
-        if (!viewed_file_) {
+        if (!viewed_file_ || is_compressed()) {
             stats_t s = stats();
             total += s.allocated_bytes;
             total += s.nodes * allocator_entry_bytes;
@@ -2688,6 +4411,49 @@ class index_gt {
 
     std::size_t memory_usage_per_node(level_t level) const noexcept { return node_bytes_(level); }
 
+    /**
+     *  @brief  Aggregates the search instrumentation across all the threads. Thread-safe.
+     *          Returns zeros, unless compiled with `USEARCH_USE_INSTRUMENTATION`.
+     *
+     *  The per-query histograms cover every query of `search`, `filtered_search`, `range_search`,
+     *  and `search_batch`. The hops and candidates counters also include insertions and `cluster`.
+     */
+    index_instrumentation_t instrumentation() const noexcept {
+        index_instrumentation_t result;
+#if USEARCH_USE_INSTRUMENTATION
+        for (std::size_t i = 0; i != contexts_.size(); ++i) {
+            typename context_t::instruments_t const& instruments = contexts_[i].instruments;
+            for (std::size_t level = 0; level != index_instrumentation_t::levels(); ++level)
+                result.hops_per_level[level] += instruments.hops_per_level[level].load(std::memory_order_relaxed);
+            result.missed_candidates += instruments.missed_candidates.load(std::memory_order_relaxed);
+            result.reused_candidates += instruments.reused_candidates.load(std::memory_order_relaxed);
+            result.distance_nanoseconds += instruments.distance_nanoseconds.load(std::memory_order_relaxed);
+        }
+        result.node_lock_waits = node_lock_waits_.load(std::memory_order_relaxed);
+        result.node_lock_wait_nanoseconds = node_lock_wait_nanoseconds_.load(std::memory_order_relaxed);
+        result.latency_nanoseconds = latency_histogram_;
+        result.hops = hops_histogram_;
+        result.computed_distances = distances_histogram_;
+#endif
+        return result;
+    }
+
+    /**
+     *  @brief  Zeroes the instrumentation counters.
+     *          The per-thread counters are single-writer, so call it while no searches are running.
+     */
+    void reset_instrumentation() noexcept {
+#if USEARCH_USE_INSTRUMENTATION
+        for (std::size_t i = 0; i != contexts_.size(); ++i)
+            contexts_[i].instruments.reset();
+        node_lock_waits_.store(0, std::memory_order_relaxed);
+        node_lock_wait_nanoseconds_.store(0, std::memory_order_relaxed);
+        latency_histogram_.reset();
+        hops_histogram_.reset();
+        distances_histogram_.reset();
+#endif
+    }
+
 #pragma endregion
 
 #pragma region Serialization
@@ -2698,7 +4464,7 @@ class index_gt {
     std::size_t serialized_length() const noexcept {
         std::size_t neighbors_length = 0;
         for (std::size_t i = 0; i != size(); ++i)
-            neighbors_length += node_bytes_(node_at_(i).level()) + sizeof(level_t);
+            neighbors_length += node_exported_bytes_(node_at_(i).level()) + sizeof(level_t);
         return sizeof(index_serialized_header_t) + neighbors_length;
     }
 
@@ -2736,9 +4502,19 @@ class index_gt {
                 return result.failed("Terminated by user");
         }
 
-        // After that dump the nodes themselves
+        // After that dump the nodes themselves, expanding the compressed lists one node at a time
+        buffer_gt<byte_t, bytes_allocator_t> staging;
+        if (is_compressed()) {
+            staging = buffer_gt<byte_t, bytes_allocator_t>(node_exported_bytes_((std::max)(max_level_, level_t(0))));
+            if (!staging)
+                return result.failed("Out of memory!");
+        }
         for (std::size_t i = 0; i != header.size; ++i) {
             span_bytes_t node_bytes = node_bytes_(node_at_(i));
+            if (staging) {
+                node_export_(i, staging.data());
+                node_bytes = {staging.data(), node_exported_bytes_(node_at_(i).level())};
+            }
             if (!output(node_bytes.data(), node_bytes.size()))
                 return result.failed("Failed to serialize into stream");
             if (!progress(++processed, total))
@@ -2806,13 +4582,155 @@ class index_gt {
         return {};
     }
 
-    template <typename progress_at = dummy_progress_t>
-    serialization_result_t save(char const* file_path, progress_at&& progress = {}) const noexcept {
+    /**
+     *  @brief  Saves serialized binary index representation at the cursor of a shared file,
+     *          dumping the nodes from multiple threads with positional writes.
+     *          Produces the same bytes as `save_to_stream`, advancing the cursor past them.
+     */
+    template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t>
+    serialization_result_t save_to_file(positional_file_t& file, executor_at&& executor = {},
+                                        progress_at&& progress = {}) const noexcept {
+
+        serialization_result_t result = file.open_if_not();
+        if (!result)
+            return result;
+
+        // Export some basic metadata
+        index_serialized_header_t header;
+        header.size = nodes_count_;
+        header.connectivity = config_.connectivity;
+        header.connectivity_base = config_.connectivity_base;
+        header.max_level = max_level_;
+        header.entry_slot = entry_slot_;
+        result = file.write(&header, sizeof(header));
+        if (!result)
+            return result;
+
+        // Export the number of levels per node with a single call
+        using levels_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<level_t>;
+        buffer_gt<level_t, levels_allocator_t> levels(header.size);
+        if (header.size && !levels)
+            return result.failed("Out of memory");
+        for (std::size_t i = 0; i != header.size; ++i)
+            levels[i] = node_at_(i).level();
+        result = file.write(levels.data(), header.size * sizeof(level_t));
+        if (!result)
+            return result;
+
+        // The compressed lists are expanded sequentially, reusing a single staging buffer
+        if (is_compressed()) {
+            buffer_gt<byte_t, bytes_allocator_t> staging(node_exported_bytes_((std::max)(max_level_, level_t(0))));
+            if (!staging)
+                return result.failed("Out of memory!");
+            for (std::size_t i = 0; i != header.size; ++i) {
+                node_export_(i, staging.data());
+                result = file.write(staging.data(), node_exported_bytes_(node_at_(i).level()));
+                if (!result)
+                    return result;
+                if (!progress(header.size + i + 1, 2 * header.size))
+                    return result.failed("Terminated by user");
+            }
+            return result;
+        }
+
+        // After that dump the nodes themselves
+        return file.write_pieces(
+            header.size, [&](std::size_t i) { return node_bytes_(node_at_(i)); }, executor,
+            [&](std::size_t processed, std::size_t total) { return progress(total + processed, 2 * total); });
+    }
+
+    /**
+     *  @brief  Symmetric to `save_to_file`, allocating all the nodes first and then
+     *          filling them from multiple threads with positional reads.
+     */
+    template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t>
+    serialization_result_t load_from_file(positional_file_t& file, executor_at&& executor = {},
+                                          progress_at&& progress = {}) noexcept {
+
+        serialization_result_t result = file.open_if_not();
+        if (!result)
+            return result;
+
+        // Remove previously stored objects
+        reset();
+
+        // Pull basic metadata
+        index_serialized_header_t header;
+        result = file.read(&header, sizeof(header));
+        if (!result)
+            return result;
+
+        // We are loading an empty index, no more work to do
+        if (!header.size)
+            return result;
+
+        // Allocate some dynamic memory to read all the levels
+        using levels_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<level_t>;
+        buffer_gt<level_t, levels_allocator_t> levels(header.size);
+        if (!levels)
+            return result.failed("Out of memory");
+        result = file.read(levels.data(), header.size * sizeof(level_t));
+        if (!result)
+            return result;
+
+        // Submit metadata
+        config_.connectivity = header.connectivity;
+        config_.connectivity_base = header.connectivity_base;
+        pre_ = precompute_(config_);
+        index_limits_t limits;
+        limits.members = header.size;
+        if (!reserve(limits)) {
+            reset();
+            return result.failed("Out of memory");
+        }
+
+        // The allocator isn't thread-safe, so the nodes are allocated upfront
+        for (std::size_t i = 0; i != header.size; ++i) {
+            span_bytes_t node_bytes = node_malloc_(levels[i]);
+            if (!node_bytes) {
+                reset();
+                return result.failed("Out of memory");
+            }
+            nodes_[i] = node_t{node_bytes.data()};
+        }
+        nodes_count_ = header.size;
+        max_level_ = static_cast<level_t>(header.max_level);
+        entry_slot_ = static_cast<compressed_slot_t>(header.entry_slot);
+
+        // The levels inside the nodes aren't populated yet, so the lengths come from `levels`
+        result = file.read_pieces(
+            header.size, [&](std::size_t i) { return span_bytes_t{nodes_[i].tape(), node_bytes_(levels[i])}; },
+            executor, progress);
+        if (!result)
+            reset();
+        return result;
+    }
+
+    /**
+     *  @brief  Saves the index to a file, dumping the nodes from multiple threads
+     *          with positional writes, if a non-dummy @p executor is passed.
+     */
+    template <typename progress_at = dummy_progress_t, typename executor_at = dummy_executor_t>
+    serialization_result_t save(char const* file_path, progress_at&& progress = {},
+                                executor_at&& executor = {}) const noexcept {
+        if (!is_dummy<executor_at>()) {
+            positional_file_t file(file_path, true);
+            return save_to_file(file, executor, std::forward<progress_at>(progress));
+        }
         return save(output_file_t(file_path), std::forward<progress_at>(progress));
     }
 
-    template <typename progress_at = dummy_progress_t>
-    serialization_result_t load(char const* file_path, progress_at&& progress = {}) noexcept {
+    /**
+     *  @brief  Loads the index from a file, reading the nodes from multiple threads
+     *          with positional reads, if a non-dummy @p executor is passed.
+     */
+    template <typename progress_at = dummy_progress_t, typename executor_at = dummy_executor_t>
+    serialization_result_t load(char const* file_path, progress_at&& progress = {},
+                                executor_at&& executor = {}) noexcept {
+        if (!is_dummy<executor_at>()) {
+            positional_file_t file(file_path, false);
+            return load_from_file(file, executor, std::forward<progress_at>(progress));
+        }
         return load(input_file_t(file_path), std::forward<progress_at>(progress));
     }
 
@@ -2939,46 +4857,219 @@ class index_gt {
             return result;
         }
 
-        // Precompute offsets of every node, but before that we need to update the configs
-        // This could have been done with `std::exclusive_scan`, but it's only available from C++17.
-        using offsets_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<std::size_t>;
-        buffer_gt<std::size_t, offsets_allocator_t> offsets(header.size);
-        if (!offsets)
-            return result.failed("Out of memory");
+        // Precompute offsets of every node, but before that we need to update the configs
+        // This could have been done with `std::exclusive_scan`, but it's only available from C++17.
+        using offsets_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<std::size_t>;
+        buffer_gt<std::size_t, offsets_allocator_t> offsets(header.size);
+        if (!offsets)
+            return result.failed("Out of memory");
+
+        config_.connectivity = header.connectivity;
+        config_.connectivity_base = header.connectivity_base;
+        pre_ = precompute_(config_);
+        misaligned_ptr_gt<level_t> levels{(byte_t*)file.data() + offset + sizeof(header)};
+        offsets[0u] = offset + sizeof(header) + sizeof(level_t) * header.size;
+        for (std::size_t i = 1; i < header.size; ++i)
+            offsets[i] = offsets[i - 1] + node_bytes_(levels[i - 1]);
+
+        std::size_t total_bytes = offsets[header.size - 1] + node_bytes_(levels[header.size - 1]);
+        if (file.size() < total_bytes) {
+            reset();
+            return result.failed("File is corrupted and can't fit all the nodes");
+        }
+
+        // Submit metadata and reserve memory
+        index_limits_t limits;
+        limits.members = header.size;
+        if (!reserve(limits)) {
+            reset();
+            return result.failed("Out of memory");
+        }
+        nodes_count_ = header.size;
+        max_level_ = static_cast<level_t>(header.max_level);
+        entry_slot_ = static_cast<compressed_slot_t>(header.entry_slot);
+
+        // Rapidly address all the nodes
+        for (std::size_t i = 0; i != header.size; ++i) {
+            nodes_[i] = node_t{(byte_t*)file.data() + offsets[i]};
+            if (!progress(i + 1, header.size))
+                return result.failed("Terminated by user");
+        }
+        viewed_file_ = std::move(file);
+        return {};
+    }
+
+#pragma endregion
+
+#pragma region Snapshots
+
+    /**
+     *  @brief  Starts a point-in-time snapshot, that writers keep consistent while they continue
+     *          inserting, updating, and re-keying members, copying each node aside before its first change.
+     *
+     *  Only one snapshot may be active at a time. It costs one pointer per member upfront, plus the
+     *  nodes modified while it is alive. Members added afterwards aren't part of it, and the links
+     *  pointing to them are dropped on export. Must not overlap with `reserve`, `clear`, `reset`,
+     *  `compact`, or `reorder`.
+     *
+     *  @return `true` if the snapshot was started, `false` if one is already active or memory is missing.
+     */
+    bool snapshot_begin() noexcept {
+        if (snapshot_.load() || is_compressed())
+            return false;
+        snapshot_state_t* snapshot = new (std::nothrow) snapshot_state_t;
+        if (!snapshot)
+            return false;
+
+        // New slots are claimed under the global lock, but their nodes may still be on their way
+        std::unique_lock<std::mutex> global_lock(global_mutex_);
+        std::size_t count = nodes_count_.load();
+        snapshot->nodes = buffer_gt<byte_t*>(count);
+        if (count && !snapshot->nodes) {
+            delete snapshot;
+            return false;
+        }
+        std::size_t size = 0;
+        for (; size != count && nodes_[size]; ++size)
+            snapshot->nodes[size] = nodes_[size].tape();
+        snapshot->size = size;
+        snapshot->max_level = max_level_;
+        snapshot->entry_slot = entry_slot_;
+
+        snapshot_state_t* expected = nullptr;
+        if (!snapshot_.compare_exchange_strong(expected, snapshot)) {
+            delete snapshot;
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     *  @brief  Discards the active snapshot, if any, waiting for the writers that may be preserving nodes.
+     */
+    void snapshot_end() noexcept {
+        snapshot_state_t* snapshot = snapshot_.exchange(nullptr);
+        if (!snapshot)
+            return;
+
+        // Every node is preserved under its lock, so passing through all of them drains the writers
+        std::size_t count = nodes_count_.load();
+        for (std::size_t i = 0; i != count; ++i)
+            node_lock_t lock = node_lock_(i);
+
+        if (!has_reset<tape_allocator_t>())
+            for (std::size_t i = 0; i != snapshot->size; ++i) {
+                byte_t* tape = snapshot->nodes[i];
+                if (tape != nodes_[i].tape())
+                    snapshot->tape.deallocate(tape, node_bytes_(node_t{tape}.level()));
+            }
+        delete snapshot;
+    }
+
+    bool has_snapshot() const noexcept { return snapshot_.load() != nullptr; }
+
+    /// @brief  Number of members in the active snapshot, including the removed ones.
+    std::size_t snapshot_size() const noexcept {
+        snapshot_state_t* snapshot = snapshot_.load();
+        return snapshot ? snapshot->size : 0;
+    }
+
+    /**
+     *  @brief  Calls @p callback with the `member_cref_t` of the given ::slot, as it was when the active
+     *          snapshot was started. Holds the node lock meanwhile, so that the writers can't change
+     *          the member, or the data the caller keeps next to it, mid-way.
+     */
+    template <typename callback_at> void snapshot_visit(std::size_t slot, callback_at&& callback) const noexcept {
+        snapshot_state_t* snapshot = snapshot_.load();
+        node_lock_t lock = node_lock_(slot);
+        node_t node{snapshot->nodes[slot]};
+        callback(member_cref_t{node.ckey(), slot});
+    }
+
+    /// @brief  Estimates the length of `save_snapshot_to_stream` outputs, including the links dropped on export.
+    std::size_t snapshot_serialized_length() const noexcept {
+        snapshot_state_t* snapshot = snapshot_.load();
+        std::size_t neighbors_length = 0;
+        for (std::size_t i = 0; snapshot && i != snapshot->size; ++i) {
+            node_lock_t lock = node_lock_(i);
+            neighbors_length += node_bytes_(node_t{snapshot->nodes[i]}.level()) + sizeof(level_t);
+        }
+        return sizeof(index_serialized_header_t) + neighbors_length;
+    }
+
+    /**
+     *  @brief  Saves the active snapshot in the same format as `save_to_stream`,
+     *          while other threads keep modifying the live index.
+     */
+    template <typename output_callback_at, typename progress_at = dummy_progress_t>
+    serialization_result_t save_snapshot_to_stream(output_callback_at&& output,
+                                                   progress_at&& progress = {}) const noexcept {
+
+        serialization_result_t result;
+        snapshot_state_t* snapshot = snapshot_.load();
+        if (!snapshot)
+            return result.failed("No active snapshot to save");
 
-        config_.connectivity = header.connectivity;
-        config_.connectivity_base = header.connectivity_base;
-        pre_ = precompute_(config_);
-        misaligned_ptr_gt<level_t> levels{(byte_t*)file.data() + offset + sizeof(header)};
-        offsets[0u] = offset + sizeof(header) + sizeof(level_t) * header.size;
-        for (std::size_t i = 1; i < header.size; ++i)
-            offsets[i] = offsets[i - 1] + node_bytes_(levels[i - 1]);
+        index_serialized_header_t header;
+        header.size = snapshot->size;
+        header.connectivity = config_.connectivity;
+        header.connectivity_base = config_.connectivity_base;
+        header.max_level = snapshot->max_level;
+        header.entry_slot = snapshot->entry_slot;
+        if (!output(&header, sizeof(header)))
+            return result.failed("Failed to serialize the header into stream");
 
-        std::size_t total_bytes = offsets[header.size - 1] + node_bytes_(levels[header.size - 1]);
-        if (file.size() < total_bytes) {
-            reset();
-            return result.failed("File is corrupted and can't fit all the nodes");
-        }
+        // Progress status
+        std::size_t processed = 0;
+        std::size_t const total = 2 * header.size;
 
-        // Submit metadata and reserve memory
-        index_limits_t limits;
-        limits.members = header.size;
-        if (!reserve(limits)) {
-            reset();
-            return result.failed("Out of memory");
+        // Export the number of levels per node, that are only reset and restored by updates
+        for (std::size_t i = 0; i != header.size; ++i) {
+            level_t level;
+            {
+                node_lock_t lock = node_lock_(i);
+                level = node_t{snapshot->nodes[i]}.level();
+            }
+            if (!output(&level, sizeof(level)))
+                return result.failed("Failed to serialize into stream");
+            if (!progress(++processed, total))
+                return result.failed("Terminated by user");
         }
-        nodes_count_ = header.size;
-        max_level_ = static_cast<level_t>(header.max_level);
-        entry_slot_ = static_cast<compressed_slot_t>(header.entry_slot);
 
-        // Rapidly address all the nodes
+        // Copy every node under its lock, dropping the links to the members added after the snapshot
+        buffer_gt<byte_t> staging(node_bytes_(static_cast<level_t>((std::max)(snapshot->max_level, level_t(0)))));
+        if (!staging)
+            return result.failed("Out of memory");
         for (std::size_t i = 0; i != header.size; ++i) {
-            nodes_[i] = node_t{(byte_t*)file.data() + offsets[i]};
-            if (!progress(i + 1, header.size))
+            std::size_t node_length;
+            {
+                node_lock_t lock = node_lock_(i);
+                span_bytes_t node_bytes = node_bytes_(node_t{snapshot->nodes[i]});
+                node_length = node_bytes.size();
+                std::memcpy(staging.data(), node_bytes.data(), node_length);
+            }
+            node_t node{staging.data()};
+            for (level_t level = 0; level <= node.level(); ++level)
+                neighbors_(node, level).retain(
+                    [&](compressed_slot_t neighbor) { return static_cast<std::size_t>(neighbor) < header.size; });
+            if (!output(staging.data(), node_length))
+                return result.failed("Failed to serialize into stream");
+            if (!progress(++processed, total))
                 return result.failed("Terminated by user");
         }
-        viewed_file_ = std::move(file);
-        return {};
+
+        if (snapshot->failed.load())
+            return result.failed("Out of memory while preserving the snapshot");
+        return result;
+    }
+
+    /**
+     *  @brief  Replaces the key of the member in the given ::slot, preserving it for the active snapshot.
+     */
+    void update_key(std::size_t slot, vector_key_t key) noexcept {
+        node_lock_t lock = node_lock_(slot);
+        snapshot_preserve_(slot);
+        node_at_(slot).key(key);
     }
 
 #pragma endregion
@@ -3013,6 +5104,9 @@ class index_gt {
         progress_at&& progress = progress_at{}, //
         prefetch_at&& prefetch = prefetch_at{}) noexcept {
 
+        if (is_compressed())
+            return;
+
         // Export all the keys, slots, and levels.
         // Partition them with the predicate.
         // Sort the allowed entries in descending order of their level.
@@ -3054,17 +5148,227 @@ class index_gt {
             return a.level == b.level ? a.cluster < b.cluster : a.level > b.level;
         });
 
-        using size_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<std::size_t>;
-        buffer_gt<std::size_t, size_allocator_t> old_slot_to_new(slots_and_levels.size());
+        buffer_gt<compressed_slot_t, slots_allocator_t> new_slot_to_old(slots_and_levels.size());
+        if (!new_slot_to_old)
+            return;
         for (std::size_t new_slot = 0; new_slot != slots_and_levels.size(); ++new_slot)
-            old_slot_to_new[slots_and_levels[new_slot].old_slot] = new_slot;
+            new_slot_to_old[new_slot] = slots_and_levels[new_slot].old_slot;
 
-        // Erase all the incoming links
-        buffer_gt<node_t, nodes_allocator_t> reordered_nodes(slots_and_levels.size());
-        tape_allocator_t reordered_tape;
+        permute_(new_slot_to_old, slot_transition, progress, processed.load(), total);
+    }
+
+    /**
+     *  @brief  Renumbers the slots in the breadth-first order of the base level graph, starting from
+     *          the entry point, so that the neighbors of every node are likely stored on the same memory
+     *          pages. Improves locality for memory-mapped and large indexes, and is preserved by `save()`.
+     *          Nodes unreachable from the entry point are appended in their original order.
+     *
+     *  @param[in] slot_transition Callback to report every `(key, old_slot, new_slot)` transition.
+     *  @param[in] progress Callback to report the execution progress.
+     *  @return `false` if the operation was interrupted or failed to allocate memory.
+     */
+    template <typename slot_transition_at = dummy_key_to_key_mapping_t, typename progress_at = dummy_progress_t>
+    bool reorder(slot_transition_at&& slot_transition = slot_transition_at{},
+                 progress_at&& progress = progress_at{}) noexcept {
+
+        std::size_t const count = size();
+        if (!count)
+            return true;
+        if (is_compressed())
+            return false;
+
+        // Visited nodes are appended to the same buffer, which doubles as the BFS queue
+        buffer_gt<compressed_slot_t, slots_allocator_t> new_slot_to_old(count);
+        visits_hash_set_t& visits = contexts_[0].visits;
+        if (!new_slot_to_old || !visits.reserve(count))
+            return false;
+        visits.clear();
+
+        std::size_t const total = 3 * count;
+        std::size_t visited = 0;
+        std::size_t next_root = 0;
+        auto visit = [&](compressed_slot_t slot) {
+            if (!visits.set(slot))
+                new_slot_to_old[visited++] = slot;
+        };
+
+        visit(static_cast<compressed_slot_t>(entry_slot_));
+        for (std::size_t queue_head = 0; queue_head != count; ++queue_head) {
+            // Restart from the first unvisited slot, if the graph is disconnected
+            while (queue_head == visited)
+                visit(static_cast<compressed_slot_t>(next_root++));
+
+            neighbors_ref_t neighbors = neighbors_base_(node_at_(new_slot_to_old[queue_head]));
+            for (std::size_t i = 0; i != neighbors.size(); ++i)
+                visit(neighbors[i]);
+            if (!progress(queue_head + 1, total))
+                return false;
+        }
+        visits.clear();
+
+        return permute_(new_slot_to_old, slot_transition, progress, count, total);
+    }
+
+    struct compression_result_t {
+        error_t error{};
+        /// @brief  Bytes taken by the base-level neighbors lists before and after the compression.
+        std::size_t uncompressed_bytes{};
+        std::size_t compressed_bytes{};
+
+        explicit operator bool() const noexcept { return !error; }
+        compression_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+    };
+
+    /**
+     *  @brief  Packs the base-level neighbors lists of an index, that won't be modified anymore,
+     *          sorting every list and encoding the gaps between the neighbors in as few bytes as needed.
+     *          The nodes are rebuilt without those lists, and even for a memory-mapped index,
+     *          the searches stop touching the part of the file, where they were stored.
+     *
+     *  Makes the index immutable, and the searches decode the lists on the fly. Both `save` and `copy`
+     *  expand them back into the regular layout. Pays off the most after `reorder`, when the neighbors
+     *  have close slots, and for the `uint40_t` slots, where most of the gaps fit into 2 or 3 bytes.
+     *  Can't run concurrently with any other operation.
+     *
+     *  @param[in] executor Thread-pool to execute the job in parallel.
+     *  @param[in] progress Callback to report the execution progress.
+     */
+    template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t>
+    compression_result_t compress(executor_at&& executor = executor_at{},
+                                  progress_at&& progress = progress_at{}) noexcept {
+
+        compression_result_t result;
+        if (is_compressed())
+            return result;
+        if (snapshot_.load())
+            return result.failed("Can't compress an index with an active snapshot");
+        if (executor.size() > contexts_.size())
+            return result.failed("Reserve thread contexts for every executor thread!");
+
+        // Every thread sorts the lists in its own context
+        std::size_t const count = size();
+        buffer_gt<std::size_t, offsets_allocator_t> offsets(count + 1);
+        if (!offsets || !reserve_decoded_neighbors_(contexts_))
+            return result.failed("Out of memory!");
+        for (context_t& context : contexts_) {
+            if (context.neighbors_snapshot.size() >= config_.connectivity_base)
+                continue;
+            context.neighbors_snapshot = buffer_gt<compressed_slot_t, slots_allocator_t>(config_.connectivity_base);
+            if (!context.neighbors_snapshot)
+                return result.failed("Out of memory!");
+        }
+        auto sorted_neighbors = [&](std::size_t thread, std::size_t slot) {
+            compressed_slot_t* sorted = contexts_[thread].neighbors_snapshot.data();
+            neighbors_ref_t neighbors = neighbors_base_(node_at_(slot));
+            std::size_t const neighbors_count = neighbors.size();
+            for (std::size_t i = 0; i != neighbors_count; ++i)
+                sorted[i] = neighbors[i];
+            std::sort(sorted, sorted + neighbors_count);
+            return span_gt<compressed_slot_t>{sorted, neighbors_count};
+        };
+
+        // Measure the lists first, to place them back to back
+        std::atomic<bool> do_tasks{true};
+        std::atomic<std::size_t> processed{0};
+        std::size_t const total = 3 * count;
+        executor.dynamic(count, [&](std::size_t thread, std::size_t slot) {
+            span_gt<compressed_slot_t> sorted = sorted_neighbors(thread, slot);
+            offsets[slot + 1] = neighbors_encode_(sorted.data(), sorted.size(), nullptr);
+            ++processed;
+            if (thread == 0)
+                do_tasks = progress(processed.load(), total);
+            return do_tasks.load();
+        });
+        if (!do_tasks)
+            return result.failed("Terminated by user");
+        offsets[0] = 0;
+        for (std::size_t slot = 0; slot != count; ++slot)
+            offsets[slot + 1] += offsets[slot];
+
+        // The decoder loads 8 bytes at a time, so the last list needs some padding
+        std::size_t const padding = sizeof(std::uint64_t);
+        buffer_gt<byte_t, bytes_allocator_t> compressed(offsets[count] + padding);
+        if (!compressed)
+            return result.failed("Out of memory!");
+        std::memset(compressed.data() + offsets[count], 0, padding);
+        executor.dynamic(count, [&](std::size_t thread, std::size_t slot) {
+            span_gt<compressed_slot_t> sorted = sorted_neighbors(thread, slot);
+            neighbors_encode_(sorted.data(), sorted.size(), compressed.data() + offsets[slot]);
+            ++processed;
+            if (thread == 0)
+                do_tasks = progress(processed.load(), total);
+            return do_tasks.load();
+        });
+        if (!do_tasks)
+            return result.failed("Terminated by user");
+
+        // Rebuild the nodes without the base-level lists, keeping the co-located vectors and upper levels
+        buffer_gt<node_t, nodes_allocator_t> compressed_nodes(count);
+        tape_allocator_t compressed_tape(tape_allocator_);
+        if (count && !compressed_nodes)
+            return result.failed("Out of memory!");
+        std::size_t const tail_bytes_per_level = pre_.neighbors_bytes;
+        for (std::size_t slot = 0; slot != count; ++slot) {
+            node_t node = node_at_(slot);
+            level_t const level = node.level();
+            std::size_t const tail_bytes = pre_.vector_bytes + level * tail_bytes_per_level;
+            byte_t* tape = (byte_t*)compressed_tape.allocate(node_head_bytes_() + tail_bytes);
+            if (!tape) {
+                if (!has_reset<tape_allocator_t>())
+                    for (std::size_t i = 0; i != slot; ++i)
+                        compressed_tape.deallocate(compressed_nodes[i].tape(),
+                                                   node_head_bytes_() + pre_.vector_bytes +
+                                                       compressed_nodes[i].level() * tail_bytes_per_level);
+                return result.failed("Out of memory!");
+            }
+            std::memcpy(tape, node.tape(), node_head_bytes_());
+            std::memcpy(tape + node_head_bytes_(), node_vector_(node), tail_bytes);
+            compressed_nodes[slot] = node_t{tape};
+            if (!progress(++processed, total))
+                return result.failed("Terminated by user");
+        }
+
+        // Nodes of a memory-mapped index stay in the file, the others are released
+        if (!viewed_file_ && !has_reset<tape_allocator_t>())
+            for (std::size_t slot = 0; slot != count; ++slot)
+                tape_allocator_.deallocate(node_at_(slot).tape(), node_bytes_(node_at_(slot)).size());
+        if (count)
+            std::memcpy(nodes_.data(), compressed_nodes.data(), count * sizeof(node_t));
+        tape_allocator_ = std::move(compressed_tape);
+
+        result.uncompressed_bytes = count * pre_.neighbors_base_bytes;
+        result.compressed_bytes = offsets[count] + (count + 1) * sizeof(std::size_t);
+        pre_.node_base_bytes = 0;
+        compressed_neighbors_ = std::move(compressed);
+        compressed_offsets_ = std::move(offsets);
+        return result;
+    }
+
+  private:
+    /**
+     *  @brief  Rebuilds the nodes tape in the order defined by ::new_slot_to_old, translating all the links.
+     *  @return `false` if the operation was interrupted, leaving the index unchanged.
+     */
+    template <typename slot_transition_at, typename progress_at>
+    bool permute_(buffer_gt<compressed_slot_t, slots_allocator_t> const& new_slot_to_old,
+                  slot_transition_at&& slot_transition, progress_at&& progress, std::size_t processed,
+                  std::size_t total) noexcept {
+
+        using size_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<std::size_t>;
+        buffer_gt<std::size_t, size_allocator_t> old_slot_to_new(new_slot_to_old.size());
+        buffer_gt<node_t, nodes_allocator_t> reordered_nodes(new_slot_to_old.size());
+        if (!old_slot_to_new || !reordered_nodes)
+            return false;
+        for (std::size_t new_slot = 0; new_slot != new_slot_to_old.size(); ++new_slot)
+            old_slot_to_new[new_slot_to_old[new_slot]] = new_slot;
 
-        for (std::size_t new_slot = 0; new_slot != slots_and_levels.size(); ++new_slot) {
-            std::size_t old_slot = slots_and_levels[new_slot].old_slot;
+        // Translate all the outgoing links
+        tape_allocator_t reordered_tape(tape_allocator_);
+        for (std::size_t new_slot = 0; new_slot != new_slot_to_old.size(); ++new_slot) {
+            std::size_t old_slot = new_slot_to_old[new_slot];
             node_t old_node = node_at_(old_slot);
 
             std::size_t node_bytes = node_bytes_(old_node.level());
@@ -3078,23 +5382,26 @@ class index_gt {
 
             reordered_nodes[new_slot] = new_node;
             if (!progress(++processed, total))
-                return;
+                return false;
         }
 
-        for (std::size_t new_slot = 0; new_slot != slots_and_levels.size(); ++new_slot) {
-            std::size_t old_slot = slots_and_levels[new_slot].old_slot;
+        for (std::size_t new_slot = 0; new_slot != new_slot_to_old.size(); ++new_slot) {
+            std::size_t old_slot = new_slot_to_old[new_slot];
             slot_transition(node_at_(old_slot).ckey(),                //
                             static_cast<compressed_slot_t>(old_slot), //
                             static_cast<compressed_slot_t>(new_slot));
             if (!progress(++processed, total))
-                return;
+                return false;
         }
 
         nodes_ = std::move(reordered_nodes);
         tape_allocator_ = std::move(reordered_tape);
         entry_slot_ = old_slot_to_new[entry_slot_];
+        return true;
     }
 
+  public:
+
     /**
      *  @brief  Scans the whole collection, removing the links leading towards
      *          banned entries. This essentially isolates some nodes from the rest
@@ -3116,6 +5423,9 @@ class index_gt {
         executor_at&& executor = executor_at{}, //
         progress_at&& progress = progress_at{}) noexcept {
 
+        if (is_compressed())
+            return;
+
         // Progress status
         std::atomic<bool> do_tasks{true};
         std::atomic<std::size_t> processed{0};
@@ -3123,17 +5433,14 @@ class index_gt {
         // Erase all the incoming links
         std::size_t nodes_count = size();
         executor.dynamic(nodes_count, [&](std::size_t thread_idx, std::size_t node_idx) {
+            node_lock_t lock = node_lock_(node_idx);
+            snapshot_preserve_(node_idx);
             node_t node = node_at_(node_idx);
             for (level_t level = 0; level <= node.level(); ++level) {
-                neighbors_ref_t neighbors = neighbors_(node, level);
-                std::size_t old_size = neighbors.size();
-                neighbors.clear();
-                for (std::size_t i = 0; i != old_size; ++i) {
-                    compressed_slot_t neighbor_slot = neighbors[i];
+                neighbors_(node, level).retain([&](compressed_slot_t neighbor_slot) {
                     node_t neighbor = node_at_(neighbor_slot);
-                    if (allow_member(member_cref_t{neighbor.ckey(), neighbor_slot}))
-                        neighbors.push_back(neighbor_slot);
-                }
+                    return allow_member(member_cref_t{neighbor.ckey(), neighbor_slot});
+                });
             }
             ++processed;
             if (thread_idx == 0)
@@ -3145,12 +5452,153 @@ class index_gt {
         progress(processed.load(), nodes_count);
     }
 
+    /**
+     *  @brief  Replaces the links of the given ::slot leading towards banned entries with the
+     *          best of their own neighbors, pruned with the same heuristic as the insertions.
+     *          Thread-safe, and can run concurrently with additions, updates, and searches.
+     *
+     *  Unlike `isolate`, it doesn't just cut the links, but bridges the gaps they leave, like
+     *  the FreshDiskANN deletions do. Similar to the optimistic insertions, the candidates are
+     *  ranked without holding the node lock, and a list is only replaced if no other thread
+     *  has changed it meanwhile. Otherwise it is left for the next call.
+     *
+     *  @param[in] slot The member, whose outgoing links should be repaired.
+     *  @param[in] metric Callable object measuring distance between ::value and present objects.
+     *  @param[in] allow_member Predicate returning `false` for the removed members.
+     *  @param[in] thread The thread, whose context will be used for temporary buffers.
+     */
+    template <typename metric_at, typename allow_member_at = dummy_predicate_t>
+    repair_result_t repair(                                  //
+        std::size_t slot, metric_at&& metric,                //
+        allow_member_at&& allow_member = allow_member_at{}, //
+        std::size_t thread = 0) usearch_noexcept_m {
+
+        repair_result_t result;
+        if (is_compressed())
+            return result.failed("Can't repair a compressed index");
+        context_t& context = contexts_[thread];
+        top_candidates_t& top = context.top_candidates;
+        visits_hash_set_t& visits = context.visits;
+        std::size_t const connectivity_max = (std::max)(config_.connectivity_base, config_.connectivity);
+        if (context.neighbors_snapshot.size() < connectivity_max) {
+            context.neighbors_snapshot = buffer_gt<compressed_slot_t, slots_allocator_t>(connectivity_max);
+            if (!context.neighbors_snapshot)
+                return result.failed("Out of memory!");
+        }
+        if (!top.reserve(connectivity_max * (connectivity_max + 1)) ||
+            !visits.reserve(connectivity_max * (connectivity_max + 1)))
+            return result.failed("Out of memory!");
+
+        auto is_allowed = [&](compressed_slot_t neighbor_slot) {
+            return allow_member(member_cref_t{node_at_(neighbor_slot).ckey(), neighbor_slot});
+        };
+        std::size_t const computed_distances = context.computed_distances_count;
+        compressed_slot_t* snapshot = context.neighbors_snapshot.data();
+        node_t node = node_at_(slot);
+        for (level_t level = 0; level <= node.level(); ++level) {
+            std::size_t const level_connectivity = level ? config_.connectivity : config_.connectivity_base;
+
+            // Copy the current links under a short lock
+            std::size_t snapshot_size = 0, banned_count = 0;
+            {
+                node_lock_t lock = node_lock_(slot);
+                neighbors_ref_t neighbors = neighbors_(node, level);
+                snapshot_size = neighbors.size();
+                for (std::size_t idx = 0; idx != snapshot_size; ++idx) {
+                    snapshot[idx] = neighbors[idx];
+                    banned_count += !is_allowed(snapshot[idx]);
+                }
+            }
+            if (!banned_count)
+                continue;
+
+            // Rank the remaining neighbors together with the neighbors of the banned ones
+            top.clear();
+            visits.clear();
+            visits.set(static_cast<compressed_slot_t>(slot));
+            auto consider = [&](compressed_slot_t candidate_slot) {
+                if (!visits.set(candidate_slot) && is_allowed(candidate_slot))
+                    top.insert_reserved(
+                        {context.measure(citerator_at(slot), citerator_at(candidate_slot), metric), candidate_slot});
+            };
+            for (std::size_t idx = 0; idx != snapshot_size; ++idx) {
+                if (is_allowed(snapshot[idx])) {
+                    consider(snapshot[idx]);
+                    continue;
+                }
+                node_lock_t banned_lock = node_lock_(snapshot[idx]);
+                node_t banned = node_at_(snapshot[idx]);
+                if (level <= banned.level())
+                    for (compressed_slot_t candidate_slot : neighbors_(banned, level))
+                        consider(candidate_slot);
+            }
+            candidates_view_t top_view = refine_(metric, level_connectivity, top, context);
+
+            // Commit, unless another thread has updated the list meanwhile
+            node_lock_t lock = node_lock_(slot);
+            neighbors_ref_t neighbors = neighbors_(node, level);
+            bool unchanged = neighbors.size() == snapshot_size;
+            for (std::size_t idx = 0; unchanged && idx != snapshot_size; ++idx)
+                unchanged = neighbors[idx] == snapshot[idx];
+            if (!unchanged)
+                continue;
+            snapshot_preserve_(slot);
+            neighbors.clear();
+            for (std::size_t idx = 0; idx != top_view.size(); idx++)
+                neighbors.push_back(top_view[idx].slot);
+            result.repaired_links += banned_count;
+        }
+
+        result.computed_distances = context.computed_distances_count - computed_distances;
+        return result;
+    }
+
+    /**
+     *  @brief  Repairs the members, that the removed ::slot links to, right after its removal.
+     *          As the links are mostly mutual, those are most of the members linking to it,
+     *          and the rest are left for the later `repair` calls. Thread-safe.
+     */
+    template <typename metric_at, typename allow_member_at = dummy_predicate_t>
+    repair_result_t repair_neighbors(                        //
+        std::size_t slot, metric_at&& metric,                //
+        allow_member_at&& allow_member = allow_member_at{}, //
+        std::size_t thread = 0) usearch_noexcept_m {
+
+        repair_result_t result;
+        if (is_compressed())
+            return result.failed("Can't repair a compressed index");
+        std::size_t const connectivity_max = (std::max)(config_.connectivity_base, config_.connectivity);
+        buffer_gt<compressed_slot_t, slots_allocator_t> targets(connectivity_max);
+        if (!targets)
+            return result.failed("Out of memory!");
+
+        node_t node = node_at_(slot);
+        for (level_t level = 0; level <= node.level(); ++level) {
+            std::size_t targets_count = 0;
+            {
+                node_lock_t lock = node_lock_(slot);
+                for (compressed_slot_t target : neighbors_(node, level))
+                    targets[targets_count++] = target;
+            }
+            for (std::size_t idx = 0; idx != targets_count; ++idx) {
+                repair_result_t target_result = repair(targets[idx], metric, allow_member, thread);
+                if (!target_result)
+                    return target_result;
+                result.repaired_links += target_result.repaired_links;
+                result.computed_distances += target_result.computed_distances;
+            }
+        }
+        return result;
+    }
+
   private:
     inline static precomputed_constants_t precompute_(index_config_t const& config) noexcept {
         precomputed_constants_t pre;
         pre.inverse_log_connectivity = 1.0 / std::log(static_cast<double>(config.connectivity));
         pre.neighbors_bytes = config.connectivity * sizeof(compressed_slot_t) + sizeof(neighbors_count_t);
         pre.neighbors_base_bytes = config.connectivity_base * sizeof(compressed_slot_t) + sizeof(neighbors_count_t);
+        pre.node_base_bytes = pre.neighbors_base_bytes;
+        pre.vector_bytes = config.vector_bytes;
         return pre;
     }
 
@@ -3158,11 +5606,15 @@ class index_gt {
 
     inline span_bytes_t node_bytes_(node_t node) const noexcept { return {node.tape(), node_bytes_(node.level())}; }
     inline std::size_t node_bytes_(level_t level) const noexcept {
-        return node_head_bytes_() + node_neighbors_bytes_(level);
+        return node_head_bytes_() + node_neighbors_bytes_(level) + pre_.vector_bytes;
     }
     inline std::size_t node_neighbors_bytes_(node_t node) const noexcept { return node_neighbors_bytes_(node.level()); }
     inline std::size_t node_neighbors_bytes_(level_t level) const noexcept {
-        return pre_.neighbors_base_bytes + pre_.neighbors_bytes * level;
+        return pre_.node_base_bytes + pre_.neighbors_bytes * level;
+    }
+    /// @brief  Length of the node in the regular layout, which differs from `node_bytes_` once `compress`-ed.
+    inline std::size_t node_exported_bytes_(level_t level) const noexcept {
+        return node_bytes_(level) + pre_.neighbors_base_bytes - pre_.node_base_bytes;
     }
 
     span_bytes_t node_malloc_(level_t level) noexcept {
@@ -3192,7 +5644,7 @@ class index_gt {
     }
 
     void node_free_(std::size_t idx) noexcept {
-        if (viewed_file_)
+        if (viewed_file_ && !is_compressed())
             return;
 
         node_t& node = nodes_[idx];
@@ -3201,16 +5653,159 @@ class index_gt {
     }
 
     inline node_t node_at_(std::size_t idx) const noexcept { return nodes_[idx]; }
+    inline byte_t* node_vector_(node_t node) const noexcept {
+        return node.neighbors_tape() + pre_.node_base_bytes;
+    }
     inline neighbors_ref_t neighbors_base_(node_t node) const noexcept { return {node.neighbors_tape()}; }
 
     inline neighbors_ref_t neighbors_non_base_(node_t node, level_t level) const noexcept {
-        return {node.neighbors_tape() + pre_.neighbors_base_bytes + (level - 1) * pre_.neighbors_bytes};
+        return {node.neighbors_tape() + pre_.node_base_bytes + pre_.vector_bytes +
+                (level - 1) * pre_.neighbors_bytes};
     }
 
     inline neighbors_ref_t neighbors_(node_t node, level_t level) const noexcept {
         return level ? neighbors_non_base_(node, level) : neighbors_base_(node);
     }
 
+    /**
+     *  @brief  Base-level neighbors of the ::slot. Once `compress`-ed, those are decoded into ::decoded,
+     *          that must fit `neighbors_base_bytes`, and are only valid until it is reused.
+     */
+    inline neighbors_ref_t neighbors_base_at_(std::size_t slot, byte_t* decoded) const noexcept {
+        if (!is_compressed())
+            return neighbors_base_(node_at_(slot));
+        neighbors_decode_(slot, decoded);
+        return {decoded};
+    }
+
+    inline std::size_t neighbors_base_count_(std::size_t slot) const noexcept {
+        if (!is_compressed())
+            return neighbors_base_(node_at_(slot)).size();
+        unsigned char const* input = compressed_neighbors_at_(slot);
+        return varint_decode_(input);
+    }
+
+    /// @brief  Requests the memory with the base-level neighbors of the ::slot, that will be expanded soon.
+    inline void prefetch_base_(std::size_t slot) const noexcept {
+        if (is_compressed())
+            prefetch_m(compressed_neighbors_at_(slot));
+        else
+            prefetch_m(node_at_(slot).tape());
+    }
+
+    /// @brief  Bytes taken by the `compress`-ed base-level list of the ::slot, or zero for the regular layout.
+    inline std::size_t compressed_neighbors_bytes_(std::size_t slot) const noexcept {
+        return is_compressed() ? compressed_offsets_[slot + 1] - compressed_offsets_[slot] : 0;
+    }
+
+    inline unsigned char const* compressed_neighbors_at_(std::size_t slot) const noexcept {
+        return reinterpret_cast<unsigned char const*>(compressed_neighbors_.data() + compressed_offsets_[slot]);
+    }
+
+    /// @brief  Byte length of a gap between the consecutive slots in a `compress`-ed list for a 2-bit code.
+    static constexpr std::size_t gap_bytes_(unsigned code) noexcept {
+        return code < 3 ? code + 1 : sizeof(compressed_slot_t);
+    }
+
+    static std::size_t varint_decode_(unsigned char const*& input) noexcept {
+        std::size_t value = 0;
+        for (std::size_t shift = 0;; shift += 7) {
+            unsigned char const byte = *input++;
+            value |= static_cast<std::size_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                return value;
+        }
+    }
+
+    /**
+     *  @brief  Encodes the ascending ::slots, starting with their count as a varint, followed by the 2-bit
+     *          length codes of the gaps between them, four per byte, and the little-endian gaps themselves.
+     *          Keeping the codes apart from the data, like Stream-VByte, makes them SIMD-decodable.
+     *  @return The number of bytes needed, that are written to ::output, unless it is `nullptr`.
+     */
+    static std::size_t neighbors_encode_(compressed_slot_t const* slots, std::size_t count, byte_t* output) noexcept {
+        std::size_t length = 0;
+        std::size_t remaining = count;
+        do {
+            unsigned char byte = static_cast<unsigned char>(remaining & 0x7F);
+            remaining >>= 7;
+            if (remaining)
+                byte |= 0x80;
+            if (output)
+                output[length] = static_cast<byte_t>(byte);
+            ++length;
+        } while (remaining);
+
+        std::size_t const codes_offset = length;
+        length += divide_round_up<4>(count);
+        if (output)
+            std::memset(output + codes_offset, 0, length - codes_offset);
+
+        std::uint64_t previous = 0;
+        for (std::size_t i = 0; i != count; ++i) {
+            std::uint64_t const current = static_cast<std::size_t>(slots[i]);
+            std::uint64_t const gap = current - previous;
+            unsigned const code = gap < (1ull << 8) ? 0u : gap < (1ull << 16) ? 1u : gap < (1ull << 24) ? 2u : 3u;
+            std::size_t const bytes = gap_bytes_(code);
+            if (output) {
+                output[codes_offset + i / 4] |= static_cast<byte_t>(code << (2 * (i % 4)));
+                for (std::size_t byte_idx = 0; byte_idx != bytes; ++byte_idx)
+                    output[length + byte_idx] = static_cast<byte_t>((gap >> (8 * byte_idx)) & 0xFF);
+            }
+            previous = current;
+            length += bytes;
+        }
+        return length;
+    }
+
+    /**
+     *  @brief  Expands the `compress`-ed base-level list of the ::slot into the `neighbors_ref_t` layout.
+     *          Loads 8 bytes per gap, reading past the list into the padding of `compressed_neighbors_`.
+     */
+    void neighbors_decode_(std::size_t slot, byte_t* decoded) const noexcept {
+        unsigned char const* input = compressed_neighbors_at_(slot);
+        std::size_t const count = varint_decode_(input);
+        unsigned char const* codes = input;
+        input += divide_round_up<4>(count);
+
+        misaligned_store<neighbors_count_t>(decoded, static_cast<neighbors_count_t>(count));
+        byte_t* slots = decoded + sizeof(neighbors_count_t);
+        std::uint64_t current = 0;
+        for (std::size_t i = 0; i != count; ++i) {
+            std::size_t const bytes = gap_bytes_((codes[i / 4] >> (2 * (i % 4))) & 3u);
+            std::uint64_t gap;
+            std::memcpy(&gap, input, sizeof(gap));
+            current += gap & (~std::uint64_t(0) >> (64 - 8 * bytes));
+            input += bytes;
+            misaligned_store<compressed_slot_t>(slots + i * sizeof(compressed_slot_t),
+                                                static_cast<compressed_slot_t>(static_cast<std::size_t>(current)));
+        }
+    }
+
+    /// @brief  Writes the node in the ::slot into ::output in the regular layout, expanding its base-level list.
+    void node_export_(std::size_t slot, byte_t* output) const noexcept {
+        node_t node = node_at_(slot);
+        level_t const level = node.level();
+        std::memcpy(output, node.tape(), node_head_bytes_());
+        byte_t* base = output + node_head_bytes_();
+        std::memset(base, 0, pre_.neighbors_base_bytes);
+        neighbors_decode_(slot, base);
+        std::memcpy(base + pre_.neighbors_base_bytes, node_vector_(node),
+                    pre_.vector_bytes + level * pre_.neighbors_bytes);
+    }
+
+    /// @brief  Allocates the room for two decoded base-level lists in every one of the ::contexts.
+    bool reserve_decoded_neighbors_(buffer_gt<context_t, contexts_allocator_t>& contexts) const noexcept {
+        for (context_t& context : contexts) {
+            if (context.decoded_neighbors.size() >= 2 * pre_.neighbors_base_bytes)
+                continue;
+            context.decoded_neighbors = buffer_gt<byte_t, bytes_allocator_t>(2 * pre_.neighbors_base_bytes);
+            if (!context.decoded_neighbors)
+                return false;
+        }
+        return true;
+    }
+
     struct node_lock_t {
         nodes_mutexes_t& mutexes;
         std::size_t slot;
@@ -3218,28 +5813,96 @@ class index_gt {
     };
 
     inline node_lock_t node_lock_(std::size_t slot) const noexcept {
+#if USEARCH_USE_INSTRUMENTATION
+        if (nodes_mutexes_.atomic_set(slot)) {
+            std::uint64_t const started = instrumentation_nanoseconds();
+            while (nodes_mutexes_.atomic_set(slot))
+                ;
+            node_lock_waits_.fetch_add(1, std::memory_order_relaxed);
+            node_lock_wait_nanoseconds_.fetch_add(instrumentation_nanoseconds() - started, std::memory_order_relaxed);
+        }
+#else
         while (nodes_mutexes_.atomic_set(slot))
             ;
+#endif
         return {nodes_mutexes_, slot};
     }
 
+#if USEARCH_USE_INSTRUMENTATION
+    /// @brief  Adds a finished query to the instrumentation histograms.
+    void instrument_query_(std::uint64_t started, std::size_t hops, std::size_t computed_distances) const noexcept {
+        latency_histogram_.record(instrumentation_nanoseconds() - started);
+        hops_histogram_.record(hops);
+        distances_histogram_.record(computed_distances);
+    }
+#endif
+
+    /**
+     *  @brief  Copies the node aside before its first change since `snapshot_begin`,
+     *          so that the active snapshot keeps seeing its older state. Must be called under the node lock.
+     */
+    void snapshot_preserve_(std::size_t slot) noexcept {
+        snapshot_state_t* snapshot = snapshot_.load();
+        if (!snapshot || slot >= snapshot->size)
+            return;
+        byte_t* live = nodes_[slot].tape();
+        if (snapshot->nodes[slot] != live)
+            return;
+
+        span_bytes_t node_bytes = node_bytes_(nodes_[slot]);
+        byte_t* copy;
+        {
+            std::unique_lock<std::mutex> lock(snapshot->tape_mutex);
+            copy = (byte_t*)snapshot->tape.allocate(node_bytes.size());
+        }
+        if (!copy) {
+            snapshot->failed = true;
+            return;
+        }
+        std::memcpy(copy, node_bytes.data(), node_bytes.size());
+        snapshot->nodes[slot] = copy;
+    }
+
+    /**
+     *  @brief  Links the node at ::node_slot into every level from ::target_level down to the base one.
+     *  @param[in] node_locked Whether the caller holds the node lock throughout. If not, the lock is only
+     *                         taken to write the links of the node, which are then reverse-linked from a copy.
+     */
     template <typename value_at, typename metric_at, typename prefetch_at>
     void connect_node_across_levels_(                                                           //
         value_at&& value, metric_at&& metric, prefetch_at&& prefetch,                           //
         std::size_t node_slot, std::size_t entry_slot, level_t max_level, level_t target_level, //
-        index_update_config_t const& config, context_t& context) usearch_noexcept_m {
+        index_update_config_t const& config, context_t& context, bool node_locked = true) usearch_noexcept_m {
 
         // Go down the level, tracking only the closest match
         std::size_t closest_slot = search_for_one_( //
             value, metric, prefetch,                //
-            entry_slot, max_level, target_level, context);
+            entry_slot, max_level, target_level, context, config.prefetch_depth);
 
         // From `target_level` down perform proper extensive search
         for (level_t level = (std::min)(target_level, max_level); level >= 0; --level) {
             // TODO: Handle out of memory conditions
-            search_to_insert_(value, metric, prefetch, closest_slot, node_slot, level, config.expansion, context);
-            closest_slot = connect_new_node_(metric, node_slot, level, context);
-            reconnect_neighbor_nodes_(metric, node_slot, value, level, context);
+            search_to_insert_(value, metric, prefetch, closest_slot, node_slot, level, config.expansion, context,
+                              config.prefetch_depth);
+            if (node_locked) {
+                closest_slot = connect_new_node_(metric, node_slot, level, context);
+                reconnect_neighbor_nodes_(metric, node_slot, value, level, neighbors_(node_at_(node_slot), level),
+                                          config.optimistic, context);
+                continue;
+            }
+
+            // Others may have linked back to the node meanwhile, but its list is formed from scratch
+            span_gt<compressed_slot_t> linked;
+            {
+                node_lock_t node_lock = node_lock_(node_slot);
+                neighbors_ref_t neighbors = neighbors_(node_at_(node_slot), level);
+                neighbors.clear();
+                closest_slot = connect_new_node_(metric, node_slot, level, context);
+                linked = {context.updated_neighbors.data(), neighbors.size()};
+                for (std::size_t idx = 0; idx != linked.size(); ++idx)
+                    linked[idx] = neighbors[idx];
+            }
+            reconnect_neighbor_nodes_(metric, node_slot, value, level, linked, config.optimistic, context);
         }
     }
 
@@ -3266,21 +5929,22 @@ class index_gt {
         return new_neighbors[0];
     }
 
-    template <typename value_at, typename metric_at>
+    template <typename value_at, typename metric_at, typename neighbors_at>
     void reconnect_neighbor_nodes_( //
-        metric_at&& metric, std::size_t new_slot, value_at&& value, level_t level,
-        context_t& context) usearch_noexcept_m {
+        metric_at&& metric, std::size_t new_slot, value_at&& value, level_t level, neighbors_at&& new_neighbors,
+        bool optimistic, context_t& context) usearch_noexcept_m {
 
-        node_t new_node = node_at_(new_slot);
         top_candidates_t& top = context.top_candidates;
-        neighbors_ref_t new_neighbors = neighbors_(new_node, level);
 
         // Reverse links from the neighbors:
         std::size_t const connectivity_max = level ? config_.connectivity : config_.connectivity_base;
         for (compressed_slot_t close_slot : new_neighbors) {
             if (close_slot == new_slot)
                 continue;
+            if (optimistic && reconnect_optimistically_(metric, new_slot, value, close_slot, level, context))
+                continue;
             node_lock_t close_lock = node_lock_(close_slot);
+            snapshot_preserve_(close_slot);
             node_t close_node = node_at_(close_slot);
 
             neighbors_ref_t close_header = neighbors_(close_node, level);
@@ -3312,6 +5976,267 @@ class index_gt {
         }
     }
 
+    /**
+     *  @brief  Optimistic analog of the reverse link update in `reconnect_neighbor_nodes_`.
+     *          Copies the neighbors list of ::close_slot under a short lock, runs the heuristic
+     *          without holding it, and commits the result only if the list is still the same.
+     *  @return `false` if the list was modified concurrently, and the update must be repeated under lock.
+     */
+    template <typename value_at, typename metric_at>
+    bool reconnect_optimistically_( //
+        metric_at&& metric, std::size_t new_slot, value_at&& value, compressed_slot_t close_slot, level_t level,
+        context_t& context) usearch_noexcept_m {
+
+        node_t close_node = node_at_(close_slot);
+        top_candidates_t& top = context.top_candidates;
+        compressed_slot_t* snapshot = context.neighbors_snapshot.data();
+        std::size_t const connectivity_max = level ? config_.connectivity : config_.connectivity_base;
+        std::size_t snapshot_size = 0;
+        {
+            node_lock_t close_lock = node_lock_(close_slot);
+            neighbors_ref_t close_header = neighbors_(close_node, level);
+            usearch_assert_m(close_header.size() <= connectivity_max, "Possible corruption");
+            usearch_assert_m(level <= close_node.level(), "Linking to missing level");
+
+            // Appending is cheap enough to be done right away
+            if (close_header.size() < connectivity_max) {
+                snapshot_preserve_(close_slot);
+                close_header.push_back(static_cast<compressed_slot_t>(new_slot));
+                return true;
+            }
+            snapshot_size = close_header.size();
+            for (std::size_t idx = 0; idx != snapshot_size; ++idx)
+                snapshot[idx] = close_header[idx];
+        }
+
+        // To fit a new connection we need to drop an existing one.
+        top.clear();
+        usearch_assert_m((top.reserve(snapshot_size + 1)), "The memory must have been reserved in `add`");
+        top.insert_reserved(
+            {context.measure(value, citerator_at(close_slot), metric), static_cast<compressed_slot_t>(new_slot)});
+        for (std::size_t idx = 0; idx != snapshot_size; ++idx)
+            top.insert_reserved(
+                {context.measure(citerator_at(close_slot), citerator_at(snapshot[idx]), metric), snapshot[idx]});
+        candidates_view_t top_view = refine_(metric, connectivity_max, top, context);
+
+        // Validate, that no other thread has updated the list meanwhile
+        node_lock_t close_lock = node_lock_(close_slot);
+        neighbors_ref_t close_header = neighbors_(close_node, level);
+        if (close_header.size() != snapshot_size)
+            return false;
+        for (std::size_t idx = 0; idx != snapshot_size; ++idx)
+            if (close_header[idx] != snapshot[idx])
+                return false;
+
+        // Export the results:
+        snapshot_preserve_(close_slot);
+        close_header.clear();
+        for (std::size_t idx = 0; idx != top_view.size(); idx++)
+            close_header.push_back(top_view[idx].slot);
+        return true;
+    }
+
+    /**
+     *  @brief  Links a batch of already allocated nodes into the graph formed by the previous batches.
+     *          Must not overlap with any other operation, so the nodes aren't locked.
+     *
+     *  Every node of the batch searches the linked part of the graph and forms its outgoing lists,
+     *  exporting every chosen link as a reverse link candidate for `link_reverse_`.
+     *
+     *  @param[inout] incoming_counts Zeroed counters for every slot, left zeroed on success.
+     *  @return `false` if run out of memory.
+     */
+    template <typename values_at, typename metric_at, typename executor_at, typename prefetch_at>
+    bool build_batch_(                                                                                  //
+        compressed_slot_t const* batch, std::size_t batch_size, values_at&& values, metric_at&& metric, //
+        index_build_config_t const& config, buffer_gt<atomic_counter_t>& incoming_counts,               //
+        executor_at&& executor, prefetch_at&& prefetch) usearch_noexcept_m {
+
+        // Every node may link to at most `connectivity` neighbors on each of its levels
+        buffer_gt<std::size_t> offsets(batch_size + 1);
+        if (!offsets)
+            return false;
+        offsets[0] = 0;
+        for (std::size_t i = 0; i != batch_size; ++i) {
+            std::size_t levels = static_cast<std::size_t>(node_at_(batch[i]).level()) + 1;
+            offsets[i + 1] = offsets[i] + levels * config_.connectivity;
+        }
+        std::size_t const capacity = offsets[batch_size];
+        buffer_gt<reverse_link_t, reverse_links_allocator_t> links(capacity);
+        buffer_gt<std::size_t> links_counts(batch_size);
+        buffer_gt<compressed_slot_t, slots_allocator_t> targets(capacity);
+        if (!links || !links_counts || !targets)
+            return false;
+
+        // Form the outgoing links, searching only through the previous batches
+        std::atomic<bool> succeeded{true};
+        std::atomic<std::size_t> targets_count{0};
+        executor.dynamic(batch_size, [&](std::size_t thread_idx, std::size_t task_idx) {
+            context_t& context = contexts_[thread_idx];
+            std::size_t const slot = batch[task_idx];
+            node_t node = node_at_(slot);
+            auto value = values[citerator_at(slot)];
+            level_t const target_level = node.level();
+            reverse_link_t* node_links = links.data() + offsets[task_idx];
+            std::size_t node_links_count = 0;
+
+            std::size_t closest_slot = search_for_one_( //
+                value, metric, prefetch,                //
+                entry_slot_, max_level_, target_level, context, config.prefetch_depth);
+            for (level_t level = target_level; level >= 0; --level) {
+                if (!search_to_insert_(value, metric, prefetch, closest_slot, slot, level, config.expansion,
+                                       context, config.prefetch_depth)) {
+                    succeeded = false;
+                    return false;
+                }
+                candidates_view_t top_view = refine_(metric, config_.connectivity, context.top_candidates, context);
+                neighbors_ref_t neighbors = neighbors_(node, level);
+                for (std::size_t idx = 0; idx != top_view.size(); idx++) {
+                    compressed_slot_t target = top_view[idx].slot;
+                    neighbors.push_back(target);
+                    node_links[node_links_count++] = {static_cast<compressed_slot_t>(slot), target,
+                                                      top_view[idx].distance, level};
+                    if (incoming_counts[target].value.fetch_add(1, std::memory_order_relaxed) == 0)
+                        targets[targets_count.fetch_add(1, std::memory_order_relaxed)] = target;
+                }
+                closest_slot = top_view[0].slot;
+            }
+            links_counts[task_idx] = node_links_count;
+            return true;
+        });
+        if (!succeeded.load())
+            return false;
+
+        return link_reverse_(links.data(), offsets.data(), links_counts.data(), batch_size, targets.data(),
+                             targets_count.load(), metric, incoming_counts, executor);
+    }
+
+    /**
+     *  @brief  Adds the reverse links, previously exported by a batch of ::sources_count nodes.
+     *          Groups them by their target, counting their number per target and scattering them with
+     *          atomic cursors, so every target merges all of its incoming links at once, running the
+     *          pruning heuristic at most once per level. Must not overlap with any other operation.
+     *
+     *  @param[in] links Reverse links of every source, starting at its ::offsets entry.
+     *  @param[in] targets Collection of the ::targets_count unique targets, in any order.
+     *  @param[inout] incoming_counts Number of links for every target, left zeroed on success.
+     *  @return `false` if run out of memory.
+     */
+    template <typename metric_at, typename executor_at>
+    bool link_reverse_(                                                                                  //
+        reverse_link_t const* links, std::size_t const* offsets, std::size_t const* links_counts,        //
+        std::size_t sources_count, compressed_slot_t const* targets, std::size_t targets_count,          //
+        metric_at&& metric, buffer_gt<atomic_counter_t>& incoming_counts, executor_at&& executor) noexcept {
+
+        // Turn the counts into cursors, remembering where every group starts
+        std::size_t const unique_targets = targets_count;
+        buffer_gt<std::size_t> group_offsets(unique_targets + 1);
+        if (!group_offsets)
+            return false;
+        group_offsets[0] = 0;
+        for (std::size_t i = 0; i != unique_targets; ++i) {
+            std::size_t group_size = incoming_counts[targets[i]].value.load(std::memory_order_relaxed);
+            incoming_counts[targets[i]].value.store(group_offsets[i], std::memory_order_relaxed);
+            group_offsets[i + 1] = group_offsets[i] + group_size;
+        }
+        buffer_gt<reverse_link_t, reverse_links_allocator_t> grouped(group_offsets[unique_targets]);
+        if (!grouped && group_offsets[unique_targets])
+            return false;
+
+        // Scatter the reverse links into their groups
+        executor.dynamic(sources_count, [&](std::size_t, std::size_t task_idx) {
+            reverse_link_t const* node_links = links + offsets[task_idx];
+            for (std::size_t i = 0; i != links_counts[task_idx]; ++i) {
+                reverse_link_t const& link = node_links[i];
+                grouped[incoming_counts[link.target].value.fetch_add(1, std::memory_order_relaxed)] = link;
+            }
+            return true;
+        });
+
+        // Merge the incoming links into every target, one level at a time
+        std::atomic<bool> succeeded{true};
+        executor.dynamic(unique_targets, [&](std::size_t thread_idx, std::size_t group_idx) {
+            context_t& context = contexts_[thread_idx];
+            top_candidates_t& top = context.top_candidates;
+            reverse_link_t* group_begin = grouped.data() + group_offsets[group_idx];
+            reverse_link_t* group_end = grouped.data() + group_offsets[group_idx + 1];
+            std::sort(group_begin, group_end,
+                      [](reverse_link_t const& a, reverse_link_t const& b) { return a.level < b.level; });
+
+            compressed_slot_t const target = targets[group_idx];
+            incoming_counts[target].value.store(0, std::memory_order_relaxed);
+            node_t target_node = node_at_(target);
+            for (reverse_link_t* level_begin = group_begin; level_begin != group_end;) {
+                level_t const level = level_begin->level;
+                reverse_link_t* level_end = level_begin;
+                while (level_end != group_end && level_end->level == level)
+                    ++level_end;
+
+                // Skip the links, that are already present
+                neighbors_ref_t neighbors = neighbors_(target_node, level);
+                reverse_link_t* kept_end = level_begin;
+                for (reverse_link_t* link = level_begin; link != level_end; ++link) {
+                    bool present = false;
+                    for (compressed_slot_t neighbor_slot : neighbors)
+                        present |= neighbor_slot == link->source;
+                    if (!present)
+                        *kept_end++ = *link;
+                }
+
+                std::size_t const incoming = static_cast<std::size_t>(kept_end - level_begin);
+                std::size_t const connectivity_max = level ? config_.connectivity : config_.connectivity_base;
+                if (neighbors.size() + incoming <= connectivity_max) {
+                    for (reverse_link_t* link = level_begin; link != kept_end; ++link)
+                        neighbors.push_back(link->source);
+                    level_begin = level_end;
+                    continue;
+                }
+
+                // To fit the new connections we need to drop some of them.
+                top.clear();
+                if (!top.reserve(neighbors.size() + incoming)) {
+                    succeeded = false;
+                    return false;
+                }
+                for (compressed_slot_t neighbor_slot : neighbors)
+                    top.insert_reserved(
+                        {context.measure(citerator_at(target), citerator_at(neighbor_slot), metric), neighbor_slot});
+                for (reverse_link_t* link = level_begin; link != kept_end; ++link)
+                    top.insert_reserved({link->distance, link->source});
+
+                // Export the results:
+                neighbors.clear();
+                candidates_view_t top_view = refine_(metric, connectivity_max, top, context);
+                for (std::size_t idx = 0; idx != top_view.size(); idx++)
+                    neighbors.push_back(top_view[idx].slot);
+                level_begin = level_end;
+            }
+            return true;
+        });
+        return succeeded.load();
+    }
+
+    /**
+     *  @brief  Joins the existing neighbors of ::slot on the given ::level with the candidates in the
+     *          `top_candidates` of the ::context, pruning them together with the usual heuristic.
+     *          Assumes no other thread is updating the same node.
+     */
+    template <typename metric_at>
+    void merge_neighbors_(metric_at&& metric, std::size_t slot, level_t level, context_t& context) noexcept {
+        top_candidates_t& top = context.top_candidates;
+        neighbors_ref_t neighbors = neighbors_(node_at_(slot), level);
+        std::size_t const connectivity_max = level ? config_.connectivity : config_.connectivity_base;
+        for (compressed_slot_t neighbor_slot : neighbors)
+            top.insert_reserved(
+                {context.measure(citerator_at(slot), citerator_at(neighbor_slot), metric), neighbor_slot});
+
+        // Export the results:
+        neighbors.clear();
+        candidates_view_t top_view = refine_(metric, connectivity_max, top, context);
+        for (std::size_t idx = 0; idx != top_view.size(); idx++)
+            neighbors.push_back(top_view[idx].slot);
+    }
+
     level_t choose_random_level_(std::default_random_engine& level_generator) const noexcept {
         std::uniform_real_distribution<double> distribution(0.0, 1.0);
         double r = -std::log(distribution(level_generator)) * pre_.inverse_log_connectivity;
@@ -3380,10 +6305,74 @@ class index_gt {
         candidates_iterator_t end() const noexcept { return {index, neighbors, visits, neighbors.size()}; }
     };
 
+    /**
+     *  @brief  Issues the optional prefetch for the unvisited ::neighbors of the node being expanded.
+     *          With a zero ::depth the whole list is passed to the callback at once. Otherwise only the
+     *          first ::depth entries are requested, and the rest follow from `prefetch_ahead_`.
+     */
+    template <typename prefetch_at>
+    void prefetch_neighbors_(prefetch_at&& prefetch, neighbors_ref_t neighbors, visits_hash_set_t& visits,
+                             std::size_t depth) const noexcept {
+        if (is_dummy<prefetch_at>())
+            return;
+        if (!depth) {
+            candidates_range_t missing_candidates{*this, neighbors, visits};
+            prefetch(missing_candidates.begin(), missing_candidates.end());
+            return;
+        }
+        for (std::size_t i = 0; i < depth && i < neighbors.size(); ++i)
+            prefetch_ahead_(prefetch, neighbors, i, visits);
+    }
+
+    /**
+     *  @brief  Software-pipelined analog of `prefetch_neighbors_`, requesting the neighbor at ::position,
+     *          while the distance to an earlier one is being computed.
+     */
+    template <typename prefetch_at>
+    void prefetch_ahead_(prefetch_at&& prefetch, neighbors_ref_t neighbors, std::size_t position,
+                         visits_hash_set_t const& visits) const noexcept {
+        if (is_dummy<prefetch_at>() || position >= neighbors.size())
+            return;
+        compressed_slot_t slot = neighbors[position];
+        if (!visits.size() || !visits.test(slot))
+            prefetch(citerator_at(slot), citerator_at(slot + 1));
+    }
+
+    /// @brief  Upper bound on the number of neighbors scored in a single batched metric call.
+    static constexpr std::size_t measure_batch_capacity() { return 64; }
+
+    /// @brief  Checks if the neighbors expansion loops should gather candidates and score them in batches.
+    template <typename value_at, typename metric_at> static constexpr bool batched_metric_() {
+        return has_one_to_many<metric_at, typename std::decay<value_at>::type, members_batch_t, distance_t>();
+    }
+
+    /**
+     *  @brief  Gathers up to `measure_batch_capacity()` unvisited neighbors into ::slots, starting at ::position,
+     *          marking them visited, and moving ::position past all the consumed neighbors.
+     *          With software-pipelined prefetching enabled, also prefetches the gathered ones.
+     *  @return The number of gathered slots.
+     */
+    template <typename prefetch_at>
+    std::size_t gather_unvisited_(prefetch_at&& prefetch, neighbors_ref_t neighbors, std::size_t& position,
+                                  visits_hash_set_t& visits, compressed_slot_t* slots,
+                                  std::size_t prefetch_depth) const noexcept {
+        std::size_t count = 0;
+        for (; position != neighbors.size() && count != measure_batch_capacity(); ++position) {
+            compressed_slot_t slot = neighbors[position];
+            if (visits.set(slot))
+                continue;
+            slots[count++] = slot;
+            if (!is_dummy<prefetch_at>() && prefetch_depth)
+                prefetch(citerator_at(slot), citerator_at(slot + 1));
+        }
+        return count;
+    }
+
     template <typename value_at, typename metric_at, typename prefetch_at = dummy_prefetch_t>
     std::size_t search_for_one_(                                      //
         value_at&& query, metric_at&& metric, prefetch_at&& prefetch, //
-        std::size_t closest_slot, level_t begin_level, level_t end_level, context_t& context) const noexcept {
+        std::size_t closest_slot, level_t begin_level, level_t end_level, context_t& context,
+        std::size_t prefetch_depth = 0) const noexcept {
 
         visits_hash_set_t& visits = context.visits;
         visits.clear();
@@ -3401,13 +6390,35 @@ class index_gt {
                 neighbors_ref_t closest_neighbors = neighbors_non_base_(node_at_(closest_slot), level);
 
                 // Optional prefetching
-                if (!is_dummy<prefetch_at>()) {
-                    candidates_range_t missing_candidates{*this, closest_neighbors, visits};
-                    prefetch(missing_candidates.begin(), missing_candidates.end());
+                prefetch_neighbors_(prefetch, closest_neighbors, visits, prefetch_depth);
+
+                // Actual traversal, scoring all the neighbors at once with batch-capable metrics
+                if (batched_metric_<value_at, metric_at>()) {
+                    compressed_slot_t batch_slots[measure_batch_capacity()];
+                    distance_t batch_distances[measure_batch_capacity()];
+                    for (std::size_t i = 0; i < closest_neighbors.size(); i += measure_batch_capacity()) {
+                        std::size_t batch_size = (std::min)(closest_neighbors.size() - i, measure_batch_capacity());
+                        for (std::size_t j = 0; j != batch_size; ++j)
+                            batch_slots[j] = closest_neighbors[i + j];
+                        context.measure_batch(query, members_batch_t{*this, batch_slots, batch_size}, metric,
+                                              batch_distances);
+                        for (std::size_t j = 0; j != batch_size; ++j) {
+                            if (batch_distances[j] < closest_dist) {
+                                closest_dist = batch_distances[j];
+                                closest_slot = batch_slots[j];
+                                changed = true;
+                            }
+                        }
+                    }
+                    context.iteration_cycles++;
+                    usearch_instrument_m(context.instruments.hop(level));
+                    usearch_instrument_m(context.instruments.miss(closest_neighbors.size()));
+                    continue;
                 }
-
-                // Actual traversal
-                for (compressed_slot_t candidate_slot : closest_neighbors) {
+                for (std::size_t i = 0; i != closest_neighbors.size(); ++i) {
+                    if (prefetch_depth)
+                        prefetch_ahead_(prefetch, closest_neighbors, i + prefetch_depth, visits);
+                    compressed_slot_t candidate_slot = closest_neighbors[i];
                     distance_t candidate_dist = context.measure(query, citerator_at(candidate_slot), metric);
                     if (candidate_dist < closest_dist) {
                         closest_dist = candidate_dist;
@@ -3416,11 +6427,106 @@ class index_gt {
                     }
                 }
                 context.iteration_cycles++;
+                usearch_instrument_m(context.instruments.hop(level));
+                usearch_instrument_m(context.instruments.miss(closest_neighbors.size()));
             } while (changed);
         }
         return closest_slot;
     }
 
+    /**
+     *  @brief  Batched analog of `search_for_one_`, descending for all the ::queries together.
+     *          On every step the queries are grouped by their current closest node, so that each
+     *          neighbors list is loaded once per group, and each neighbor is scored against the whole
+     *          group with `context_t::measure_many`. Queries, that didn't move on the previous step,
+     *          have already seen those neighbors and are skipped, as are the groups made only of them.
+     *  @param[out] entries Closest slots and distances, ordered by query index on exit.
+     */
+    template <typename queries_at, typename value_at, typename metric_at, typename prefetch_at = dummy_prefetch_t>
+    void search_for_many_(                                                   //
+        queries_at&& queries, std::size_t queries_count,                     //
+        batch_entry_t* entries, value_at* values, distance_t* distances,     //
+        metric_at&& metric, prefetch_at&& prefetch, std::size_t entry_slot, //
+        level_t begin_level, level_t end_level, context_t& context) const noexcept {
+
+        visits_hash_set_t& visits = context.visits;
+        visits.clear();
+
+        // Optional prefetching
+        if (!is_dummy<prefetch_at>())
+            prefetch(citerator_at(entry_slot), citerator_at(entry_slot + 1));
+
+        // All of the queries start from the same entry point
+        for (std::size_t i = 0; i != queries_count; ++i)
+            values[i] = queries[i];
+        context.measure_many(values, queries_count, citerator_at(entry_slot), metric, distances);
+        for (std::size_t i = 0; i != queries_count; ++i)
+            entries[i] = {i, entry_slot, distances[i], true};
+
+        // Within a group the pending queries come first, so the settled ones can be cut off
+        auto lower_slot = [](batch_entry_t const& a, batch_entry_t const& b) noexcept {
+            return a.slot != b.slot ? a.slot < b.slot : a.pending > b.pending;
+        };
+        auto lower_query = [](batch_entry_t const& a, batch_entry_t const& b) noexcept { return a.query < b.query; };
+        for (level_t level = begin_level; level > end_level; --level) {
+            for (std::size_t i = 0; i != queries_count; ++i)
+                entries[i].pending = true;
+            bool changed;
+            do {
+                changed = false;
+                std::sort(entries, entries + queries_count, lower_slot);
+
+                // Queries sharing the closest node form a group, that traverses its neighbors together
+                for (std::size_t group_begin = 0; group_begin != queries_count;) {
+                    std::size_t const group_slot = entries[group_begin].slot;
+                    std::size_t group_end = group_begin + 1;
+                    while (group_end != queries_count && entries[group_end].slot == group_slot)
+                        ++group_end;
+                    std::size_t group_size = 0;
+                    while (group_size != group_end - group_begin && entries[group_begin + group_size].pending)
+                        ++group_size;
+                    if (!group_size) {
+                        group_begin = group_end;
+                        continue;
+                    }
+                    for (std::size_t i = 0; i != group_size; ++i) {
+                        values[i] = queries[entries[group_begin + i].query];
+                        entries[group_begin + i].pending = false;
+                    }
+
+                    node_lock_t group_lock = node_lock_(group_slot);
+                    neighbors_ref_t group_neighbors = neighbors_non_base_(node_at_(group_slot), level);
+
+                    // Optional prefetching
+                    if (!is_dummy<prefetch_at>()) {
+                        candidates_range_t missing_candidates{*this, group_neighbors, visits};
+                        prefetch(missing_candidates.begin(), missing_candidates.end());
+                    }
+
+                    // Actual traversal
+                    for (compressed_slot_t candidate_slot : group_neighbors) {
+                        context.measure_many(values, group_size, citerator_at(candidate_slot), metric, distances);
+                        for (std::size_t i = 0; i != group_size; ++i) {
+                            batch_entry_t& entry = entries[group_begin + i];
+                            if (distances[i] < entry.distance) {
+                                entry.distance = distances[i];
+                                entry.slot = candidate_slot;
+                                entry.pending = true;
+                                changed = true;
+                            }
+                        }
+                    }
+                    context.iteration_cycles++;
+                    usearch_instrument_m(context.instruments.hop(level));
+                    usearch_instrument_m(context.instruments.miss(group_neighbors.size()));
+                    group_begin = group_end;
+                }
+            } while (changed);
+        }
+
+        std::sort(entries, entries + queries_count, lower_query);
+    }
+
     /**
      *  @brief  Traverses a layer of a graph, to find the best place to insert a new node.
      *          Locks the nodes in the process, assuming other threads are updating neighbors lists.
@@ -3429,8 +6535,8 @@ class index_gt {
     template <typename value_at, typename metric_at, typename prefetch_at = dummy_prefetch_t>
     bool search_to_insert_(                                           //
         value_at&& query, metric_at&& metric, prefetch_at&& prefetch, //
-        std::size_t start_slot, std::size_t new_slot, level_t level, std::size_t top_limit,
-        context_t& context) noexcept {
+        std::size_t start_slot, std::size_t new_slot, level_t level, std::size_t top_limit, context_t& context,
+        std::size_t prefetch_depth = 0) noexcept {
 
         visits_hash_set_t& visits = context.visits;
         next_candidates_t& next = context.next_candidates; // pop min, push
@@ -3451,6 +6557,9 @@ class index_gt {
         top.insert_reserved({radius, static_cast<compressed_slot_t>(start_slot)});
         visits.set(static_cast<compressed_slot_t>(start_slot));
 
+        // An updated node may still be reachable through its old incoming links, but must not link to itself
+        visits.set(static_cast<compressed_slot_t>(new_slot));
+
         while (!next.empty()) {
 
             candidate_t candidacy = next.top();
@@ -3459,6 +6568,7 @@ class index_gt {
 
             next.pop();
             context.iteration_cycles++;
+            usearch_instrument_m(context.instruments.hop(level));
 
             compressed_slot_t candidate_slot = candidacy.slot;
             if (new_slot == candidate_slot)
@@ -3467,17 +6577,39 @@ class index_gt {
             node_lock_t candidate_lock = node_lock_(candidate_slot);
             neighbors_ref_t candidate_neighbors = neighbors_(candidate_ref, level);
 
-            // Optional prefetching
-            if (!is_dummy<prefetch_at>()) {
-                candidates_range_t missing_candidates{*this, candidate_neighbors, visits};
-                prefetch(missing_candidates.begin(), missing_candidates.end());
-            }
+            // Optional prefetching, including the node to be expanded next
+            prefetch_neighbors_(prefetch, candidate_neighbors, visits, prefetch_depth);
+            if (prefetch_depth && !next.empty())
+                prefetch_base_(next.top().slot);
 
             // Assume the worst-case when reserving memory
             if (!visits.reserve(visits.size() + candidate_neighbors.size()))
                 return false;
 
-            for (compressed_slot_t successor_slot : candidate_neighbors) {
+            // Gather the unvisited neighbors and score them at once with batch-capable metrics
+            if (batched_metric_<value_at, metric_at>()) {
+                compressed_slot_t batch_slots[measure_batch_capacity()];
+                distance_t batch_distances[measure_batch_capacity()];
+                for (std::size_t position = 0; position != candidate_neighbors.size();) {
+                    std::size_t batch_size = gather_unvisited_(prefetch, candidate_neighbors, position, visits,
+                                                               batch_slots, prefetch_depth);
+                    context.measure_batch(query, members_batch_t{*this, batch_slots, batch_size}, metric,
+                                          batch_distances);
+                    for (std::size_t j = 0; j != batch_size; ++j) {
+                        if (top.size() < top_limit || batch_distances[j] < radius) {
+                            next.insert({-batch_distances[j], batch_slots[j]});
+                            top.insert({batch_distances[j], batch_slots[j]}, top_limit);
+                            radius = top.top().distance;
+                        }
+                    }
+                }
+                continue;
+            }
+
+            for (std::size_t i = 0; i != candidate_neighbors.size(); ++i) {
+                if (prefetch_depth)
+                    prefetch_ahead_(prefetch, candidate_neighbors, i + prefetch_depth, visits);
+                compressed_slot_t successor_slot = candidate_neighbors[i];
                 if (visits.set(successor_slot))
                     continue;
 
@@ -3495,6 +6627,40 @@ class index_gt {
         return true;
     }
 
+    /**
+     *  @brief  Adaptive early termination of a base layer traversal, see `index_search_config_t::patience`.
+     *          Tracks the `wanted`-th closest result, which is at most the `top_limit`-th.
+     */
+    class early_termination_t {
+        std::size_t wanted_;
+        std::size_t patience_;
+        double distance_ratio_;
+        distance_t wanted_radius_ = std::numeric_limits<distance_t>::max();
+        std::size_t stale_expansions_ = 0;
+
+      public:
+        early_termination_t(std::size_t wanted, std::size_t top_limit, std::size_t patience,
+                            double distance_ratio) noexcept
+            : wanted_(wanted <= top_limit && (patience || distance_ratio > 0) ? wanted : 0), patience_(patience),
+              distance_ratio_(distance_ratio) {}
+
+        /**
+         *  @brief  Easy queries converge long before the `top` is exhausted, so stop once the closest `wanted`
+         *          haven't changed for a while, or the next ::candidate_distance is too far to improve them.
+         */
+        bool operator()(top_candidates_t const& top, distance_t candidate_distance) noexcept {
+            if (!wanted_ || top.size() < wanted_)
+                return false;
+            distance_t current_radius = top.data()[wanted_ - 1].distance;
+            stale_expansions_ = current_radius < wanted_radius_ ? 0 : stale_expansions_ + 1;
+            wanted_radius_ = current_radius;
+            if (patience_ && stale_expansions_ > patience_)
+                return true;
+            return distance_ratio_ > 0 && wanted_radius_ > 0 &&
+                   candidate_distance > static_cast<distance_t>(wanted_radius_ * distance_ratio_);
+        }
+    };
+
     /**
      *  @brief  Traverses the @b base layer of a graph, to find a close match.
      *          Doesn't lock any nodes, assuming read-only simultaneous access.
@@ -3503,12 +6669,15 @@ class index_gt {
     template <typename value_at, typename metric_at, typename predicate_at, typename prefetch_at>
     bool search_to_find_in_base_(                                                               //
         value_at&& query, metric_at&& metric, predicate_at&& predicate, prefetch_at&& prefetch, //
-        std::size_t start_slot, std::size_t expansion, context_t& context) const usearch_noexcept_m {
+        std::size_t start_slot, std::size_t expansion, context_t& context, std::size_t prefetch_depth = 0,
+        std::size_t wanted = 0, std::size_t patience = 0, double distance_ratio = 0) const usearch_noexcept_m {
 
         visits_hash_set_t& visits = context.visits;
         next_candidates_t& next = context.next_candidates; // pop min, push
         top_candidates_t& top = context.top_candidates;    // pop max, push
         std::size_t const top_limit = expansion;
+        usearch_instrument_m(std::size_t scanned_neighbors = 0);
+        early_termination_t early_termination(wanted, top_limit, patience, distance_ratio);
 
         visits.clear();
         next.clear();
@@ -3534,26 +6703,59 @@ class index_gt {
 
         while (!next.empty()) {
 
+            // The rejected members don't enter the `top`, so the `radius` can't bound the search until it is full
             candidate_t candidate = next.top();
-            if ((-candidate.distance) > radius)
+            if ((-candidate.distance) > radius && top.size() >= top_limit)
+                break;
+
+            if (early_termination(top, -candidate.distance))
                 break;
 
             next.pop();
             context.iteration_cycles++;
+            usearch_instrument_m(context.instruments.hop(0));
 
-            neighbors_ref_t candidate_neighbors = neighbors_base_(node_at_(candidate.slot));
+            neighbors_ref_t candidate_neighbors = neighbors_base_at_(candidate.slot, context.decoded_neighbors.data());
+            usearch_instrument_m(scanned_neighbors += candidate_neighbors.size());
 
-            // Optional prefetching
-            if (!is_dummy<prefetch_at>()) {
-                candidates_range_t missing_candidates{*this, candidate_neighbors, visits};
-                prefetch(missing_candidates.begin(), missing_candidates.end());
-            }
+            // Optional prefetching, including the neighbors list of the candidate to be expanded next
+            prefetch_neighbors_(prefetch, candidate_neighbors, visits, prefetch_depth);
+            if (prefetch_depth && !next.empty())
+                prefetch_base_(next.top().slot);
 
             // Assume the worst-case when reserving memory
             if (!visits.reserve(visits.size() + candidate_neighbors.size()))
                 return false;
 
-            for (compressed_slot_t successor_slot : candidate_neighbors) {
+            // Gather the unvisited neighbors and score them at once with batch-capable metrics
+            if (batched_metric_<value_at, metric_at>()) {
+                compressed_slot_t batch_slots[measure_batch_capacity()];
+                distance_t batch_distances[measure_batch_capacity()];
+                for (std::size_t position = 0; position != candidate_neighbors.size();) {
+                    std::size_t batch_size = gather_unvisited_(prefetch, candidate_neighbors, position, visits,
+                                                               batch_slots, prefetch_depth);
+                    context.measure_batch(query, members_batch_t{*this, batch_slots, batch_size}, metric,
+                                          batch_distances);
+                    for (std::size_t j = 0; j != batch_size; ++j) {
+                        compressed_slot_t successor_slot = batch_slots[j];
+                        distance_t successor_dist = batch_distances[j];
+                        if (top.size() < top_limit || successor_dist < radius) {
+                            next.insert({-successor_dist, successor_slot});
+                            if (is_dummy<predicate_at>() ||
+                                predicate(member_cref_t{node_at_(successor_slot).ckey(), successor_slot})) {
+                                top.insert({successor_dist, successor_slot}, top_limit);
+                                radius = top.top().distance;
+                            }
+                        }
+                    }
+                }
+                continue;
+            }
+
+            for (std::size_t i = 0; i != candidate_neighbors.size(); ++i) {
+                if (prefetch_depth)
+                    prefetch_ahead_(prefetch, candidate_neighbors, i + prefetch_depth, visits);
+                compressed_slot_t successor_slot = candidate_neighbors[i];
                 if (visits.set(successor_slot))
                     continue;
 
@@ -3562,16 +6764,190 @@ class index_gt {
                     // This can substantially grow our priority queue:
                     next.insert({-successor_dist, successor_slot});
                     if (is_dummy<predicate_at>() ||
-                        predicate(member_cref_t{node_at_(successor_slot).ckey(), successor_slot}))
+                        predicate(member_cref_t{node_at_(successor_slot).ckey(), successor_slot})) {
                         top.insert({successor_dist, successor_slot}, top_limit);
-                    radius = top.top().distance;
+                        radius = top.top().distance;
+                    }
+                }
+            }
+        }
+
+        // Every scanned neighbor was either visited just now, or reused, skipping the start
+        usearch_instrument_m(context.instruments.miss(visits.size() - 1));
+        usearch_instrument_m(context.instruments.reuse(scanned_neighbors - (visits.size() - 1)));
+        return true;
+    }
+
+    /**
+     *  @brief  Traverses the @b base layer of a graph, scoring only the members that pass the ::allowed
+     *          predicate. The rejected neighbors aren't scored, but their allowed neighbors are, bridging
+     *          over the gaps that selective filters leave in the graph.
+     *  @return `true` if procedure succeeded, `false` if run out of memory.
+     */
+    template <typename value_at, typename metric_at, typename allowed_at, typename prefetch_at>
+    bool search_to_find_in_filtered_base_(                                                    //
+        value_at&& query, metric_at&& metric, allowed_at&& allowed, prefetch_at&& prefetch, //
+        std::size_t start_slot, std::size_t expansion, context_t& context, std::size_t wanted = 0,
+        std::size_t patience = 0, double distance_ratio = 0) const usearch_noexcept_m {
+
+        visits_hash_set_t& visits = context.visits;
+        next_candidates_t& next = context.next_candidates; // pop min, push
+        top_candidates_t& top = context.top_candidates;    // pop max, push
+        std::size_t const top_limit = expansion;
+        usearch_instrument_m(std::size_t scanned_neighbors = 0);
+        early_termination_t early_termination(wanted, top_limit, patience, distance_ratio);
+
+        visits.clear();
+        next.clear();
+        top.clear();
+        if (!visits.reserve(config_.connectivity_base + 1u))
+            return false;
+
+        // The entry point is likely rejected, but still serves as the starting hub
+        distance_t radius = context.measure(query, citerator_at(start_slot), metric);
+        next.insert_reserved({-radius, static_cast<compressed_slot_t>(start_slot)});
+        visits.set(static_cast<compressed_slot_t>(start_slot));
+        if (allowed(member_cref_t{node_at_(start_slot).ckey(), start_slot}))
+            top.insert_reserved({radius, static_cast<compressed_slot_t>(start_slot)});
+
+        auto consider = [&](compressed_slot_t successor_slot) {
+            distance_t successor_dist = context.measure(query, citerator_at(successor_slot), metric);
+            if (top.size() < top_limit || successor_dist < radius) {
+                next.insert({-successor_dist, successor_slot});
+                top.insert({successor_dist, successor_slot}, top_limit);
+                radius = top.top().distance;
+            }
+        };
+
+        while (!next.empty()) {
+
+            candidate_t candidate = next.top();
+            if ((-candidate.distance) > radius && top.size() >= top_limit)
+                break;
+            if (early_termination(top, -candidate.distance))
+                break;
+
+            next.pop();
+            context.iteration_cycles++;
+            usearch_instrument_m(context.instruments.hop(0));
+
+            neighbors_ref_t candidate_neighbors = neighbors_base_at_(candidate.slot, context.decoded_neighbors.data());
+            usearch_instrument_m(scanned_neighbors += candidate_neighbors.size());
+            prefetch_neighbors_(prefetch, candidate_neighbors, visits, 0);
+            if (!visits.reserve(visits.size() + candidate_neighbors.size()))
+                return false;
+
+            for (std::size_t i = 0; i != candidate_neighbors.size(); ++i) {
+                compressed_slot_t successor_slot = candidate_neighbors[i];
+                if (visits.set(successor_slot))
+                    continue;
+                if (allowed(member_cref_t{node_at_(successor_slot).ckey(), successor_slot})) {
+                    consider(successor_slot);
+                    continue;
+                }
+
+                // Look past the rejected neighbor, without marking its rejected neighbors as visited,
+                // as they may still be bridged over later from another direction
+                neighbors_ref_t bridged_neighbors =
+                    neighbors_base_at_(successor_slot, context.decoded_neighbors.data() + pre_.neighbors_base_bytes);
+                usearch_instrument_m(scanned_neighbors += bridged_neighbors.size());
+                prefetch_neighbors_(prefetch, bridged_neighbors, visits, 0);
+                if (!visits.reserve(visits.size() + bridged_neighbors.size()))
+                    return false;
+                for (std::size_t j = 0; j != bridged_neighbors.size(); ++j) {
+                    compressed_slot_t bridged_slot = bridged_neighbors[j];
+                    if (visits.test(bridged_slot) ||
+                        !allowed(member_cref_t{node_at_(bridged_slot).ckey(), bridged_slot}))
+                        continue;
+                    visits.set(bridged_slot);
+                    consider(bridged_slot);
                 }
             }
         }
 
+        // Every scanned neighbor was either visited just now, or reused, or rejected while bridging
+        usearch_instrument_m(context.instruments.miss(visits.size() - 1));
+        usearch_instrument_m(context.instruments.reuse(scanned_neighbors - (visits.size() - 1)));
         return true;
     }
 
+    /**
+     *  @brief  Traverses the @b base layer of a graph, like `search_to_find_in_base_`, but keeps expanding
+     *          every candidate within the ::radius, even after the `top` of ::expansion closest is full.
+     *          Every scored member is passed to ::report, which returns `true` to stop the traversal.
+     *  @return `true` if procedure succeeded, `false` if run out of memory.
+     */
+    template <typename value_at, typename metric_at, typename report_at, typename prefetch_at>
+    bool search_to_find_in_range_(                                                      //
+        value_at&& query, metric_at&& metric, report_at&& report, prefetch_at&& prefetch, //
+        std::size_t start_slot, distance_t radius, std::size_t expansion, context_t& context) const noexcept {
+
+        visits_hash_set_t& visits = context.visits;
+        next_candidates_t& next = context.next_candidates; // pop min, push
+        top_candidates_t& top = context.top_candidates;    // pop max, push
+        std::size_t const top_limit = expansion;
+        usearch_instrument_m(std::size_t scanned_neighbors = 0);
+
+        visits.clear();
+        next.clear();
+        top.clear();
+        if (!visits.reserve(config_.connectivity_base + 1u))
+            return false;
+
+        // Every scanned neighbor was either visited just now, or reused, skipping the start
+        auto finish = [&]() noexcept {
+            usearch_instrument_m(context.instruments.miss(visits.size() - 1));
+            usearch_instrument_m(context.instruments.reuse(scanned_neighbors - (visits.size() - 1)));
+            return true;
+        };
+
+        distance_t start_dist = context.measure(query, citerator_at(start_slot), metric);
+        next.insert_reserved({-start_dist, static_cast<compressed_slot_t>(start_slot)});
+        top.insert_reserved({start_dist, static_cast<compressed_slot_t>(start_slot)});
+        visits.set(static_cast<compressed_slot_t>(start_slot));
+        if (report(static_cast<compressed_slot_t>(start_slot), start_dist))
+            return finish();
+
+        // The `top` guides the search towards the ::query, until the candidates get within the ::radius
+        distance_t beam_radius = start_dist;
+        while (!next.empty()) {
+
+            candidate_t candidate = next.top();
+            if ((-candidate.distance) > (std::max)(radius, beam_radius) && top.size() >= top_limit)
+                break;
+
+            next.pop();
+            context.iteration_cycles++;
+            usearch_instrument_m(context.instruments.hop(0));
+
+            neighbors_ref_t candidate_neighbors = neighbors_base_at_(candidate.slot, context.decoded_neighbors.data());
+            usearch_instrument_m(scanned_neighbors += candidate_neighbors.size());
+            prefetch_neighbors_(prefetch, candidate_neighbors, visits, 0);
+            if (!visits.reserve(visits.size() + candidate_neighbors.size()))
+                return false;
+
+            for (std::size_t i = 0; i != candidate_neighbors.size(); ++i) {
+                compressed_slot_t successor_slot = candidate_neighbors[i];
+                if (visits.set(successor_slot))
+                    continue;
+
+                distance_t successor_dist = context.measure(query, citerator_at(successor_slot), metric);
+                bool const in_beam = top.size() < top_limit || successor_dist < beam_radius;
+                if (in_beam) {
+                    top.insert({successor_dist, successor_slot}, top_limit);
+                    beam_radius = top.top().distance;
+                }
+                if (in_beam || successor_dist <= radius)
+                    if (!next.insert({-successor_dist, successor_slot}))
+                        return false;
+                if (report(successor_slot, successor_dist))
+                    return finish();
+            }
+        }
+
+        return finish();
+    }
+
     /**
      *  @brief  Iterates through all members, without actually touching the index.
      */
@@ -9,6 +9,7 @@
 
 #include <functional> // `std::function`
 #include <numeric>    // `std::iota`
+#include <string>     // `std::string`
 #include <thread>     // `std::thread`
 #include <vector>     // `std::vector`
 
@@ -39,9 +40,8 @@ static_assert(sizeof(index_dense_head_buffer_t) == 64, "File header should be ex
  *          Metadata is parsed into a `index_dense_head_t`, containing the USearch package version,
  *          and the properties of the index.
  *
- *  It uses: 13 bytes for file versioning, 22 bytes for structural information = 35 bytes.
- *  The following 24 bytes contain binary size of the graph, of the vectors, and the checksum,
- *  leaving 5 bytes at the end vacant.
+ *  It uses: 13 bytes for file versioning, 29 bytes for structural information, 4 bytes for the
+ *  quantizer, and 2 bytes for the reranking and layout flags = 48 bytes, leaving the last 16 bytes vacant.
  */
 struct index_dense_head_t {
 
@@ -55,18 +55,27 @@ struct index_dense_head_t {
     misaligned_ref_gt<version_t> version_minor;
     misaligned_ref_gt<version_t> version_patch;
 
-    // Structural: 4 * 3 = 12 bytes
+    // Structural: 4 * 1 = 4 bytes
     misaligned_ref_gt<metric_kind_t> kind_metric;
     misaligned_ref_gt<scalar_kind_t> kind_scalar;
     misaligned_ref_gt<scalar_kind_t> kind_key;
     misaligned_ref_gt<scalar_kind_t> kind_compressed_slot;
 
-    // Population: 8 * 3 = 24 bytes
+    // Population: 8 * 3 + 1 = 25 bytes
     misaligned_ref_gt<std::uint64_t> count_present;
     misaligned_ref_gt<std::uint64_t> count_deleted;
     misaligned_ref_gt<std::uint64_t> dimensions;
     misaligned_ref_gt<bool> multi;
 
+    // Compression: 4 bytes, zero for uncompressed vectors
+    misaligned_ref_gt<std::uint32_t> quantizer_subspaces;
+
+    // Reranking: 1 byte, `unknown_k` if no higher-precision copies are stored
+    misaligned_ref_gt<scalar_kind_t> kind_rerank_scalar;
+
+    // Layout: 1 byte, marking vectors stored inside of the graph nodes
+    misaligned_ref_gt<bool> colocated_vectors;
+
     index_dense_head_t(byte_t* ptr) noexcept
         : magic((char const*)exchange(ptr, ptr + sizeof(magic_t))),         //
           version_major(exchange(ptr, ptr + sizeof(version_t))),            //
@@ -79,7 +88,10 @@ struct index_dense_head_t {
           count_present(exchange(ptr, ptr + sizeof(std::uint64_t))),        //
           count_deleted(exchange(ptr, ptr + sizeof(std::uint64_t))),        //
           dimensions(exchange(ptr, ptr + sizeof(std::uint64_t))),           //
-          multi(exchange(ptr, ptr + sizeof(bool))) {}
+          multi(exchange(ptr, ptr + sizeof(bool))),                         //
+          quantizer_subspaces(exchange(ptr, ptr + sizeof(std::uint32_t))), //
+          kind_rerank_scalar(exchange(ptr, ptr + sizeof(scalar_kind_t))),   //
+          colocated_vectors(exchange(ptr, ptr + sizeof(bool))) {}
 };
 
 struct index_dense_head_result_t {
@@ -98,9 +110,31 @@ struct index_dense_head_result_t {
 struct index_dense_config_t : public index_config_t {
     std::size_t expansion_add = default_expansion_add();
     std::size_t expansion_search = default_expansion_search();
+    /// @brief Adaptive early termination of searches, see `index_search_config_t::patience`.
+    /// Applies to the plain and filtered searches, but not to the range ones, which report the whole radius.
+    std::size_t patience_search = 0;
+    /// @brief Adaptive early termination of searches, see `index_search_config_t::distance_ratio`.
+    double distance_ratio_search = 0;
+    std::size_t prefetch_depth = default_prefetch_depth();
     bool exclude_vectors = false;
+    /// @brief Links new entries to the hub nodes optimistically, see `index_update_config_t::optimistic`.
+    bool optimistic_insertion = false;
     bool multi = false;
 
+    /**
+     *  @brief  In two-stage search, the number of candidates rescored with higher-precision
+     *          vectors per every wanted result. Zero disables reranking in `search()`.
+     */
+    std::size_t rerank_factor = 4;
+
+    /**
+     *  @brief  Stores every vector inside of its graph node, right after the base level neighbors,
+     *          instead of a separate tape. Saves a pointer chase and a cache miss per distance
+     *          computation, which matters most for low-dimensional vectors.
+     *          Nodes aren't padded, so co-located vectors are not guaranteed to be cache-line aligned.
+     */
+    bool colocate_vectors = false;
+
     /**
      *  @brief  Allows you to reduce RAM consumption by avoiding
      *          reverse-indexing keys-to-vectors, and only keeping
@@ -112,6 +146,19 @@ struct index_dense_config_t : public index_config_t {
      */
     bool enable_key_lookups = true;
 
+    /**
+     *  @brief  Repairs the neighborhoods of the removed entries right away, bridging the links
+     *          leading through them, instead of leaving them in the search paths until `isolate`
+     *          or `compact`. The links missed this way are later picked up by `consolidate`.
+     */
+    bool repair_on_remove = false;
+
+    /**
+     *  @brief  Huge pages and NUMA policy for the nodes and vectors tapes. Like `enable_key_lookups`,
+     *          isn't serialized. For per-node replicas of a `view`, pass it to `memory_mapped_file_t`.
+     */
+    memory_placement_t placement{};
+
     index_dense_config_t(index_config_t base) noexcept : index_config_t(base) {}
 
     index_dense_config_t(std::size_t c = default_connectivity(), std::size_t ea = default_expansion_add(),
@@ -129,9 +176,27 @@ struct index_dense_clustering_config_t {
     } mode = merge_smallest_k;
 };
 
+/**
+ *  @brief  Sample-based tuning of the search schedule in `index_dense_gt::calibrate`,
+ *          trading the expansion against the adaptive early termination criteria.
+ */
+struct index_dense_calibration_config_t {
+    /// @brief Number of nearest neighbors every query is expected to find.
+    std::size_t wanted = 10;
+    /// @brief Mean fraction of the exact `wanted` nearest neighbors, that searches must find.
+    double target_recall = 0.95;
+    /// @brief Largest expansion to try, growing in powers of two from `wanted`.
+    std::size_t max_expansion = 1024;
+};
+
 struct index_dense_serialization_config_t {
     bool exclude_vectors = false;
     bool use_64_bit_dimensions = false;
+    /// @brief Renumbers the nodes in breadth-first order after loading, to improve memory locality.
+    bool reorder = false;
+    /// @brief Optimizes `view` for files larger than RAM, disabling the kernel read-ahead and
+    /// requesting the pages of the upcoming candidates asynchronously, ahead of traversal.
+    bool disk_resident = false;
 };
 
 struct index_dense_copy_config_t : public index_copy_config_t {
@@ -301,6 +366,10 @@ inline index_dense_metadata_result_t index_dense_metadata_from_buffer(memory_map
  *  The second (2.) starts with @b "usearch"-magic-string, used to infer the file type on open.
  *  The third (3.) is implemented by the underlying `index_gt` class.
  */
+template <typename scalar_at, typename metric_at, std::size_t dimensions_ak, //
+          typename key_at, typename compressed_slot_at>
+class index_dense_typed_gt;
+
 template <typename key_at = default_key_t, typename compressed_slot_at = default_slot_t> //
 class index_dense_gt {
   public:
@@ -334,28 +403,147 @@ class index_dense_gt {
     using member_iterator_t = typename index_t::member_iterator_t;
     using member_citerator_t = typename index_t::member_citerator_t;
 
-    /// @brief Punned metric object.
+    /**
+     *  @brief Punned metric object.
+     *
+     *  In @b quantized indexes the stored vectors are product-quantization codes, and the standalone
+     *  queries are passed as lookup tables produced by `product_quantizer_t::lookup_table`.
+     */
     class metric_proxy_t {
         index_dense_gt const* index_ = nullptr;
 
       public:
         metric_proxy_t(index_dense_gt const& index) noexcept : index_(&index) {}
 
-        inline distance_t operator()(byte_t const* a, member_cref_t b) const noexcept { return f(a, v(b)); }
+        inline distance_t operator()(byte_t const* a, member_cref_t b) const noexcept { return q(a, v(b)); }
         inline distance_t operator()(member_cref_t a, member_cref_t b) const noexcept { return f(v(a), v(b)); }
 
-        inline distance_t operator()(byte_t const* a, member_citerator_t b) const noexcept { return f(a, v(b)); }
+        inline distance_t operator()(byte_t const* a, member_citerator_t b) const noexcept { return q(a, v(b)); }
         inline distance_t operator()(member_citerator_t a, member_citerator_t b) const noexcept {
             return f(v(a), v(b));
         }
 
         inline distance_t operator()(byte_t const* a, byte_t const* b) const noexcept { return f(a, b); }
 
-        inline byte_t const* v(member_cref_t m) const noexcept { return index_->vectors_lookup_[get_slot(m)]; }
-        inline byte_t const* v(member_citerator_t m) const noexcept { return index_->vectors_lookup_[get_slot(m)]; }
-        inline distance_t f(byte_t const* a, byte_t const* b) const noexcept { return index_->metric_(a, b); }
+        inline void operator()(byte_t const* const* as, std::size_t n, member_citerator_t b,
+                               distance_t* results) const noexcept {
+            if (!index_->quantizer_)
+                return index_->metric_(as, n, v(b), results);
+            for (std::size_t i = 0; i != n; ++i)
+                results[i] = q(as[i], v(b));
+        }
+
+        /// @brief Scores a query against a batch of gathered members, with one kernel dispatch per batch.
+        template <typename batch_at>
+        inline void operator()(byte_t const* a, batch_at const& batch, distance_t* results) const noexcept {
+            if (index_->quantizer_) {
+                for (std::size_t i = 0; i != batch.size(); ++i)
+                    results[i] = q(a, v(batch[i]));
+                return;
+            }
+            byte_t const* vectors[64];
+            for (std::size_t offset = 0; offset < batch.size(); offset += 64) {
+                std::size_t count = (std::min<std::size_t>)(batch.size() - offset, 64);
+                for (std::size_t i = 0; i != count; ++i)
+                    vectors[i] = v(batch[offset + i]);
+                index_->metric_(a, vectors, count, results + offset);
+            }
+        }
+
+        inline byte_t const* v(member_cref_t m) const noexcept { return v(get_slot(m)); }
+        inline byte_t const* v(member_citerator_t m) const noexcept { return v(get_slot(m)); }
+        inline byte_t const* v(std::size_t slot) const noexcept {
+            return index_->config_.vector_bytes ? index_->typed_->vector_at(slot) : index_->vectors_lookup_[slot];
+        }
+
+        /// @brief Distance between two stored vectors.
+        inline distance_t f(byte_t const* a, byte_t const* b) const noexcept {
+            return index_->quantizer_ ? index_->quantizer_.symmetric_distance(codes_(a), codes_(b))
+                                      : index_->metric_(a, b);
+        }
+
+        /// @brief Distance between a prepared query and a stored vector.
+        inline distance_t q(byte_t const* a, byte_t const* b) const noexcept {
+            return index_->quantizer_
+                       ? index_->quantizer_.asymmetric_distance(reinterpret_cast<f32_t const*>(a), codes_(b))
+                       : index_->metric_(a, b);
+        }
+    };
+
+    /**
+     *  @brief  Built-in prefetching policy, pulling the stored vectors of the upcoming candidates
+     *          into CPU caches, while the distances to the current ones are being computed.
+     *          Only the first few cache lines are requested, the hardware prefetcher covers the rest.
+     *
+     *  For disk-resident indexes the pages of both the vectors and the nodes are requested from the
+     *  storage instead, as CPU prefetches are dropped for pages that aren't yet in memory.
+     */
+    struct vectors_prefetch_t {
+        index_dense_gt const* index_ = nullptr;
+
+        static constexpr std::size_t cache_line_bytes() { return 64; }
+        static constexpr std::size_t max_cache_lines() { return 4; }
+
+        vectors_prefetch_t(index_dense_gt const& index) noexcept : index_(&index) {}
+
+        template <typename member_citerator_like_at>
+        inline void operator()(member_citerator_like_at begin, member_citerator_like_at end) const noexcept {
+            std::size_t const bytes = (std::min)(index_->vector_bytes_(), cache_line_bytes() * max_cache_lines());
+            metric_proxy_t proxy{*index_};
+            if (index_->disk_resident_) {
+                std::size_t const vector_bytes = index_->separate_vector_bytes_();
+                for (; begin != end; ++begin) {
+                    std::size_t const slot = static_cast<std::size_t>(get_slot(begin));
+                    span_gt<byte_t> node = index_->typed_->node_bytes_at(slot);
+                    memory_mapped_file_t::advise_willneed(node.data(), node.size());
+                    if (vector_bytes && index_->vectors_lookup_[slot])
+                        memory_mapped_file_t::advise_willneed(index_->vectors_lookup_[slot], vector_bytes);
+                }
+                return;
+            }
+            for (; begin != end; ++begin) {
+                byte_t const* vector = proxy.v(static_cast<std::size_t>(get_slot(begin)));
+                if (!vector)
+                    continue;
+                for (std::size_t offset = 0; offset < bytes; offset += cache_line_bytes())
+                    prefetch_m(vector + offset);
+            }
+        }
+    };
+
+    /**
+     *  @brief  Statically-typed alternative to `metric_proxy_t`, calling the ::metric_at kernel directly
+     *          with a compile-time number of scalar words, so that it can be inlined and unrolled.
+     *          Only valid for non-quantized indexes, storing ::scalar_at vectors.
+     */
+    template <typename scalar_at, typename metric_at, std::size_t scalar_words_ak> class typed_metric_proxy_gt {
+        metric_proxy_t proxy_;
+
+      public:
+        typed_metric_proxy_gt(index_dense_gt const& index) noexcept : proxy_(index) {}
+
+        inline distance_t operator()(byte_t const* a, member_cref_t b) const noexcept { return f(a, proxy_.v(b)); }
+        inline distance_t operator()(member_cref_t a, member_cref_t b) const noexcept {
+            return f(proxy_.v(a), proxy_.v(b));
+        }
+        inline distance_t operator()(byte_t const* a, member_citerator_t b) const noexcept {
+            return f(a, proxy_.v(b));
+        }
+        inline distance_t operator()(member_citerator_t a, member_citerator_t b) const noexcept {
+            return f(proxy_.v(a), proxy_.v(b));
+        }
+        inline distance_t operator()(byte_t const* a, byte_t const* b) const noexcept { return f(a, b); }
+
+        inline distance_t f(byte_t const* a, byte_t const* b) const noexcept {
+            return static_cast<distance_t>(metric_at{}(reinterpret_cast<scalar_at const*>(a),
+                                                       reinterpret_cast<scalar_at const*>(b), scalar_words_ak));
+        }
     };
 
+    static product_quantizer_t::code_t const* codes_(byte_t const* vector) noexcept {
+        return reinterpret_cast<product_quantizer_t::code_t const*>(vector);
+    }
+
     index_dense_config_t config_;
     index_t* typed_ = nullptr;
 
@@ -377,6 +565,15 @@ class index_dense_gt {
     /// @brief An instance of a potentially stateful `metric_t` used to initialize copies and forks.
     metric_t metric_;
 
+    /// @brief Optional codebooks, replacing the stored vectors with compact codes, if trained.
+    product_quantizer_t quantizer_;
+
+    /// @brief Set for indexes viewed from files larger than RAM, switching the prefetching policy.
+    bool disk_resident_ = false;
+
+    /// @brief Per-thread distance lookup tables for queries into a quantized index.
+    mutable std::vector<f32_t> lookup_tables_;
+
     using vectors_tape_allocator_t = memory_mapping_allocator_gt<8>;
     /// @brief Allocator for the copied vectors, aligned to widest double-precision scalars.
     vectors_tape_allocator_t vectors_tape_allocator_;
@@ -384,6 +581,15 @@ class index_dense_gt {
     /// @brief For every managed `compressed_slot_t` stores a pointer to the allocated vector copy.
     mutable std::vector<byte_t*> vectors_lookup_;
 
+    /// @brief Optional higher-precision metric, used to rescore the candidates found with `metric_`.
+    metric_t rerank_metric_;
+    casts_t rerank_casts_;
+    mutable std::vector<byte_t> rerank_cast_buffer_;
+
+    /// @brief Allocator and per-slot pointers for the higher-precision copies of vectors, if reranking is enabled.
+    vectors_tape_allocator_t rerank_vectors_tape_allocator_;
+    std::vector<byte_t*> rerank_vectors_lookup_;
+
     /// @brief Originally forms and array of integers [0, threads], marking all
     mutable std::vector<std::size_t> available_threads_;
 
@@ -398,6 +604,14 @@ class index_dense_gt {
     using shared_lock_t = shared_lock_gt<shared_mutex_t>;
     using unique_lock_t = std::unique_lock<shared_mutex_t>;
 
+#if USEARCH_USE_INSTRUMENTATION
+    using lookup_mutex_t = instrumented_shared_mutex_gt<shared_mutex_t>;
+#else
+    using lookup_mutex_t = shared_mutex_t;
+#endif
+    using lookup_shared_lock_t = shared_lock_gt<lookup_mutex_t>;
+    using lookup_unique_lock_t = std::unique_lock<lookup_mutex_t>;
+
     struct key_and_slot_t {
         vector_key_t key;
         compressed_slot_t slot;
@@ -419,11 +633,30 @@ class index_dense_gt {
         bool operator()(key_and_slot_t const& a, key_and_slot_t const& b) const noexcept { return a.key == b.key; }
     };
 
-    /// @brief Multi-Map from keys to IDs, and allocated vectors.
-    flat_hash_multi_set_gt<key_and_slot_t, lookup_key_hash_t, lookup_key_same_t> slot_lookup_;
+    using slot_lookup_set_t = flat_hash_multi_set_gt<key_and_slot_t, lookup_key_hash_t, lookup_key_same_t>;
+
+    /// @brief One of the independently locked parts of the `slot_lookup_`.
+    struct slot_lookup_shard_t {
+        slot_lookup_set_t slots;
+        mutable shared_mutex_t mutex;
+    };
+
+    static constexpr std::size_t slot_lookup_shards_log2() { return 6; }
+    static constexpr std::size_t slot_lookup_shards() { return std::size_t(1) << slot_lookup_shards_log2(); }
 
-    /// @brief Mutex, controlling concurrent access to `slot_lookup_`.
-    mutable shared_mutex_t slot_lookup_mutex_;
+    /// @brief Multi-Map from keys to IDs, split into shards, so that concurrent insertions rarely collide.
+    buffer_gt<slot_lookup_shard_t> slot_lookup_{slot_lookup_shards()};
+
+    /// @brief Mutex, controlling concurrent access to `slot_lookup_` as a whole.
+    /// Single-key operations take it in shared mode, and then lock just their shard.
+    /// Operations spanning many keys, like `rename` or `clear`, take it exclusively and skip the shard locks.
+    mutable lookup_mutex_t slot_lookup_mutex_;
+
+    /// @brief Picks the shard by the top bits of a multiplicative hash, independent of the in-shard position.
+    slot_lookup_shard_t& slot_shard_(vector_key_t key) const noexcept {
+        std::uint64_t hash = static_cast<std::uint64_t>(lookup_key_hash_t{}(key)) * 0x9E3779B97F4A7C15ull;
+        return slot_lookup_.data()[hash >> (64 - slot_lookup_shards_log2())];
+    }
 
     /// @brief Ring-shaped queue of deleted entries, to be reused on future insertions.
     ring_gt<compressed_slot_t> free_keys_;
@@ -434,10 +667,34 @@ class index_dense_gt {
     /// @brief A constant for the reserved key value, used to mark deleted entries.
     vector_key_t free_key_ = default_free_value<vector_key_t>();
 
+    /// @brief Position of the next `consolidate` step, advanced by every call.
+    std::atomic<std::size_t> consolidation_cursor_{0};
+
+    /// @brief Vector pointers of the active snapshot, preserved copy-on-write, like the nodes of `typed_`.
+    struct snapshot_vectors_t {
+        std::vector<byte_t*> vectors;
+        std::vector<byte_t*> rerank_vectors;
+        std::mutex tape_mutex;
+        vectors_tape_allocator_t tape;
+        std::atomic<bool> failed{false};
+    };
+    std::unique_ptr<snapshot_vectors_t> snapshot_vectors_;
+
+    /// @brief Taken in shared mode by every insertion, and exclusively to start or end a snapshot,
+    /// so that the captured nodes and vectors are never half-written.
+    mutable shared_mutex_t snapshot_mutex_;
+
+    template <typename, typename, std::size_t, typename, typename> friend class index_dense_typed_gt;
+
   public:
     using search_result_t = typename index_t::search_result_t;
+    using search_batch_result_t = typename index_t::search_batch_result_t;
+    using range_search_result_t = typename index_t::range_search_result_t;
     using cluster_result_t = typename index_t::cluster_result_t;
     using add_result_t = typename index_t::add_result_t;
+    using build_result_t = typename index_t::build_result_t;
+    using merge_result_t = typename index_t::merge_result_t;
+    using compression_result_t = typename index_t::compression_result_t;
     using stats_t = typename index_t::stats_t;
     using match_t = typename index_t::match_t;
 
@@ -445,18 +702,29 @@ class index_dense_gt {
     index_dense_gt(index_dense_gt&& other)
         : config_(std::move(other.config_)),
 
-          typed_(exchange(other.typed_, nullptr)),     //
-          cast_buffer_(std::move(other.cast_buffer_)), //
-          casts_(std::move(other.casts_)),             //
-          metric_(std::move(other.metric_)),           //
+          typed_(exchange(other.typed_, nullptr)),         //
+          cast_buffer_(std::move(other.cast_buffer_)),     //
+          casts_(std::move(other.casts_)),                 //
+          metric_(std::move(other.metric_)),               //
+          quantizer_(std::move(other.quantizer_)),         //
+          lookup_tables_(std::move(other.lookup_tables_)), //
 
           vectors_tape_allocator_(std::move(other.vectors_tape_allocator_)), //
           vectors_lookup_(std::move(other.vectors_lookup_)),                 //
 
+          rerank_metric_(std::move(other.rerank_metric_)),                                 //
+          rerank_casts_(std::move(other.rerank_casts_)),                                   //
+          rerank_cast_buffer_(std::move(other.rerank_cast_buffer_)),                       //
+          rerank_vectors_tape_allocator_(std::move(other.rerank_vectors_tape_allocator_)), //
+          rerank_vectors_lookup_(std::move(other.rerank_vectors_lookup_)),                 //
+
           available_threads_(std::move(other.available_threads_)), //
-          slot_lookup_(std::move(other.slot_lookup_)),             //
           free_keys_(std::move(other.free_keys_)),                 //
-          free_key_(std::move(other.free_key_)) {}                 //
+          free_key_(std::move(other.free_key_)),                   //
+          snapshot_vectors_(std::move(other.snapshot_vectors_)) {  //
+        // Leave the freshly allocated empty shards behind, so the lookups on `other` stay valid
+        std::swap(slot_lookup_, other.slot_lookup_);
+    }
 
     index_dense_gt& operator=(index_dense_gt&& other) {
         swap(other);
@@ -474,14 +742,23 @@ class index_dense_gt {
         std::swap(cast_buffer_, other.cast_buffer_);
         std::swap(casts_, other.casts_);
         std::swap(metric_, other.metric_);
+        std::swap(quantizer_, other.quantizer_);
+        std::swap(lookup_tables_, other.lookup_tables_);
 
         std::swap(vectors_tape_allocator_, other.vectors_tape_allocator_);
         std::swap(vectors_lookup_, other.vectors_lookup_);
 
+        std::swap(rerank_metric_, other.rerank_metric_);
+        std::swap(rerank_casts_, other.rerank_casts_);
+        std::swap(rerank_cast_buffer_, other.rerank_cast_buffer_);
+        std::swap(rerank_vectors_tape_allocator_, other.rerank_vectors_tape_allocator_);
+        std::swap(rerank_vectors_lookup_, other.rerank_vectors_lookup_);
+
         std::swap(available_threads_, other.available_threads_);
         std::swap(slot_lookup_, other.slot_lookup_);
         std::swap(free_keys_, other.free_keys_);
         std::swap(free_key_, other.free_key_);
+        std::swap(snapshot_vectors_, other.snapshot_vectors_);
     }
 
     ~index_dense_gt() {
@@ -506,8 +783,12 @@ class index_dense_gt {
         scalar_kind_t scalar_kind = metric.scalar_kind();
         std::size_t hardware_threads = std::thread::hardware_concurrency();
 
+        config.vector_bytes = config.colocate_vectors ? metric.bytes_per_vector() : 0;
+
         index_dense_gt result;
         result.config_ = config;
+        result.vectors_tape_allocator_ = vectors_tape_allocator_t(config.placement);
+        result.rerank_vectors_tape_allocator_ = vectors_tape_allocator_t(config.placement);
         result.cast_buffer_.resize(hardware_threads * metric.bytes_per_vector());
         result.casts_ = make_casts_(scalar_kind);
         result.metric_ = metric;
@@ -519,7 +800,7 @@ class index_dense_gt {
 
         // Available since C11, but only C++17, so we use the C version.
         index_t* raw = index_allocator_t{}.allocate(1);
-        new (raw) index_t(config);
+        new (raw) index_t(config, {}, tape_allocator_t(config.placement));
         result.typed_ = raw;
         return result;
     }
@@ -554,14 +835,85 @@ class index_dense_gt {
 
     scalar_kind_t scalar_kind() const noexcept { return metric_.scalar_kind(); }
     std::size_t bytes_per_vector() const noexcept { return metric_.bytes_per_vector(); }
+    std::size_t bytes_per_stored_vector() const noexcept { return vector_bytes_(); }
     std::size_t scalar_words() const noexcept { return metric_.scalar_words(); }
     std::size_t dimensions() const noexcept { return metric_.dimensions(); }
 
+    // Product quantization of the stored vectors
+    using quantization_result_t = product_quantizer_t::train_result_t;
+    product_quantizer_t const& quantizer() const noexcept { return quantizer_; }
+    bool quantized() const noexcept { return bool(quantizer_); }
+
+    /**
+     *  @brief Switches the index to @b product-quantized vectors storage, learning codebooks from a sample.
+     *         Every following insertion will keep just `quantizer().bytes_per_code()` bytes per vector,
+     *         and the distances to queries will be estimated with per-query lookup tables.
+     *
+     *  @param[in] vectors Row-major matrix of ::count training vectors with `dimensions()` scalars each.
+     *  @param[in] subspaces Number of one-byte codes per vector, must divide the `dimensions()`.
+     *  @param[in] iterations Number of k-means refinement rounds.
+     *  @param[in] executor Thread-pool to train different subspaces concurrently.
+     */
+    template <typename executor_at = dummy_executor_t>
+    quantization_result_t quantize(                                     //
+        f32_t const* vectors, std::size_t count, std::size_t subspaces, //
+        std::size_t iterations = 16, executor_at&& executor = executor_at{}) {
+
+        quantization_result_t result;
+        if (typed_->size())
+            return result.failed("Quantization can only be enabled for an empty index");
+        if (metric_.scalar_kind() != scalar_kind_t::f32_k)
+            return result.failed("Quantization requires a single-precision metric");
+
+        product_quantizer_t quantizer;
+        result = quantizer.train(vectors, count, dimensions(), subspaces, metric_.metric_kind(), iterations,
+                                 std::forward<executor_at>(executor));
+        if (!result)
+            return result;
+
+        quantizer_ = std::move(quantizer);
+        lookup_tables_.resize(available_threads_.size() * quantizer_.lookup_table_length());
+        if (config_.colocate_vectors && !rebuild_typed_())
+            return result.failed("Out of memory!");
+        return result;
+    }
+
+    // Higher-precision copies of vectors for two-stage search
+    metric_t const& rerank_metric() const noexcept { return rerank_metric_; }
+    bool reranked() const noexcept { return bool(rerank_metric_); }
+    std::size_t rerank_factor() const { return config_.rerank_factor; }
+    void change_rerank_factor(std::size_t n) { config_.rerank_factor = n; }
+
+    /**
+     *  @brief Enables @b two-stage search, keeping a higher-precision copy of every following insertion.
+     *         The graph is traversed with the compact vectors of `metric()`, and the closest
+     *         `wanted * rerank_factor()` candidates are then rescored with the ::metric over the copies.
+     *
+     *  @param[in] metric Metric of the same dimensions, like an `f32_k` counterpart of an `i8_k` metric.
+     *  @return `false` if the index isn't empty, or the ::metric doesn't match the dimensions.
+     */
+    bool enable_rerank(metric_t metric) {
+        if (typed_->size() || metric.dimensions() != dimensions() || !metric)
+            return false;
+
+        rerank_casts_ = make_casts_(metric.scalar_kind());
+        rerank_cast_buffer_.resize(available_threads_.size() * metric.bytes_per_vector());
+        rerank_vectors_lookup_.resize(vectors_lookup_.size());
+        rerank_metric_ = std::move(metric);
+        return true;
+    }
+
     // Fetching and changing search criteria
     std::size_t expansion_add() const { return config_.expansion_add; }
     std::size_t expansion_search() const { return config_.expansion_search; }
     void change_expansion_add(std::size_t n) { config_.expansion_add = n; }
     void change_expansion_search(std::size_t n) { config_.expansion_search = n; }
+    std::size_t patience_search() const { return config_.patience_search; }
+    double distance_ratio_search() const { return config_.distance_ratio_search; }
+    void change_patience_search(std::size_t n) { config_.patience_search = n; }
+    void change_distance_ratio_search(double ratio) { config_.distance_ratio_search = ratio; }
+    std::size_t prefetch_depth() const { return config_.prefetch_depth; }
+    void change_prefetch_depth(std::size_t n) { config_.prefetch_depth = n; }
 
     member_citerator_t cbegin() const { return typed_->cbegin(); }
     member_citerator_t cend() const { return typed_->cend(); }
@@ -576,6 +928,27 @@ class index_dense_gt {
         return typed_->stats(stats_per_level, max_level);
     }
 
+    /**
+     *  @brief  Per-query hops, distances, and latency histograms, with the lock waits in the graph
+     *          and in the keys lookup. Returns zeros, unless compiled with `USEARCH_USE_INSTRUMENTATION`.
+     */
+    index_instrumentation_t instrumentation() const {
+        index_instrumentation_t result = typed_->instrumentation();
+#if USEARCH_USE_INSTRUMENTATION
+        result.lookup_lock_waits = slot_lookup_mutex_.waits();
+        result.lookup_lock_wait_nanoseconds = slot_lookup_mutex_.wait_nanoseconds();
+#endif
+        return result;
+    }
+
+    /// @brief  Zeroes the instrumentation counters, while no searches are running.
+    void reset_instrumentation() {
+        typed_->reset_instrumentation();
+#if USEARCH_USE_INSTRUMENTATION
+        slot_lookup_mutex_.reset();
+#endif
+    }
+
     dynamic_allocator_t const& allocator() const { return typed_->dynamic_allocator(); }
     vector_key_t const& free_key() const { return free_key_; }
 
@@ -603,6 +976,31 @@ class index_dense_gt {
         distance_t max = infinite_distance();
     };
 
+    /**
+     *  @brief Set of slots, precomputed from a collection of keys, to be reused across many searches,
+     *         like all the entries of a single tenant. Along with the slots, keeps the sorted keys, so that
+     *         a slot freed by `remove` and reused by another key is no longer matched.
+     *         The `count` is exact when the filter is made, and only bounds the members from above after
+     *         removals, which costs just an occasional exhaustive scan. Invalidated by `compact` and `reorder`.
+     */
+    struct filter_t {
+        error_t error{};
+        bitset_t slots{};
+        std::vector<vector_key_t> keys{};
+        std::size_t capacity{};
+        std::size_t count{};
+
+        explicit operator bool() const noexcept { return !error; }
+        filter_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+        inline bool test(std::size_t slot) const noexcept { return slot < capacity && slots.test(slot); }
+        inline bool test(std::size_t slot, vector_key_t key) const noexcept {
+            return test(slot) && std::binary_search(keys.begin(), keys.end(), key);
+        }
+    };
+
     // clang-format off
     add_result_t add(vector_key_t key, b1x8_t const* vector, std::size_t thread = any_thread(), bool force_vector_copy = true) { return add_(key, vector, thread, force_vector_copy, casts_.from_b1x8); }
     add_result_t add(vector_key_t key, i8_t const* vector, std::size_t thread = any_thread(), bool force_vector_copy = true) { return add_(key, vector, thread, force_vector_copy, casts_.from_i8); }
@@ -610,6 +1008,12 @@ class index_dense_gt {
     add_result_t add(vector_key_t key, f32_t const* vector, std::size_t thread = any_thread(), bool force_vector_copy = true) { return add_(key, vector, thread, force_vector_copy, casts_.from_f32); }
     add_result_t add(vector_key_t key, f64_t const* vector, std::size_t thread = any_thread(), bool force_vector_copy = true) { return add_(key, vector, thread, force_vector_copy, casts_.from_f64); }
 
+    template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t> build_result_t build(vector_key_t const* keys, b1x8_t const* vectors, std::size_t count, executor_at&& executor = executor_at{}, progress_at&& progress = progress_at{}) { return build_(keys, vectors, count, std::forward<executor_at>(executor), std::forward<progress_at>(progress), casts_.from_b1x8); }
+    template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t> build_result_t build(vector_key_t const* keys, i8_t const* vectors, std::size_t count, executor_at&& executor = executor_at{}, progress_at&& progress = progress_at{}) { return build_(keys, vectors, count, std::forward<executor_at>(executor), std::forward<progress_at>(progress), casts_.from_i8); }
+    template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t> build_result_t build(vector_key_t const* keys, f16_t const* vectors, std::size_t count, executor_at&& executor = executor_at{}, progress_at&& progress = progress_at{}) { return build_(keys, vectors, count, std::forward<executor_at>(executor), std::forward<progress_at>(progress), casts_.from_f16); }
+    template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t> build_result_t build(vector_key_t const* keys, f32_t const* vectors, std::size_t count, executor_at&& executor = executor_at{}, progress_at&& progress = progress_at{}) { return build_(keys, vectors, count, std::forward<executor_at>(executor), std::forward<progress_at>(progress), casts_.from_f32); }
+    template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t> build_result_t build(vector_key_t const* keys, f64_t const* vectors, std::size_t count, executor_at&& executor = executor_at{}, progress_at&& progress = progress_at{}) { return build_(keys, vectors, count, std::forward<executor_at>(executor), std::forward<progress_at>(progress), casts_.from_f64); }
+
     search_result_t search(b1x8_t const* vector, std::size_t wanted, std::size_t thread = any_thread(), bool exact = false) const { return search_(vector, wanted, dummy_predicate_t {}, thread, exact, casts_.from_b1x8); }
     search_result_t search(i8_t const* vector, std::size_t wanted, std::size_t thread = any_thread(), bool exact = false) const { return search_(vector, wanted, dummy_predicate_t {}, thread, exact, casts_.from_i8); }
     search_result_t search(f16_t const* vector, std::size_t wanted, std::size_t thread = any_thread(), bool exact = false) const { return search_(vector, wanted, dummy_predicate_t {}, thread, exact, casts_.from_f16); }
@@ -622,6 +1026,30 @@ class index_dense_gt {
     template <typename predicate_at> search_result_t filtered_search(f32_t const* vector, std::size_t wanted, predicate_at&& predicate, std::size_t thread = any_thread(), bool exact = false) const { return search_(vector, wanted, std::forward<predicate_at>(predicate), thread, exact, casts_.from_f32); }
     template <typename predicate_at> search_result_t filtered_search(f64_t const* vector, std::size_t wanted, predicate_at&& predicate, std::size_t thread = any_thread(), bool exact = false) const { return search_(vector, wanted, std::forward<predicate_at>(predicate), thread, exact, casts_.from_f64); }
 
+    search_result_t search(b1x8_t const* vector, std::size_t wanted, filter_t const& filter, std::size_t thread = any_thread(), bool exact = false) const { return filtered_search_(vector, wanted, filter, thread, exact, casts_.from_b1x8); }
+    search_result_t search(i8_t const* vector, std::size_t wanted, filter_t const& filter, std::size_t thread = any_thread(), bool exact = false) const { return filtered_search_(vector, wanted, filter, thread, exact, casts_.from_i8); }
+    search_result_t search(f16_t const* vector, std::size_t wanted, filter_t const& filter, std::size_t thread = any_thread(), bool exact = false) const { return filtered_search_(vector, wanted, filter, thread, exact, casts_.from_f16); }
+    search_result_t search(f32_t const* vector, std::size_t wanted, filter_t const& filter, std::size_t thread = any_thread(), bool exact = false) const { return filtered_search_(vector, wanted, filter, thread, exact, casts_.from_f32); }
+    search_result_t search(f64_t const* vector, std::size_t wanted, filter_t const& filter, std::size_t thread = any_thread(), bool exact = false) const { return filtered_search_(vector, wanted, filter, thread, exact, casts_.from_f64); }
+
+    template <typename callback_at> range_search_result_t range_search(b1x8_t const* vector, distance_t radius, callback_at&& callback, std::size_t max_count = std::numeric_limits<std::size_t>::max(), std::size_t thread = any_thread(), bool exact = false) const { return range_search_(vector, radius, std::forward<callback_at>(callback), max_count, thread, exact, casts_.from_b1x8); }
+    template <typename callback_at> range_search_result_t range_search(i8_t const* vector, distance_t radius, callback_at&& callback, std::size_t max_count = std::numeric_limits<std::size_t>::max(), std::size_t thread = any_thread(), bool exact = false) const { return range_search_(vector, radius, std::forward<callback_at>(callback), max_count, thread, exact, casts_.from_i8); }
+    template <typename callback_at> range_search_result_t range_search(f16_t const* vector, distance_t radius, callback_at&& callback, std::size_t max_count = std::numeric_limits<std::size_t>::max(), std::size_t thread = any_thread(), bool exact = false) const { return range_search_(vector, radius, std::forward<callback_at>(callback), max_count, thread, exact, casts_.from_f16); }
+    template <typename callback_at> range_search_result_t range_search(f32_t const* vector, distance_t radius, callback_at&& callback, std::size_t max_count = std::numeric_limits<std::size_t>::max(), std::size_t thread = any_thread(), bool exact = false) const { return range_search_(vector, radius, std::forward<callback_at>(callback), max_count, thread, exact, casts_.from_f32); }
+    template <typename callback_at> range_search_result_t range_search(f64_t const* vector, distance_t radius, callback_at&& callback, std::size_t max_count = std::numeric_limits<std::size_t>::max(), std::size_t thread = any_thread(), bool exact = false) const { return range_search_(vector, radius, std::forward<callback_at>(callback), max_count, thread, exact, casts_.from_f64); }
+
+    template <typename vectors_source_at> search_result_t search_reranked(b1x8_t const* vector, std::size_t wanted, std::size_t candidates, vectors_source_at&& source, std::size_t thread = any_thread()) const { return search_reranked_(vector, wanted, candidates, std::forward<vectors_source_at>(source), thread, casts_.from_b1x8); }
+    template <typename vectors_source_at> search_result_t search_reranked(i8_t const* vector, std::size_t wanted, std::size_t candidates, vectors_source_at&& source, std::size_t thread = any_thread()) const { return search_reranked_(vector, wanted, candidates, std::forward<vectors_source_at>(source), thread, casts_.from_i8); }
+    template <typename vectors_source_at> search_result_t search_reranked(f16_t const* vector, std::size_t wanted, std::size_t candidates, vectors_source_at&& source, std::size_t thread = any_thread()) const { return search_reranked_(vector, wanted, candidates, std::forward<vectors_source_at>(source), thread, casts_.from_f16); }
+    template <typename vectors_source_at> search_result_t search_reranked(f32_t const* vector, std::size_t wanted, std::size_t candidates, vectors_source_at&& source, std::size_t thread = any_thread()) const { return search_reranked_(vector, wanted, candidates, std::forward<vectors_source_at>(source), thread, casts_.from_f32); }
+    template <typename vectors_source_at> search_result_t search_reranked(f64_t const* vector, std::size_t wanted, std::size_t candidates, vectors_source_at&& source, std::size_t thread = any_thread()) const { return search_reranked_(vector, wanted, candidates, std::forward<vectors_source_at>(source), thread, casts_.from_f64); }
+
+    template <typename executor_at = dummy_executor_t> search_batch_result_t search_batch(b1x8_t const* queries, std::size_t queries_count, std::size_t wanted, vector_key_t* keys, distance_t* distances, std::size_t* counts, executor_at&& executor = executor_at{}) const { return search_batch_(queries, queries_count, wanted, keys, distances, counts, std::forward<executor_at>(executor), casts_.from_b1x8); }
+    template <typename executor_at = dummy_executor_t> search_batch_result_t search_batch(i8_t const* queries, std::size_t queries_count, std::size_t wanted, vector_key_t* keys, distance_t* distances, std::size_t* counts, executor_at&& executor = executor_at{}) const { return search_batch_(queries, queries_count, wanted, keys, distances, counts, std::forward<executor_at>(executor), casts_.from_i8); }
+    template <typename executor_at = dummy_executor_t> search_batch_result_t search_batch(f16_t const* queries, std::size_t queries_count, std::size_t wanted, vector_key_t* keys, distance_t* distances, std::size_t* counts, executor_at&& executor = executor_at{}) const { return search_batch_(queries, queries_count, wanted, keys, distances, counts, std::forward<executor_at>(executor), casts_.from_f16); }
+    template <typename executor_at = dummy_executor_t> search_batch_result_t search_batch(f32_t const* queries, std::size_t queries_count, std::size_t wanted, vector_key_t* keys, distance_t* distances, std::size_t* counts, executor_at&& executor = executor_at{}) const { return search_batch_(queries, queries_count, wanted, keys, distances, counts, std::forward<executor_at>(executor), casts_.from_f32); }
+    template <typename executor_at = dummy_executor_t> search_batch_result_t search_batch(f64_t const* queries, std::size_t queries_count, std::size_t wanted, vector_key_t* keys, distance_t* distances, std::size_t* counts, executor_at&& executor = executor_at{}) const { return search_batch_(queries, queries_count, wanted, keys, distances, counts, std::forward<executor_at>(executor), casts_.from_f64); }
+
     std::size_t get(vector_key_t key, b1x8_t* vector, std::size_t vectors_count = 1) const { return get_(key, vector, vectors_count, casts_.to_b1x8); }
     std::size_t get(vector_key_t key, i8_t* vector, std::size_t vectors_count = 1) const { return get_(key, vector, vectors_count, casts_.to_i8); }
     std::size_t get(vector_key_t key, f16_t* vector, std::size_t vectors_count = 1) const { return get_(key, vector, vectors_count, casts_.to_f16); }
@@ -647,32 +1075,11 @@ class index_dense_gt {
      *          exporting the mean, maximum, and minimum values.
      */
     aggregated_distances_t distance_between(vector_key_t a, vector_key_t b, std::size_t = any_thread()) const {
-        shared_lock_t lock(slot_lookup_mutex_);
+        // Both keys may land in the same shard, so collect the slots one key at a time
+        std::vector<compressed_slot_t> a_slots = slots_(a);
+        std::vector<compressed_slot_t> b_slots = slots_(b);
         aggregated_distances_t result;
-        if (!multi()) {
-            auto a_it = slot_lookup_.find(key_and_slot_t::any_slot(a));
-            auto b_it = slot_lookup_.find(key_and_slot_t::any_slot(b));
-            bool a_missing = a_it == slot_lookup_.end();
-            bool b_missing = b_it == slot_lookup_.end();
-            if (a_missing || b_missing)
-                return result;
-
-            key_and_slot_t a_key_and_slot = *a_it;
-            byte_t const* a_vector = vectors_lookup_[a_key_and_slot.slot];
-            key_and_slot_t b_key_and_slot = *b_it;
-            byte_t const* b_vector = vectors_lookup_[b_key_and_slot.slot];
-            distance_t a_b_distance = metric_(a_vector, b_vector);
-
-            result.mean = result.min = result.max = a_b_distance;
-            result.count = 1;
-            return result;
-        }
-
-        auto a_range = slot_lookup_.equal_range(key_and_slot_t::any_slot(a));
-        auto b_range = slot_lookup_.equal_range(key_and_slot_t::any_slot(b));
-        bool a_missing = a_range.first == a_range.second;
-        bool b_missing = b_range.first == b_range.second;
-        if (a_missing || b_missing)
+        if (a_slots.empty() || b_slots.empty())
             return result;
 
         result.min = std::numeric_limits<distance_t>::max();
@@ -680,23 +1087,17 @@ class index_dense_gt {
         result.mean = 0;
         result.count = 0;
 
-        while (a_range.first != a_range.second) {
-            key_and_slot_t a_key_and_slot = *a_range.first;
-            byte_t const* a_vector = vectors_lookup_[a_key_and_slot.slot];
-            while (b_range.first != b_range.second) {
-                key_and_slot_t b_key_and_slot = *b_range.first;
-                byte_t const* b_vector = vectors_lookup_[b_key_and_slot.slot];
-                distance_t a_b_distance = metric_(a_vector, b_vector);
+        for (compressed_slot_t a_slot : a_slots) {
+            byte_t const* a_vector = vectors_lookup_[a_slot];
+            for (compressed_slot_t b_slot : b_slots) {
+                byte_t const* b_vector = vectors_lookup_[b_slot];
+                distance_t a_b_distance = metric_proxy_t{*this}.f(a_vector, b_vector);
 
                 result.mean += a_b_distance;
                 result.min = (std::min)(result.min, a_b_distance);
                 result.max = (std::max)(result.max, a_b_distance);
                 result.count++;
-
-                //
-                ++b_range.first;
             }
-            ++a_range.first;
         }
 
         result.mean /= result.count;
@@ -709,8 +1110,10 @@ class index_dense_gt {
     cluster_result_t cluster(vector_key_t key, std::size_t level, std::size_t thread = any_thread()) const {
 
         // Check if such `key` is even present.
-        shared_lock_t slots_lock(slot_lookup_mutex_);
-        auto key_range = slot_lookup_.equal_range(key_and_slot_t::any_slot(key));
+        slot_lookup_shard_t const& shard = slot_shard_(key);
+        lookup_shared_lock_t lookup_lock(slot_lookup_mutex_);
+        shared_lock_t slots_lock(shard.mutex);
+        auto key_range = shard.slots.equal_range(key_and_slot_t::any_slot(key));
         cluster_result_t result;
         if (key_range.first == key_range.second)
             return result.failed("Key missing!");
@@ -744,15 +1147,22 @@ class index_dense_gt {
      *  @return `true` if the memory reservation was successful, `false` otherwise.
      */
     bool reserve(index_limits_t limits) {
+        // The removed entries keep their slots, so `size()` may be less than the slots in use
+        limits.members = (std::max)(limits.members, typed_->size());
         {
-            unique_lock_t lock(slot_lookup_mutex_);
-            slot_lookup_.reserve(limits.members);
+            lookup_unique_lock_t lock(slot_lookup_mutex_);
+            for (slot_lookup_shard_t& shard : slot_lookup_)
+                shard.slots.reserve(divide_round_up<slot_lookup_shards()>(limits.members));
             vectors_lookup_.resize(limits.members);
+            if (rerank_metric_)
+                rerank_vectors_lookup_.resize(limits.members);
 
             // During reserve, no insertions may be happening, so we can safely overwrite the whole collection.
             std::unique_lock<std::mutex> available_threads_lock(available_threads_mutex_);
             available_threads_.resize(limits.threads());
             std::iota(available_threads_.begin(), available_threads_.end(), 0ul);
+            lookup_tables_.resize(available_threads_.size() * quantizer_.lookup_table_length());
+            rerank_cast_buffer_.resize(available_threads_.size() * rerank_metric_.bytes_per_vector());
         }
         return typed_->reserve(limits);
     }
@@ -764,14 +1174,18 @@ class index_dense_gt {
      *  Will keep the number of available threads/contexts the same as it was.
      */
     void clear() {
-        unique_lock_t lookup_lock(slot_lookup_mutex_);
+        snapshot_end_();
+        lookup_unique_lock_t lookup_lock(slot_lookup_mutex_);
 
         std::unique_lock<std::mutex> free_lock(free_keys_mutex_);
         typed_->clear();
-        slot_lookup_.clear();
+        for (slot_lookup_shard_t& shard : slot_lookup_)
+            shard.slots.clear();
         vectors_lookup_.clear();
+        rerank_vectors_lookup_.clear();
         free_keys_.clear();
         vectors_tape_allocator_.reset();
+        rerank_vectors_tape_allocator_.reset();
     }
 
     /**
@@ -782,15 +1196,20 @@ class index_dense_gt {
      *  If the index is memory-mapped - releases the mapping and the descriptor.
      */
     void reset() {
-        unique_lock_t lookup_lock(slot_lookup_mutex_);
+        snapshot_end_();
+        lookup_unique_lock_t lookup_lock(slot_lookup_mutex_);
 
         std::unique_lock<std::mutex> free_lock(free_keys_mutex_);
         std::unique_lock<std::mutex> available_threads_lock(available_threads_mutex_);
         typed_->reset();
-        slot_lookup_.clear();
+        for (slot_lookup_shard_t& shard : slot_lookup_)
+            shard.slots.clear();
         vectors_lookup_.clear();
+        rerank_vectors_lookup_.clear();
         free_keys_.clear();
         vectors_tape_allocator_.reset();
+        rerank_vectors_tape_allocator_.reset();
+        disk_resident_ = false;
 
         // Reset the thread IDs.
         available_threads_.resize(std::thread::hardware_concurrency());
@@ -808,6 +1227,7 @@ class index_dense_gt {
         serialization_result_t result;
         std::uint64_t matrix_rows = 0;
         std::uint64_t matrix_cols = 0;
+        bool const has_rerank_vectors = rerank_metric_ && !config.exclude_vectors;
 
         // We may not want to put the vectors into the same file
         if (!config.exclude_vectors) {
@@ -815,7 +1235,7 @@ class index_dense_gt {
             if (!config.use_64_bit_dimensions) {
                 std::uint32_t dimensions[2];
                 dimensions[0] = static_cast<std::uint32_t>(typed_->size());
-                dimensions[1] = static_cast<std::uint32_t>(metric_.bytes_per_vector());
+                dimensions[1] = static_cast<std::uint32_t>(separate_vector_bytes_());
                 if (!output(&dimensions, sizeof(dimensions)))
                     return result.failed("Failed to serialize into stream");
                 matrix_rows = dimensions[0];
@@ -823,7 +1243,7 @@ class index_dense_gt {
             } else {
                 std::uint64_t dimensions[2];
                 dimensions[0] = static_cast<std::uint64_t>(typed_->size());
-                dimensions[1] = static_cast<std::uint64_t>(metric_.bytes_per_vector());
+                dimensions[1] = static_cast<std::uint64_t>(separate_vector_bytes_());
                 if (!output(&dimensions, sizeof(dimensions)))
                     return result.failed("Failed to serialize into stream");
                 matrix_rows = dimensions[0];
@@ -838,36 +1258,21 @@ class index_dense_gt {
             }
         }
 
-        // Augment metadata
-        {
-            index_dense_head_buffer_t buffer;
-            std::memset(buffer, 0, sizeof(buffer));
-            index_dense_head_t head{buffer};
-            std::memcpy(buffer, default_magic(), std::strlen(default_magic()));
-
-            // Describe software version
-            using version_t = index_dense_head_t::version_t;
-            head.version_major = static_cast<version_t>(USEARCH_VERSION_MAJOR);
-            head.version_minor = static_cast<version_t>(USEARCH_VERSION_MINOR);
-            head.version_patch = static_cast<version_t>(USEARCH_VERSION_PATCH);
-
-            // Describes types used
-            head.kind_metric = metric_.metric_kind();
-            head.kind_scalar = metric_.scalar_kind();
-            head.kind_key = unum::usearch::scalar_kind<vector_key_t>();
-            head.kind_compressed_slot = unum::usearch::scalar_kind<compressed_slot_t>();
-
-            head.count_present = size();
-            head.count_deleted = typed_->size() - size();
-            head.dimensions = dimensions();
-            head.multi = multi();
-
-            if (!output(&buffer, sizeof(buffer)))
-                return result.failed("Failed to serialize into stream");
-        }
+        // Augment metadata and save the codebooks right after it
+        result = save_head_(output, has_rerank_vectors, size(), typed_->size() - size());
+        if (!result)
+            return result;
 
         // Save the actual proximity graph
-        return typed_->save_to_stream(std::forward<output_callback_at>(output), std::forward<progress_at>(progress));
+        result = typed_->save_to_stream(output, std::forward<progress_at>(progress));
+        if (!result || !has_rerank_vectors)
+            return result;
+
+        // Dump the higher-precision copies after the graph, so that older readers can ignore them
+        for (std::uint64_t i = 0; i != matrix_rows; ++i)
+            if (!output(rerank_vectors_lookup_[i], rerank_metric_.bytes_per_vector()))
+                return result.failed("Failed to serialize into stream");
+        return result;
     }
 
     /**
@@ -878,9 +1283,13 @@ class index_dense_gt {
         std::size_t matrix_length = 0;
         if (!config.exclude_vectors) {
             dimensions_length = config.use_64_bit_dimensions ? sizeof(std::uint64_t) * 2 : sizeof(std::uint32_t) * 2;
-            matrix_length = typed_->size() * metric_.bytes_per_vector();
+            matrix_length = typed_->size() * separate_vector_bytes_();
         }
-        return dimensions_length + matrix_length + sizeof(index_dense_head_buffer_t) + typed_->serialized_length();
+        std::size_t quantizer_length = quantizer_ ? quantizer_.serialized_length() : 0;
+        std::size_t rerank_length =
+            rerank_metric_ && !config.exclude_vectors ? typed_->size() * rerank_metric_.bytes_per_vector() : 0;
+        return dimensions_length + matrix_length + sizeof(index_dense_head_buffer_t) + quantizer_length +
+               typed_->serialized_length() + rerank_length;
     }
 
     /**
@@ -920,7 +1329,7 @@ class index_dense_gt {
             }
             // Load the vectors one after another
             vectors_lookup_.resize(matrix_rows);
-            for (std::uint64_t slot = 0; slot != matrix_rows; ++slot) {
+            for (std::uint64_t slot = 0; slot != matrix_rows && matrix_cols; ++slot) {
                 byte_t* vector = vectors_tape_allocator_.allocate(matrix_cols);
                 if (!input(vector, matrix_cols))
                     return result.failed("Failed to read vectors");
@@ -929,39 +1338,183 @@ class index_dense_gt {
         }
 
         // Load metadata and choose the right metric
-        {
-            index_dense_head_buffer_t buffer;
-            if (!input(buffer, sizeof(buffer)))
-                return result.failed("Failed to read the index ");
+        result = load_head_(input, config, matrix_cols);
+        if (!result)
+            return result;
 
-            index_dense_head_t head{buffer};
-            if (std::memcmp(buffer, default_magic(), std::strlen(default_magic())) != 0)
-                return result.failed("Magic header mismatch - the file isn't an index");
+        // Pull the actual proximity graph
+        result = typed_->load_from_stream(std::forward<input_callback_at>(input), std::forward<progress_at>(progress));
+        if (!result)
+            return result;
+        if (typed_->size() != static_cast<std::size_t>(matrix_rows))
+            return result.failed("Index size and the number of vectors doesn't match");
+        reindex_colocated_vectors_();
 
-            // Validate the software version
-            if (head.version_major != USEARCH_VERSION_MAJOR)
-                return result.failed("File format may be different, please rebuild");
+        // Load the higher-precision copies one after another
+        if (rerank_metric_) {
+            rerank_vectors_lookup_.resize(matrix_rows);
+            for (std::uint64_t slot = 0; slot != matrix_rows; ++slot) {
+                byte_t* vector = rerank_vectors_tape_allocator_.allocate(rerank_metric_.bytes_per_vector());
+                if (!input(vector, rerank_metric_.bytes_per_vector()))
+                    return result.failed("Failed to read higher-precision vectors");
+                rerank_vectors_lookup_[slot] = vector;
+            }
+        }
 
-            // Check the types used
-            if (head.kind_key != unum::usearch::scalar_kind<vector_key_t>())
-                return result.failed("Key type doesn't match, consider rebuilding");
-            if (head.kind_compressed_slot != unum::usearch::scalar_kind<compressed_slot_t>())
-                return result.failed("Slot type doesn't match, consider rebuilding");
+        reindex_keys_();
+        if (config.reorder) {
+            compaction_result_t reordered = reorder();
+            if (!reordered)
+                return result.failed(reordered.error.release());
+        }
+        return result;
+    }
 
-            config_.multi = head.multi;
-            metric_ = metric_t::builtin(head.dimensions, head.kind_metric, head.kind_scalar);
-            cast_buffer_.resize(available_threads_.size() * metric_.bytes_per_vector());
-            casts_ = make_casts_(head.kind_scalar);
+    /**
+     *  @brief  Saves serialized binary index representation at the cursor of a shared file,
+     *          dumping the vectors and the graph nodes from multiple threads with positional writes.
+     *          Produces the same bytes as `save_to_stream`.
+     */
+    template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t>
+    serialization_result_t save_to_file(positional_file_t& file, serialization_config_t config = {},
+                                        executor_at&& executor = {}, progress_at&& progress = {}) const {
+
+        serialization_result_t result = file.open_if_not();
+        if (!result)
+            return result;
+
+        std::uint64_t matrix_rows = 0;
+        std::uint64_t matrix_cols = 0;
+        bool const has_rerank_vectors = rerank_metric_ && !config.exclude_vectors;
+        auto output = [&](void const* buffer, std::size_t length) {
+            result = file.write(buffer, length);
+            return !!result;
+        };
+
+        // We may not want to put the vectors into the same file
+        if (!config.exclude_vectors) {
+            matrix_rows = typed_->size();
+            matrix_cols = separate_vector_bytes_();
+            std::uint32_t dimensions_32[2] = {static_cast<std::uint32_t>(matrix_rows),
+                                              static_cast<std::uint32_t>(matrix_cols)};
+            std::uint64_t dimensions_64[2] = {matrix_rows, matrix_cols};
+            if (!config.use_64_bit_dimensions ? !output(&dimensions_32, sizeof(dimensions_32))
+                                              : !output(&dimensions_64, sizeof(dimensions_64)))
+                return result;
+
+            // Dump the vectors from multiple threads
+            if (matrix_cols) {
+                result = file.write_pieces(
+                    matrix_rows, [&](std::size_t i) { return span_gt<byte_t>{vectors_lookup_[i], matrix_cols}; },
+                    executor);
+                if (!result)
+                    return result;
+            }
+        }
+
+        // Augment metadata and save the codebooks right after it
+        serialization_result_t head_result =
+            save_head_(output, has_rerank_vectors, size(), typed_->size() - size());
+        if (!head_result)
+            return head_result;
+
+        // Save the actual proximity graph
+        result = typed_->save_to_file(file, executor, std::forward<progress_at>(progress));
+        if (!result || !has_rerank_vectors)
+            return result;
+
+        // Dump the higher-precision copies after the graph, so that older readers can ignore them
+        std::size_t const rerank_bytes = rerank_metric_.bytes_per_vector();
+        return file.write_pieces(
+            matrix_rows,
+            [&](std::size_t i) { return span_gt<byte_t>{rerank_vectors_lookup_[i], rerank_bytes}; }, executor);
+    }
+
+    /**
+     *  @brief  Symmetric to `save_to_file`, allocating all the vectors and nodes first,
+     *          and then filling them from multiple threads with positional reads.
+     */
+    template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t>
+    serialization_result_t load_from_file(positional_file_t& file, serialization_config_t config = {},
+                                          executor_at&& executor = {}, progress_at&& progress = {}) {
+
+        // Discard all previous memory allocations of `vectors_tape_allocator_`
+        reset();
+
+        serialization_result_t result = file.open_if_not();
+        if (!result)
+            return result;
+
+        std::uint64_t matrix_rows = 0;
+        std::uint64_t matrix_cols = 0;
+        auto input = [&](void* buffer, std::size_t length) {
+            result = file.read(buffer, length);
+            return !!result;
+        };
+
+        // We may not want to load the vectors from the same file, or allow attaching them afterwards
+        if (!config.exclude_vectors) {
+            if (!config.use_64_bit_dimensions) {
+                std::uint32_t dimensions[2];
+                if (!input(&dimensions, sizeof(dimensions)))
+                    return result;
+                matrix_rows = dimensions[0];
+                matrix_cols = dimensions[1];
+            } else {
+                std::uint64_t dimensions[2];
+                if (!input(&dimensions, sizeof(dimensions)))
+                    return result;
+                matrix_rows = dimensions[0];
+                matrix_cols = dimensions[1];
+            }
+
+            // The tape allocator isn't thread-safe, so the vectors are allocated upfront
+            vectors_lookup_.resize(matrix_rows);
+            for (std::uint64_t slot = 0; slot != matrix_rows && matrix_cols; ++slot)
+                if (!(vectors_lookup_[slot] = vectors_tape_allocator_.allocate(matrix_cols)))
+                    return result.failed("Out of memory");
+            if (matrix_cols) {
+                result = file.read_pieces(
+                    matrix_rows, [&](std::size_t i) { return span_gt<byte_t>{vectors_lookup_[i], matrix_cols}; },
+                    executor);
+                if (!result)
+                    return result;
+            }
         }
 
+        // Load metadata and choose the right metric
+        serialization_result_t head_result = load_head_(input, config, matrix_cols);
+        if (!head_result)
+            return head_result;
+
         // Pull the actual proximity graph
-        result = typed_->load_from_stream(std::forward<input_callback_at>(input), std::forward<progress_at>(progress));
+        result = typed_->load_from_file(file, executor, std::forward<progress_at>(progress));
         if (!result)
             return result;
         if (typed_->size() != static_cast<std::size_t>(matrix_rows))
             return result.failed("Index size and the number of vectors doesn't match");
+        reindex_colocated_vectors_();
 
-        reindex_keys_();
+        // Load the higher-precision copies
+        if (rerank_metric_) {
+            std::size_t const rerank_bytes = rerank_metric_.bytes_per_vector();
+            rerank_vectors_lookup_.resize(matrix_rows);
+            for (std::uint64_t slot = 0; slot != matrix_rows; ++slot)
+                if (!(rerank_vectors_lookup_[slot] = rerank_vectors_tape_allocator_.allocate(rerank_bytes)))
+                    return result.failed("Out of memory");
+            result = file.read_pieces(
+                matrix_rows, [&](std::size_t i) { return span_gt<byte_t>{rerank_vectors_lookup_[i], rerank_bytes}; },
+                executor);
+            if (!result)
+                return result;
+        }
+
+        reindex_keys_(executor);
+        if (config.reorder) {
+            compaction_result_t reordered = reorder();
+            if (!reordered)
+                return result.failed(reordered.error.release());
+        }
         return result;
     }
 
@@ -982,6 +1535,9 @@ class index_dense_gt {
         serialization_result_t result = file.open_if_not();
         if (!result)
             return result;
+        if (config.disk_resident)
+            file.advise_random();
+        disk_resident_ = config.disk_resident;
 
         // Infer the new index size
         std::uint64_t matrix_rows = 0;
@@ -1039,9 +1595,41 @@ class index_dense_gt {
             cast_buffer_.resize(available_threads_.size() * metric_.bytes_per_vector());
             casts_ = make_casts_(head.kind_scalar);
             offset += sizeof(buffer);
+
+            quantizer_ = product_quantizer_t{};
+            if (head.quantizer_subspaces) {
+                auto input = [&](void* destination, std::size_t length) noexcept {
+                    if (file.size() - offset < length)
+                        return false;
+                    std::memcpy(destination, file.data() + offset, length);
+                    offset += length;
+                    return true;
+                };
+                result = quantizer_.load_from_stream(input);
+                if (!result)
+                    return result;
+                if (quantizer_.dimensions() != dimensions())
+                    return result.failed("Codebooks don't match the vectors");
+            }
+            lookup_tables_.resize(available_threads_.size() * quantizer_.lookup_table_length());
+
+            config_.colocate_vectors = head.colocated_vectors;
+            if (!config.exclude_vectors && separate_vector_bytes_() != matrix_cols)
+                return result.failed("Stored vectors don't match the metric");
+            if (typed_->config().vector_bytes != colocated_vector_bytes_() && !rebuild_typed_())
+                return result.failed("Out of memory!");
+
+            rerank_metric_ = metric_t{};
+            if (head.kind_rerank_scalar != scalar_kind_t::unknown_k && !config.exclude_vectors) {
+                rerank_metric_ = metric_t::builtin(head.dimensions, head.kind_metric, head.kind_rerank_scalar);
+                rerank_casts_ = make_casts_(head.kind_rerank_scalar);
+                rerank_cast_buffer_.resize(available_threads_.size() * rerank_metric_.bytes_per_vector());
+            }
         }
 
         // Pull the actual proximity graph
+        byte_t const* file_data = file.data();
+        std::size_t const file_size = file.size();
         result = typed_->view(std::move(file), offset, std::forward<progress_at>(progress));
         if (!result)
             return result;
@@ -1053,6 +1641,18 @@ class index_dense_gt {
         if (!config.exclude_vectors)
             for (std::uint64_t slot = 0; slot != matrix_rows; ++slot)
                 vectors_lookup_[slot] = (byte_t*)vectors_buffer.data() + matrix_cols * slot;
+        reindex_colocated_vectors_();
+
+        // Address the higher-precision copies, following the graph
+        if (rerank_metric_) {
+            offset += typed_->serialized_length();
+            std::size_t const rerank_bytes = rerank_metric_.bytes_per_vector();
+            if (file_size - offset < matrix_rows * rerank_bytes)
+                return result.failed("File is corrupted and lacks higher-precision vectors");
+            rerank_vectors_lookup_.resize(matrix_rows);
+            for (std::uint64_t slot = 0; slot != matrix_rows; ++slot)
+                rerank_vectors_lookup_[slot] = (byte_t*)file_data + offset + rerank_bytes * slot;
+        }
 
         reindex_keys_();
         return result;
@@ -1167,17 +1767,106 @@ class index_dense_gt {
         return stream_result;
     }
 
-    template <typename progress_at = dummy_progress_t>
+    /**
+     *  @brief  Saves the index to a file, dumping the vectors and the graph nodes
+     *          from multiple threads with positional writes, if a non-dummy @p executor is passed.
+     */
+    template <typename progress_at = dummy_progress_t, typename executor_at = dummy_executor_t>
     serialization_result_t save(char const* file_path,              //
                                 serialization_config_t config = {}, //
-                                progress_at&& progress = {}) const {
+                                progress_at&& progress = {},        //
+                                executor_at&& executor = {}) const {
+        if (!is_dummy<executor_at>()) {
+            positional_file_t file(file_path, true);
+            return save_to_file(file, config, executor, std::forward<progress_at>(progress));
+        }
         return save(output_file_t(file_path), config, std::forward<progress_at>(progress));
     }
 
-    template <typename progress_at = dummy_progress_t>
+    /**
+     *  @brief  Point-in-time view of the index, for serialization while the writers keep going.
+     *          Released on destruction. Only one can be active per index at a time, and the
+     *          structural calls, like `reserve`, `compact`, `isolate` or `clear`, must not overlap it.
+     */
+    class snapshot_t {
+        index_dense_gt* index_ = nullptr;
+        friend class index_dense_gt;
+        explicit snapshot_t(index_dense_gt* index) noexcept : index_(index) {}
+
+      public:
+        snapshot_t() noexcept = default;
+        snapshot_t(snapshot_t&& other) noexcept : index_(exchange(other.index_, nullptr)) {}
+        snapshot_t& operator=(snapshot_t&& other) noexcept {
+            std::swap(index_, other.index_);
+            return *this;
+        }
+        snapshot_t(snapshot_t const&) = delete;
+        snapshot_t& operator=(snapshot_t const&) = delete;
+        ~snapshot_t() noexcept {
+            if (index_)
+                index_->snapshot_end_();
+        }
+
+        explicit operator bool() const noexcept { return index_ != nullptr; }
+
+        /// @brief Number of slots captured, including the removed ones.
+        std::size_t slots() const noexcept { return index_->typed_->snapshot_size(); }
+
+        /// @brief Serializes the captured state in the same format as `index_dense_gt::save_to_stream`.
+        template <typename output_callback_at, typename progress_at = dummy_progress_t>
+        serialization_result_t save_to_stream(output_callback_at&& output,        //
+                                              serialization_config_t config = {}, //
+                                              progress_at&& progress = {}) const {
+            return index_->save_snapshot_to_stream_(std::forward<output_callback_at>(output), config,
+                                                    std::forward<progress_at>(progress));
+        }
+
+        /// @brief Serializes the captured state into a file, readable with `index_dense_gt::load`.
+        template <typename progress_at = dummy_progress_t>
+        serialization_result_t save(output_file_t file, serialization_config_t config = {},
+                                    progress_at&& progress = {}) const {
+
+            serialization_result_t io_result = file.open_if_not();
+            if (!io_result)
+                return io_result;
+
+            serialization_result_t stream_result = save_to_stream(
+                [&](void const* buffer, std::size_t length) {
+                    io_result = file.write(buffer, length);
+                    return !!io_result;
+                },
+                config, std::forward<progress_at>(progress));
+
+            if (!stream_result) {
+                io_result.error.release();
+                return stream_result;
+            }
+            return io_result;
+        }
+    };
+
+    /**
+     *  @brief  Captures a consistent view of the index, without copying any vectors or nodes.
+     *          Later updates copy the members they are about to overwrite aside, so concurrent
+     *          additions, removals and renames keep going, while the snapshot is being saved.
+     *          Briefly waits for the in-flight insertions to finish.
+     *  @return Empty handle, if another snapshot is active or the memory is exhausted.
+     */
+    snapshot_t snapshot() { return snapshot_t(snapshot_begin_() ? this : nullptr); }
+
+    /**
+     *  @brief  Loads the index from a file, reading the vectors and the graph nodes
+     *          from multiple threads with positional reads, if a non-dummy @p executor is passed.
+     */
+    template <typename progress_at = dummy_progress_t, typename executor_at = dummy_executor_t>
     serialization_result_t load(char const* file_path,              //
                                 serialization_config_t config = {}, //
-                                progress_at&& progress = {}) {
+                                progress_at&& progress = {},        //
+                                executor_at&& executor = {}) {
+        if (!is_dummy<executor_at>()) {
+            positional_file_t file(file_path, false);
+            return load_from_file(file, config, executor, std::forward<progress_at>(progress));
+        }
         return load(input_file_t(file_path), config, std::forward<progress_at>(progress));
     }
 
@@ -1186,8 +1875,10 @@ class index_dense_gt {
      *  @return `true` if the key is present in the index, `false` otherwise.
      */
     bool contains(vector_key_t key) const {
-        shared_lock_t lock(slot_lookup_mutex_);
-        return slot_lookup_.contains(key_and_slot_t::any_slot(key));
+        slot_lookup_shard_t const& shard = slot_shard_(key);
+        lookup_shared_lock_t lookup_lock(slot_lookup_mutex_);
+        shared_lock_t lock(shard.mutex);
+        return shard.slots.contains(key_and_slot_t::any_slot(key));
     }
 
     /**
@@ -1195,8 +1886,43 @@ class index_dense_gt {
      *  @return Zero if nothing is found, a positive integer otherwise.
      */
     std::size_t count(vector_key_t key) const {
-        shared_lock_t lock(slot_lookup_mutex_);
-        return slot_lookup_.count(key_and_slot_t::any_slot(key));
+        slot_lookup_shard_t const& shard = slot_shard_(key);
+        lookup_shared_lock_t lookup_lock(slot_lookup_mutex_);
+        shared_lock_t lock(shard.mutex);
+        return shard.slots.count(key_and_slot_t::any_slot(key));
+    }
+
+    /**
+     *  @brief Collects the slots of the given keys into a ::filter_t for the filter-aware `search()`.
+     *         Entries added afterwards are never matched by the filter, unless they reuse the slot of
+     *         a removed entry @b and one of the given keys.
+     */
+    template <typename keys_iterator_at>
+    filter_t make_filter(keys_iterator_at keys_begin, keys_iterator_at keys_end) const {
+        filter_t filter;
+        lookup_shared_lock_t lookup_lock(slot_lookup_mutex_);
+        filter.capacity = typed_->size();
+        filter.slots = bitset_t(filter.capacity);
+        if (!filter.slots)
+            return filter.failed("Out of memory!");
+
+        for (; keys_begin != keys_end; ++keys_begin) {
+            vector_key_t key = *keys_begin;
+            slot_lookup_shard_t const& shard = slot_shard_(key);
+            shared_lock_t lock(shard.mutex);
+            auto key_range = shard.slots.equal_range(key_and_slot_t::any_slot(key));
+            for (; key_range.first != key_range.second; ++key_range.first) {
+                key_and_slot_t key_and_slot = *key_range.first;
+                std::size_t slot = static_cast<std::size_t>(key_and_slot.slot);
+                if (slot < filter.capacity && !filter.slots.set(slot)) {
+                    filter.keys.push_back(key);
+                    filter.count++;
+                }
+            }
+        }
+        std::sort(filter.keys.begin(), filter.keys.end());
+        filter.keys.erase(std::unique(filter.keys.begin(), filter.keys.end()), filter.keys.end());
+        return filter;
     }
 
     struct labeling_result_t {
@@ -1219,32 +1945,13 @@ class index_dense_gt {
      *          If an error occurred during the removal operation, `result.error` will contain an error message.
      */
     labeling_result_t remove(vector_key_t key) {
-        labeling_result_t result;
-
-        unique_lock_t lookup_lock(slot_lookup_mutex_);
-        auto matching_slots = slot_lookup_.equal_range(key_and_slot_t::any_slot(key));
-        if (matching_slots.first == matching_slots.second)
+        if (!config_.repair_on_remove)
+            return remove_(key, nullptr);
+        std::vector<compressed_slot_t> removed_slots;
+        labeling_result_t result = remove_(key, &removed_slots);
+        if (!result)
             return result;
-
-        // Grow the removed entries ring, if needed
-        std::size_t matching_count = std::distance(matching_slots.first, matching_slots.second);
-        std::unique_lock<std::mutex> free_lock(free_keys_mutex_);
-        if (!free_keys_.reserve(free_keys_.size() + matching_count))
-            return result.failed("Can't allocate memory for a free-list");
-
-        // A removed entry would be:
-        // - present in `free_keys_`
-        // - missing in the `slot_lookup_`
-        // - marked in the `typed_` index with a `free_key_`
-        for (auto slots_it = matching_slots.first; slots_it != matching_slots.second; ++slots_it) {
-            compressed_slot_t slot = (*slots_it).slot;
-            free_keys_.push(slot);
-            typed_->at(slot).key = free_key_;
-        }
-        slot_lookup_.erase(key);
-        result.completed = matching_count;
-
-        return result;
+        return repair_removed_(std::move(result), removed_slots);
     }
 
     /**
@@ -1257,39 +1964,13 @@ class index_dense_gt {
      */
     template <typename keys_iterator_at>
     labeling_result_t remove(keys_iterator_at keys_begin, keys_iterator_at keys_end) {
-
-        labeling_result_t result;
-        unique_lock_t lookup_lock(slot_lookup_mutex_);
-        std::unique_lock<std::mutex> free_lock(free_keys_mutex_);
-        // Grow the removed entries ring, if needed
-        std::size_t matching_count = 0;
-        for (auto keys_it = keys_begin; keys_it != keys_end; ++keys_it)
-            matching_count += slot_lookup_.count(key_and_slot_t::any_slot(*keys_it));
-
-        if (!free_keys_.reserve(free_keys_.size() + matching_count))
-            return result.failed("Can't allocate memory for a free-list");
-
-        // Remove them one-by-one
-        for (auto keys_it = keys_begin; keys_it != keys_end; ++keys_it) {
-            vector_key_t key = *keys_it;
-            auto matching_slots = slot_lookup_.equal_range(key_and_slot_t::any_slot(key));
-            // A removed entry would be:
-            // - present in `free_keys_`
-            // - missing in the `slot_lookup_`
-            // - marked in the `typed_` index with a `free_key_`
-            matching_count = 0;
-            for (auto slots_it = matching_slots.first; slots_it != matching_slots.second; ++slots_it) {
-                compressed_slot_t slot = (*slots_it).slot;
-                free_keys_.push(slot);
-                typed_->at(slot).key = free_key_;
-                ++matching_count;
-            }
-
-            slot_lookup_.erase(key);
-            result.completed += matching_count;
-        }
-
-        return result;
+        if (!config_.repair_on_remove)
+            return remove_(keys_begin, keys_end, nullptr);
+        std::vector<compressed_slot_t> removed_slots;
+        labeling_result_t result = remove_(keys_begin, keys_end, &removed_slots);
+        if (!result)
+            return result;
+        return repair_removed_(std::move(result), removed_slots);
     }
 
     /**
@@ -1302,20 +1983,23 @@ class index_dense_gt {
      */
     labeling_result_t rename(vector_key_t from, vector_key_t to) {
         labeling_result_t result;
-        unique_lock_t lookup_lock(slot_lookup_mutex_);
+        lookup_unique_lock_t lookup_lock(slot_lookup_mutex_);
 
-        if (!multi() && slot_lookup_.contains(key_and_slot_t::any_slot(to)))
+        slot_lookup_set_t& from_slots = slot_shard_(from).slots;
+        slot_lookup_set_t& to_slots = slot_shard_(to).slots;
+        if (!multi() && to_slots.contains(key_and_slot_t::any_slot(to)))
             return result.failed("Renaming impossible, the key is already in use");
 
         // The `from` may map to multiple entries
         while (true) {
             key_and_slot_t key_and_slot_removed;
-            if (!slot_lookup_.pop_first(key_and_slot_t::any_slot(from), key_and_slot_removed))
+            if (!from_slots.pop_first(key_and_slot_t::any_slot(from), key_and_slot_removed))
                 break;
 
             key_and_slot_t key_and_slot_replacing{to, key_and_slot_removed.slot};
-            slot_lookup_.try_emplace(key_and_slot_replacing); // This can't fail
-            typed_->at(key_and_slot_removed.slot).key = to;
+            if (!to_slots.try_emplace(key_and_slot_replacing))
+                return result.failed("Out of memory!");
+            typed_->update_key(key_and_slot_removed.slot, to);
             ++result.completed;
         }
 
@@ -1329,18 +2013,20 @@ class index_dense_gt {
      *  @param[in] limit The maximum number of keys to export, that can fit in ::keys.
      */
     void export_keys(vector_key_t* keys, std::size_t offset, std::size_t limit) const {
-        shared_lock_t lock(slot_lookup_mutex_);
-        offset = (std::min)(offset, slot_lookup_.size());
-        slot_lookup_.for_each([&](key_and_slot_t const& key_and_slot) {
-            if (offset)
-                // Skip the first `offset` entries
-                --offset;
-            else if (limit) {
-                *keys = key_and_slot.key;
-                ++keys;
-                --limit;
-            }
-        });
+        lookup_shared_lock_t lookup_lock(slot_lookup_mutex_);
+        for (slot_lookup_shard_t const& shard : slot_lookup_) {
+            shared_lock_t lock(shard.mutex);
+            shard.slots.for_each([&](key_and_slot_t const& key_and_slot) {
+                if (offset)
+                    // Skip the first `offset` entries
+                    --offset;
+                else if (limit) {
+                    *keys = key_and_slot.key;
+                    ++keys;
+                    --limit;
+                }
+            });
+        }
     }
 
     struct copy_result_t {
@@ -1376,20 +2062,43 @@ class index_dense_gt {
             copy.free_keys_.push(free_keys_[i]);
 
         // Allocate buffers and move the vectors themselves
-        if (!config.force_vector_copy && copy.config_.exclude_vectors)
+        if (config_.colocate_vectors) {
+            *copy.typed_ = std::move(typed_result.index);
+            copy.vectors_lookup_.resize(vectors_lookup_.size());
+            copy.reindex_colocated_vectors_();
+        } else if (!config.force_vector_copy && copy.config_.exclude_vectors)
             copy.vectors_lookup_ = vectors_lookup_;
         else {
+            // The reserved, but still unused slots have no vectors to copy
             copy.vectors_lookup_.resize(vectors_lookup_.size());
-            for (std::size_t slot = 0; slot != vectors_lookup_.size(); ++slot)
-                copy.vectors_lookup_[slot] = copy.vectors_tape_allocator_.allocate(copy.metric_.bytes_per_vector());
-            if (std::count(copy.vectors_lookup_.begin(), copy.vectors_lookup_.end(), nullptr))
-                return result.failed("Out of memory!");
-            for (std::size_t slot = 0; slot != vectors_lookup_.size(); ++slot)
-                std::memcpy(copy.vectors_lookup_[slot], vectors_lookup_[slot], metric_.bytes_per_vector());
+            for (std::size_t slot = 0; slot != vectors_lookup_.size(); ++slot) {
+                if (!vectors_lookup_[slot])
+                    continue;
+                copy.vectors_lookup_[slot] = copy.vectors_tape_allocator_.allocate(copy.vector_bytes_());
+                if (!copy.vectors_lookup_[slot])
+                    return result.failed("Out of memory!");
+                std::memcpy(copy.vectors_lookup_[slot], vectors_lookup_[slot], vector_bytes_());
+            }
         }
 
-        copy.slot_lookup_ = slot_lookup_;
-        *copy.typed_ = std::move(typed_result.index);
+        // Higher-precision copies are always owned by the index
+        if (rerank_metric_) {
+            std::size_t const rerank_bytes = rerank_metric_.bytes_per_vector();
+            copy.rerank_vectors_lookup_.resize(rerank_vectors_lookup_.size());
+            for (std::size_t slot = 0; slot != rerank_vectors_lookup_.size(); ++slot) {
+                if (!rerank_vectors_lookup_[slot])
+                    continue;
+                copy.rerank_vectors_lookup_[slot] = copy.rerank_vectors_tape_allocator_.allocate(rerank_bytes);
+                if (!copy.rerank_vectors_lookup_[slot])
+                    return result.failed("Out of memory!");
+                std::memcpy(copy.rerank_vectors_lookup_[slot], rerank_vectors_lookup_[slot], rerank_bytes);
+            }
+        }
+
+        for (std::size_t shard = 0; shard != slot_lookup_shards(); ++shard)
+            copy.slot_lookup_[shard].slots = slot_lookup_[shard].slots;
+        if (!config_.colocate_vectors)
+            *copy.typed_ = std::move(typed_result.index);
         return result;
     }
 
@@ -1402,10 +2111,17 @@ class index_dense_gt {
         index_dense_gt& other = result.index;
 
         other.config_ = config_;
+        other.vectors_tape_allocator_ = vectors_tape_allocator_t(config_.placement);
+        other.rerank_vectors_tape_allocator_ = vectors_tape_allocator_t(config_.placement);
         other.cast_buffer_ = cast_buffer_;
         other.casts_ = casts_;
 
         other.metric_ = metric_;
+        other.quantizer_ = quantizer_;
+        other.lookup_tables_ = lookup_tables_;
+        other.rerank_metric_ = rerank_metric_;
+        other.rerank_casts_ = rerank_casts_;
+        other.rerank_cast_buffer_ = rerank_cast_buffer_;
         other.available_threads_ = available_threads_;
         other.free_key_ = free_key_;
 
@@ -1413,7 +2129,7 @@ class index_dense_gt {
         if (!raw)
             return result.failed("Can't allocate the index");
 
-        new (raw) index_t(config());
+        new (raw) index_t(config(), {}, tape_allocator_t(config_.placement));
         other.typed_ = raw;
         return result;
     }
@@ -1440,17 +2156,46 @@ class index_dense_gt {
     template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t>
     compaction_result_t isolate(executor_at&& executor = executor_at{}, progress_at&& progress = progress_at{}) {
         compaction_result_t result;
-        std::atomic<std::size_t> pruned_edges;
-        auto disallow = [&](member_cref_t const& member) noexcept {
+        std::atomic<std::size_t> pruned_edges{0};
+        auto allow = [&](member_cref_t const& member) noexcept {
             bool freed = member.key == free_key_;
             pruned_edges += freed;
-            return freed;
+            return !freed;
         };
-        typed_->isolate(disallow, std::forward<executor_at>(executor), std::forward<progress_at>(progress));
+        typed_->isolate(allow, std::forward<executor_at>(executor), std::forward<progress_at>(progress));
         result.pruned_edges = pruned_edges;
         return result;
     }
 
+    /**
+     *  @brief  Incrementally repairs the links leading to removed entries, visiting at most
+     *          @p max_members slots per call, and continuing from where the previous call stopped.
+     *          Unlike `isolate` and `compact`, can run concurrently with additions and searches,
+     *          so a background thread can keep the graph clean in small steps, without stopping the world.
+     *  @return The ::compaction_result_t, where `result.pruned_edges` is the number of links replaced.
+     */
+    compaction_result_t consolidate(std::size_t max_members = 1024) {
+        compaction_result_t result;
+        std::size_t const count = typed_->size();
+        if (count == size())
+            return result;
+
+        thread_lock_t lock = thread_lock_(any_thread());
+        auto allow = [&](member_cref_t const& member) noexcept { return member.key != free_key_; };
+        std::size_t const first = consolidation_cursor_.fetch_add(max_members) % count;
+        for (std::size_t i = 0; i != (std::min)(max_members, count); ++i) {
+            std::size_t slot = (first + i) % count;
+            if (typed_->at(slot).key == free_key_)
+                continue;
+            typename index_t::repair_result_t repaired =
+                typed_->repair(slot, metric_proxy_t{*this}, allow, lock.thread_id);
+            if (!repaired)
+                return result.failed(std::move(repaired.error));
+            result.pruned_edges += repaired.repaired_links;
+        }
+        return result;
+    }
+
     class values_proxy_t {
         index_dense_gt const* index_;
 
@@ -1471,23 +2216,227 @@ class index_dense_gt {
     template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t>
     compaction_result_t compact(executor_at&& executor = executor_at{}, progress_at&& progress = progress_at{}) {
         compaction_result_t result;
+        if (typed_->is_compressed())
+            return result.failed("Can't compact a compressed index");
 
-        std::vector<byte_t*> new_vectors_lookup(vectors_lookup_.size());
-        vectors_tape_allocator_t new_vectors_allocator;
-
+        std::vector<compressed_slot_t> new_slot_to_old(typed_->size());
+        std::size_t transitions = 0;
         auto track_slot_change = [&](vector_key_t, compressed_slot_t old_slot, compressed_slot_t new_slot) {
-            byte_t* new_vector = new_vectors_allocator.allocate(metric_.bytes_per_vector());
-            byte_t* old_vector = vectors_lookup_[old_slot];
-            std::memcpy(new_vector, old_vector, metric_.bytes_per_vector());
-            new_vectors_lookup[new_slot] = new_vector;
+            new_slot_to_old[new_slot] = old_slot;
+            ++transitions;
         };
         typed_->compact(values_proxy_t{*this}, metric_proxy_t{*this}, track_slot_change,
                         std::forward<executor_at>(executor), std::forward<progress_at>(progress));
-        vectors_lookup_ = std::move(new_vectors_lookup);
-        vectors_tape_allocator_ = std::move(new_vectors_allocator);
+        if (transitions != new_slot_to_old.size())
+            return result.failed("Compaction was interrupted");
+
+        relocate_vectors_(new_slot_to_old);
+        reindex_keys_();
+        return result;
+    }
+
+    /**
+     *  @brief  Appends all the entries of ::other, reusing the neighbors lists of both graphs
+     *          and only searching for the links between them, via `index_gt::merge`.
+     *          The slots of ::other are shifted past the existing ones, and its removed entries stay removed.
+     *          Nothing else may run on either index meanwhile, and ::other may be a memory-mapped view.
+     *
+     *  @param[in] other Index with the same metric, connectivity, and vectors layout.
+     *  @param[in] executor Thread-pool to execute the job in parallel.
+     *  @param[in] progress Callback to report the execution progress.
+     */
+    template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t>
+    merge_result_t merge(index_dense_gt const& other, executor_at&& executor = executor_at{},
+                         progress_at&& progress = progress_at{}) {
+
+        merge_result_t result;
+        if (metric_.metric_kind() != other.metric_.metric_kind() ||
+            metric_.scalar_kind() != other.metric_.scalar_kind() || dimensions() != other.dimensions())
+            return result.failed("Can't merge indexes with different metrics");
+        if (quantizer_ || other.quantizer_)
+            return result.failed("Can't merge product-quantized indexes");
+        if (bool(rerank_metric_) != bool(other.rerank_metric_) ||
+            (rerank_metric_ && (rerank_metric_.metric_kind() != other.rerank_metric_.metric_kind() ||
+                                rerank_metric_.scalar_kind() != other.rerank_metric_.scalar_kind())))
+            return result.failed("Can't merge indexes with different reranking metrics");
+        if (!multi() && other.multi())
+            return result.failed("Can't merge a multi-index into a regular one");
+
+        // Nothing is modified before we know that the keys don't collide
+        std::size_t const offset = typed_->size();
+        std::size_t const other_size = other.typed_->size();
+        if (!multi()) {
+            std::atomic<bool> collided{false};
+            executor.dynamic(other_size, [&](std::size_t, std::size_t slot) {
+                vector_key_t key = other.typed_->at(slot).key;
+                if (key != other.free_key_ && contains(key))
+                    collided = true;
+                return !collided.load();
+            });
+            if (collided.load())
+                return result.failed("Duplicate keys not allowed in high-level wrappers");
+        }
+        if (capacity() < offset + other_size || limits().threads() < executor.size()) {
+            index_limits_t new_limits = limits();
+            new_limits.members = (std::max)(new_limits.members, offset + other_size);
+            new_limits.threads_add = (std::max)(new_limits.threads_add, executor.size());
+            new_limits.threads_search = (std::max)(new_limits.threads_search, executor.size());
+            if (!reserve(new_limits))
+                return result.failed("Out of memory!");
+        }
+        // Enough to mark every copied entry as removed, if the merge fails after copying
+        if (!free_keys_.reserve(free_keys_.size() + other_size))
+            return result.failed("Out of memory!");
+
+        std::size_t const rerank_bytes = rerank_metric_.bytes_per_vector();
+        auto copy = [&](member_ref_t member) {
+            std::size_t const slot = member.slot;
+            std::size_t const other_slot = slot - offset;
+            if (config_.colocate_vectors)
+                vectors_lookup_[slot] = typed_->vector_at(slot);
+            else if (byte_t const* vector = other.vectors_lookup_[other_slot]) {
+                vectors_lookup_[slot] = (byte_t*)vectors_tape_allocator_.allocate(vector_bytes_());
+                std::memcpy(vectors_lookup_[slot], vector, vector_bytes_());
+            }
+            if (rerank_metric_) {
+                rerank_vectors_lookup_[slot] = rerank_vectors_tape_allocator_.allocate(rerank_bytes);
+                std::memcpy(rerank_vectors_lookup_[slot], other.rerank_vectors_lookup_[other_slot], rerank_bytes);
+            }
+
+            // Removed entries are re-marked with our own `free_key_` and never published
+            vector_key_t const key = member.key;
+            if (key == other.free_key_) {
+                typed_->update_key(slot, free_key_);
+                return;
+            }
+            slot_lookup_shard_t& shard = slot_shard_(key);
+            lookup_shared_lock_t lookup_lock(slot_lookup_mutex_);
+            unique_lock_t slot_lock(shard.mutex);
+            shard.slots.try_emplace(key_and_slot_t{key, static_cast<compressed_slot_t>(slot)});
+        };
+
+        {
+            shared_lock_t snapshot_lock(snapshot_mutex_);
+            result = typed_->merge(*other.typed_, values_proxy_t{*this}, metric_proxy_t{*this}, config_.expansion_add,
+                                   copy, std::forward<executor_at>(executor), std::forward<progress_at>(progress),
+                                   vectors_prefetch_t{*this});
+        }
+        if (typed_->size() != offset + other_size)
+            return result;
+        if (result) {
+            std::unique_lock<std::mutex> lock(free_keys_mutex_);
+            for (std::size_t i = 0; i != other.free_keys_.size(); ++i)
+                free_keys_.push(static_cast<compressed_slot_t>(offset + other.free_keys_[i]));
+            return result;
+        }
+
+        // The copied nodes stay in the graph, but their keys may already be published,
+        // so unpublish them, keeping our own entries with the same keys, and mark the copies removed
+        lookup_unique_lock_t lookup_lock(slot_lookup_mutex_);
+        std::unique_lock<std::mutex> free_lock(free_keys_mutex_);
+        std::vector<key_and_slot_t> kept;
+        for (std::size_t slot = offset; slot != offset + other_size; ++slot) {
+            vector_key_t const key = typed_->at(slot).key;
+            if (key != free_key_) {
+                slot_lookup_set_t& slots = slot_shard_(key).slots;
+                key_and_slot_t popped;
+                kept.clear();
+                while (slots.pop_first(key_and_slot_t::any_slot(key), popped))
+                    if (static_cast<std::size_t>(popped.slot) < offset)
+                        kept.push_back(popped);
+                for (key_and_slot_t const& key_and_slot : kept)
+                    slots.try_emplace(key_and_slot);
+                typed_->update_key(slot, free_key_);
+            }
+            free_keys_.push(static_cast<compressed_slot_t>(slot));
+        }
+        return result;
+    }
+
+    /**
+     *  @brief  Merges two serialized indexes into a new file, loading only the first one into memory
+     *          and memory-mapping the second one. The first index defines the configuration of the result.
+     *
+     *  @param[in] first_path Path to the first index, loaded into memory and extended.
+     *  @param[in] second_path Path to the second index, viewed without copying.
+     *  @param[in] output_path Path to the file to write the merged index into.
+     */
+    template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t>
+    static merge_result_t merge(char const* first_path, char const* second_path, char const* output_path,
+                                executor_at&& executor = executor_at{}, progress_at&& progress = progress_at{}) {
+
+        merge_result_t result;
+        index_dense_metadata_result_t first_meta = index_dense_metadata_from_path(first_path);
+        if (!first_meta)
+            return result.failed(std::move(first_meta.error));
+        index_dense_metadata_result_t second_meta = index_dense_metadata_from_path(second_path);
+        if (!second_meta)
+            return result.failed(std::move(second_meta.error));
+
+        index_dense_head_t const& head = first_meta.head;
+        index_dense_head_t const& other_head = second_meta.head;
+        index_dense_gt first = make(metric_t(head.dimensions, head.kind_metric, head.kind_scalar));
+        index_dense_gt second = make(metric_t(other_head.dimensions, other_head.kind_metric, other_head.kind_scalar));
+        if (!first || !second)
+            return result.failed("Out of memory!");
+
+        serialization_result_t io = first.load(first_path);
+        if (!io)
+            return result.failed(std::move(io.error));
+        io = second.view(second_path);
+        if (!io)
+            return result.failed(std::move(io.error));
+
+        result = first.merge(second, std::forward<executor_at>(executor), std::forward<progress_at>(progress));
+        if (!result)
+            return result;
+        io = first.save(output_path);
+        if (!io)
+            return result.failed(std::move(io.error));
+        return result;
+    }
+
+    /**
+     *  @brief Renumbers the entries in the breadth-first order of the graph, so that the neighbors
+     *         and their vectors are stored close to each other in memory. Saving the index afterwards
+     *         preserves the layout, which benefits memory-mapped indexes opened with `view()` the most.
+     *  @param progress The progress tracker instance to use. Default ::dummy_progress_t reports nothing.
+     *  @return The ::compaction_result_t indicating the result of the reordering.
+     */
+    template <typename progress_at = dummy_progress_t>
+    compaction_result_t reorder(progress_at&& progress = progress_at{}) {
+        compaction_result_t result;
+
+        std::vector<compressed_slot_t> new_slot_to_old(typed_->size());
+        auto track_slot_change = [&](vector_key_t, compressed_slot_t old_slot, compressed_slot_t new_slot) {
+            new_slot_to_old[new_slot] = old_slot;
+        };
+        if (!typed_->reorder(track_slot_change, std::forward<progress_at>(progress)))
+            return result.failed("Reordering was interrupted or ran out of memory");
+
+        relocate_vectors_(new_slot_to_old);
+        reindex_keys_();
+        return result;
+    }
+
+    /**
+     *  @brief Packs the base-level neighbors lists of the graph via `index_gt::compress`, making the index
+     *         immutable until it is cleared. Best applied after `reorder`, to a `view`-ed or loaded index.
+     *  @param executor The executor parallel processing. Default ::dummy_executor_t single-threaded.
+     *  @param progress The progress tracker instance to use. Default ::dummy_progress_t reports nothing.
+     *  @return The ::compression_result_t with the number of bytes taken by the lists before and after.
+     */
+    template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t>
+    compression_result_t compress(executor_at&& executor = executor_at{}, progress_at&& progress = progress_at{}) {
+        compression_result_t result =
+            typed_->compress(std::forward<executor_at>(executor), std::forward<progress_at>(progress));
+        if (result)
+            reindex_colocated_vectors_();
         return result;
     }
 
+    bool is_compressed() const noexcept { return typed_->is_compressed(); }
+
     template <                                                 //
         typename man_to_woman_at = dummy_key_to_key_mapping_t, //
         typename woman_to_man_at = dummy_key_to_key_mapping_t, //
@@ -1655,7 +2604,7 @@ class index_dense_gt {
             distance_t merge_distance = std::numeric_limits<distance_t>::max();
 
             for (std::size_t candidate_idx = 0; candidate_idx + 1 < unique_clusters; ++candidate_idx) {
-                distance_t distance = metric_(merge_source.vector, clusters[candidate_idx].vector);
+                distance_t distance = metric_proxy_t{*this}.f(merge_source.vector, clusters[candidate_idx].vector);
                 if (distance < merge_distance) {
                     merge_distance = distance;
                     merge_target_idx = candidate_idx;
@@ -1708,6 +2657,168 @@ class index_dense_gt {
         return result;
     }
 
+    struct calibration_result_t {
+        error_t error{};
+        /// @brief The chosen `expansion_search`, `patience_search`, and `distance_ratio_search`.
+        std::size_t expansion{};
+        std::size_t patience{};
+        double distance_ratio{};
+        /// @brief Mean recall of the chosen schedule on the sample, relative to the exact search.
+        double recall{};
+        /// @brief Number of times the distances were computed by the chosen schedule, across all queries.
+        std::size_t computed_distances{};
+        /// @brief Number of schedules evaluated.
+        std::size_t schedules{};
+
+        explicit operator bool() const noexcept { return !error; }
+        calibration_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+    };
+
+    /**
+     *  @brief  Picks the cheapest search schedule, that holds the target recall on a sample of queries,
+     *          and applies it to the following searches. Compares the results of every schedule with the
+     *          exact search, and measures the cost in distance computations, as it doesn't depend on the load.
+     *          If no schedule reaches the target, the one with the highest recall is applied instead.
+     *          Not thread-safe with concurrent searches, as it changes the configuration of the index.
+     *
+     *  @param[in] queries_begin Iterator pointing to the first query, dereferencing into a vector pointer.
+     *  @param[in] queries_end Iterator pointing to the last query.
+     *  @param[in] config Configuration parameters for calibration.
+     *  @param[in] executor Thread-pool to execute the job in parallel.
+     *  @param[in] progress Callback to report the execution progress.
+     */
+    template <                                   //
+        typename queries_iterator_at,            //
+        typename executor_at = dummy_executor_t, //
+        typename progress_at = dummy_progress_t  //
+        >
+    calibration_result_t calibrate(                  //
+        queries_iterator_at queries_begin,           //
+        queries_iterator_at queries_end,             //
+        index_dense_calibration_config_t config = {}, //
+        executor_at&& executor = executor_at{},      //
+        progress_at&& progress = progress_at{}) {
+
+        std::size_t const queries_count = queries_end - queries_begin;
+        std::size_t const wanted = config.wanted;
+        calibration_result_t result;
+        if (!queries_count || !wanted || !size())
+            return result.failed("Calibration needs a non-empty index and sample of queries!");
+
+        struct schedule_t {
+            std::size_t expansion;
+            std::size_t patience;
+            double distance_ratio;
+        };
+        schedule_t const original{config_.expansion_search, config_.patience_search, config_.distance_ratio_search};
+        auto apply = [&](schedule_t const& schedule) noexcept {
+            config_.expansion_search = schedule.expansion;
+            config_.patience_search = schedule.patience;
+            config_.distance_ratio_search = schedule.distance_ratio;
+        };
+
+        using dynamic_allocator_traits_t = std::allocator_traits<dynamic_allocator_t>;
+        using keys_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<vector_key_t>;
+        using counts_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<std::size_t>;
+        buffer_gt<vector_key_t, keys_allocator_t> exact_keys(queries_count * wanted);
+        buffer_gt<std::size_t, counts_allocator_t> exact_counts(queries_count);
+        buffer_gt<std::size_t, counts_allocator_t> hits(queries_count);
+        if (!exact_keys || !exact_counts || !hits)
+            return result.failed("Out of memory!");
+
+        // The ground truth is sorted, to intersect it with the approximate results
+        std::atomic<char const*> atomic_error{nullptr};
+        executor.dynamic(queries_count, [&](std::size_t thread_idx, std::size_t query_idx) {
+            search_result_t found = search(queries_begin[query_idx], wanted, thread_idx, true);
+            if (!found) {
+                atomic_error = found.error.release();
+                return false;
+            }
+            vector_key_t* keys = exact_keys.data() + query_idx * wanted;
+            exact_counts[query_idx] = found.dump_to(keys);
+            std::sort(keys, keys + exact_counts[query_idx]);
+            return true;
+        });
+        if (atomic_error)
+            return result.failed(atomic_error.load());
+
+        // Expansions beyond the index size are all exhaustive, so there is no need to go further
+        std::size_t const max_expansion = (std::max)(config.max_expansion, wanted);
+        std::size_t last_expansion = wanted, expansions_count = 1;
+        for (; last_expansion * 2 <= max_expansion && last_expansion < size(); last_expansion *= 2)
+            ++expansions_count;
+
+        // The default criteria are relative to the `wanted` count and to its radius
+        std::size_t const patiences[] = {0, wanted, wanted * 4};
+        double const distance_ratios[] = {0, 1.5, 3};
+        std::size_t const schedules_count = expansions_count * 3 * 3;
+
+        schedule_t best = original;
+        double best_recall = -1;
+        std::size_t best_cost = std::numeric_limits<std::size_t>::max();
+        bool best_reached = false;
+        for (std::size_t expansion = wanted; expansion <= last_expansion; expansion *= 2) {
+            for (std::size_t patience : patiences) {
+                for (double distance_ratio : distance_ratios) {
+                    apply({expansion, patience, distance_ratio});
+
+                    std::atomic<std::size_t> computed_distances(0);
+                    executor.dynamic(queries_count, [&](std::size_t thread_idx, std::size_t query_idx) {
+                        search_result_t found = search(queries_begin[query_idx], wanted, thread_idx);
+                        if (!found) {
+                            atomic_error = found.error.release();
+                            return false;
+                        }
+                        vector_key_t const* keys = exact_keys.data() + query_idx * wanted;
+                        vector_key_t const* keys_end = keys + exact_counts[query_idx];
+                        std::size_t query_hits = 0;
+                        for (std::size_t i = 0; i != found.size(); ++i)
+                            query_hits += std::binary_search(keys, keys_end, vector_key_t(found[i].member.key));
+                        hits[query_idx] = query_hits;
+                        computed_distances += found.computed_distances;
+                        return true;
+                    });
+                    if (atomic_error) {
+                        apply(original);
+                        return result.failed(atomic_error.load());
+                    }
+
+                    double recall = 0;
+                    for (std::size_t query_idx = 0; query_idx != queries_count; ++query_idx)
+                        recall += exact_counts[query_idx] ? double(hits[query_idx]) / exact_counts[query_idx] : 1.0;
+                    recall /= queries_count;
+
+                    // Among the schedules reaching the target, prefer the cheapest, otherwise the most accurate
+                    bool reached = recall >= config.target_recall;
+                    std::size_t cost = computed_distances.load();
+                    bool better = reached ? !best_reached || cost < best_cost
+                                          : !best_reached && (recall > best_recall ||
+                                                              (recall == best_recall && cost < best_cost));
+                    if (better) {
+                        best = {expansion, patience, distance_ratio};
+                        best_recall = recall, best_cost = cost, best_reached = reached;
+                    }
+                    result.schedules++;
+                    if (!progress(result.schedules, schedules_count)) {
+                        apply(original);
+                        return result.failed("Calibration was cancelled!");
+                    }
+                }
+            }
+        }
+
+        apply(best);
+        result.expansion = best.expansion;
+        result.patience = best.patience;
+        result.distance_ratio = best.distance_ratio;
+        result.recall = best_recall;
+        result.computed_distances = best_cost;
+        return result;
+    }
+
   private:
     struct thread_lock_t {
         index_dense_gt const& parent;
@@ -1737,58 +2848,280 @@ class index_dense_gt {
         available_threads_mutex_.unlock();
     }
 
-    template <typename scalar_at>
-    add_result_t add_(                             //
-        vector_key_t key, scalar_at const* vector, //
-        std::size_t thread, bool force_vector_copy, cast_t const& cast) {
+    labeling_result_t remove_(vector_key_t key, std::vector<compressed_slot_t>* removed_slots) {
+        labeling_result_t result;
 
-        if (!multi() && contains(key))
-            return add_result_t{}.failed("Duplicate keys not allowed in high-level wrappers");
+        slot_lookup_shard_t& shard = slot_shard_(key);
+        lookup_shared_lock_t lookup_lock(slot_lookup_mutex_);
+        unique_lock_t lock(shard.mutex);
+        auto matching_slots = shard.slots.equal_range(key_and_slot_t::any_slot(key));
+        if (matching_slots.first == matching_slots.second)
+            return result;
 
-        // Cast the vector, if needed for compatibility with `metric_`
-        thread_lock_t lock = thread_lock_(thread);
-        bool copy_vector = !config_.exclude_vectors || force_vector_copy;
-        byte_t const* vector_data = reinterpret_cast<byte_t const*>(vector);
-        {
-            byte_t* casted_data = cast_buffer_.data() + metric_.bytes_per_vector() * lock.thread_id;
-            bool casted = cast(vector_data, dimensions(), casted_data);
-            if (casted)
-                vector_data = casted_data, copy_vector = true;
-        }
+        // Grow the removed entries ring, if needed
+        std::size_t matching_count = std::distance(matching_slots.first, matching_slots.second);
+        std::unique_lock<std::mutex> free_lock(free_keys_mutex_);
+        if (!free_keys_.reserve(free_keys_.size() + matching_count))
+            return result.failed("Can't allocate memory for a free-list");
 
-        // Check if there are some removed entries, whose nodes we can reuse
-        compressed_slot_t free_slot = default_free_value<compressed_slot_t>();
-        {
-            std::unique_lock<std::mutex> lock(free_keys_mutex_);
-            free_keys_.try_pop(free_slot);
+        // A removed entry would be:
+        // - present in `free_keys_`
+        // - missing in the `slot_lookup_`
+        // - marked in the `typed_` index with a `free_key_`
+        for (auto slots_it = matching_slots.first; slots_it != matching_slots.second; ++slots_it) {
+            compressed_slot_t slot = (*slots_it).slot;
+            free_keys_.push(slot);
+            typed_->update_key(slot, free_key_);
+            if (removed_slots)
+                removed_slots->push_back(slot);
         }
+        shard.slots.erase(key);
+        result.completed = matching_count;
 
-        // Perform the insertion or the update
-        bool reuse_node = free_slot != default_free_value<compressed_slot_t>();
+        return result;
+    }
+
+    template <typename keys_iterator_at>
+    labeling_result_t remove_(keys_iterator_at keys_begin, keys_iterator_at keys_end,
+                              std::vector<compressed_slot_t>* removed_slots) {
+
+        labeling_result_t result;
+        lookup_unique_lock_t lookup_lock(slot_lookup_mutex_);
+        std::unique_lock<std::mutex> free_lock(free_keys_mutex_);
+        // Grow the removed entries ring, if needed
+        std::size_t matching_count = 0;
+        for (auto keys_it = keys_begin; keys_it != keys_end; ++keys_it)
+            matching_count += slot_shard_(*keys_it).slots.count(key_and_slot_t::any_slot(*keys_it));
+
+        if (!free_keys_.reserve(free_keys_.size() + matching_count))
+            return result.failed("Can't allocate memory for a free-list");
+
+        // Remove them one-by-one
+        for (auto keys_it = keys_begin; keys_it != keys_end; ++keys_it) {
+            vector_key_t key = *keys_it;
+            slot_lookup_set_t& slots = slot_shard_(key).slots;
+            auto matching_slots = slots.equal_range(key_and_slot_t::any_slot(key));
+            // A removed entry would be:
+            // - present in `free_keys_`
+            // - missing in the `slot_lookup_`
+            // - marked in the `typed_` index with a `free_key_`
+            matching_count = 0;
+            for (auto slots_it = matching_slots.first; slots_it != matching_slots.second; ++slots_it) {
+                compressed_slot_t slot = (*slots_it).slot;
+                free_keys_.push(slot);
+                typed_->update_key(slot, free_key_);
+                if (removed_slots)
+                    removed_slots->push_back(slot);
+                ++matching_count;
+            }
+
+            slots.erase(key);
+            result.completed += matching_count;
+        }
+
+        return result;
+    }
+
+    labeling_result_t repair_removed_(labeling_result_t result, std::vector<compressed_slot_t> const& removed_slots) {
+        thread_lock_t lock = thread_lock_(any_thread());
+        auto allow = [&](member_cref_t const& member) noexcept { return member.key != free_key_; };
+        for (compressed_slot_t slot : removed_slots) {
+            typename index_t::repair_result_t repaired =
+                typed_->repair_neighbors(slot, metric_proxy_t{*this}, allow, lock.thread_id);
+            if (!repaired)
+                return result.failed(std::move(repaired.error));
+        }
+        return result;
+    }
+
+    /**
+     *  @brief  Populates an empty index with a whole static collection at once, using `index_gt::build`.
+     *          Nothing else may run on the index meanwhile. Product-quantized indexes build incrementally,
+     *          as their queries need per-thread lookup tables.
+     */
+    template <typename scalar_at, typename executor_at, typename progress_at>
+    build_result_t build_(                                                 //
+        vector_key_t const* keys, scalar_at const* vectors, std::size_t count, //
+        executor_at&& executor, progress_at&& progress, cast_t const& cast) {
+
+        build_result_t result;
+        if (typed_->size())
+            return result.failed("Bulk construction requires an empty index");
+        if (!multi()) {
+            std::vector<vector_key_t> sorted_keys(keys, keys + count);
+            std::sort(sorted_keys.begin(), sorted_keys.end());
+            if (std::adjacent_find(sorted_keys.begin(), sorted_keys.end()) != sorted_keys.end())
+                return result.failed("Duplicate keys not allowed in high-level wrappers");
+        }
+        if (capacity() < count || limits().threads() < executor.size()) {
+            index_limits_t new_limits = limits();
+            new_limits.members = (std::max)(new_limits.members, count);
+            new_limits.threads_add = (std::max)(new_limits.threads_add, executor.size());
+            new_limits.threads_search = (std::max)(new_limits.threads_search, executor.size());
+            if (!reserve(new_limits))
+                return result.failed("Out of memory!");
+        }
+
+        std::size_t const vector_bytes = std::is_same<scalar_at, b1x8_t>::value
+                                             ? divide_round_up<CHAR_BIT>(dimensions())
+                                             : dimensions() * sizeof(scalar_at);
+        if (quantizer_) {
+            std::atomic<char const*> atomic_error{nullptr};
+            std::atomic<bool> do_tasks{true};
+            std::atomic<std::size_t> processed{0};
+            executor.dynamic(count, [&](std::size_t thread, std::size_t task) {
+                byte_t const* vector = reinterpret_cast<byte_t const*>(vectors) + vector_bytes * task;
+                add_result_t added = add_(keys[task], reinterpret_cast<scalar_at const*>(vector), thread, true, cast);
+                if (!added) {
+                    char const* expected = nullptr;
+                    atomic_error.compare_exchange_strong(expected, added.error.release());
+                    return false;
+                }
+                ++processed;
+                if (thread == 0)
+                    do_tasks = progress(processed.load(), count);
+                return do_tasks.load();
+            });
+            if (atomic_error.load())
+                return result.failed(atomic_error.load());
+            if (!do_tasks.load())
+                return result.failed("Construction was interrupted");
+            result.new_size = typed_->size();
+            return result;
+        }
+
+        auto store = [&](member_ref_t member) {
+            std::size_t const slot = member.slot;
+            byte_t const* vector = reinterpret_cast<byte_t const*>(vectors) + vector_bytes * slot;
+            byte_t* stored = config_.colocate_vectors ? typed_->vector_at(slot)
+                                                      : (byte_t*)vectors_tape_allocator_.allocate(vector_bytes_());
+            vectors_lookup_[slot] = stored;
+            if (!cast(vector, dimensions(), stored))
+                std::memcpy(stored, vector, metric_.bytes_per_vector());
+
+            // Keep the higher-precision copy, casting straight from the original input
+            if (rerank_metric_) {
+                byte_t* rerank_vector = rerank_vectors_tape_allocator_.allocate(rerank_metric_.bytes_per_vector());
+                rerank_vectors_lookup_[slot] = rerank_vector;
+                if (!cast_from_(rerank_casts_, vectors)(vector, dimensions(), rerank_vector))
+                    std::memcpy(rerank_vector, vector, rerank_metric_.bytes_per_vector());
+            }
+
+            vector_key_t const key = member.key;
+            slot_lookup_shard_t& shard = slot_shard_(key);
+            lookup_shared_lock_t lookup_lock(slot_lookup_mutex_);
+            unique_lock_t slot_lock(shard.mutex);
+            shard.slots.try_emplace(key_and_slot_t{key, static_cast<compressed_slot_t>(slot)});
+        };
+
+        index_build_config_t build_config;
+        build_config.expansion = config_.expansion_add;
+        build_config.prefetch_depth = prefetch_depth_();
+        {
+            shared_lock_t snapshot_lock(snapshot_mutex_);
+            result = typed_->build(keys, count, values_proxy_t{*this}, metric_proxy_t{*this}, build_config, store,
+                                   std::forward<executor_at>(executor), std::forward<progress_at>(progress),
+                                   vectors_prefetch_t{*this});
+        }
+        if (!result)
+            clear();
+        return result;
+    }
+
+    template <typename scalar_at>
+    add_result_t add_(                             //
+        vector_key_t key, scalar_at const* vector, //
+        std::size_t thread, bool force_vector_copy, cast_t const& cast) {
+        return add_(key, vector, thread, force_vector_copy, cast, metric_proxy_t{*this});
+    }
+
+    template <typename scalar_at, typename cast_at, typename metric_at>
+    add_result_t add_(                             //
+        vector_key_t key, scalar_at const* vector, //
+        std::size_t thread, bool force_vector_copy, cast_at const& cast, metric_at const& metric) {
+
+        if (!multi() && contains(key))
+            return add_result_t{}.failed("Duplicate keys not allowed in high-level wrappers");
+
+        // Cast the vector, if needed for compatibility with `metric_`
+        thread_lock_t lock = thread_lock_(thread);
+        bool copy_vector = !config_.exclude_vectors || force_vector_copy || quantizer_ || config_.colocate_vectors;
+        byte_t const* vector_data = reinterpret_cast<byte_t const*>(vector);
+        {
+            byte_t* casted_data = cast_buffer_.data() + metric_.bytes_per_vector() * lock.thread_id;
+            bool casted = cast(vector_data, dimensions(), casted_data);
+            if (casted)
+                vector_data = casted_data, copy_vector = true;
+        }
+        byte_t const* query_data = prepare_query_(vector_data, lock.thread_id);
+
+        // Check if there are some removed entries, whose nodes we can reuse
+        compressed_slot_t free_slot = default_free_value<compressed_slot_t>();
+        {
+            std::unique_lock<std::mutex> lock(free_keys_mutex_);
+            free_keys_.try_pop(free_slot);
+        }
+
+        // Perform the insertion or the update
+        bool reuse_node = free_slot != default_free_value<compressed_slot_t>();
+        shared_lock_t snapshot_lock(snapshot_mutex_);
         auto on_success = [&](member_ref_t member) {
-            unique_lock_t slot_lock(slot_lookup_mutex_);
-            slot_lookup_.try_emplace(key_and_slot_t{key, static_cast<compressed_slot_t>(member.slot)});
+            if (reuse_node)
+                snapshot_preserve_vectors_(member.slot);
             if (copy_vector) {
-                if (!reuse_node)
-                    vectors_lookup_[member.slot] = vectors_tape_allocator_.allocate(metric_.bytes_per_vector());
-                std::memcpy(vectors_lookup_[member.slot], vector_data, metric_.bytes_per_vector());
+                if (config_.colocate_vectors)
+                    vectors_lookup_[member.slot] = typed_->vector_at(member.slot);
+                else if (!reuse_node)
+                    vectors_lookup_[member.slot] = vectors_tape_allocator_.allocate(vector_bytes_());
+                if (quantizer_)
+                    quantizer_.encode(reinterpret_cast<f32_t const*>(vector_data),
+                                      reinterpret_cast<product_quantizer_t::code_t*>(vectors_lookup_[member.slot]));
+                else
+                    std::memcpy(vectors_lookup_[member.slot], vector_data, metric_.bytes_per_vector());
             } else
                 vectors_lookup_[member.slot] = (byte_t*)vector_data;
+
+            // Keep the higher-precision copy, casting straight from the original input
+            if (rerank_metric_) {
+                if (!reuse_node)
+                    rerank_vectors_lookup_[member.slot] =
+                        rerank_vectors_tape_allocator_.allocate(rerank_metric_.bytes_per_vector());
+                byte_t* rerank_vector = rerank_vectors_lookup_[member.slot];
+                byte_t const* original = reinterpret_cast<byte_t const*>(vector);
+                if (!cast_from_(rerank_casts_, vector)(original, dimensions(), rerank_vector))
+                    std::memcpy(rerank_vector, original, rerank_metric_.bytes_per_vector());
+            }
+
+            // Publish the key only after the vector is in place, locking just its shard
+            slot_lookup_shard_t& shard = slot_shard_(key);
+            lookup_shared_lock_t lookup_lock(slot_lookup_mutex_);
+            unique_lock_t slot_lock(shard.mutex);
+            shard.slots.try_emplace(key_and_slot_t{key, static_cast<compressed_slot_t>(member.slot)});
         };
 
         index_update_config_t update_config;
         update_config.thread = lock.thread_id;
         update_config.expansion = config_.expansion_add;
+        update_config.optimistic = config_.optimistic_insertion;
+        update_config.prefetch_depth = prefetch_depth_();
 
-        metric_proxy_t metric{*this};
+        vectors_prefetch_t prefetch{*this};
         return reuse_node //
-                   ? typed_->update(typed_->iterator_at(free_slot), key, vector_data, metric, update_config, on_success)
-                   : typed_->add(key, vector_data, metric, update_config, on_success);
+                   ? typed_->update(typed_->iterator_at(free_slot), key, query_data, metric, update_config, on_success,
+                                    prefetch)
+                   : typed_->add(key, query_data, metric, update_config, on_success, prefetch);
     }
 
     template <typename scalar_at, typename predicate_at>
     search_result_t search_(scalar_at const* vector, std::size_t wanted, predicate_at&& predicate, std::size_t thread,
                             bool exact, cast_t const& cast) const {
+        return search_(vector, wanted, std::forward<predicate_at>(predicate), thread, exact, cast,
+                       metric_proxy_t{*this});
+    }
+
+    template <typename scalar_at, typename predicate_at, typename cast_at, typename metric_at>
+    search_result_t search_(scalar_at const* vector, std::size_t wanted, predicate_at&& predicate, std::size_t thread,
+                            bool exact, cast_at const& cast, metric_at const& metric) const {
 
         // Cast the vector, if needed for compatibility with `metric_`
         thread_lock_t lock = thread_lock_(thread);
@@ -1799,23 +3132,301 @@ class index_dense_gt {
             if (casted)
                 vector_data = casted_data;
         }
+        vector_data = prepare_query_(vector_data, lock.thread_id);
 
         index_search_config_t search_config;
         search_config.thread = lock.thread_id;
         search_config.expansion = config_.expansion_search;
+        search_config.patience = config_.patience_search;
+        search_config.distance_ratio = config_.distance_ratio_search;
         search_config.exact = exact;
+        search_config.prefetch_depth = prefetch_depth_();
+
+        // In two-stage search, fetch more candidates to rescore them afterwards
+        bool const rerank = rerank_metric_ && config_.rerank_factor;
+        std::size_t const candidates = rerank ? wanted * config_.rerank_factor : wanted;
 
+        search_result_t result;
         if (std::is_same<typename std::decay<predicate_at>::type, dummy_predicate_t>::value) {
             auto allow = [free_key_ = this->free_key_](member_cref_t const& member) noexcept {
                 return member.key != free_key_;
             };
-            return typed_->search(vector_data, wanted, metric_proxy_t{*this}, search_config, allow);
+            result = typed_->search(vector_data, candidates, metric, search_config, allow, vectors_prefetch_t{*this});
         } else {
             auto allow = [free_key_ = this->free_key_, &predicate](member_cref_t const& member) noexcept {
                 return member.key != free_key_ && predicate(member.key);
             };
-            return typed_->search(vector_data, wanted, metric_proxy_t{*this}, search_config, allow);
+            result = typed_->search(vector_data, candidates, metric, search_config, allow, vectors_prefetch_t{*this});
+        }
+        if (!rerank || !result)
+            return result;
+
+        auto rerank_source = [this](member_citerator_t member) noexcept {
+            return rerank_vectors_lookup_[get_slot(member)];
+        };
+        return rerank_(std::move(result), rerank_query_(vector, lock.thread_id), wanted, rerank_metric_,
+                       rerank_source, search_config);
+    }
+
+    template <typename scalar_at>
+    search_result_t filtered_search_(scalar_at const* vector, std::size_t wanted, filter_t const& filter,
+                                     std::size_t thread, bool exact, cast_t const& cast) const {
+
+        // Cast the vector, if needed for compatibility with `metric_`
+        thread_lock_t lock = thread_lock_(thread);
+        byte_t const* vector_data = reinterpret_cast<byte_t const*>(vector);
+        {
+            byte_t* casted_data = cast_buffer_.data() + metric_.bytes_per_vector() * lock.thread_id;
+            bool casted = cast(vector_data, dimensions(), casted_data);
+            if (casted)
+                vector_data = casted_data;
+        }
+        vector_data = prepare_query_(vector_data, lock.thread_id);
+
+        index_search_config_t search_config;
+        search_config.thread = lock.thread_id;
+        search_config.expansion = config_.expansion_search;
+        search_config.patience = config_.patience_search;
+        search_config.distance_ratio = config_.distance_ratio_search;
+        search_config.exact = exact;
+        search_config.prefetch_depth = prefetch_depth_();
+
+        bool const rerank = rerank_metric_ && config_.rerank_factor;
+        std::size_t const candidates = rerank ? wanted * config_.rerank_factor : wanted;
+
+        // The removed entries may still be marked in an outdated filter, and their slots may have been reused
+        auto allow = [&filter](member_cref_t const& member) noexcept {
+            return filter.test(member.slot, member.key);
+        };
+        search_result_t result = typed_->filtered_search(vector_data, candidates, metric_proxy_t{*this}, filter,
+                                                         filter.count, search_config, allow,
+                                                         vectors_prefetch_t{*this});
+        if (!rerank || !result)
+            return result;
+
+        auto rerank_source = [this](member_citerator_t member) noexcept {
+            return rerank_vectors_lookup_[get_slot(member)];
+        };
+        return rerank_(std::move(result), rerank_query_(vector, lock.thread_id), wanted, rerank_metric_,
+                       rerank_source, search_config);
+    }
+
+    /**
+     *  @brief  Reports every entry within the ::radius to the ::callback, receiving the `vector_key_t` and
+     *          the `distance_t`. Distances are measured with the `metric()`, without reranking.
+     */
+    template <typename scalar_at, typename callback_at>
+    range_search_result_t range_search_(scalar_at const* vector, distance_t radius, callback_at&& callback,
+                                        std::size_t max_count, std::size_t thread, bool exact,
+                                        cast_t const& cast) const {
+
+        // Cast the vector, if needed for compatibility with `metric_`
+        thread_lock_t lock = thread_lock_(thread);
+        byte_t const* vector_data = reinterpret_cast<byte_t const*>(vector);
+        {
+            byte_t* casted_data = cast_buffer_.data() + metric_.bytes_per_vector() * lock.thread_id;
+            bool casted = cast(vector_data, dimensions(), casted_data);
+            if (casted)
+                vector_data = casted_data;
+        }
+        vector_data = prepare_query_(vector_data, lock.thread_id);
+
+        // The `patience_search` and `distance_ratio_search` don't apply, as every match within the radius counts
+        index_search_config_t search_config;
+        search_config.thread = lock.thread_id;
+        search_config.expansion = config_.expansion_search;
+        search_config.exact = exact;
+        search_config.prefetch_depth = prefetch_depth_();
+
+        auto allow = [free_key_ = this->free_key_](member_cref_t const& member) noexcept {
+            return member.key != free_key_;
+        };
+        auto report = [&callback](member_cref_t const& member, distance_t distance) {
+            vector_key_t key = member.key;
+            callback(key, distance);
+        };
+        return typed_->range_search(vector_data, radius, metric_proxy_t{*this}, report, max_count, search_config,
+                                    allow, vectors_prefetch_t{*this});
+    }
+
+    /**
+     *  @brief  Searches for `candidates` approximate neighbors using the stored vectors, and reorders them
+     *          by the exact distances to the original vectors, fetched from an external ::source.
+     *
+     *  @param[in] candidates Number of approximate neighbors to rescore, or zero for `wanted * rerank_factor()`.
+     *  @param[in] source Callable object mapping a `vector_key_t` to a `byte_t const*` pointer to the original
+     *                    vector, matching the `rerank_metric()` if it's enabled, or the `metric()` otherwise.
+     *                    Can be backed by a user-managed array, a memory-mapped file, or a remote store.
+     *                    Returning `nullptr` moves the entry to the end of the results.
+     */
+    template <typename scalar_at, typename vectors_source_at>
+    search_result_t search_reranked_(                                        //
+        scalar_at const* vector, std::size_t wanted, std::size_t candidates, //
+        vectors_source_at&& source, std::size_t thread, cast_t const& cast) const {
+
+        // Cast the vector, if needed for compatibility with `metric_`
+        thread_lock_t lock = thread_lock_(thread);
+        byte_t const* vector_data = reinterpret_cast<byte_t const*>(vector);
+        {
+            byte_t* casted_data = cast_buffer_.data() + metric_.bytes_per_vector() * lock.thread_id;
+            bool casted = cast(vector_data, dimensions(), casted_data);
+            if (casted)
+                vector_data = casted_data;
+        }
+
+        index_search_config_t search_config;
+        search_config.thread = lock.thread_id;
+        search_config.expansion = config_.expansion_search;
+        search_config.patience = config_.patience_search;
+        search_config.distance_ratio = config_.distance_ratio_search;
+        search_config.prefetch_depth = prefetch_depth_();
+
+        auto allow = [free_key_ = this->free_key_](member_cref_t const& member) noexcept {
+            return member.key != free_key_;
+        };
+        if (!candidates)
+            candidates = wanted * (std::max)(config_.rerank_factor, std::size_t(1));
+        search_result_t approximate = typed_->search(                                      //
+            prepare_query_(vector_data, lock.thread_id), (std::max)(wanted, candidates), //
+            metric_proxy_t{*this}, search_config, allow, vectors_prefetch_t{*this});
+        if (!approximate)
+            return approximate;
+
+        auto rerank_source = [&](member_citerator_t member) { return source(vector_key_t(get_key(member))); };
+        return rerank_metric_ //
+                   ? rerank_(std::move(approximate), rerank_query_(vector, lock.thread_id), wanted, rerank_metric_,
+                             rerank_source, search_config)
+                   : rerank_(std::move(approximate), vector_data, wanted, metric_, rerank_source, search_config);
+    }
+
+    /**
+     *  @brief  Rescores the candidates of the last search in the same thread with a more accurate ::metric.
+     *  @param[in] source Callable object mapping a `member_citerator_t` to a `byte_t const*` vector.
+     */
+    template <typename vectors_source_at>
+    search_result_t rerank_(search_result_t approximate, byte_t const* query, std::size_t wanted,
+                            metric_t const& metric, vectors_source_at&& source,
+                            index_search_config_t const& search_config) const {
+
+        auto original_metric = [&](byte_t const* query, member_citerator_t member) noexcept -> distance_t {
+            byte_t const* original = source(member);
+            return original ? metric(query, original) : std::numeric_limits<distance_t>::max();
+        };
+        search_result_t result = typed_->rescore(query, wanted, original_metric, search_config);
+        result.visited_members += approximate.visited_members;
+        result.computed_distances += approximate.computed_distances;
+        return result;
+    }
+
+    /// @brief Casts the original query to the `rerank_metric_` scalar kind, if needed.
+    template <typename scalar_at>
+    byte_t const* rerank_query_(scalar_at const* vector, std::size_t thread_id) const {
+        byte_t const* vector_data = reinterpret_cast<byte_t const*>(vector);
+        byte_t* casted_data = rerank_cast_buffer_.data() + rerank_metric_.bytes_per_vector() * thread_id;
+        bool casted = cast_from_(rerank_casts_, vector)(vector_data, dimensions(), casted_data);
+        return casted ? casted_data : vector_data;
+    }
+
+    /**
+     *  @brief  Answers a contiguous matrix of ::queries, splitting it into small groups, that share
+     *          the upper-levels traversal in `index_gt::search_batch`.
+     *
+     *  @param[out] keys Matrix of `queries_count` rows and `wanted` columns for the found keys.
+     *  @param[out] distances Matrix of `queries_count` rows and `wanted` columns for the distances.
+     *  @param[out] counts Array of `queries_count` integers for the number of results per query.
+     */
+    template <typename scalar_at, typename executor_at>
+    search_batch_result_t search_batch_(                                         //
+        scalar_at const* queries, std::size_t queries_count, std::size_t wanted, //
+        vector_key_t* keys, distance_t* distances, std::size_t* counts,          //
+        executor_at&& executor, cast_t const& cast) const {
+
+        // Nothing will be exported, but the callers still read the counts of every query
+        search_batch_result_t result;
+        if (!wanted) {
+            std::fill_n(counts, queries_count, std::size_t(0));
+            result.count = queries_count;
+            return result;
         }
+
+        // Groups should be large enough to share the top levels, but small enough to balance the load.
+        std::size_t const group_size = 32;
+        std::size_t const groups_count = divide_round_up(queries_count, group_size);
+        std::size_t const query_bytes = std::is_same<scalar_at, b1x8_t>::value
+                                            ? divide_round_up<CHAR_BIT>(dimensions())
+                                            : dimensions() * sizeof(scalar_at);
+        std::size_t const casted_bytes = metric_.bytes_per_vector();
+
+        // Every executor thread needs its own buffers for the casted queries.
+        std::size_t const executor_threads = executor.size();
+        std::vector<byte_t> casted_buffer(executor_threads * group_size * casted_bytes);
+        std::vector<byte_t const*> queries_buffer(executor_threads * group_size);
+        std::size_t const table_length = quantizer_.lookup_table_length();
+        std::vector<f32_t> tables_buffer(executor_threads * group_size * table_length);
+
+        std::atomic<std::size_t> answered(0);
+        std::atomic<std::size_t> visited_members(0);
+        std::atomic<std::size_t> computed_distances(0);
+        std::atomic<char const*> atomic_error{nullptr};
+
+        auto allow = [free_key_ = this->free_key_](member_cref_t const& member) noexcept {
+            return member.key != free_key_;
+        };
+
+        executor.dynamic(groups_count, [&](std::size_t executor_thread, std::size_t group_idx) {
+            std::size_t const group_begin = group_idx * group_size;
+            std::size_t const group_end = (std::min)(group_begin + group_size, queries_count);
+            byte_t const** group_queries = queries_buffer.data() + executor_thread * group_size;
+            byte_t* casted_data = casted_buffer.data() + executor_thread * group_size * casted_bytes;
+
+            // Cast the vectors, if needed for compatibility with `metric_`
+            for (std::size_t query_idx = group_begin; query_idx != group_end; ++query_idx) {
+                byte_t const* query_data = reinterpret_cast<byte_t const*>(queries) + query_bytes * query_idx;
+                byte_t* query_casted = casted_data + casted_bytes * (query_idx - group_begin);
+                bool casted = cast(query_data, dimensions(), query_casted);
+                group_queries[query_idx - group_begin] = casted ? query_casted : query_data;
+                if (quantizer_) {
+                    f32_t* table = tables_buffer.data() + table_length * (executor_thread * group_size +
+                                                                          query_idx - group_begin);
+                    quantizer_.lookup_table(reinterpret_cast<f32_t const*>(group_queries[query_idx - group_begin]),
+                                            table);
+                    group_queries[query_idx - group_begin] = reinterpret_cast<byte_t const*>(table);
+                }
+            }
+
+            thread_lock_t lock = thread_lock_(any_thread());
+            index_search_config_t search_config;
+            search_config.thread = lock.thread_id;
+            search_config.expansion = config_.expansion_search;
+            search_config.patience = config_.patience_search;
+            search_config.distance_ratio = config_.distance_ratio_search;
+            search_config.prefetch_depth = prefetch_depth_();
+
+            auto export_results = [&](std::size_t group_query_idx, search_result_t const& query_result) {
+                std::size_t query_idx = group_begin + group_query_idx;
+                counts[query_idx] = query_result.dump_to(keys + wanted * query_idx, distances + wanted * query_idx);
+            };
+            search_batch_result_t group_result = typed_->search_batch( //
+                group_queries, group_end - group_begin, wanted, metric_proxy_t{*this}, export_results, search_config,
+                allow, vectors_prefetch_t{*this});
+            if (!group_result) {
+                atomic_error = group_result.error.release();
+                return false;
+            }
+
+            answered += group_result.count;
+            visited_members += group_result.visited_members;
+            computed_distances += group_result.computed_distances;
+            return true;
+        });
+
+        if (atomic_error)
+            return result.failed(atomic_error.load());
+
+        result.count = answered;
+        result.visited_members = visited_members;
+        result.computed_distances = computed_distances;
+        return result;
     }
 
     template <typename scalar_at>
@@ -1832,6 +3443,7 @@ class index_dense_gt {
             if (casted)
                 vector_data = casted_data;
         }
+        vector_data = prepare_query_(vector_data, lock.thread_id);
 
         index_cluster_config_t cluster_config;
         cluster_config.thread = lock.thread_id;
@@ -1857,10 +3469,13 @@ class index_dense_gt {
             if (casted)
                 vector_data = casted_data;
         }
+        vector_data = prepare_query_(vector_data, lock.thread_id);
 
         // Check if such `key` is even present.
-        shared_lock_t slots_lock(slot_lookup_mutex_);
-        auto key_range = slot_lookup_.equal_range(key_and_slot_t::any_slot(key));
+        slot_lookup_shard_t const& shard = slot_shard_(key);
+        lookup_shared_lock_t lookup_lock(slot_lookup_mutex_);
+        shared_lock_t slots_lock(shard.mutex);
+        auto key_range = shard.slots.equal_range(key_and_slot_t::any_slot(key));
         aggregated_distances_t result;
         if (key_range.first == key_range.second)
             return result;
@@ -1873,8 +3488,7 @@ class index_dense_gt {
         while (key_range.first != key_range.second) {
             key_and_slot_t key_and_slot = *key_range.first;
             byte_t const* a_vector = vectors_lookup_[key_and_slot.slot];
-            byte_t const* b_vector = vector_data;
-            distance_t a_b_distance = metric_(a_vector, b_vector);
+            distance_t a_b_distance = metric_proxy_t{*this}.q(vector_data, a_vector);
 
             result.mean += a_b_distance;
             result.min = (std::min)(result.min, a_b_distance);
@@ -1889,58 +3503,389 @@ class index_dense_gt {
         return result;
     }
 
-    void reindex_keys_() {
+    /**
+     *  @brief Moves the vectors into new tapes in the order of the renumbered slots,
+     *         so that the vectors of consecutive slots are also adjacent in memory.
+     *         Vectors that may be owned by the user, with `exclude_vectors`, are only renumbered.
+     */
+    void relocate_vectors_(std::vector<compressed_slot_t> const& new_slot_to_old) {
+        auto relocate = [&](std::vector<byte_t*>& lookup, vectors_tape_allocator_t& allocator, std::size_t bytes) {
+            std::vector<byte_t*> new_lookup(lookup.size());
+            vectors_tape_allocator_t new_allocator(config_.placement);
+            for (std::size_t new_slot = 0; new_slot != new_slot_to_old.size(); ++new_slot) {
+                byte_t const* old_vector = lookup[new_slot_to_old[new_slot]];
+                if (!old_vector)
+                    continue;
+                new_lookup[new_slot] = new_allocator.allocate(bytes);
+                std::memcpy(new_lookup[new_slot], old_vector, bytes);
+            }
+            lookup = std::move(new_lookup);
+            allocator = std::move(new_allocator);
+        };
+        // Vectors owned by the user must stay where they are, so only the pointers are permuted,
+        // and the copies made on casts remain in the old tape
+        bool const may_reference_external = config_.exclude_vectors && !quantizer_;
+        if (config_.colocate_vectors)
+            reindex_colocated_vectors_();
+        else if (may_reference_external) {
+            std::vector<byte_t*> new_lookup(vectors_lookup_.size());
+            for (std::size_t new_slot = 0; new_slot != new_slot_to_old.size(); ++new_slot)
+                new_lookup[new_slot] = vectors_lookup_[new_slot_to_old[new_slot]];
+            vectors_lookup_ = std::move(new_lookup);
+        } else
+            relocate(vectors_lookup_, vectors_tape_allocator_, vector_bytes_());
+        if (rerank_metric_)
+            relocate(rerank_vectors_lookup_, rerank_vectors_tape_allocator_, rerank_metric_.bytes_per_vector());
+    }
+
+    /// @brief Number of bytes kept in `vectors_lookup_` entries, which is smaller for quantized indexes.
+    std::size_t vector_bytes_() const noexcept {
+        return quantizer_ ? quantizer_.bytes_per_code() : metric_.bytes_per_vector();
+    }
 
-        // Estimate number of entries first
-        std::size_t count_total = typed_->size();
-        std::size_t count_removed = 0;
-        for (std::size_t i = 0; i != count_total; ++i) {
-            member_cref_t member = typed_->at(i);
-            count_removed += member.key == free_key_;
-        }
+    /// @brief Collects the slots of all the entries under ::key, locking only its shard.
+    std::vector<compressed_slot_t> slots_(vector_key_t key) const {
+        std::vector<compressed_slot_t> slots;
+        slot_lookup_shard_t const& shard = slot_shard_(key);
+        lookup_shared_lock_t lookup_lock(slot_lookup_mutex_);
+        shared_lock_t lock(shard.mutex);
+        auto key_range = shard.slots.equal_range(key_and_slot_t::any_slot(key));
+        for (; key_range.first != key_range.second; ++key_range.first)
+            slots.push_back((*key_range.first).slot);
+        return slots;
+    }
 
-        if (!count_removed && !config_.enable_key_lookups)
+    /// @brief Disk-resident indexes request all neighbors at once, to overlap more of the I/O.
+    std::size_t prefetch_depth_() const noexcept { return disk_resident_ ? 0 : config_.prefetch_depth; }
+
+    /// @brief Number of bytes per vector stored inside of the graph nodes.
+    std::size_t colocated_vector_bytes_() const noexcept { return config_.colocate_vectors ? vector_bytes_() : 0; }
+
+    /// @brief Number of bytes per vector stored in a separate tape, and serialized before the graph.
+    std::size_t separate_vector_bytes_() const noexcept { return config_.colocate_vectors ? 0 : vector_bytes_(); }
+
+    /**
+     *  @brief Recreates the empty graph after the vectors layout has changed,
+     *         so that the nodes are allocated with the right `vector_bytes`.
+     */
+    bool rebuild_typed_() {
+        index_limits_t limits = typed_->limits();
+        config_.vector_bytes = colocated_vector_bytes_();
+        typed_->~index_t();
+        new (typed_) index_t(config_, {}, tape_allocator_t(config_.placement));
+        return typed_->reserve(limits);
+    }
+
+    /// @brief Points `vectors_lookup_` into the graph nodes, after they were moved or loaded.
+    void reindex_colocated_vectors_() {
+        if (!config_.colocate_vectors)
             return;
+        if (vectors_lookup_.size() < typed_->size())
+            vectors_lookup_.resize(typed_->size());
+        for (std::size_t slot = 0; slot != typed_->size(); ++slot)
+            vectors_lookup_[slot] = typed_->vector_at(slot);
+    }
 
-        // Pull entries from the underlying `typed_` into either
-        // into `slot_lookup_`, or `free_keys_` if they are unused.
-        unique_lock_t lock(slot_lookup_mutex_);
-        slot_lookup_.clear();
-        if (config_.enable_key_lookups)
-            slot_lookup_.reserve(count_total - count_removed);
-        free_keys_.clear();
-        free_keys_.reserve(count_removed);
-        for (std::size_t i = 0; i != typed_->size(); ++i) {
-            member_cref_t member = typed_->at(i);
-            if (member.key == free_key_)
-                free_keys_.push(static_cast<compressed_slot_t>(i));
-            else if (config_.enable_key_lookups)
-                slot_lookup_.try_emplace(key_and_slot_t{vector_key_t(member.key), static_cast<compressed_slot_t>(i)});
-        }
+    /// @brief Replaces a casted query with its distance lookup table, if the index is quantized.
+    byte_t const* prepare_query_(byte_t const* vector, std::size_t thread_id) const noexcept {
+        if (!quantizer_)
+            return vector;
+        f32_t* table = lookup_tables_.data() + quantizer_.lookup_table_length() * thread_id;
+        quantizer_.lookup_table(reinterpret_cast<f32_t const*>(vector), table);
+        return reinterpret_cast<byte_t const*>(table);
     }
 
-    template <typename scalar_at>
-    std::size_t get_(vector_key_t key, scalar_at* reconstructed, std::size_t vectors_limit, cast_t const& cast) const {
+    bool snapshot_begin_() {
+        unique_lock_t lock(snapshot_mutex_);
+        if (snapshot_vectors_)
+            return false;
+        std::unique_ptr<snapshot_vectors_t> state(new (std::nothrow) snapshot_vectors_t);
+        if (!state || !typed_->snapshot_begin())
+            return false;
+
+        // No insertions are in flight, so every captured slot has its vectors in place
+        std::size_t const count = typed_->snapshot_size();
+        state->vectors.assign(vectors_lookup_.begin(), vectors_lookup_.begin() + count);
+        if (rerank_metric_)
+            state->rerank_vectors.assign(rerank_vectors_lookup_.begin(), rerank_vectors_lookup_.begin() + count);
+        snapshot_vectors_ = std::move(state);
+        return true;
+    }
 
-        if (!multi()) {
-            compressed_slot_t slot;
-            // Find the matching ID
-            {
-                shared_lock_t lock(slot_lookup_mutex_);
-                auto it = slot_lookup_.find(key_and_slot_t::any_slot(key));
-                if (it == slot_lookup_.end())
-                    return false;
-                slot = (*it).slot;
+    void snapshot_end_() noexcept {
+        unique_lock_t lock(snapshot_mutex_);
+        if (!snapshot_vectors_)
+            return;
+        typed_->snapshot_end();
+        snapshot_vectors_.reset();
+    }
+
+    /// @brief Copies the vectors of a reused @p slot aside, before they are overwritten. Called under its node lock.
+    void snapshot_preserve_vectors_(std::size_t slot) noexcept {
+        snapshot_vectors_t* snapshot = snapshot_vectors_.get();
+        if (!snapshot || slot >= snapshot->vectors.size())
+            return;
+
+        auto preserve = [&](byte_t*& captured, byte_t* live, std::size_t bytes) {
+            if (captured != live || !bytes)
+                return;
+            std::unique_lock<std::mutex> lock(snapshot->tape_mutex);
+            byte_t* copy = snapshot->tape.allocate(bytes);
+            if (!copy) {
+                snapshot->failed = true;
+                return;
+            }
+            std::memcpy(copy, live, bytes);
+            captured = copy;
+        };
+
+        if (!config_.colocate_vectors)
+            preserve(snapshot->vectors[slot], vectors_lookup_[slot], vector_bytes_());
+        if (rerank_metric_)
+            preserve(snapshot->rerank_vectors[slot], rerank_vectors_lookup_[slot], rerank_metric_.bytes_per_vector());
+    }
+
+    template <typename output_callback_at, typename progress_at>
+    serialization_result_t save_snapshot_to_stream_(output_callback_at&& output, serialization_config_t config,
+                                                    progress_at&& progress) const {
+
+        serialization_result_t result;
+        snapshot_vectors_t const& snapshot = *snapshot_vectors_;
+        std::uint64_t const matrix_rows = typed_->snapshot_size();
+        std::uint64_t const matrix_cols = separate_vector_bytes_();
+        bool const has_rerank_vectors = rerank_metric_ && !config.exclude_vectors;
+
+        // Count the members, as they were, since the removals may have happened since
+        std::size_t count_present = 0;
+        for (std::size_t i = 0; i != matrix_rows; ++i)
+            typed_->snapshot_visit(i, [&](member_cref_t member) { count_present += member.key != free_key_; });
+
+        // Each vector is staged under its node lock, as a concurrent update may be overwriting it
+        std::size_t const rerank_bytes = has_rerank_vectors ? rerank_metric_.bytes_per_vector() : 0;
+        std::size_t const staging_bytes = (std::max<std::size_t>)(matrix_cols, rerank_bytes);
+        buffer_gt<byte_t> staging(staging_bytes);
+        if (staging_bytes && !staging)
+            return result.failed("Out of memory!");
+        auto stage = [&](std::vector<byte_t*> const& lookup, std::size_t i, std::size_t bytes) {
+            typed_->snapshot_visit(i, [&](member_cref_t) { std::memcpy(staging.data(), lookup[i], bytes); });
+            return output(staging.data(), bytes);
+        };
+
+        // We may not want to put the vectors into the same file
+        if (!config.exclude_vectors) {
+            std::uint32_t dimensions_32[2] = {static_cast<std::uint32_t>(matrix_rows),
+                                              static_cast<std::uint32_t>(matrix_cols)};
+            std::uint64_t dimensions_64[2] = {matrix_rows, matrix_cols};
+            if (!config.use_64_bit_dimensions ? !output(&dimensions_32, sizeof(dimensions_32))
+                                              : !output(&dimensions_64, sizeof(dimensions_64)))
+                return result.failed("Failed to serialize into stream");
+            if (matrix_cols)
+                for (std::uint64_t i = 0; i != matrix_rows; ++i)
+                    if (!stage(snapshot.vectors, i, matrix_cols))
+                        return result.failed("Failed to serialize into stream");
+        }
+
+        // Augment metadata and save the codebooks right after it
+        result = save_head_(output, has_rerank_vectors, count_present, matrix_rows - count_present);
+        if (!result)
+            return result;
+
+        // Save the actual proximity graph
+        result = typed_->save_snapshot_to_stream(output, std::forward<progress_at>(progress));
+        if (!result)
+            return result;
+
+        // Dump the higher-precision copies after the graph, so that older readers can ignore them
+        if (has_rerank_vectors)
+            for (std::uint64_t i = 0; i != matrix_rows; ++i)
+                if (!stage(snapshot.rerank_vectors, i, rerank_bytes))
+                    return result.failed("Failed to serialize into stream");
+        if (snapshot.failed)
+            return result.failed("Out of memory, while preserving the snapshot");
+        return result;
+    }
+
+    /// @brief Serializes the fixed-size head and the optional codebooks, shared by all the exporting paths.
+    template <typename output_callback_at>
+    serialization_result_t save_head_(output_callback_at&& output, bool has_rerank_vectors, std::size_t count_present,
+                                      std::size_t count_deleted) const {
+        serialization_result_t result;
+        index_dense_head_buffer_t buffer;
+        std::memset(buffer, 0, sizeof(buffer));
+        index_dense_head_t head{buffer};
+        std::memcpy(buffer, default_magic(), std::strlen(default_magic()));
+
+        // Describe software version
+        using version_t = index_dense_head_t::version_t;
+        head.version_major = static_cast<version_t>(USEARCH_VERSION_MAJOR);
+        head.version_minor = static_cast<version_t>(USEARCH_VERSION_MINOR);
+        head.version_patch = static_cast<version_t>(USEARCH_VERSION_PATCH);
+
+        // Describes types used
+        head.kind_metric = metric_.metric_kind();
+        head.kind_scalar = metric_.scalar_kind();
+        head.kind_key = unum::usearch::scalar_kind<vector_key_t>();
+        head.kind_compressed_slot = unum::usearch::scalar_kind<compressed_slot_t>();
+
+        head.count_present = count_present;
+        head.count_deleted = count_deleted;
+        head.dimensions = dimensions();
+        head.multi = multi();
+        head.quantizer_subspaces = static_cast<std::uint32_t>(quantizer_ ? quantizer_.subspaces() : 0);
+        head.kind_rerank_scalar = has_rerank_vectors ? rerank_metric_.scalar_kind() : scalar_kind_t::unknown_k;
+        head.colocated_vectors = config_.colocate_vectors;
+
+        if (!output(&buffer, sizeof(buffer)))
+            return result.failed("Failed to serialize into stream");
+
+        // Save the codebooks right after the metadata
+        if (quantizer_) {
+            result = quantizer_.save_to_stream(output);
+            if (!result)
+                return result;
+        }
+        return result;
+    }
+
+    /// @brief Parses the fixed-size head and the optional codebooks, choosing the metric and the casts.
+    template <typename input_callback_at>
+    serialization_result_t load_head_(input_callback_at&& input, serialization_config_t config,
+                                      std::uint64_t matrix_cols) {
+        serialization_result_t result;
+        index_dense_head_buffer_t buffer;
+        if (!input(buffer, sizeof(buffer)))
+            return result.failed("Failed to read the index ");
+
+        index_dense_head_t head{buffer};
+        if (std::memcmp(buffer, default_magic(), std::strlen(default_magic())) != 0)
+            return result.failed("Magic header mismatch - the file isn't an index");
+
+        // Validate the software version
+        if (head.version_major != USEARCH_VERSION_MAJOR)
+            return result.failed("File format may be different, please rebuild");
+
+        // Check the types used
+        if (head.kind_key != unum::usearch::scalar_kind<vector_key_t>())
+            return result.failed("Key type doesn't match, consider rebuilding");
+        if (head.kind_compressed_slot != unum::usearch::scalar_kind<compressed_slot_t>())
+            return result.failed("Slot type doesn't match, consider rebuilding");
+
+        config_.multi = head.multi;
+        metric_ = metric_t::builtin(head.dimensions, head.kind_metric, head.kind_scalar);
+        cast_buffer_.resize(available_threads_.size() * metric_.bytes_per_vector());
+        casts_ = make_casts_(head.kind_scalar);
+
+        quantizer_ = product_quantizer_t{};
+        if (head.quantizer_subspaces) {
+            result = quantizer_.load_from_stream(input);
+            if (!result)
+                return result;
+            if (quantizer_.dimensions() != dimensions())
+                return result.failed("Codebooks don't match the vectors");
+        }
+        lookup_tables_.resize(available_threads_.size() * quantizer_.lookup_table_length());
+
+        config_.colocate_vectors = head.colocated_vectors;
+        if (!config.exclude_vectors && separate_vector_bytes_() != matrix_cols)
+            return result.failed("Stored vectors don't match the metric");
+        if (typed_->config().vector_bytes != colocated_vector_bytes_() && !rebuild_typed_())
+            return result.failed("Out of memory!");
+
+        rerank_metric_ = metric_t{};
+        if (head.kind_rerank_scalar != scalar_kind_t::unknown_k && !config.exclude_vectors) {
+            rerank_metric_ = metric_t::builtin(head.dimensions, head.kind_metric, head.kind_rerank_scalar);
+            rerank_casts_ = make_casts_(head.kind_rerank_scalar);
+            rerank_cast_buffer_.resize(available_threads_.size() * rerank_metric_.bytes_per_vector());
+        }
+        return result;
+    }
+
+    template <typename executor_at = dummy_executor_t> void reindex_keys_(executor_at&& executor = {}) {
+
+        // Estimate number of entries first
+        std::size_t count_total = typed_->size();
+        std::atomic<std::size_t> count_removed{0};
+        std::size_t const threads = (std::max<std::size_t>)(1, executor.size());
+        std::size_t const slots_per_thread = divide_round_up(count_total, threads);
+        executor.fixed(threads, [&](std::size_t, std::size_t thread) {
+            std::size_t first = (std::min)(count_total, thread * slots_per_thread);
+            std::size_t last = (std::min)(count_total, first + slots_per_thread);
+            std::size_t thread_removed = 0;
+            for (std::size_t i = first; i != last; ++i)
+                thread_removed += typed_->at(i).key == free_key_;
+            count_removed += thread_removed;
+        });
+
+        if (!count_removed && !config_.enable_key_lookups)
+            return;
+
+        // Pull entries from the underlying `typed_` into either
+        // into `slot_lookup_`, or `free_keys_` if they are unused.
+        lookup_unique_lock_t lock(slot_lookup_mutex_);
+        for (slot_lookup_shard_t& shard : slot_lookup_) {
+            shard.slots.clear();
+            if (config_.enable_key_lookups)
+                shard.slots.reserve(divide_round_up<slot_lookup_shards()>(count_total - count_removed));
+        }
+        free_keys_.clear();
+        free_keys_.reserve(count_removed);
+        for (std::size_t i = 0; i != count_total && count_removed; ++i)
+            if (typed_->at(i).key == free_key_)
+                free_keys_.push(static_cast<compressed_slot_t>(i));
+
+        // Populate the lookup shards concurrently, only contending on the individual shard locks
+        if (config_.enable_key_lookups)
+            executor.fixed(threads, [&](std::size_t, std::size_t thread) {
+                std::size_t first = (std::min)(count_total, thread * slots_per_thread);
+                std::size_t last = (std::min)(count_total, first + slots_per_thread);
+                for (std::size_t i = first; i != last; ++i) {
+                    member_cref_t member = typed_->at(i);
+                    if (member.key == free_key_)
+                        continue;
+                    vector_key_t key = vector_key_t(member.key);
+                    slot_lookup_shard_t& shard = slot_shard_(key);
+                    unique_lock_t shard_lock(shard.mutex);
+                    shard.slots.try_emplace(key_and_slot_t{key, static_cast<compressed_slot_t>(i)});
+                }
+            });
+    }
+
+    template <typename scalar_at>
+    std::size_t get_(vector_key_t key, scalar_at* reconstructed, std::size_t vectors_limit, cast_t const& cast) const {
+
+        // Quantized vectors are first decoded into the metric's own `f32_t` representation
+        std::vector<f32_t> decoded(quantizer_ ? dimensions() : 0);
+        auto export_vector = [&](byte_t const* punned_vector, byte_t* reconstructed_vector) {
+            if (quantizer_) {
+                quantizer_.decode(codes_(punned_vector), decoded.data());
+                punned_vector = reinterpret_cast<byte_t const*>(decoded.data());
+            }
+            bool casted = cast(punned_vector, dimensions(), reconstructed_vector);
+            if (!casted)
+                std::memcpy(reconstructed_vector, punned_vector, metric_.bytes_per_vector());
+        };
+
+        if (!multi()) {
+            compressed_slot_t slot;
+            // Find the matching ID
+            {
+                slot_lookup_shard_t const& shard = slot_shard_(key);
+                lookup_shared_lock_t lookup_lock(slot_lookup_mutex_);
+                shared_lock_t lock(shard.mutex);
+                auto it = shard.slots.find(key_and_slot_t::any_slot(key));
+                if (it == shard.slots.end())
+                    return false;
+                slot = (*it).slot;
             }
             // Export the entry
             byte_t const* punned_vector = reinterpret_cast<byte_t const*>(vectors_lookup_[slot]);
-            bool casted = cast(punned_vector, dimensions(), (byte_t*)reconstructed);
-            if (!casted)
-                std::memcpy(reconstructed, punned_vector, metric_.bytes_per_vector());
+            export_vector(punned_vector, (byte_t*)reconstructed);
             return true;
         } else {
-            shared_lock_t lock(slot_lookup_mutex_);
-            auto equal_range_pair = slot_lookup_.equal_range(key_and_slot_t::any_slot(key));
+            slot_lookup_shard_t const& shard = slot_shard_(key);
+            lookup_shared_lock_t lookup_lock(slot_lookup_mutex_);
+            shared_lock_t lock(shard.mutex);
+            auto equal_range_pair = shard.slots.equal_range(key_and_slot_t::any_slot(key));
             std::size_t count_exported = 0;
             for (auto begin = equal_range_pair.first;
                  begin != equal_range_pair.second && count_exported != vectors_limit; ++begin, ++count_exported) {
@@ -1948,14 +3893,18 @@ class index_dense_gt {
                 compressed_slot_t slot = (*begin).slot;
                 byte_t const* punned_vector = reinterpret_cast<byte_t const*>(vectors_lookup_[slot]);
                 byte_t* reconstructed_vector = (byte_t*)reconstructed + metric_.bytes_per_vector() * count_exported;
-                bool casted = cast(punned_vector, dimensions(), reconstructed_vector);
-                if (!casted)
-                    std::memcpy(reconstructed_vector, punned_vector, metric_.bytes_per_vector());
+                export_vector(punned_vector, reconstructed_vector);
             }
             return count_exported;
         }
     }
 
+    static cast_t const& cast_from_(casts_t const& casts, b1x8_t const*) noexcept { return casts.from_b1x8; }
+    static cast_t const& cast_from_(casts_t const& casts, i8_t const*) noexcept { return casts.from_i8; }
+    static cast_t const& cast_from_(casts_t const& casts, f16_t const*) noexcept { return casts.from_f16; }
+    static cast_t const& cast_from_(casts_t const& casts, f32_t const*) noexcept { return casts.from_f32; }
+    static cast_t const& cast_from_(casts_t const& casts, f64_t const*) noexcept { return casts.from_f64; }
+
     template <typename to_scalar_at> static casts_t make_casts_() {
         casts_t result;
 
@@ -1989,6 +3938,922 @@ class index_dense_gt {
 using index_dense_t = index_dense_gt<>;
 using index_dense_big_t = index_dense_gt<uuid_t, uint40_t>;
 
+/**
+ *  @brief  Horizontally partitioned collection of ::index_dense_gt instances.
+ *
+ *  Every key is routed to exactly one shard by its hash, so the shards stay disjoint and
+ *  all of the single-key operations touch only one of them. Searches fan out to all shards
+ *  through an executor and the sorted per-shard results are merged into a single top-k.
+ *
+ *  Each shard is a complete index with its own graph, entry point, and keys lookup. Shards can
+ *  be saved, loaded, viewed, compacted, or rebuilt one at a time, while the others keep serving.
+ *  Those per-shard operations are not synchronized with searches over the same shard.
+ */
+template <typename key_at = default_key_t, typename compressed_slot_at = default_slot_t> //
+class index_dense_sharded_gt {
+  public:
+    using shard_t = index_dense_gt<key_at, compressed_slot_at>;
+    using vector_key_t = typename shard_t::vector_key_t;
+    using distance_t = typename shard_t::distance_t;
+    using add_result_t = typename shard_t::add_result_t;
+    using labeling_result_t = typename shard_t::labeling_result_t;
+    using compaction_result_t = typename shard_t::compaction_result_t;
+    using serialization_config_t = typename shard_t::serialization_config_t;
+
+    /**
+     *  @brief  Top-k results merged across all shards.
+     *
+     *  Unlike the ::index_gt::search_result_t, it owns the matches and holds no locks,
+     *  as the per-shard results are released right after being merged.
+     */
+    struct search_result_t {
+        std::vector<vector_key_t> keys;
+        std::vector<distance_t> distances;
+
+        /** @brief  Number of search results found. */
+        std::size_t count{};
+        /** @brief  Number of graph nodes traversed, summed across shards. */
+        std::size_t visited_members{};
+        /** @brief  Number of times the distances were computed, summed across shards. */
+        std::size_t computed_distances{};
+        error_t error{};
+
+        explicit operator bool() const noexcept { return !error; }
+        search_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+
+        inline operator std::size_t() const noexcept { return count; }
+        inline std::size_t size() const noexcept { return count; }
+        inline bool empty() const noexcept { return !count; }
+
+        inline std::size_t dump_to(vector_key_t* keys_out, distance_t* distances_out) const noexcept {
+            std::copy_n(keys.data(), count, keys_out);
+            std::copy_n(distances.data(), count, distances_out);
+            return count;
+        }
+        inline std::size_t dump_to(vector_key_t* keys_out) const noexcept {
+            std::copy_n(keys.data(), count, keys_out);
+            return count;
+        }
+        inline bool contains(vector_key_t key) const noexcept {
+            return std::find(keys.begin(), keys.begin() + count, key) != keys.begin() + count;
+        }
+    };
+
+  private:
+    std::vector<shard_t> shards_;
+
+  public:
+    index_dense_sharded_gt() = default;
+    index_dense_sharded_gt(index_dense_sharded_gt&&) = default;
+    index_dense_sharded_gt& operator=(index_dense_sharded_gt&&) = default;
+
+    /**
+     *  @brief Constructs a sharded index, where every shard shares the same metric and configuration.
+     *  @param[in] metric One of the provided or an @b ad-hoc metric, type-punned.
+     *  @param[in] shards_count The number of independent shards, at least one.
+     *  @param[in] config The configuration of every shard (optional).
+     *  @return An instance of ::index_dense_sharded_gt, empty if any of the shards failed to construct.
+     */
+    static index_dense_sharded_gt make(    //
+        metric_punned_t metric,            //
+        std::size_t shards_count,          //
+        index_dense_config_t config = {}) {
+
+        index_dense_sharded_gt result;
+        if (!shards_count)
+            return result;
+        result.shards_.reserve(shards_count);
+        for (std::size_t i = 0; i != shards_count; ++i) {
+            result.shards_.push_back(shard_t::make(metric, config));
+            if (!result.shards_.back())
+                return {};
+        }
+        return result;
+    }
+
+    explicit operator bool() const noexcept { return !shards_.empty(); }
+    std::size_t shards_count() const noexcept { return shards_.size(); }
+    shard_t& shard(std::size_t i) noexcept { return shards_[i]; }
+    shard_t const& shard(std::size_t i) const noexcept { return shards_[i]; }
+
+    /**
+     *  @brief Picks the shard by the high bits of a multiplicative hash, mapped onto the range
+     *         without a division. The multiplier differs from the one of the in-shard keys lookup,
+     *         so that the keys of a single shard still spread across all of its lookup shards.
+     */
+    std::size_t shard_of(vector_key_t key) const noexcept {
+        std::uint64_t hash = static_cast<std::uint64_t>(std::hash<vector_key_t>{}(key)) * 0xC2B2AE3D27D4EB4Full;
+        return static_cast<std::size_t>(((hash >> 32) * static_cast<std::uint64_t>(shards_.size())) >> 32);
+    }
+
+    std::size_t size() const {
+        std::size_t result = 0;
+        for (shard_t const& shard : shards_)
+            result += shard.size();
+        return result;
+    }
+
+    std::size_t capacity() const {
+        std::size_t result = 0;
+        for (shard_t const& shard : shards_)
+            result += shard.capacity();
+        return result;
+    }
+
+    std::size_t memory_usage() const {
+        std::size_t result = 0;
+        for (shard_t const& shard : shards_)
+            result += shard.memory_usage();
+        return result;
+    }
+
+    /**
+     *  @brief Reserves memory in every shard, splitting the members evenly with a margin for the hash skew.
+     *         Each shard gets all the threads, as any thread may insert into any shard.
+     *  @return `true` if the memory reservation was successful in every shard, `false` otherwise.
+     */
+    bool reserve(index_limits_t limits) {
+        index_limits_t shard_limits = limits;
+        std::size_t even = divide_round_up(limits.members, shards_.size());
+        shard_limits.members = (std::min)(limits.members, even + even / 4 + 1);
+        for (shard_t& shard : shards_)
+            if (!shard.reserve(shard_limits))
+                return false;
+        return true;
+    }
+
+    template <typename scalar_at>
+    add_result_t add(vector_key_t key, scalar_at const* vector, std::size_t thread = shard_t::any_thread()) {
+        return shards_[shard_of(key)].add(key, vector, thread);
+    }
+
+    template <typename scalar_at>
+    add_result_t update(vector_key_t key, scalar_at const* vector, std::size_t thread = shard_t::any_thread()) {
+        shard_t& shard = shards_[shard_of(key)];
+
+        // Keep a copy of the old entries to restore them, if the new one can't be added.
+        // Any stored scalar kind round-trips through `f64_t` exactly.
+        std::size_t const dimensions = shard.dimensions();
+        std::size_t const old_count = shard.count(key);
+        std::vector<f64_t> old_vectors(old_count * dimensions);
+        shard.get(key, old_vectors.data(), old_count);
+
+        labeling_result_t removed = shard.remove(key);
+        if (!removed) {
+            add_result_t result;
+            return result.failed(std::move(removed.error));
+        }
+        add_result_t added = shard.add(key, vector, thread);
+        if (!added)
+            for (std::size_t i = 0; i != old_count; ++i)
+                shard.add(key, old_vectors.data() + i * dimensions, thread);
+        return added;
+    }
+
+    template <typename scalar_at> std::size_t get(vector_key_t key, scalar_at* vector, std::size_t count = 1) const {
+        return shards_[shard_of(key)].get(key, vector, count);
+    }
+
+    bool contains(vector_key_t key) const { return shards_[shard_of(key)].contains(key); }
+    std::size_t count(vector_key_t key) const { return shards_[shard_of(key)].count(key); }
+    labeling_result_t remove(vector_key_t key) { return shards_[shard_of(key)].remove(key); }
+
+    /**
+     *  @brief Searches every shard for the closest vectors and merges the results.
+     *  @param[in] vector The query vector.
+     *  @param[in] wanted The number of closest vectors to return.
+     *  @param[in] executor Thread-pool to search the shards in parallel. Default ::dummy_executor_t runs sequentially.
+     *  @return The merged top-k results, sorted by distance, or the error of the first failed shard.
+     */
+    template <typename scalar_at, typename executor_at = dummy_executor_t>
+    search_result_t search(scalar_at const* vector, std::size_t wanted, executor_at&& executor = executor_at{}) const {
+        search_result_t result;
+        std::size_t const shards_count = shards_.size();
+        std::vector<vector_key_t> shards_keys(shards_count * wanted);
+        std::vector<distance_t> shards_distances(shards_count * wanted);
+        std::vector<std::size_t> shards_counts(shards_count);
+        std::vector<std::size_t> visited_members(shards_count), computed_distances(shards_count);
+        std::vector<char const*> errors(shards_count);
+
+        executor.fixed(shards_count, [&](std::size_t, std::size_t shard_idx) {
+            typename shard_t::search_result_t shard_result = shards_[shard_idx].search(vector, wanted);
+            if (!shard_result) {
+                errors[shard_idx] = shard_result.error.release();
+                return;
+            }
+            shards_counts[shard_idx] = shard_result.dump_to( //
+                shards_keys.data() + shard_idx * wanted, shards_distances.data() + shard_idx * wanted);
+            visited_members[shard_idx] = shard_result.visited_members;
+            computed_distances[shard_idx] = shard_result.computed_distances;
+        });
+
+        for (std::size_t shard_idx = 0; shard_idx != shards_count; ++shard_idx) {
+            if (errors[shard_idx])
+                return result.failed(errors[shard_idx]);
+            result.visited_members += visited_members[shard_idx];
+            result.computed_distances += computed_distances[shard_idx];
+        }
+
+        // Every shard's results are already sorted, so a k-way merge over their heads is enough
+        result.keys.resize(wanted);
+        result.distances.resize(wanted);
+        std::vector<std::size_t> cursors(shards_count);
+        for (; result.count != wanted; ++result.count) {
+            std::size_t best_shard = shards_count;
+            for (std::size_t shard_idx = 0; shard_idx != shards_count; ++shard_idx)
+                if (cursors[shard_idx] != shards_counts[shard_idx] &&
+                    (best_shard == shards_count ||
+                     shards_distances[shard_idx * wanted + cursors[shard_idx]] <
+                         shards_distances[best_shard * wanted + cursors[best_shard]]))
+                    best_shard = shard_idx;
+            if (best_shard == shards_count)
+                break;
+            std::size_t offset = best_shard * wanted + cursors[best_shard]++;
+            result.keys[result.count] = shards_keys[offset];
+            result.distances[result.count] = shards_distances[offset];
+        }
+        return result;
+    }
+
+    /**
+     *  @brief Compacts every shard one after another, so only one of them is being rebuilt at a time.
+     *         To compact a single shard, call `shard(i).compact()` directly.
+     */
+    template <typename executor_at = dummy_executor_t>
+    compaction_result_t compact(executor_at&& executor = executor_at{}) {
+        compaction_result_t result;
+        for (shard_t& shard : shards_) {
+            compaction_result_t shard_result = shard.compact(executor);
+            if (!shard_result)
+                return shard_result;
+            result.pruned_edges += shard_result.pruned_edges;
+        }
+        return result;
+    }
+
+    /**
+     *  @brief Saves a single shard into its own file, independent from the other shards.
+     *  @param[in] shard_idx The shard to save, in range `[0, shards_count())`.
+     *  @param[in] file_path The path to the file.
+     */
+    serialization_result_t save_shard(std::size_t shard_idx, char const* file_path,
+                                      serialization_config_t config = {}) const {
+        return shards_[shard_idx].save(file_path, config);
+    }
+
+    /**
+     *  @brief Loads a single shard from its own file, replacing its previous contents.
+     *         The keys in that file must have been routed to the same shard index.
+     */
+    serialization_result_t load_shard(std::size_t shard_idx, char const* file_path,
+                                      serialization_config_t config = {}) {
+        return shards_[shard_idx].load(file_path, config);
+    }
+
+    /**
+     *  @brief Memory-maps a single shard from its own file, without loading it into RAM.
+     *         The keys in that file must have been routed to the same shard index.
+     */
+    serialization_result_t view_shard(std::size_t shard_idx, char const* file_path,
+                                      serialization_config_t config = {}) {
+        return shards_[shard_idx].view(memory_mapped_file_t(file_path), 0, config);
+    }
+};
+
+using index_dense_sharded_t = index_dense_sharded_gt<>;
+
+/**
+ *  @brief  Maps a statically-typed metric kernel, like `metric_cos_gt<f16_t>`, to its punned `metric_kind_t`,
+ *          to be stored in the file headers. Ad-hoc kernels map to `metric_kind_t::unknown_k`.
+ */
+template <typename metric_at> struct metric_kind_of_gt {
+    static constexpr metric_kind_t value = metric_kind_t::unknown_k;
+};
+template <typename scalar_at, typename result_at> struct metric_kind_of_gt<metric_ip_gt<scalar_at, result_at>> {
+    static constexpr metric_kind_t value = metric_kind_t::ip_k;
+};
+template <typename scalar_at, typename result_at> struct metric_kind_of_gt<metric_cos_gt<scalar_at, result_at>> {
+    static constexpr metric_kind_t value = metric_kind_t::cos_k;
+};
+template <typename scalar_at, typename result_at> struct metric_kind_of_gt<metric_l2sq_gt<scalar_at, result_at>> {
+    static constexpr metric_kind_t value = metric_kind_t::l2sq_k;
+};
+template <typename scalar_at, typename result_at> struct metric_kind_of_gt<metric_pearson_gt<scalar_at, result_at>> {
+    static constexpr metric_kind_t value = metric_kind_t::pearson_k;
+};
+template <typename scalar_at, typename result_at>
+struct metric_kind_of_gt<metric_haversine_gt<scalar_at, result_at>> {
+    static constexpr metric_kind_t value = metric_kind_t::haversine_k;
+};
+template <typename scalar_at, typename result_at>
+struct metric_kind_of_gt<metric_divergence_gt<scalar_at, result_at>> {
+    static constexpr metric_kind_t value = metric_kind_t::divergence_k;
+};
+template <typename scalar_at, typename result_at> struct metric_kind_of_gt<metric_hamming_gt<scalar_at, result_at>> {
+    static constexpr metric_kind_t value = metric_kind_t::hamming_k;
+};
+template <typename scalar_at, typename result_at> struct metric_kind_of_gt<metric_tanimoto_gt<scalar_at, result_at>> {
+    static constexpr metric_kind_t value = metric_kind_t::tanimoto_k;
+};
+template <typename scalar_at, typename result_at> struct metric_kind_of_gt<metric_sorensen_gt<scalar_at, result_at>> {
+    static constexpr metric_kind_t value = metric_kind_t::sorensen_k;
+};
+
+/**
+ *  @brief  Dense index specialized at compile-time for a fixed scalar type, metric kernel, and dimensionality.
+ *
+ *  Shares the storage, the keys lookup, and the file format with ::index_dense_gt, which it wraps,
+ *  so files can be exchanged freely between the two. Insertions and searches bypass `metric_punned_t`
+ *  and the `cast_t` conversions, calling the ::metric_at kernel directly with a `constexpr` length,
+ *  so the compiler can inline, unroll, and vectorize the innermost traversal loop.
+ *
+ *  Product quantization and reranking aren't supported, as they need the punned metrics.
+ *
+ *  @tparam scalar_at The type of the stored and queried scalars, like `f16_t` or `f32_t`.
+ *  @tparam metric_at The distance kernel, like `metric_cos_gt<f16_t, f32_t>`, called as `(a, b, scalar_words)`.
+ *  @tparam dimensions_ak The number of dimensions, or bits for `b1x8_t` vectors.
+ */
+template <typename scalar_at, typename metric_at, std::size_t dimensions_ak, //
+          typename key_at = default_key_t, typename compressed_slot_at = default_slot_t>
+class index_dense_typed_gt {
+  public:
+    using dense_t = index_dense_gt<key_at, compressed_slot_at>;
+    using scalar_t = scalar_at;
+    using vector_key_t = typename dense_t::vector_key_t;
+    using distance_t = typename dense_t::distance_t;
+    using add_result_t = typename dense_t::add_result_t;
+    using search_result_t = typename dense_t::search_result_t;
+    using labeling_result_t = typename dense_t::labeling_result_t;
+    using serialization_config_t = typename dense_t::serialization_config_t;
+
+    static constexpr std::size_t dimensions() noexcept { return dimensions_ak; }
+    static constexpr std::size_t scalar_words() noexcept {
+        return std::is_same<scalar_at, b1x8_t>::value ? (dimensions_ak + CHAR_BIT - 1) / CHAR_BIT : dimensions_ak;
+    }
+
+  private:
+    using metric_proxy_t = typename dense_t::template typed_metric_proxy_gt<scalar_at, metric_at, scalar_words()>;
+
+    /// @brief The inputs already match the stored scalars, so no conversions are ever needed.
+    struct no_cast_t {
+        inline bool operator()(byte_t const*, std::size_t, byte_t*) const noexcept { return false; }
+    };
+
+    dense_t dense_;
+
+    /// @brief Checks, if the loaded or viewed contents can be served by this specialization.
+    bool compatible_() const noexcept {
+        metric_punned_t const& metric = dense_.metric();
+        return metric.dimensions() == dimensions_ak && metric.scalar_kind() == scalar_kind<scalar_at>() &&
+               metric.metric_kind() == metric_kind_of_gt<metric_at>::value && //
+               !dense_.quantized() && !dense_.reranked();
+    }
+
+    serialization_result_t check_compatible_(serialization_result_t result) {
+        if (result && !compatible_()) {
+            dense_.reset();
+            return result.failed("The file doesn't match the compile-time index specialization");
+        }
+        return result;
+    }
+
+  public:
+    index_dense_typed_gt() = default;
+    index_dense_typed_gt(index_dense_typed_gt&&) = default;
+    index_dense_typed_gt& operator=(index_dense_typed_gt&&) = default;
+
+    /**
+     *  @brief Constructs an instance of ::index_dense_typed_gt.
+     *  @param[in] config The index configuration (optional).
+     *  @return An instance of ::index_dense_typed_gt.
+     */
+    static index_dense_typed_gt make(index_dense_config_t config = {}) {
+        static_assert(metric_kind_of_gt<metric_at>::value != metric_kind_t::unknown_k,
+                      "Only the built-in metric kernels can be written in the shared file format");
+        index_dense_typed_gt result;
+        metric_punned_t metric(dimensions_ak, metric_kind_of_gt<metric_at>::value, scalar_kind<scalar_at>());
+        result.dense_ = dense_t::make(metric, config);
+        return result;
+    }
+
+    explicit operator bool() const noexcept { return bool(dense_); }
+    dense_t const& dense() const noexcept { return dense_; }
+
+    std::size_t size() const { return dense_.size(); }
+    std::size_t capacity() const { return dense_.capacity(); }
+    std::size_t memory_usage() const { return dense_.memory_usage(); }
+    index_dense_config_t const& config() const { return dense_.config(); }
+    bool reserve(index_limits_t limits) { return dense_.reserve(limits); }
+
+    add_result_t add(vector_key_t key, scalar_t const* vector, std::size_t thread = dense_t::any_thread(),
+                     bool force_vector_copy = true) {
+        return dense_.add_(key, vector, thread, force_vector_copy, no_cast_t{}, metric_proxy_t{dense_});
+    }
+
+    search_result_t search(scalar_t const* vector, std::size_t wanted, std::size_t thread = dense_t::any_thread(),
+                           bool exact = false) const {
+        return dense_.search_(vector, wanted, dummy_predicate_t{}, thread, exact, no_cast_t{}, metric_proxy_t{dense_});
+    }
+
+    template <typename predicate_at>
+    search_result_t filtered_search(scalar_t const* vector, std::size_t wanted, predicate_at&& predicate,
+                                    std::size_t thread = dense_t::any_thread(), bool exact = false) const {
+        return dense_.search_(vector, wanted, std::forward<predicate_at>(predicate), thread, exact, no_cast_t{},
+                              metric_proxy_t{dense_});
+    }
+
+    std::size_t get(vector_key_t key, scalar_t* vector, std::size_t vectors_count = 1) const {
+        return dense_.get(key, vector, vectors_count);
+    }
+    bool contains(vector_key_t key) const { return dense_.contains(key); }
+    std::size_t count(vector_key_t key) const { return dense_.count(key); }
+    labeling_result_t remove(vector_key_t key) { return dense_.remove(key); }
+
+    serialization_result_t save(char const* file_path, serialization_config_t config = {}) const {
+        return dense_.save(file_path, config);
+    }
+    serialization_result_t load(char const* file_path, serialization_config_t config = {}) {
+        return check_compatible_(dense_.load(file_path, config));
+    }
+    serialization_result_t view(char const* file_path, serialization_config_t config = {}) {
+        return check_compatible_(dense_.view(memory_mapped_file_t(file_path), 0, config));
+    }
+};
+
+/**
+ *  @brief  Durable ::index_dense_gt, pairing a full snapshot file with an append-only log
+ *          of the `add`, `remove`, and `rename` operations applied since that snapshot.
+ *
+ *  A `checkpoint` only flushes the log, so its cost grows with the number of changes rather than
+ *  the size of the index. Opening loads the snapshot and replays the log, stopping at the first
+ *  torn or corrupted record left by a crash. A `compact` writes a new snapshot and restarts the
+ *  log empty. It can run from a background thread, with writers only waiting while the snapshot
+ *  is being written.
+ *
+ *  Replay is idempotent: additions overwrite existing entries and renames replace the target.
+ *  So a crash between replacing the snapshot and truncating the log loses nothing. That needs
+ *  unique keys, so multi-key indexes are rejected.
+ */
+template <typename key_at = default_key_t, typename compressed_slot_at = default_slot_t>
+class index_dense_journaled_gt {
+  public:
+    using dense_t = index_dense_gt<key_at, compressed_slot_at>;
+    using vector_key_t = typename dense_t::vector_key_t;
+    using add_result_t = typename dense_t::add_result_t;
+    using search_result_t = typename dense_t::search_result_t;
+    using labeling_result_t = typename dense_t::labeling_result_t;
+
+    enum class operation_t : std::uint8_t {
+        add_k = 1,
+        remove_k = 2,
+        rename_k = 3,
+    };
+
+    /// @brief The log starts with a "usearch-log" magic, followed by the format version and the key size.
+    /// Every record is a blind write of its keys, so replaying a log over any snapshot, taken after some
+    /// prefix of it, reproduces the same contents. Renames carry the moved vector for that reason.
+    static constexpr char const* log_magic() { return "usearch-log"; }
+    static constexpr std::uint8_t log_version() { return 2; }
+    static constexpr std::size_t log_head_bytes() { return 16; }
+
+  private:
+#if defined(USEARCH_DEFINED_CPP17)
+    using shared_mutex_t = std::shared_mutex;
+#else
+    using shared_mutex_t = unfair_shared_mutex_t;
+#endif
+    using shared_lock_t = shared_lock_gt<shared_mutex_t>;
+    using unique_lock_t = std::unique_lock<shared_mutex_t>;
+
+    /// @brief Precedes every record, so that torn writes at the end of the log can be detected.
+    struct record_head_t {
+        std::uint32_t payload_bytes;
+        std::uint32_t checksum;
+    };
+
+    /// @brief Leads the payload of every record, followed by the vector for additions and renames.
+    struct record_payload_t {
+        std::uint8_t operation;
+        std::uint8_t scalar;
+        std::uint8_t reserved[6];
+        vector_key_t key;
+        vector_key_t new_key;
+    };
+
+    static constexpr std::size_t key_stripes() { return 64; }
+
+    /// @brief Non-movable state, kept on the heap so the journaled index itself can be moved.
+    struct journal_t {
+        std::string snapshot_path;
+        std::string log_path;
+        std::FILE* log = nullptr;
+        std::size_t log_bytes = 0;
+        std::size_t snapshot_bytes = 0;
+
+        /// @brief Serializes the appends, so that every record is written contiguously.
+        std::mutex log_mutex;
+        /// @brief Taken in shared mode by writers, and exclusively by compactions.
+        shared_mutex_t snapshot_mutex;
+        /// @brief Per-key locks, making the log order of operations on the same key match their order in the index.
+        std::mutex key_mutexes[key_stripes()];
+
+        ~journal_t() noexcept {
+            if (log)
+                std::fclose(log);
+        }
+    };
+
+    dense_t dense_;
+    std::unique_ptr<journal_t> journal_;
+
+    /// @brief FNV-1a hash of the payload, cheap enough to compute on every append.
+    static std::uint32_t checksum_(byte_t const* data, std::size_t length) noexcept {
+        std::uint32_t hash = 2166136261u;
+        for (std::size_t i = 0; i != length; ++i)
+            hash = (hash ^ static_cast<std::uint8_t>(data[i])) * 16777619u;
+        return hash;
+    }
+
+    std::size_t vector_bytes_(scalar_kind_t scalar) const noexcept {
+        return divide_round_up<CHAR_BIT>(dense_.dimensions() * bits_per_scalar(scalar));
+    }
+
+    /// @brief Flushes a file or a directory to disk, so that its contents or entries survive a power loss.
+    static bool sync_path_(char const* path) noexcept {
+#if defined(USEARCH_DEFINED_WINDOWS)
+        (void)path;
+        return true;
+#else
+        int descriptor = ::open(path, O_RDONLY);
+        if (descriptor < 0)
+            return false;
+        bool synced = ::fsync(descriptor) == 0;
+        ::close(descriptor);
+        return synced;
+#endif
+    }
+
+    /// @brief Directory containing the ::path, which holds the entries of the snapshot and the log.
+    static std::string directory_of_(std::string const& path) {
+        std::size_t separator = path.find_last_of("/\\");
+        if (separator == std::string::npos)
+            return ".";
+        return separator ? path.substr(0, separator) : path.substr(0, 1);
+    }
+
+    std::mutex& key_mutex_(vector_key_t key) const noexcept {
+        std::uint64_t hash = static_cast<std::uint64_t>(std::hash<vector_key_t>{}(key)) * 0x9E3779B97F4A7C15ull;
+        return journal_->key_mutexes[hash >> 58];
+    }
+
+    serialization_result_t append_(operation_t operation, vector_key_t key, vector_key_t new_key = {},
+                                   scalar_kind_t scalar = scalar_kind_t::unknown_k, void const* vector = nullptr) {
+        serialization_result_t result;
+        std::size_t vector_bytes = vector ? vector_bytes_(scalar) : 0;
+        std::vector<byte_t> record(sizeof(record_head_t) + sizeof(record_payload_t) + vector_bytes);
+        record_payload_t payload{};
+        payload.operation = static_cast<std::uint8_t>(operation);
+        payload.scalar = static_cast<std::uint8_t>(scalar);
+        payload.key = key;
+        payload.new_key = new_key;
+        std::memcpy(record.data() + sizeof(record_head_t), &payload, sizeof(payload));
+        if (vector_bytes)
+            std::memcpy(record.data() + sizeof(record_head_t) + sizeof(payload), vector, vector_bytes);
+        record_head_t head;
+        head.payload_bytes = static_cast<std::uint32_t>(record.size() - sizeof(record_head_t));
+        head.checksum = checksum_(record.data() + sizeof(record_head_t), head.payload_bytes);
+        std::memcpy(record.data(), &head, sizeof(head));
+
+        std::unique_lock<std::mutex> lock(journal_->log_mutex);
+        if (!journal_->log || std::fwrite(record.data(), record.size(), 1, journal_->log) != 1)
+            return result.failed("Failed to append to the log");
+        journal_->log_bytes += record.size();
+        return result;
+    }
+
+    /// @brief Truncates the log, leaving just its head.
+    serialization_result_t restart_log_() {
+        serialization_result_t result;
+        std::unique_lock<std::mutex> lock(journal_->log_mutex);
+        if (journal_->log)
+            std::fclose(exchange(journal_->log, nullptr));
+        journal_->log = std::fopen(journal_->log_path.c_str(), "wb");
+        if (!journal_->log)
+            return result.failed(std::strerror(errno));
+        byte_t head[log_head_bytes()] = {};
+        std::memcpy(head, log_magic(), std::strlen(log_magic()));
+        head[12] = static_cast<byte_t>(log_version());
+        head[13] = static_cast<byte_t>(sizeof(vector_key_t));
+        if (std::fwrite(head, sizeof(head), 1, journal_->log) != 1 || std::fflush(journal_->log) != 0)
+            return result.failed(std::strerror(errno));
+        journal_->log_bytes = 0;
+        return result;
+    }
+
+    template <typename scalar_at> serialization_result_t replay_add_(vector_key_t key, byte_t const* vector) {
+        serialization_result_t result;
+        std::vector<scalar_at> aligned(vector_bytes_(scalar_kind<scalar_at>()) / sizeof(scalar_at));
+        std::memcpy(aligned.data(), vector, aligned.size() * sizeof(scalar_at));
+        if (dense_.size() >= dense_.capacity() && !dense_.reserve(ceil2(dense_.size() + 1)))
+            return result.failed("Out of memory!");
+        add_result_t added = dense_.add(key, aligned.data());
+        if (!added)
+            return result.failed(added.error.release());
+        return result;
+    }
+
+    /**
+     *  @brief  Replays the log on top of the loaded snapshot.
+     *  @param[out] exists Set if the log file exists, even if it is empty.
+     *  @param[out] torn Set if the log ends with an incomplete or corrupted record.
+     *  @return Error, if the log header doesn't match or a complete record can't be applied.
+     */
+    serialization_result_t replay_(bool& exists, bool& torn) {
+        serialization_result_t result;
+        torn = false;
+        std::FILE* file = std::fopen(journal_->log_path.c_str(), "rb");
+        exists = file != nullptr;
+        if (!file)
+            return result;
+
+        byte_t head[log_head_bytes()];
+        if (std::fread(head, sizeof(head), 1, file) != 1) {
+            torn = true;
+            std::fclose(file);
+            return result;
+        }
+        if (std::memcmp(head, log_magic(), std::strlen(log_magic())) != 0 ||
+            static_cast<std::uint8_t>(head[12]) != log_version() || head[13] != sizeof(vector_key_t)) {
+            std::fclose(file);
+            return result.failed("Log header mismatch - the file isn't a compatible log");
+        }
+
+        std::vector<byte_t> payload;
+        record_head_t record;
+        while (std::fread(&record, sizeof(record), 1, file) == 1) {
+            payload.resize(record.payload_bytes);
+            if (record.payload_bytes < sizeof(record_payload_t) ||
+                std::fread(payload.data(), payload.size(), 1, file) != 1 ||
+                checksum_(payload.data(), payload.size()) != record.checksum) {
+                torn = true;
+                break;
+            }
+
+            record_payload_t fields;
+            std::memcpy(&fields, payload.data(), sizeof(fields));
+            byte_t const* vector = payload.data() + sizeof(fields);
+            scalar_kind_t scalar = static_cast<scalar_kind_t>(fields.scalar);
+            serialization_result_t replayed;
+            switch (static_cast<operation_t>(fields.operation)) {
+            case operation_t::add_k:
+                if (payload.size() != sizeof(fields) + vector_bytes_(scalar)) {
+                    torn = true;
+                    break;
+                }
+                dense_.remove(fields.key).error.release();
+                switch (scalar) {
+                case scalar_kind_t::b1x8_k: replayed = replay_add_<b1x8_t>(fields.key, vector); break;
+                case scalar_kind_t::i8_k: replayed = replay_add_<i8_t>(fields.key, vector); break;
+                case scalar_kind_t::f16_k: replayed = replay_add_<f16_t>(fields.key, vector); break;
+                case scalar_kind_t::f32_k: replayed = replay_add_<f32_t>(fields.key, vector); break;
+                case scalar_kind_t::f64_k: replayed = replay_add_<f64_t>(fields.key, vector); break;
+                default: torn = true; break;
+                }
+                break;
+            case operation_t::remove_k: dense_.remove(fields.key).error.release(); break;
+            case operation_t::rename_k:
+                if (scalar != scalar_kind_t::f64_k || payload.size() != sizeof(fields) + vector_bytes_(scalar)) {
+                    torn = true;
+                    break;
+                }
+                // The snapshot may already reflect this rename and even later additions under the old key
+                dense_.remove(fields.key).error.release();
+                dense_.remove(fields.new_key).error.release();
+                replayed = replay_add_<f64_t>(fields.new_key, vector);
+                break;
+            default: torn = true; break;
+            }
+            if (!replayed) {
+                std::fclose(file);
+                return replayed;
+            }
+            if (torn)
+                break;
+            journal_->log_bytes += sizeof(record) + payload.size();
+        }
+
+        // Anything left after the last complete record is a torn write
+        long consumed = std::ftell(file);
+        torn = torn || consumed < 0 || static_cast<std::size_t>(consumed) != log_head_bytes() + journal_->log_bytes;
+        std::fclose(file);
+        return result;
+    }
+
+  public:
+    index_dense_journaled_gt() = default;
+    index_dense_journaled_gt(index_dense_journaled_gt&&) = default;
+    index_dense_journaled_gt& operator=(index_dense_journaled_gt&&) = default;
+
+    /**
+     *  @brief Constructs an instance of ::index_dense_journaled_gt, yet to be `open`-ed.
+     *  @param[in] metric One of the provided or an @b ad-hoc metric, type-punned.
+     *  @param[in] config The index configuration, that must not allow multiple vectors per key (optional).
+     *  @return An instance of ::index_dense_journaled_gt, empty on failure.
+     */
+    static index_dense_journaled_gt make(metric_punned_t metric, index_dense_config_t config = {}) {
+        index_dense_journaled_gt result;
+        if (config.multi)
+            return result;
+        result.dense_ = dense_t::make(metric, config);
+        if (result.dense_)
+            result.journal_.reset(new journal_t);
+        return result;
+    }
+
+    explicit operator bool() const noexcept { return journal_ != nullptr; }
+    dense_t const& dense() const noexcept { return dense_; }
+
+    /// @brief Bytes of records in the log since the last snapshot, the cost of the next replay.
+    std::size_t log_bytes() const noexcept { return journal_->log_bytes; }
+    std::size_t snapshot_bytes() const noexcept { return journal_->snapshot_bytes; }
+
+    /**
+     *  @brief Suggests a compaction, once replaying the log may become comparable to reading the snapshot.
+     *  @param[in] ratio The fraction of the snapshot size, the log may grow to.
+     */
+    bool should_compact(double ratio = 0.5) const noexcept {
+        return static_cast<double>(journal_->log_bytes) > ratio * static_cast<double>(journal_->snapshot_bytes);
+    }
+
+    /**
+     *  @brief  Loads the snapshot, if it exists, replays the log, and starts appending to it.
+     *          A log with a torn tail is compacted right away, so new records never follow garbage.
+     *          A complete record, that can't be applied, fails the whole call and leaves the log untouched.
+     *  @param[in] executor Thread-pool used to load and, if needed, compact the snapshot in parallel.
+     */
+    template <typename executor_at = dummy_executor_t>
+    serialization_result_t open(char const* snapshot_path, char const* log_path, executor_at&& executor = {}) {
+        serialization_result_t result;
+        journal_->snapshot_path = snapshot_path;
+        journal_->log_path = log_path;
+        journal_->log_bytes = 0;
+        journal_->snapshot_bytes = 0;
+
+        if (std::FILE* snapshot = std::fopen(snapshot_path, "rb")) {
+            std::fclose(snapshot);
+            result = dense_.load(snapshot_path, {}, dummy_progress_t{}, executor);
+            if (!result)
+                return result;
+            if (dense_.multi()) {
+                dense_.reset();
+                return result.failed("Journaling requires unique keys");
+            }
+            journal_->snapshot_bytes = dense_.serialized_length();
+        }
+
+        bool exists = false, torn = false;
+        result = replay_(exists, torn);
+        if (!result)
+            return result;
+        if (torn)
+            return compact(executor);
+        if (!exists)
+            return restart_log_();
+
+        std::unique_lock<std::mutex> lock(journal_->log_mutex);
+        journal_->log = std::fopen(log_path, "ab");
+        if (!journal_->log)
+            return result.failed(std::strerror(errno));
+        return result;
+    }
+
+    /**
+     *  @brief  Makes all the logged operations durable, flushing the log to disk.
+     *          Costs O(changes) since the previous checkpoint, instead of O(index size) of `save`.
+     */
+    serialization_result_t checkpoint() {
+        serialization_result_t result;
+        std::unique_lock<std::mutex> lock(journal_->log_mutex);
+        if (!journal_->log || std::fflush(journal_->log) != 0)
+            return result.failed("Failed to flush the log");
+#if !defined(USEARCH_DEFINED_WINDOWS)
+        if (::fsync(fileno(journal_->log)) != 0)
+            return result.failed(std::strerror(errno));
+#endif
+        return result;
+    }
+
+    /**
+     *  @brief  Writes a new snapshot next to the current one, atomically replaces it, and restarts the log.
+     *          May be called periodically from a background thread, concurrent writers wait
+     *          only for its duration, while readers aren't blocked at all.
+     *  @param[in] executor Thread-pool used to write the snapshot in parallel.
+     */
+    template <typename executor_at = dummy_executor_t> serialization_result_t compact(executor_at&& executor = {}) {
+        unique_lock_t lock(journal_->snapshot_mutex);
+        std::string temporary_path = journal_->snapshot_path + ".tmp";
+        serialization_result_t result = dense_.save(temporary_path.c_str(), {}, dummy_progress_t{}, executor);
+        if (!result)
+            return result;
+
+        // The new snapshot must be on disk before it replaces the old one, and the rename before the log is lost
+        if (!sync_path_(temporary_path.c_str()))
+            return result.failed(std::strerror(errno));
+#if defined(USEARCH_DEFINED_WINDOWS)
+        std::remove(journal_->snapshot_path.c_str());
+#endif
+        if (std::rename(temporary_path.c_str(), journal_->snapshot_path.c_str()) != 0)
+            return result.failed(std::strerror(errno));
+        if (!sync_path_(directory_of_(journal_->snapshot_path).c_str()))
+            return result.failed(std::strerror(errno));
+        journal_->snapshot_bytes = dense_.serialized_length();
+        return restart_log_();
+    }
+
+    std::size_t size() const { return dense_.size(); }
+    std::size_t capacity() const { return dense_.capacity(); }
+    std::size_t memory_usage() const { return dense_.memory_usage(); }
+    index_dense_config_t const& config() const { return dense_.config(); }
+    bool reserve(index_limits_t limits) { return dense_.reserve(limits); }
+
+    template <typename scalar_at>
+    add_result_t add(vector_key_t key, scalar_at const* vector, std::size_t thread = dense_t::any_thread()) {
+        shared_lock_t snapshot_lock(journal_->snapshot_mutex);
+        std::unique_lock<std::mutex> key_lock(key_mutex_(key));
+        add_result_t result = dense_.add(key, vector, thread);
+        if (!result)
+            return result;
+
+        // Roll back, if the log can't be appended, so that the index never diverges from its log
+        serialization_result_t logged = append_(operation_t::add_k, key, {}, scalar_kind<scalar_at>(), vector);
+        if (!logged) {
+            dense_.remove(key).error.release();
+            return result.failed(logged.error.release());
+        }
+        return result;
+    }
+
+    labeling_result_t remove(vector_key_t key) {
+        shared_lock_t snapshot_lock(journal_->snapshot_mutex);
+        std::unique_lock<std::mutex> key_lock(key_mutex_(key));
+        std::vector<f64_t> removed(dense_.dimensions());
+        dense_.get(key, removed.data());
+        labeling_result_t result = dense_.remove(key);
+        if (!result || !result.completed)
+            return result;
+
+        // Roll back, if the log can't be appended, restoring the exact copy of the removed vector
+        serialization_result_t logged = append_(operation_t::remove_k, key);
+        if (!logged) {
+            dense_.add(key, removed.data()).error.release();
+            return result.failed(logged.error.release());
+        }
+        return result;
+    }
+
+    labeling_result_t rename(vector_key_t from, vector_key_t to) {
+        shared_lock_t snapshot_lock(journal_->snapshot_mutex);
+        std::mutex* first = &key_mutex_(from);
+        std::mutex* second = &key_mutex_(to);
+        if (first > second)
+            std::swap(first, second);
+        std::unique_lock<std::mutex> first_lock(*first);
+        std::unique_lock<std::mutex> second_lock;
+        if (second != first)
+            second_lock = std::unique_lock<std::mutex>(*second);
+        std::vector<f64_t> moved(dense_.dimensions());
+        dense_.get(from, moved.data());
+        labeling_result_t result = dense_.rename(from, to);
+        if (!result || !result.completed)
+            return result;
+
+        // Roll back, if the log can't be appended
+        serialization_result_t logged = append_(operation_t::rename_k, from, to, scalar_kind_t::f64_k, moved.data());
+        if (!logged) {
+            dense_.rename(to, from).error.release();
+            return result.failed(logged.error.release());
+        }
+        return result;
+    }
+
+    template <typename scalar_at>
+    search_result_t search(scalar_at const* vector, std::size_t wanted, std::size_t thread = dense_t::any_thread(),
+                           bool exact = false) const {
+        return dense_.search(vector, wanted, thread, exact);
+    }
+
+    template <typename scalar_at> std::size_t get(vector_key_t key, scalar_at* vector, std::size_t count = 1) const {
+        return dense_.get(key, vector, count);
+    }
+    bool contains(vector_key_t key) const { return dense_.contains(key); }
+    std::size_t count(vector_key_t key) const { return dense_.count(key); }
+};
+
+using index_dense_journaled_t = index_dense_journaled_gt<>;
+
 /**
  *  @brief  Adapts the Male-Optimal Stable Marriage algorithm for unequal sets
  *          to perform fast one-to-one matching between two large collections
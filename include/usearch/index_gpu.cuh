@@ -0,0 +1,449 @@
+/**
+ *  @file       index_gpu.cuh
+ *  @author     Ash Vardanian
+ *  @brief      Optional CUDA backend, offloading the `exact_search_t` to a GPU.
+ *  @date       October 14, 2026
+ *
+ *  Compiled with NVCC against the CUDA runtime.
+ *  The dataset stays in host memory and is streamed through double-buffered pinned staging,
+ *  so it doesn't have to fit into the device memory.
+ */
+#pragma once
+#include <cfloat>  // `FLT_MAX`
+#include <cstring> // `std::memcpy`
+
+#include <usearch/index_plugins.hpp>
+
+#include <cuda_runtime.h>
+
+namespace unum {
+namespace usearch {
+
+using gpu_error_t = cudaError_t;
+using gpu_stream_t = cudaStream_t;
+using gpu_event_t = cudaEvent_t;
+
+/**
+ *  @brief Inserts into an ascending list of at most `limit` entries, keeping equal distances in arrival order.
+ */
+__device__ inline void gpu_insert_bounded( //
+    exact_offset_and_distance_t* elements, unsigned& size, unsigned limit, exact_offset_and_distance_t element) {
+    if (size == limit && !(element.distance < elements[size - 1].distance))
+        return;
+    unsigned slot = size - (size == limit);
+    for (; slot && element.distance < elements[slot - 1].distance; --slot)
+        elements[slot] = elements[slot - 1];
+    elements[slot] = element;
+    size += size != limit;
+}
+
+/**
+ *  @brief Squared norms of `count` row-major vectors, reused by every tile of `l2sq` and `cos` distances.
+ */
+template <typename scalar_at>
+__global__ void gpu_squared_norms_kernel( //
+    scalar_at const* vectors, std::size_t count, std::size_t dimensions, scalar_at* norms) {
+    std::size_t idx = std::size_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (idx >= count)
+        return;
+    scalar_at const* vector = vectors + idx * dimensions;
+    scalar_at sum = 0;
+    for (std::size_t i = 0; i != dimensions; ++i)
+        sum += vector[i] * vector[i];
+    norms[idx] = sum;
+}
+
+/**
+ *  @brief  Tiled GEMM-style kernel, computing the dot-products of a block of queries and a chunk of the dataset,
+ *          staging square tiles of both in shared memory, and converting them into distances on the fly.
+ *          The output is row-major, with `dataset_count` distances per query.
+ */
+template <unsigned tile_ak>
+__global__ void gpu_distances_kernel(                                                       //
+    float const* queries, float const* queries_norms, std::size_t queries_count,            //
+    float const* dataset, float const* dataset_norms, std::size_t dataset_count,            //
+    std::size_t dimensions, metric_kind_t metric_kind, float* distances) {
+
+    __shared__ float queries_tile[tile_ak][tile_ak];
+    __shared__ float dataset_tile[tile_ak][tile_ak + 1]; //< Padded to avoid bank conflicts on transposed reads
+
+    std::size_t query_idx = std::size_t(blockIdx.y) * tile_ak + threadIdx.y;
+    std::size_t dataset_idx = std::size_t(blockIdx.x) * tile_ak + threadIdx.x;
+    std::size_t dataset_row = std::size_t(blockIdx.x) * tile_ak + threadIdx.y;
+
+    float dot = 0;
+    for (std::size_t offset = 0; offset < dimensions; offset += tile_ak) {
+        std::size_t column = offset + threadIdx.x;
+        bool in_column = column < dimensions;
+        queries_tile[threadIdx.y][threadIdx.x] =
+            query_idx < queries_count && in_column ? queries[query_idx * dimensions + column] : 0.f;
+        dataset_tile[threadIdx.y][threadIdx.x] =
+            dataset_row < dataset_count && in_column ? dataset[dataset_row * dimensions + column] : 0.f;
+        __syncthreads();
+        for (unsigned i = 0; i != tile_ak; ++i)
+            dot += queries_tile[threadIdx.y][i] * dataset_tile[threadIdx.x][i];
+        __syncthreads();
+    }
+
+    if (query_idx >= queries_count || dataset_idx >= dataset_count)
+        return;
+
+    // Match the semantics of `metric_l2sq_gt`, `metric_ip_gt`, and `metric_cos_gt`
+    float distance;
+    switch (metric_kind) {
+    case metric_kind_t::l2sq_k:
+        distance = fmaxf(queries_norms[query_idx] + dataset_norms[dataset_idx] - 2 * dot, 0.f);
+        break;
+    case metric_kind_t::ip_k: distance = 1 - dot; break;
+    default: {
+        float query_norm = queries_norms[query_idx], dataset_norm = dataset_norms[dataset_idx];
+        distance = query_norm == 0 && dataset_norm == 0 ? 0.f
+                   : query_norm == 0 || dataset_norm == 0 ? 1.f
+                                                          : 1 - dot / (sqrtf(query_norm) * sqrtf(dataset_norm));
+    } break;
+    }
+    distances[query_idx * dataset_count + dataset_idx] = distance;
+}
+
+/**
+ *  @brief  On-device top-k selection, merging a row of distances into the running results of every query.
+ *          Each of the `threads_ak` threads keeps a sorted list over a strided slice of the row,
+ *          and the lists are merged pairwise in shared memory, so only `wanted` entries leave the device.
+ */
+template <unsigned threads_ak, unsigned wanted_limit_ak>
+__global__ void gpu_select_kernel(                                                       //
+    float const* distances, std::size_t dataset_count, std::size_t dataset_offset,       //
+    unsigned wanted, exact_offset_and_distance_t* results) {
+
+    __shared__ exact_offset_and_distance_t lists[threads_ak][wanted_limit_ak];
+    __shared__ unsigned sizes[threads_ak];
+
+    unsigned thread_idx = threadIdx.x;
+    float const* row = distances + std::size_t(blockIdx.x) * dataset_count;
+    exact_offset_and_distance_t* top = results + std::size_t(blockIdx.x) * wanted;
+
+    exact_offset_and_distance_t local[wanted_limit_ak];
+    unsigned size = 0;
+
+    // The first thread carries over the results of the previous chunks, skipping the padding
+    if (thread_idx == 0)
+        for (unsigned i = 0; i != wanted && top[i].offset != 0xFFFFFFFFu; ++i)
+            gpu_insert_bounded(local, size, wanted, top[i]);
+    for (std::size_t i = thread_idx; i < dataset_count; i += threads_ak) {
+        exact_offset_and_distance_t candidate;
+        candidate.offset = static_cast<u32_t>(dataset_offset + i);
+        candidate.distance = row[i];
+        gpu_insert_bounded(local, size, wanted, candidate);
+    }
+    for (unsigned i = 0; i != size; ++i)
+        lists[thread_idx][i] = local[i];
+    sizes[thread_idx] = size;
+    __syncthreads();
+
+    // Merge pairs of neighboring lists, halving the number of lists on every step
+    for (unsigned step = 1; step < threads_ak; step *= 2) {
+        if (thread_idx % (2 * step) == 0) {
+            exact_offset_and_distance_t const* first = lists[thread_idx];
+            exact_offset_and_distance_t const* second = lists[thread_idx + step];
+            unsigned first_size = sizes[thread_idx], second_size = sizes[thread_idx + step];
+            unsigned i = 0, j = 0;
+            for (size = 0; size != wanted && (i != first_size || j != second_size); ++size)
+                local[size] = j == second_size || (i != first_size && !(second[j].distance < first[i].distance))
+                                  ? first[i++]
+                                  : second[j++];
+            for (unsigned k = 0; k != size; ++k)
+                lists[thread_idx][k] = local[k];
+            sizes[thread_idx] = size;
+        }
+        __syncthreads();
+    }
+
+    if (thread_idx != 0)
+        return;
+    for (unsigned i = 0; i != wanted; ++i) {
+        bool present = i < sizes[0];
+        top[i].offset = present ? lists[0][i].offset : 0xFFFFFFFFu;
+        top[i].distance = present ? lists[0][i].distance : FLT_MAX;
+    }
+}
+
+template <typename result_at> __global__ void gpu_results_reset_kernel(result_at* results, std::size_t count) {
+    std::size_t idx = std::size_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (idx >= count)
+        return;
+    results[idx].offset = 0xFFFFFFFFu;
+    results[idx].distance = FLT_MAX;
+}
+
+/**
+ *  @brief  GPU backend for the `exact_search_t`, attached with `exact_search_t::change_device(gpu.device())`.
+ *          Supports the built-in `l2sq`, `ip`, and `cos` metrics over `f32` vectors, staging the next chunk
+ *          on the host, while the previous one is being processed on the device.
+ *          Declines everything else, like `f16`, `i8`, binary, or double-precision vectors, user-defined metrics,
+ *          or more than `wanted_limit()` results, leaving those to the CPU.
+ *
+ *  If no device is present, `device()` returns an empty hook, and every search runs on the CPU.
+ *  A single instance must not be used from multiple threads concurrently.
+ */
+class gpu_exact_search_t {
+
+    /// @brief Side of the square tiles of the distances kernel.
+    static constexpr unsigned tile_side() { return 16; }
+    /// @brief Number of threads selecting the top-k of every query.
+    static constexpr unsigned select_threads() { return 64; }
+    /// @brief Number of dataset vectors staged and uploaded at once.
+    static constexpr std::size_t chunk_vectors() { return 8192; }
+    /// @brief Number of queries resident on the device, while the whole dataset is streamed past them.
+    static constexpr std::size_t queries_batch() { return 16384; }
+    /// @brief Number of queries compared with a chunk in a single distances tile, bounding its size.
+    static constexpr std::size_t queries_block() { return 1024; }
+
+    int device_ = -1;
+    gpu_stream_t copy_stream_ = nullptr;
+    gpu_stream_t compute_stream_ = nullptr;
+    gpu_event_t uploaded_[2] = {};
+    gpu_event_t consumed_[2] = {};
+
+    std::size_t dimensions_capacity_ = 0;
+    float* staging_[2] = {};       //< Pinned host memory
+    float* dataset_[2] = {};       //< Device memory from here on
+    float* dataset_norms_[2] = {};
+    float* queries_ = nullptr;
+    float* queries_norms_ = nullptr;
+    float* distances_ = nullptr;
+    exact_offset_and_distance_t* results_ = nullptr;
+
+    static bool ok(gpu_error_t error) noexcept { return error == cudaSuccess; }
+
+    static bool search_(                                                                   //
+        void* state, metric_punned_t const& metric,                                        //
+        byte_t const* dataset_data, std::size_t dataset_count, std::size_t dataset_stride, //
+        byte_t const* queries_data, std::size_t queries_count, std::size_t queries_stride, //
+        std::size_t wanted, exact_offset_and_distance_t* results) {
+        return static_cast<gpu_exact_search_t*>(state)->search(     //
+            metric, dataset_data, dataset_count, dataset_stride,    //
+            queries_data, queries_count, queries_stride, wanted, results);
+    }
+
+    /// @brief Packs `count` strided `f32` vectors into contiguous rows.
+    static void pack_( //
+        byte_t const* data, std::size_t count, std::size_t stride, std::size_t dimensions, float* output) noexcept {
+        for (std::size_t row = 0; row != count; ++row, data += stride, output += dimensions)
+            std::memcpy(output, data, dimensions * sizeof(float));
+    }
+
+    void release_buffers_() noexcept {
+        for (std::size_t slot = 0; slot != 2; ++slot) {
+            if (staging_[slot])
+                cudaFreeHost(staging_[slot]);
+            if (dataset_[slot])
+                cudaFree(dataset_[slot]);
+            if (dataset_norms_[slot])
+                cudaFree(dataset_norms_[slot]);
+            staging_[slot] = dataset_[slot] = dataset_norms_[slot] = nullptr;
+        }
+        if (queries_)
+            cudaFree(queries_);
+        if (queries_norms_)
+            cudaFree(queries_norms_);
+        if (distances_)
+            cudaFree(distances_);
+        if (results_)
+            cudaFree(results_);
+        queries_ = queries_norms_ = distances_ = nullptr;
+        results_ = nullptr;
+        dimensions_capacity_ = 0;
+    }
+
+    /// @brief Allocates the buffers for vectors of up to `dimensions` scalars, independent of the dataset size.
+    bool reserve_(std::size_t dimensions) noexcept {
+        if (dimensions <= dimensions_capacity_)
+            return true;
+        release_buffers_();
+        bool allocated = true;
+        for (std::size_t slot = 0; slot != 2; ++slot) {
+            allocated =
+                allocated && ok(cudaMallocHost((void**)&staging_[slot], chunk_vectors() * dimensions * sizeof(float)));
+            allocated = allocated &&
+                        ok(cudaMalloc((void**)&dataset_[slot], chunk_vectors() * dimensions * sizeof(float)));
+            allocated =
+                allocated && ok(cudaMalloc((void**)&dataset_norms_[slot], chunk_vectors() * sizeof(float)));
+        }
+        allocated =
+            allocated && ok(cudaMalloc((void**)&queries_, queries_batch() * dimensions * sizeof(float)));
+        allocated = allocated && ok(cudaMalloc((void**)&queries_norms_, queries_batch() * sizeof(float)));
+        allocated =
+            allocated && ok(cudaMalloc((void**)&distances_, queries_block() * chunk_vectors() * sizeof(float)));
+        allocated = allocated && ok(cudaMalloc((void**)&results_,
+                                               queries_batch() * wanted_limit() * sizeof(exact_offset_and_distance_t)));
+        if (!allocated) {
+            release_buffers_();
+            return false;
+        }
+        dimensions_capacity_ = dimensions;
+        return true;
+    }
+
+    /// @brief Uploads a batch of queries through the first staging buffer, computing their norms.
+    bool upload_queries_( //
+        byte_t const* queries_data, std::size_t queries_count, std::size_t queries_stride,
+        std::size_t dimensions) noexcept {
+        for (std::size_t begin = 0; begin < queries_count; begin += chunk_vectors()) {
+            std::size_t count = (std::min)(queries_count - begin, chunk_vectors());
+            pack_(queries_data + begin * queries_stride, count, queries_stride, dimensions, staging_[0]);
+            if (!ok(cudaMemcpyAsync(queries_ + begin * dimensions, staging_[0], count * dimensions * sizeof(float),
+                                    cudaMemcpyHostToDevice, copy_stream_)) ||
+                !ok(cudaStreamSynchronize(copy_stream_)))
+                return false;
+        }
+        gpu_squared_norms_kernel<<<divide_round_up<256>(queries_count), 256, 0, compute_stream_>>>( //
+            queries_, queries_count, dimensions, queries_norms_);
+        return true;
+    }
+
+  public:
+    /// @brief Maximum number of results per query, selected on the device.
+    static constexpr std::size_t wanted_limit() { return 64; }
+
+    /**
+     *  @brief Attaches to the given device, if present, or stays disabled otherwise.
+     */
+    explicit gpu_exact_search_t(int device = 0) noexcept {
+        int devices_count = 0;
+        if (!ok(cudaGetDeviceCount(&devices_count)) || device < 0 || device >= devices_count) {
+            cudaGetLastError(); //< Reset the sticky error of a missing driver
+            return;
+        }
+        bool created = ok(cudaSetDevice(device)) &&           //
+                       ok(cudaStreamCreate(&copy_stream_)) && //
+                       ok(cudaStreamCreate(&compute_stream_));  //
+        for (std::size_t slot = 0; slot != 2; ++slot)
+            created = created && ok(cudaEventCreate(&uploaded_[slot])) && ok(cudaEventCreate(&consumed_[slot]));
+        device_ = device;
+        if (!created)
+            reset();
+    }
+
+    ~gpu_exact_search_t() noexcept { reset(); }
+    gpu_exact_search_t(gpu_exact_search_t const&) = delete;
+    gpu_exact_search_t& operator=(gpu_exact_search_t const&) = delete;
+
+    /// @brief Releases all the device resources, disabling the backend.
+    void reset() noexcept {
+        if (device_ < 0)
+            return;
+        cudaSetDevice(device_);
+        release_buffers_();
+        for (std::size_t slot = 0; slot != 2; ++slot) {
+            if (uploaded_[slot])
+                cudaEventDestroy(uploaded_[slot]);
+            if (consumed_[slot])
+                cudaEventDestroy(consumed_[slot]);
+            uploaded_[slot] = consumed_[slot] = nullptr;
+        }
+        if (copy_stream_)
+            cudaStreamDestroy(copy_stream_);
+        if (compute_stream_)
+            cudaStreamDestroy(compute_stream_);
+        copy_stream_ = compute_stream_ = nullptr;
+        device_ = -1;
+    }
+
+    explicit operator bool() const noexcept { return device_ >= 0; }
+
+    /// @brief Type-punned hook for `exact_search_t`, empty if no device is present.
+    exact_search_device_t device() noexcept {
+        exact_search_device_t hook;
+        if (device_ >= 0)
+            hook.search = &gpu_exact_search_t::search_, hook.state = this;
+        return hook;
+    }
+
+    /**
+     *  @brief Finds the `wanted` closest dataset vectors for every query, like `exact_search_t`.
+     *  @return `false` if the request isn't supported or the device failed, so the CPU path must be used.
+     */
+    bool search(                                                                           //
+        metric_punned_t const& metric,                                                     //
+        byte_t const* dataset_data, std::size_t dataset_count, std::size_t dataset_stride, //
+        byte_t const* queries_data, std::size_t queries_count, std::size_t queries_stride, //
+        std::size_t wanted, exact_offset_and_distance_t* results) noexcept {
+
+        if (device_ < 0 || !metric.is_builtin() || !wanted || wanted > wanted_limit())
+            return false;
+        switch (metric.metric_kind()) {
+        case metric_kind_t::l2sq_k:
+        case metric_kind_t::ip_k:
+        case metric_kind_t::cos_k: break;
+        default: return false;
+        }
+        if (metric.scalar_kind() != scalar_kind_t::f32_k)
+            return false;
+        std::size_t dimensions = metric.dimensions();
+        if (!dimensions || dataset_count > std::numeric_limits<u32_t>::max())
+            return false;
+        if (!ok(cudaSetDevice(device_)) || !reserve_(dimensions))
+            return false;
+
+        metric_kind_t metric_kind = metric.metric_kind();
+        unsigned wanted_u = static_cast<unsigned>(wanted);
+        dim3 distances_block(tile_side(), tile_side());
+
+        for (std::size_t batch_begin = 0; batch_begin < queries_count; batch_begin += queries_batch()) {
+            std::size_t batch_count = (std::min)(queries_count - batch_begin, queries_batch());
+            if (!upload_queries_(queries_data + batch_begin * queries_stride, batch_count, queries_stride, dimensions))
+                return false;
+            gpu_results_reset_kernel<<<divide_round_up<256>(batch_count * wanted), 256, 0, compute_stream_>>>(
+                results_, batch_count * wanted);
+
+            // Stream the dataset through two staging slots: while the device processes one chunk,
+            // the host packs the next one, and the copy engine uploads it
+            std::size_t chunks_count = divide_round_up(dataset_count, chunk_vectors());
+            for (std::size_t chunk_idx = 0; chunk_idx != chunks_count; ++chunk_idx) {
+                std::size_t slot = chunk_idx % 2;
+                std::size_t chunk_begin = chunk_idx * chunk_vectors();
+                std::size_t chunk_count = (std::min)(dataset_count - chunk_begin, chunk_vectors());
+
+                // The pinned slot is free, once its previous upload has finished,
+                // and the device slot, once the kernels reading it have finished
+                if (!ok(cudaEventSynchronize(uploaded_[slot])))
+                    return false;
+                pack_(dataset_data + chunk_begin * dataset_stride, chunk_count, dataset_stride, dimensions,
+                      staging_[slot]);
+                if (!ok(cudaStreamWaitEvent(copy_stream_, consumed_[slot], 0)) ||
+                    !ok(cudaMemcpyAsync(dataset_[slot], staging_[slot], chunk_count * dimensions * sizeof(float),
+                                        cudaMemcpyHostToDevice, copy_stream_)) ||
+                    !ok(cudaEventRecord(uploaded_[slot], copy_stream_)) ||
+                    !ok(cudaStreamWaitEvent(compute_stream_, uploaded_[slot], 0)))
+                    return false;
+
+                gpu_squared_norms_kernel<<<divide_round_up<256>(chunk_count), 256, 0, compute_stream_>>>(
+                    dataset_[slot], chunk_count, dimensions, dataset_norms_[slot]);
+                for (std::size_t block_begin = 0; block_begin < batch_count; block_begin += queries_block()) {
+                    std::size_t block_count = (std::min)(batch_count - block_begin, queries_block());
+                    dim3 distances_grid(static_cast<unsigned>(divide_round_up(chunk_count, tile_side())),
+                                        static_cast<unsigned>(divide_round_up(block_count, tile_side())));
+                    gpu_distances_kernel<tile_side()><<<distances_grid, distances_block, 0, compute_stream_>>>( //
+                        queries_ + block_begin * dimensions, queries_norms_ + block_begin, block_count,         //
+                        dataset_[slot], dataset_norms_[slot], chunk_count,                                    //
+                        dimensions, metric_kind, distances_);
+                    gpu_select_kernel<select_threads(), wanted_limit()>
+                        <<<static_cast<unsigned>(block_count), select_threads(), 0, compute_stream_>>>( //
+                            distances_, chunk_count, chunk_begin, wanted_u, results_ + block_begin * wanted);
+                }
+                if (!ok(cudaEventRecord(consumed_[slot], compute_stream_)))
+                    return false;
+            }
+
+            if (!ok(cudaStreamSynchronize(compute_stream_)) || !ok(cudaGetLastError()) ||
+                !ok(cudaMemcpy(results + batch_begin * wanted, results_,
+                                        batch_count * wanted * sizeof(exact_offset_and_distance_t),
+                                        cudaMemcpyDeviceToHost)))
+                return false;
+        }
+        return true;
+    }
+};
+
+} // namespace usearch
+} // namespace unum
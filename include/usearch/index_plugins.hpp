@@ -3,13 +3,16 @@
 #include <float.h>  // `_Float16`
 #include <stdlib.h> // `aligned_alloc`
 
-#include <cstring> // `std::strncmp`
-#include <numeric> // `std::iota`
-#include <thread>  // `std::thread`
-#include <vector>  // `std::vector`
+#include <condition_variable> // `std::condition_variable`
+#include <cstring>            // `std::strncmp`
+#include <exception>          // `std::exception_ptr`
+#include <memory>             // `std::unique_ptr`
+#include <mutex>              // `std::mutex`
+#include <numeric>            // `std::iota`
+#include <thread>             // `std::thread`
+#include <vector>             // `std::vector`
 
 #include <atomic> // `std::atomic`
-#include <thread> // `std::thread`
 
 #include <usearch/index.hpp> // `expected_gt` and macros
 
@@ -22,6 +25,8 @@
 #endif
 
 #if defined(USEARCH_DEFINED_LINUX)
+#include <pthread.h>  // `pthread_setaffinity_np()`
+#include <sched.h>    // `cpu_set_t`
 #include <sys/auxv.h> // `getauxval()`
 #endif
 
@@ -257,7 +262,7 @@ inline expected_gt<scalar_kind_t> scalar_kind_from_name(char const* name, std::s
     else if (str_equals(name, len, "i8"))
         parsed.result = scalar_kind_t::i8_k;
     else
-        parsed.failed("Unknown type, choose: f32, f16, f64, i8");
+        parsed.error = "Unknown type, choose: f32, f16, f64, i8";
     return parsed;
 }
 
@@ -286,8 +291,8 @@ inline expected_gt<metric_kind_t> metric_from_name(char const* name, std::size_t
     } else if (str_equals(name, len, "sorensen")) {
         parsed.result = metric_kind_t::sorensen_k;
     } else
-        parsed.failed("Unknown distance, choose: l2sq, ip, cos, haversine, divergence, jaccard, pearson, hamming, "
-                      "tanimoto, sorensen");
+        parsed.error = "Unknown distance, choose: l2sq, ip, cos, haversine, divergence, jaccard, pearson, hamming, "
+                       "tanimoto, sorensen";
     return parsed;
 }
 
@@ -478,6 +483,310 @@ class executor_stl_t {
     }
 };
 
+/**
+ *  @brief  A persistent "thread-pool" with per-thread task queues and work-stealing.
+ *          Unlike the `executor_stl_t`, spawns the threads once in the constructor and
+ *          reuses them between calls, which is preferable for frequent small batches.
+ *
+ *  Every thread owns a contiguous range of task indices, popping small chunks of tasks from its front.
+ *  Once a thread exhausts its range, it steals the back half of some other thread's range.
+ *  Both ends of a range are packed into a single atomic word, so popping and stealing are lock-free.
+ *  The calling thread participates in every job as the thread number zero, so an executor
+ *  of `size()` threads only spawns `size() - 1` workers. Jobs submitted concurrently from
+ *  different threads are serialized. If any thread throws, the remaining tasks are skipped,
+ *  and the first exception is rethrown on the calling thread, once all the workers are done.
+ */
+class executor_pool_t {
+
+    /// @brief  The range of task indices assigned to a single thread, padded to a cache line.
+    ///         Packs the `begin` into the lower half of the word and the `end` into the upper one.
+    struct usearch_align_m tasks_range_t {
+        std::atomic<std::uint64_t> packed{0};
+    };
+
+    /// @brief  Maximum number of tasks distributed at once, so that both ends of a range fit into 64 bits.
+    static constexpr std::size_t tasks_per_round() { return std::numeric_limits<std::uint32_t>::max(); }
+
+    static std::uint64_t pack_(std::size_t begin, std::size_t end) noexcept {
+        return static_cast<std::uint64_t>(begin) | (static_cast<std::uint64_t>(end) << 32);
+    }
+    static std::size_t begin_(std::uint64_t packed) noexcept { return static_cast<std::size_t>(packed & 0xFFFFFFFFu); }
+    static std::size_t end_(std::uint64_t packed) noexcept { return static_cast<std::size_t>(packed >> 32); }
+
+    /// @brief  Type-punned entry point of a job, called once from every thread.
+    using trampoline_t = void (*)(executor_pool_t&, void*, std::size_t);
+
+    std::size_t threads_count_{};
+    std::vector<std::thread> workers_;
+    std::unique_ptr<tasks_range_t[]> ranges_;
+    /// @brief  The first task index of the current round, added to the indices popped from the ranges.
+    std::size_t round_begin_{};
+    std::atomic<bool> stop_{false};
+
+    /// @brief  Serializes the submissions of new jobs.
+    std::mutex submission_mutex_;
+    /// @brief  Protects the job description and the counters below.
+    std::mutex state_mutex_;
+    std::condition_variable wake_condition_;
+    std::condition_variable done_condition_;
+    std::size_t generation_{};
+    std::size_t workers_busy_{};
+    bool shutting_down_{};
+    trampoline_t trampoline_{};
+    void* job_{};
+    /// @brief  The first exception thrown by a worker during the current job.
+    std::exception_ptr exception_{};
+
+  public:
+    /**
+     *  @param threads_count The number of threads to be used for parallel execution.
+     *  @param pin_threads Whether to pin the worker threads to separate cores. Only supported on Linux.
+     *                    The submitting thread, acting as the thread number zero, keeps its own affinity.
+     */
+    executor_pool_t(std::size_t threads_count = 0, bool pin_threads = false) noexcept(false)
+        : threads_count_(threads_count ? threads_count : std::thread::hardware_concurrency()),
+          ranges_(new tasks_range_t[threads_count_]) {
+
+        workers_.reserve(threads_count_ - 1);
+        for (std::size_t thread_idx = 1; thread_idx < threads_count_; ++thread_idx)
+            workers_.emplace_back([this, thread_idx, pin_threads]() {
+                if (pin_threads)
+                    pin_(thread_idx);
+                work_(thread_idx);
+            });
+    }
+
+    ~executor_pool_t() noexcept {
+        {
+            std::unique_lock<std::mutex> lock(state_mutex_);
+            shutting_down_ = true;
+        }
+        wake_condition_.notify_all();
+        for (std::thread& worker : workers_)
+            worker.join();
+    }
+
+    executor_pool_t(executor_pool_t const&) = delete;
+    executor_pool_t& operator=(executor_pool_t const&) = delete;
+
+    /**
+     *  @return Maximum number of threads available to the executor.
+     */
+    std::size_t size() const noexcept { return threads_count_; }
+
+    /**
+     *  @brief Executes a fixed number of tasks using the specified thread-aware function.
+     *  @param tasks                 The total number of tasks to be executed.
+     *  @param thread_aware_function The thread-aware function to be called for each thread index and task index.
+     *  @throws The first exception raised by the thread-aware function on any of the threads.
+     */
+    template <typename thread_aware_function_at>
+    void fixed(std::size_t tasks, thread_aware_function_at&& thread_aware_function) noexcept(false) {
+        auto task = [&](std::size_t thread_idx, std::size_t task_idx) {
+            thread_aware_function(thread_idx, task_idx);
+            return true;
+        };
+        run_tasks_(tasks, task);
+    }
+
+    /**
+     *  @brief Executes limited number of tasks using the specified thread-aware function.
+     *  @param tasks                 The upper bound on the number of tasks.
+     *  @param thread_aware_function The thread-aware function to be called for each thread index and task index.
+     *  @throws The first exception raised by the thread-aware function on any of the threads.
+     */
+    template <typename thread_aware_function_at>
+    void dynamic(std::size_t tasks, thread_aware_function_at&& thread_aware_function) noexcept(false) {
+        auto task = [&](std::size_t thread_idx, std::size_t task_idx) -> bool {
+            return thread_aware_function(thread_idx, task_idx);
+        };
+        run_tasks_(tasks, task);
+    }
+
+    /**
+     *  @brief Saturates every available thread with the given workload, until they finish.
+     *  @param thread_aware_function The thread-aware function to be called for each thread index.
+     *  @throws The first exception raised by the thread-aware function on any of the threads.
+     */
+    template <typename thread_aware_function_at>
+    void parallel(thread_aware_function_at&& thread_aware_function) noexcept(false) {
+        using function_t = typename std::remove_reference<thread_aware_function_at>::type;
+        std::unique_lock<std::mutex> submission_lock(submission_mutex_);
+        if (threads_count_ == 1)
+            return thread_aware_function(0);
+        execute_(&trampoline_parallel_<function_t>, (void*)&thread_aware_function);
+    }
+
+  private:
+    template <typename task_at> void run_tasks_(std::size_t tasks, task_at& task) noexcept(false) {
+        std::unique_lock<std::mutex> submission_lock(submission_mutex_);
+        if (threads_count_ == 1 || tasks <= 1) {
+            for (std::size_t task_idx = 0; task_idx != tasks; ++task_idx)
+                if (!task(0, task_idx))
+                    break;
+            return;
+        }
+
+        // Split the tasks evenly, before waking up the workers
+        stop_.store(false, std::memory_order_relaxed);
+        for (round_begin_ = 0; round_begin_ < tasks && !stop_.load(std::memory_order_relaxed);
+             round_begin_ += tasks_per_round()) {
+            std::size_t round_tasks = (std::min)(tasks - round_begin_, tasks_per_round());
+            std::size_t tasks_per_thread = round_tasks / threads_count_;
+            std::size_t tasks_remainder = round_tasks % threads_count_;
+            for (std::size_t thread_idx = 0, begin = 0; thread_idx != threads_count_; ++thread_idx) {
+                std::size_t end = begin + tasks_per_thread + (thread_idx < tasks_remainder);
+                ranges_[thread_idx].packed.store(pack_(begin, end), std::memory_order_relaxed);
+                begin = end;
+            }
+            execute_(&trampoline_tasks_<task_at>, (void*)&task);
+        }
+    }
+
+    template <typename task_at> static void trampoline_tasks_(executor_pool_t& pool, void* job, std::size_t thread) {
+        task_at& task = *reinterpret_cast<task_at*>(job);
+        std::size_t chunk_begin, chunk_end;
+        while (pool.next_tasks_(thread, chunk_begin, chunk_end))
+            for (std::size_t task_idx = chunk_begin; task_idx != chunk_end; ++task_idx)
+                if (pool.stop_.load(std::memory_order_relaxed) || !task(thread, pool.round_begin_ + task_idx))
+                    return pool.stop_.store(true, std::memory_order_relaxed);
+    }
+
+    template <typename function_at>
+    static void trampoline_parallel_(executor_pool_t&, void* job, std::size_t thread) {
+        function_at& function = *reinterpret_cast<function_at*>(job);
+        function(thread);
+    }
+
+    /**
+     *  @brief  Pops the next chunk of tasks from the thread's own range, or steals from others.
+     *          The chunks are at most 1/16th of the remaining range, so that the thieves still have work.
+     *  @return `false` if no tasks are left anywhere.
+     */
+    bool next_tasks_(std::size_t thread, std::size_t& chunk_begin, std::size_t& chunk_end) noexcept {
+        // The task indices carry no data, the job itself is published by `execute_` under a mutex
+        tasks_range_t& own = ranges_[thread];
+        std::uint64_t packed = own.packed.load(std::memory_order_relaxed);
+        while (begin_(packed) != end_(packed)) {
+            std::size_t chunk = (std::min<std::size_t>)((end_(packed) - begin_(packed) + 15) / 16, 1024);
+            if (own.packed.compare_exchange_weak(packed, pack_(begin_(packed) + chunk, end_(packed)),
+                                                 std::memory_order_relaxed)) {
+                chunk_begin = begin_(packed);
+                chunk_end = chunk_begin + chunk;
+                return true;
+            }
+        }
+
+        // Only the owner refills an empty range, and thieves never touch empty ones,
+        // so a plain store can't race with them
+        for (std::size_t offset = 1; offset != threads_count_; ++offset) {
+            tasks_range_t& victim = ranges_[(thread + offset) % threads_count_];
+            std::uint64_t stolen = victim.packed.load(std::memory_order_relaxed);
+            while (begin_(stolen) != end_(stolen)) {
+                std::size_t remaining = end_(stolen) - begin_(stolen);
+                std::size_t stolen_begin = end_(stolen) - (remaining + 1) / 2;
+                if (!victim.packed.compare_exchange_weak(stolen, pack_(begin_(stolen), stolen_begin),
+                                                         std::memory_order_relaxed))
+                    continue;
+                own.packed.store(pack_(stolen_begin + 1, end_(stolen)), std::memory_order_relaxed);
+                chunk_begin = stolen_begin;
+                chunk_end = stolen_begin + 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief  Waits for all the workers to finish the current job, even if the calling thread throws.
+    struct completion_guard_t {
+        executor_pool_t& pool;
+        ~completion_guard_t() noexcept {
+            std::unique_lock<std::mutex> lock(pool.state_mutex_);
+            pool.done_condition_.wait(lock, [&] { return pool.workers_busy_ == 0; });
+        }
+    };
+
+    void execute_(trampoline_t trampoline, void* job) noexcept(false) {
+        {
+            std::unique_lock<std::mutex> lock(state_mutex_);
+            trampoline_ = trampoline;
+            job_ = job;
+            exception_ = nullptr;
+            workers_busy_ = workers_.size();
+            ++generation_;
+        }
+        wake_condition_.notify_all();
+        {
+            completion_guard_t guard{*this};
+            try {
+                trampoline(*this, job, 0);
+            } catch (...) {
+                stop_.store(true, std::memory_order_relaxed);
+                throw;
+            }
+        }
+
+        // The workers can't throw across threads, so their exceptions are rethrown here
+        std::exception_ptr exception;
+        {
+            std::unique_lock<std::mutex> lock(state_mutex_);
+            std::swap(exception, exception_);
+        }
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+
+    void work_(std::size_t thread_idx) noexcept {
+        std::size_t last_generation = 0;
+        while (true) {
+            trampoline_t trampoline;
+            void* job;
+            {
+                std::unique_lock<std::mutex> lock(state_mutex_);
+                wake_condition_.wait(lock, [&] { return shutting_down_ || generation_ != last_generation; });
+                if (shutting_down_)
+                    return;
+                last_generation = generation_;
+                trampoline = trampoline_;
+                job = job_;
+            }
+            std::exception_ptr exception;
+            try {
+                trampoline(*this, job, thread_idx);
+            } catch (...) {
+                exception = std::current_exception();
+                stop_.store(true, std::memory_order_relaxed);
+            }
+            {
+                std::unique_lock<std::mutex> lock(state_mutex_);
+                if (exception && !exception_)
+                    exception_ = exception;
+                if (--workers_busy_ == 0)
+                    done_condition_.notify_one();
+            }
+        }
+    }
+
+    /// @brief  Pins the current thread to one of the cores it is allowed to run on, chosen by its index in the pool.
+    static void pin_(std::size_t thread_idx) noexcept {
+#if defined(USEARCH_DEFINED_LINUX)
+        cpu_set_t allowed;
+        if (pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &allowed) != 0 || !CPU_COUNT(&allowed))
+            return;
+        std::size_t skipped = thread_idx % static_cast<std::size_t>(CPU_COUNT(&allowed));
+        std::size_t core = 0;
+        for (; !CPU_ISSET(core, &allowed) || skipped; ++core)
+            skipped -= CPU_ISSET(core, &allowed) ? 1 : 0;
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        CPU_SET(core, &cpu_set);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set);
+#else
+        (void)thread_idx;
+#endif
+    }
+};
+
 #if USEARCH_USE_OPENMP
 
 /**
@@ -600,34 +909,6 @@ class aligned_allocator_gt {
 
 using aligned_allocator_t = aligned_allocator_gt<>;
 
-class page_allocator_t {
-  public:
-    static constexpr std::size_t page_size() { return 4096; }
-
-    /**
-     *  @brief Allocates an @b uninitialized block of memory of the specified size.
-     *  @param count_bytes The number of bytes to allocate.
-     *  @return A pointer to the allocated memory block, or `nullptr` if allocation fails.
-     */
-    byte_t* allocate(std::size_t count_bytes) const noexcept {
-        count_bytes = divide_round_up(count_bytes, page_size()) * page_size();
-#if defined(USEARCH_DEFINED_WINDOWS)
-        return (byte_t*)(::VirtualAlloc(NULL, count_bytes, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
-#else
-        return (byte_t*)mmap(NULL, count_bytes, PROT_WRITE | PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, 0, 0);
-#endif
-    }
-
-    void deallocate(byte_t* page_pointer, std::size_t count_bytes) const noexcept {
-#if defined(USEARCH_DEFINED_WINDOWS)
-        ::VirtualFree(page_pointer, 0, MEM_RELEASE);
-#else
-        count_bytes = divide_round_up(count_bytes, page_size()) * page_size();
-        munmap(page_pointer, count_bytes);
-#endif
-    }
-};
-
 /**
  *  @brief  Memory-mapping allocator designed for "alloc many, free at once" usage patterns.
  *          @b Thread-safe, @b except constructors and destructors.
@@ -645,6 +926,7 @@ template <std::size_t alignment_ak = 1> class memory_mapping_allocator_gt {
     }
 
     std::mutex mutex_;
+    page_allocator_t pages_;
     byte_t* last_arena_ = nullptr;
     std::size_t last_usage_ = head_size();
     std::size_t last_capacity_ = min_capacity();
@@ -657,11 +939,14 @@ template <std::size_t alignment_ak = 1> class memory_mapping_allocator_gt {
     using const_pointer = byte_t const*;
 
     memory_mapping_allocator_gt() = default;
+    explicit memory_mapping_allocator_gt(memory_placement_t placement) noexcept : pages_(placement) {}
     memory_mapping_allocator_gt(memory_mapping_allocator_gt&& other) noexcept
-        : last_arena_(exchange(other.last_arena_, nullptr)), last_usage_(exchange(other.last_usage_, 0)),
-          last_capacity_(exchange(other.last_capacity_, 0)), wasted_space_(exchange(other.wasted_space_, 0)) {}
+        : pages_(other.pages_), last_arena_(exchange(other.last_arena_, nullptr)),
+          last_usage_(exchange(other.last_usage_, 0)), last_capacity_(exchange(other.last_capacity_, 0)),
+          wasted_space_(exchange(other.wasted_space_, 0)) {}
 
     memory_mapping_allocator_gt& operator=(memory_mapping_allocator_gt&& other) noexcept {
+        std::swap(pages_, other.pages_);
         std::swap(last_arena_, other.last_arena_);
         std::swap(last_usage_, other.last_usage_);
         std::swap(last_capacity_, other.last_capacity_);
@@ -669,6 +954,9 @@ template <std::size_t alignment_ak = 1> class memory_mapping_allocator_gt {
         return *this;
     }
 
+    /// @brief Placement of the arenas, preserved by the copies of the allocator.
+    memory_placement_t placement() const noexcept { return pages_.placement(); }
+
     ~memory_mapping_allocator_gt() noexcept { reset(); }
 
     /**
@@ -681,7 +969,7 @@ template <std::size_t alignment_ak = 1> class memory_mapping_allocator_gt {
             std::memcpy(&previous_arena, last_arena, sizeof(byte_t*));
             std::size_t last_cap = 0;
             std::memcpy(&last_cap, last_arena + sizeof(byte_t*), sizeof(std::size_t));
-            page_allocator_t{}.deallocate(last_arena, last_cap);
+            pages_.deallocate(last_arena, last_cap);
             last_arena = previous_arena;
         }
 
@@ -694,17 +982,18 @@ template <std::size_t alignment_ak = 1> class memory_mapping_allocator_gt {
 
     /**
      *  @brief Copy constructor.
-     *  @note This is a no-op copy constructor since the allocator is not copyable.
+     *  @note Only copies the placement, but not the arenas, since the allocator is not copyable.
      */
-    memory_mapping_allocator_gt(memory_mapping_allocator_gt const&) noexcept {}
+    memory_mapping_allocator_gt(memory_mapping_allocator_gt const& other) noexcept : pages_(other.pages_) {}
 
     /**
      *  @brief Copy assignment operator.
-     *  @note This is a no-op copy assignment operator since the allocator is not copyable.
+     *  @note Only copies the placement, but not the arenas, since the allocator is not copyable.
      *  @return Reference to the allocator after the assignment.
      */
-    memory_mapping_allocator_gt& operator=(memory_mapping_allocator_gt const&) noexcept {
+    memory_mapping_allocator_gt& operator=(memory_mapping_allocator_gt const& other) noexcept {
         reset();
+        pages_ = other.pages_;
         return *this;
     }
 
@@ -718,7 +1007,8 @@ template <std::size_t alignment_ak = 1> class memory_mapping_allocator_gt {
         std::unique_lock<std::mutex> lock(mutex_);
         if (!last_arena_ || (last_usage_ + extended_bytes >= last_capacity_)) {
             std::size_t new_cap = (std::max)(last_capacity_, ceil2(extended_bytes)) * capacity_multiplier();
-            byte_t* new_arena = page_allocator_t{}.allocate(new_cap);
+            new_cap = divide_round_up(new_cap, pages_.granularity()) * pages_.granularity();
+            byte_t* new_arena = pages_.allocate(new_cap);
             if (!new_arena)
                 return nullptr;
             std::memcpy(new_arena, &last_arena_, sizeof(byte_t*));
@@ -739,14 +1029,13 @@ template <std::size_t alignment_ak = 1> class memory_mapping_allocator_gt {
      *  @return The amount of space in bytes.
      */
     std::size_t total_allocated() const noexcept {
-        if (!last_arena_)
-            return 0;
         std::size_t total_used = 0;
-        std::size_t last_capacity = last_capacity_;
-        do {
-            total_used += last_capacity;
-            last_capacity /= capacity_multiplier();
-        } while (last_capacity >= min_capacity());
+        for (byte_t* arena = last_arena_; arena;) {
+            std::size_t capacity = 0;
+            std::memcpy(&capacity, arena + sizeof(byte_t*), sizeof(std::size_t));
+            std::memcpy(&arena, arena, sizeof(byte_t*));
+            total_used += capacity;
+        }
         return total_used;
     }
 
@@ -794,6 +1083,11 @@ class unfair_shared_mutex_t {
         }
     }
 
+    inline bool try_lock() noexcept {
+        std::int32_t raw = idle_k;
+        return state_.compare_exchange_strong(raw, writing_k, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
     inline void unlock() noexcept { state_.store(idle_k, std::memory_order_release); }
 
     inline void lock_shared() noexcept {
@@ -812,6 +1106,12 @@ class unfair_shared_mutex_t {
         }
     }
 
+    inline bool try_lock_shared() noexcept {
+        std::int32_t raw = state_.load(std::memory_order_acquire);
+        return raw != writing_k &&
+               state_.compare_exchange_strong(raw, raw + 1, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
     inline void unlock_shared() noexcept { state_.fetch_sub(1, std::memory_order_release); }
 
     /**
@@ -850,6 +1150,50 @@ class unfair_shared_mutex_t {
     }
 };
 
+/**
+ *  @brief  Wraps a shared mutex, counting the acquisitions that couldn't succeed immediately,
+ *          and the time spent waiting for them. Uncontended acquisitions cost a single `try_lock`.
+ */
+template <typename mutex_at = unfair_shared_mutex_t> class instrumented_shared_mutex_gt {
+    mutex_at mutex_;
+    std::atomic<std::size_t> waits_{0};
+    std::atomic<std::size_t> wait_nanoseconds_{0};
+
+    void waited_(std::uint64_t started) noexcept {
+        waits_.fetch_add(1, std::memory_order_relaxed);
+        wait_nanoseconds_.fetch_add(instrumentation_nanoseconds() - started, std::memory_order_relaxed);
+    }
+
+  public:
+    inline void lock() noexcept {
+        if (mutex_.try_lock())
+            return;
+        std::uint64_t const started = instrumentation_nanoseconds();
+        mutex_.lock();
+        waited_(started);
+    }
+
+    inline void lock_shared() noexcept {
+        if (mutex_.try_lock_shared())
+            return;
+        std::uint64_t const started = instrumentation_nanoseconds();
+        mutex_.lock_shared();
+        waited_(started);
+    }
+
+    inline bool try_lock() noexcept { return mutex_.try_lock(); }
+    inline bool try_lock_shared() noexcept { return mutex_.try_lock_shared(); }
+    inline void unlock() noexcept { mutex_.unlock(); }
+    inline void unlock_shared() noexcept { mutex_.unlock_shared(); }
+
+    std::size_t waits() const noexcept { return waits_.load(std::memory_order_relaxed); }
+    std::size_t wait_nanoseconds() const noexcept { return wait_nanoseconds_.load(std::memory_order_relaxed); }
+    void reset() noexcept {
+        waits_.store(0, std::memory_order_relaxed);
+        wait_nanoseconds_.store(0, std::memory_order_relaxed);
+    }
+};
+
 template <typename mutex_at = unfair_shared_mutex_t> class shared_lock_gt {
     mutex_at& mutex_;
 
@@ -1352,14 +1696,24 @@ class metric_punned_t {
     using metric_array_array_state_t = result_t (*)(uptr_t, uptr_t, uptr_t);
     /// Distance function callback, like `metric_array_array_size_t`, but depends on member variables.
     using metric_rounted_t = result_t (metric_punned_t::*)(uptr_t, uptr_t) const;
+    /// Distance function that takes one array, an array of arrays, their count, their length, and the outputs.
+    using metric_array_arrays_size_t = void (*)(uptr_t, uptr_t const*, std::size_t, uptr_t, result_t*);
+    /// Batched distance function callback, scoring one array against many, and dispatched once per batch.
+    using metric_batch_routed_t = void (metric_punned_t::*)(uptr_t, uptr_t const*, std::size_t, result_t*) const;
 
     metric_rounted_t metric_routed_ = nullptr;
     uptr_t metric_ptr_ = 0;
     uptr_t metric_third_arg_ = 0;
 
+    /// Falls back to a loop over `metric_routed_`, unless a dedicated batched kernel is configured.
+    metric_batch_routed_t metric_batch_routed_ = &metric_punned_t::invoke_batch_routed;
+    uptr_t metric_batch_ptr_ = 0;
+
     std::size_t dimensions_ = 0;
     metric_kind_t metric_kind_ = metric_kind_t::unknown_k;
     scalar_kind_t scalar_kind_ = scalar_kind_t::unknown_k;
+    /// Only the `builtin` metrics are guaranteed to match their `metric_kind_`, unlike the user-defined ones.
+    bool is_builtin_ = false;
 
 #if USEARCH_USE_SIMSIMD
     simsimd_capability_t isa_kind_ = simsimd_cap_serial_k;
@@ -1375,6 +1729,40 @@ class metric_punned_t {
         return (this->*metric_routed_)(reinterpret_cast<uptr_t>(a), reinterpret_cast<uptr_t>(b));
     }
 
+    /**
+     *  @brief  Computes the distances from every one of ::count vectors in ::as to the same vector ::b,
+     *          keeping ::b hot in cache between evaluations. All built-in metrics are symmetric, so those
+     *          reuse the one-to-many batch kernel, while custom metrics are called pair by pair.
+     */
+    inline void operator()(byte_t const* const* as, std::size_t count, byte_t const* b,
+                           result_t* results) const noexcept {
+        if (is_builtin_)
+            return (this->*metric_batch_routed_)(reinterpret_cast<uptr_t>(b), reinterpret_cast<uptr_t const*>(as),
+                                                 count, results);
+        for (std::size_t i = 0; i != count; ++i)
+            results[i] = (this->*metric_routed_)(reinterpret_cast<uptr_t>(as[i]), reinterpret_cast<uptr_t>(b));
+    }
+
+    /**
+     *  @brief  Computes the distances from the same vector ::a to every one of ::count vectors in ::bs,
+     *          dispatching once for the whole batch, so the kernel can keep ::a in registers.
+     */
+    inline void operator()(byte_t const* a, byte_t const* const* bs, std::size_t count,
+                           result_t* results) const noexcept {
+        (this->*metric_batch_routed_)(reinterpret_cast<uptr_t>(a), reinterpret_cast<uptr_t const*>(bs), count,
+                                      results);
+    }
+
+    /**
+     *  @brief  Computes an ::as_count by ::bs_count tile of distances in row-major order,
+     *          so that `results[i * bs_count + j]` is the distance between `as[i]` and `bs[j]`.
+     */
+    inline void operator()(byte_t const* const* as, std::size_t as_count, byte_t const* const* bs,
+                           std::size_t bs_count, result_t* results) const noexcept {
+        for (std::size_t i = 0; i != as_count; ++i)
+            operator()(as[i], bs, bs_count, results + i * bs_count);
+    }
+
     inline metric_punned_t() noexcept = default;
     inline metric_punned_t(metric_punned_t const&) noexcept = default;
     inline metric_punned_t& operator=(metric_punned_t const&) noexcept = default;
@@ -1406,6 +1794,7 @@ class metric_punned_t {
         metric.dimensions_ = dimensions;
         metric.metric_kind_ = metric_kind;
         metric.scalar_kind_ = scalar_kind;
+        metric.is_builtin_ = true;
 
 #if USEARCH_USE_SIMSIMD
         if (!metric.configure_with_simsimd())
@@ -1472,6 +1861,7 @@ class metric_punned_t {
     inline std::size_t dimensions() const noexcept { return dimensions_; }
     inline metric_kind_t metric_kind() const noexcept { return metric_kind_; }
     inline scalar_kind_t scalar_kind() const noexcept { return scalar_kind_; }
+    inline bool is_builtin() const noexcept { return is_builtin_; }
     inline explicit operator bool() const noexcept { return metric_routed_ && metric_ptr_; }
 
     /**
@@ -1543,6 +1933,8 @@ class metric_punned_t {
         metric_routed_ = metric_kind_ == metric_kind_t::ip_k
                              ? reinterpret_cast<metric_rounted_t>(&metric_punned_t::invoke_simsimd_reverse)
                              : reinterpret_cast<metric_rounted_t>(&metric_punned_t::invoke_simsimd);
+        metric_batch_routed_ = metric_kind_ == metric_kind_t::ip_k ? &metric_punned_t::invoke_simsimd_batch_reverse
+                                                                   : &metric_punned_t::invoke_simsimd_batch;
         isa_kind_ = simd_kind;
         return true;
     }
@@ -1559,6 +1951,21 @@ class metric_punned_t {
         return (result_t)result;
     }
     result_t invoke_simsimd_reverse(uptr_t a, uptr_t b) const noexcept { return 1 - invoke_simsimd(a, b); }
+    void invoke_simsimd_batch(uptr_t a, uptr_t const* bs, std::size_t count, result_t* results) const noexcept {
+        auto function_pointer = (simsimd_metric_punned_t)(metric_ptr_);
+        for (std::size_t i = 0; i != count; ++i) {
+            simsimd_distance_t result;
+            function_pointer(reinterpret_cast<void const*>(a), reinterpret_cast<void const*>(bs[i]),
+                             metric_third_arg_, &result);
+            results[i] = (result_t)result;
+        }
+    }
+    void invoke_simsimd_batch_reverse(uptr_t a, uptr_t const* bs, std::size_t count,
+                                      result_t* results) const noexcept {
+        invoke_simsimd_batch(a, bs, count, results);
+        for (std::size_t i = 0; i != count; ++i)
+            results[i] = 1 - results[i];
+    }
 #else
     bool configure_with_simsimd() noexcept { return false; }
 #endif
@@ -1572,44 +1979,53 @@ class metric_punned_t {
         result_t result = function_pointer(a, b);
         return result;
     }
+    void invoke_batch_routed(uptr_t a, uptr_t const* bs, std::size_t count, result_t* results) const noexcept {
+        for (std::size_t i = 0; i != count; ++i)
+            results[i] = (this->*metric_routed_)(a, bs[i]);
+    }
+    void invoke_batch_array_arrays_third(uptr_t a, uptr_t const* bs, std::size_t count,
+                                         result_t* results) const noexcept {
+        auto function_pointer = (metric_array_arrays_size_t)(metric_batch_ptr_);
+        function_pointer(a, bs, count, metric_third_arg_, results);
+    }
     void configure_with_autovec() noexcept {
         switch (metric_kind_) {
         case metric_kind_t::ip_k: {
             switch (scalar_kind_) {
-            case scalar_kind_t::f32_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_ip_gt<f32_t>>; break;
-            case scalar_kind_t::f16_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_ip_gt<f16_t, f32_t>>; break;
-            case scalar_kind_t::i8_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_ip_gt<i8_t, f32_t>>; break;
-            case scalar_kind_t::f64_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_ip_gt<f64_t>>; break;
+            case scalar_kind_t::f32_k: configure_with_autovec_<metric_ip_gt<f32_t>>(); break;
+            case scalar_kind_t::f16_k: configure_with_autovec_<metric_ip_gt<f16_t, f32_t>>(); break;
+            case scalar_kind_t::i8_k: configure_with_autovec_<metric_ip_gt<i8_t, f32_t>>(); break;
+            case scalar_kind_t::f64_k: configure_with_autovec_<metric_ip_gt<f64_t>>(); break;
             default: metric_ptr_ = 0; break;
             }
             break;
         }
         case metric_kind_t::cos_k: {
             switch (scalar_kind_) {
-            case scalar_kind_t::f32_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_cos_gt<f32_t>>; break;
-            case scalar_kind_t::f16_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_cos_gt<f16_t, f32_t>>; break;
-            case scalar_kind_t::i8_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_cos_gt<i8_t, f32_t>>; break;
-            case scalar_kind_t::f64_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_cos_gt<f64_t>>; break;
+            case scalar_kind_t::f32_k: configure_with_autovec_<metric_cos_gt<f32_t>>(); break;
+            case scalar_kind_t::f16_k: configure_with_autovec_<metric_cos_gt<f16_t, f32_t>>(); break;
+            case scalar_kind_t::i8_k: configure_with_autovec_<metric_cos_gt<i8_t, f32_t>>(); break;
+            case scalar_kind_t::f64_k: configure_with_autovec_<metric_cos_gt<f64_t>>(); break;
             default: metric_ptr_ = 0; break;
             }
             break;
         }
         case metric_kind_t::l2sq_k: {
             switch (scalar_kind_) {
-            case scalar_kind_t::f32_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_l2sq_gt<f32_t>>; break;
-            case scalar_kind_t::f16_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_l2sq_gt<f16_t, f32_t>>; break;
-            case scalar_kind_t::i8_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_l2sq_gt<i8_t, f32_t>>; break;
-            case scalar_kind_t::f64_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_l2sq_gt<f64_t>>; break;
+            case scalar_kind_t::f32_k: configure_with_autovec_<metric_l2sq_gt<f32_t>>(); break;
+            case scalar_kind_t::f16_k: configure_with_autovec_<metric_l2sq_gt<f16_t, f32_t>>(); break;
+            case scalar_kind_t::i8_k: configure_with_autovec_<metric_l2sq_gt<i8_t, f32_t>>(); break;
+            case scalar_kind_t::f64_k: configure_with_autovec_<metric_l2sq_gt<f64_t>>(); break;
             default: metric_ptr_ = 0; break;
             }
             break;
         }
         case metric_kind_t::pearson_k: {
             switch (scalar_kind_) {
-            case scalar_kind_t::i8_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_pearson_gt<i8_t, f32_t>>; break;
-            case scalar_kind_t::f16_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_pearson_gt<f16_t, f32_t>>; break;
-            case scalar_kind_t::f32_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_pearson_gt<f32_t>>; break;
-            case scalar_kind_t::f64_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_pearson_gt<f64_t>>; break;
+            case scalar_kind_t::i8_k: configure_with_autovec_<metric_pearson_gt<i8_t, f32_t>>(); break;
+            case scalar_kind_t::f16_k: configure_with_autovec_<metric_pearson_gt<f16_t, f32_t>>(); break;
+            case scalar_kind_t::f32_k: configure_with_autovec_<metric_pearson_gt<f32_t>>(); break;
+            case scalar_kind_t::f64_k: configure_with_autovec_<metric_pearson_gt<f64_t>>(); break;
             default: metric_ptr_ = 0; break;
             }
             break;
@@ -1617,27 +2033,25 @@ class metric_punned_t {
         case metric_kind_t::haversine_k: {
             switch (scalar_kind_) {
             case scalar_kind_t::f16_k: metric_ptr_ = 0; break; //< Having half-precision 2D coordinates is a bit silly.
-            case scalar_kind_t::f32_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_haversine_gt<f32_t>>; break;
-            case scalar_kind_t::f64_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_haversine_gt<f64_t>>; break;
+            case scalar_kind_t::f32_k: configure_with_autovec_<metric_haversine_gt<f32_t>>(); break;
+            case scalar_kind_t::f64_k: configure_with_autovec_<metric_haversine_gt<f64_t>>(); break;
             default: metric_ptr_ = 0; break;
             }
             break;
         }
         case metric_kind_t::divergence_k: {
             switch (scalar_kind_) {
-            case scalar_kind_t::f16_k:
-                metric_ptr_ = (uptr_t)&equidimensional_<metric_divergence_gt<f16_t, f32_t>>;
-                break;
-            case scalar_kind_t::f32_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_divergence_gt<f32_t>>; break;
-            case scalar_kind_t::f64_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_divergence_gt<f64_t>>; break;
+            case scalar_kind_t::f16_k: configure_with_autovec_<metric_divergence_gt<f16_t, f32_t>>(); break;
+            case scalar_kind_t::f32_k: configure_with_autovec_<metric_divergence_gt<f32_t>>(); break;
+            case scalar_kind_t::f64_k: configure_with_autovec_<metric_divergence_gt<f64_t>>(); break;
             default: metric_ptr_ = 0; break;
             }
             break;
         }
         case metric_kind_t::jaccard_k: // Equivalent to Tanimoto
-        case metric_kind_t::tanimoto_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_tanimoto_gt<b1x8_t>>; break;
-        case metric_kind_t::hamming_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_hamming_gt<b1x8_t>>; break;
-        case metric_kind_t::sorensen_k: metric_ptr_ = (uptr_t)&equidimensional_<metric_sorensen_gt<b1x8_t>>; break;
+        case metric_kind_t::tanimoto_k: configure_with_autovec_<metric_tanimoto_gt<b1x8_t>>(); break;
+        case metric_kind_t::hamming_k: configure_with_autovec_<metric_hamming_gt<b1x8_t>>(); break;
+        case metric_kind_t::sorensen_k: configure_with_autovec_<metric_sorensen_gt<b1x8_t>>(); break;
         default: return;
         }
     }
@@ -1647,6 +2061,20 @@ class metric_punned_t {
         using scalar_t = typename typed_at::scalar_t;
         return static_cast<result_t>(typed_at{}((scalar_t const*)a, (scalar_t const*)b, a_dimensions));
     }
+
+    template <typename typed_at>
+    inline static void equidimensional_batch_(uptr_t a, uptr_t const* bs, std::size_t count, uptr_t a_dimensions,
+                                              result_t* results) noexcept {
+        using scalar_t = typename typed_at::scalar_t;
+        for (std::size_t i = 0; i != count; ++i)
+            results[i] = static_cast<result_t>(typed_at{}((scalar_t const*)a, (scalar_t const*)bs[i], a_dimensions));
+    }
+
+    template <typename typed_at> void configure_with_autovec_() noexcept {
+        metric_ptr_ = (uptr_t)&equidimensional_<typed_at>;
+        metric_batch_ptr_ = (uptr_t)&equidimensional_batch_<typed_at>;
+        metric_batch_routed_ = &metric_punned_t::invoke_batch_array_arrays_third;
+    }
 };
 
 /**
@@ -1689,13 +2117,38 @@ struct exact_offset_and_distance_t {
 
 using exact_search_results_t = vectors_view_gt<exact_offset_and_distance_t>;
 
+/**
+ *  @brief  Type-punned accelerator backend for `exact_search_t`, like the GPU one in `index_gpu.cuh`.
+ *          Any request it doesn't support, like a custom metric or a missing device, is declined,
+ *          and the search falls back to the CPU.
+ */
+struct exact_search_device_t {
+    /**
+     *  @brief Fills `wanted` sorted entries for every query into `results`, padded like in `exact_search_t`.
+     *  @return `false` if the request was declined or failed, leaving the `results` in an unspecified state.
+     */
+    using search_t = bool (*)(                                                                 //
+        void* state, metric_punned_t const& metric,                                            //
+        byte_t const* dataset_data, std::size_t dataset_count, std::size_t dataset_stride,     //
+        byte_t const* queries_data, std::size_t queries_count, std::size_t queries_stride,     //
+        std::size_t wanted, exact_offset_and_distance_t* results);
+
+    search_t search = nullptr;
+    void* state = nullptr;
+
+    explicit operator bool() const noexcept { return search != nullptr; }
+};
+
 /**
  *  @brief  Helper-structure for exact search operations.
- *          Perfect if you have @b <1M vectors and @b <100 queries per call.
+ *          Memory usage is bounded by the number of queries, results, and threads,
+ *          independent of the dataset size, so it scales to ground-truth generation.
  *
- *  Uses a 3-step procedure to minimize:
- *  - cache-misses on vector lookups,
- *  - multi-threaded contention on concurrent writes.
+ *  Uses a 2-step procedure to minimize:
+ *  - cache-misses on vector lookups, processing L2-sized tiles of the dataset against L1-sized blocks of queries,
+ *  - multi-threaded contention on concurrent writes, keeping a bounded top-k per query in every thread.
+ *
+ *  With an `exact_search_device_t` attached, the requests it accepts are offloaded, and the rest stay on the CPU.
  */
 class exact_search_t {
 
@@ -1703,10 +2156,47 @@ class exact_search_t {
         return a.distance < b.distance;
     }
 
+    /// @brief Size of the dataset tile, that every thread compares against all of the queries, reusing it from L2.
+    static constexpr std::size_t dataset_tile_bytes() { return 256 * 1024; }
+    /// @brief Size of the queries block, traversed for every dataset vector in the tile, reusing it from L1.
+    static constexpr std::size_t queries_block_bytes() { return 16 * 1024; }
+    /// @brief Number of queries scored against the same dataset vector in a single batched metric call.
+    static constexpr std::size_t queries_batch() { return 64; }
+
     using keys_and_distances_t = buffer_gt<exact_offset_and_distance_t>;
+    using counts_t = buffer_gt<std::size_t>;
+
+    /// @brief Per-thread sorted top-k lists for every query, followed by the merged results.
     keys_and_distances_t keys_and_distances;
+    counts_t counts;
+    /// @brief Optional accelerator, tried before the CPU path.
+    exact_search_device_t device_;
+
+    /**
+     *  @brief Inserts into an ascending list of at most `limit` entries, like `sorted_buffer_gt::insert`,
+     *         but over an externally-owned slice, so thousands of lists can share one allocation.
+     */
+    inline static void insert_bounded( //
+        exact_offset_and_distance_t* elements, std::size_t& size, std::size_t limit,
+        exact_offset_and_distance_t element) noexcept {
+        if (size == limit && !smaller_distance(element, elements[size - 1]))
+            return;
+        std::size_t slot = std::upper_bound(elements, elements + size, element, &smaller_distance) - elements;
+        std::size_t to_move = size - slot - (size == limit);
+        exact_offset_and_distance_t* source = elements + size - 1 - (size == limit);
+        for (; to_move; --to_move, --source)
+            source[1] = source[0];
+        elements[slot] = element;
+        size += size != limit;
+    }
 
   public:
+    exact_search_t() = default;
+    explicit exact_search_t(exact_search_device_t device) noexcept : device_(device) {}
+
+    exact_search_device_t device() const noexcept { return device_; }
+    void change_device(exact_search_device_t device) noexcept { device_ = device; }
+
     template <typename scalar_at, typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t>
     exact_search_results_t operator()(                                          //
         vectors_view_gt<scalar_at> dataset, vectors_view_gt<scalar_at> queries, //
@@ -1719,6 +2209,12 @@ class exact_search_t {
             wanted, executor, progress);
     }
 
+    /**
+     *  @brief Finds the `wanted` closest dataset vectors for every query.
+     *  @return Row-major view with `wanted` entries per query, sorted by distance.
+     *          If the dataset is smaller than `wanted`, the tail is padded with `u32_t` max offsets
+     *          and `f32_t` max distances. Empty, if the memory allocation failed or the progress was cancelled.
+     */
     template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t>
     exact_search_results_t operator()(                                                     //
         byte_t const* dataset_data, std::size_t dataset_count, std::size_t dataset_stride, //
@@ -1726,69 +2222,365 @@ class exact_search_t {
         std::size_t wanted, metric_punned_t const& metric, executor_at&& executor = executor_at{},
         progress_at&& progress = progress_at{}) {
 
-        // Allocate temporary memory to store the distance matrix
-        // Previous version didn't need temporary memory, but the performance was much lower.
-        // In the new design we keep two buffers - original and transposed, as in-place transpositions
-        // of non-rectangular matrixes is expensive.
+        if (!wanted || !queries_count)
+            return {};
+
+        // Offload to the accelerator, if one is attached and supports this request.
+        // The results are written straight into the front of the buffer, without any thread-local lists.
         std::size_t tasks_count = dataset_count * queries_count;
-        if (keys_and_distances.size() < tasks_count * 2)
-            keys_and_distances = keys_and_distances_t(tasks_count * 2);
-        if (keys_and_distances.size() < tasks_count * 2)
+        if (device_ && dataset_count <= std::numeric_limits<u32_t>::max()) {
+            std::size_t results_count = queries_count * wanted;
+            if (keys_and_distances.size() < results_count)
+                keys_and_distances = keys_and_distances_t(results_count);
+            if (keys_and_distances.size() < results_count)
+                return {};
+            if (device_.search(device_.state, metric,                             //
+                               dataset_data, dataset_count, dataset_stride,       //
+                               queries_data, queries_count, queries_stride,       //
+                               wanted, keys_and_distances.data())) {
+                if (!progress(tasks_count, tasks_count))
+                    return {};
+                return {keys_and_distances.data(), wanted, queries_count, wanted * sizeof(exact_offset_and_distance_t)};
+            }
+        }
+
+        // Allocate temporary memory for a top-k list per query in every thread, and the merged results.
+        // Unlike materializing the whole distance matrix, this doesn't depend on the `dataset_count`.
+        std::size_t threads_count = (std::max<std::size_t>)(executor.size(), 1);
+        std::size_t lists_count = threads_count * queries_count;
+        std::size_t entries_count = (lists_count + queries_count) * wanted;
+        if (keys_and_distances.size() < entries_count)
+            keys_and_distances = keys_and_distances_t(entries_count);
+        if (counts.size() < lists_count)
+            counts = counts_t(lists_count);
+        if (keys_and_distances.size() < entries_count || counts.size() < lists_count)
             return {};
+        std::fill_n(counts.data(), lists_count, std::size_t(0));
 
-        exact_offset_and_distance_t* keys_and_distances_per_dataset = keys_and_distances.data();
-        exact_offset_and_distance_t* keys_and_distances_per_query = keys_and_distances_per_dataset + tasks_count;
+        exact_offset_and_distance_t* keys_and_distances_per_thread = keys_and_distances.data();
+        exact_offset_and_distance_t* keys_and_distances_per_query = keys_and_distances.data() + lists_count * wanted;
 
-        // §1. Compute distances in a data-parallel fashion
+        std::size_t dataset_tile = (std::max<std::size_t>)(dataset_tile_bytes() / (dataset_stride + 1), 1);
+        std::size_t queries_block = (std::max<std::size_t>)(queries_block_bytes() / (queries_stride + 1), 1);
+        std::size_t tiles_count = divide_round_up(dataset_count, dataset_tile);
+
+        // §1. Compare every dataset tile against blocks of queries, updating the thread-local top-k lists
         std::atomic<std::size_t> processed{0};
-        executor.dynamic(dataset_count, [&](std::size_t thread_idx, std::size_t dataset_idx) {
-            byte_t const* dataset = dataset_data + dataset_idx * dataset_stride;
-            for (std::size_t query_idx = 0; query_idx != queries_count; ++query_idx) {
-                byte_t const* query = queries_data + query_idx * queries_stride;
-                auto distance = metric(dataset, query);
-                std::size_t task_idx = queries_count * dataset_idx + query_idx;
-                keys_and_distances_per_dataset[task_idx].offset = static_cast<u32_t>(dataset_idx);
-                keys_and_distances_per_dataset[task_idx].distance = static_cast<f32_t>(distance);
+        std::atomic<bool> cancelled{false};
+        executor.dynamic(tiles_count, [&](std::size_t thread_idx, std::size_t tile_idx) {
+            std::size_t dataset_begin = tile_idx * dataset_tile;
+            std::size_t dataset_end = (std::min)(dataset_begin + dataset_tile, dataset_count);
+            exact_offset_and_distance_t* thread_lists =
+                keys_and_distances_per_thread + thread_idx * queries_count * wanted;
+            std::size_t* thread_counts = counts.data() + thread_idx * queries_count;
+
+            // Every dataset vector is scored against a batch of queries in one kernel call
+            byte_t const* batch_queries[queries_batch()];
+            metric_punned_t::result_t batch_distances[queries_batch()];
+            for (std::size_t block_begin = 0; block_begin < queries_count; block_begin += queries_block) {
+                std::size_t block_end = (std::min)(block_begin + queries_block, queries_count);
+                for (std::size_t batch_begin = block_begin; batch_begin < block_end; batch_begin += queries_batch()) {
+                    std::size_t batch_size = (std::min)(block_end - batch_begin, queries_batch());
+                    for (std::size_t i = 0; i != batch_size; ++i)
+                        batch_queries[i] = queries_data + (batch_begin + i) * queries_stride;
+
+                    for (std::size_t dataset_idx = dataset_begin; dataset_idx != dataset_end; ++dataset_idx) {
+                        byte_t const* dataset = dataset_data + dataset_idx * dataset_stride;
+                        metric(dataset, batch_queries, batch_size, batch_distances);
+                        for (std::size_t i = 0; i != batch_size; ++i) {
+                            std::size_t query_idx = batch_begin + i;
+                            exact_offset_and_distance_t candidate;
+                            candidate.offset = static_cast<u32_t>(dataset_idx);
+                            candidate.distance = static_cast<f32_t>(batch_distances[i]);
+                            insert_bounded(thread_lists + query_idx * wanted, thread_counts[query_idx], wanted,
+                                           candidate);
+                        }
+                    }
+                }
             }
 
             // It's more efficient in this case to report progress from a single thread
-            processed += queries_count;
-            if (thread_idx == 0)
-                if (!progress(processed.load(), tasks_count))
-                    return false;
+            processed += (dataset_end - dataset_begin) * queries_count;
+            if (thread_idx == 0 && !progress(processed.load(), tasks_count)) {
+                cancelled = true;
+                return false;
+            }
             return true;
         });
-        if (processed.load() != tasks_count)
+        if (cancelled.load() || processed.load() != tasks_count)
             return {};
 
-        // §2. Transpose in a single thread to avoid contention writing into the same memory buffers
-        for (std::size_t query_idx = 0; query_idx != queries_count; ++query_idx) {
-            for (std::size_t dataset_idx = 0; dataset_idx != dataset_count; ++dataset_idx) {
-                std::size_t from_idx = queries_count * dataset_idx + query_idx;
-                std::size_t to_idx = dataset_count * query_idx + dataset_idx;
-                keys_and_distances_per_query[to_idx] = keys_and_distances_per_dataset[from_idx];
-            }
-        }
-
-        // §3. Partial-sort every query result
+        // §2. Merge the thread-local lists of every query, padding the missing entries
         executor.fixed(queries_count, [&](std::size_t, std::size_t query_idx) {
-            auto start = keys_and_distances_per_query + dataset_count * query_idx;
-            if (wanted > 1) {
-                // TODO: Consider alternative sorting approaches
-                // radix_sort(start, start + dataset_count, wanted);
-                // std::sort(start, start + dataset_count, &smaller_distance);
-                std::partial_sort(start, start + wanted, start + dataset_count, &smaller_distance);
-            } else {
-                auto min_it = std::min_element(start, start + dataset_count, &smaller_distance);
-                if (min_it != start)
-                    std::swap(*min_it, *start);
+            exact_offset_and_distance_t* merged = keys_and_distances_per_query + query_idx * wanted;
+            std::size_t merged_count = 0;
+            for (std::size_t thread_idx = 0; thread_idx != threads_count; ++thread_idx) {
+                std::size_t list_idx = thread_idx * queries_count + query_idx;
+                exact_offset_and_distance_t const* list = keys_and_distances_per_thread + list_idx * wanted;
+                for (std::size_t i = 0; i != counts[list_idx]; ++i)
+                    insert_bounded(merged, merged_count, wanted, list[i]);
+            }
+            for (; merged_count != wanted; ++merged_count) {
+                merged[merged_count].offset = std::numeric_limits<u32_t>::max();
+                merged[merged_count].distance = std::numeric_limits<f32_t>::max();
             }
         });
 
         // At the end report the latest numbers, because the reporter thread may be finished earlier
         progress(tasks_count, tasks_count);
-        return {keys_and_distances_per_query, wanted, queries_count,
-                dataset_count * sizeof(exact_offset_and_distance_t)};
+        return {keys_and_distances_per_query, wanted, queries_count, wanted * sizeof(exact_offset_and_distance_t)};
+    }
+};
+
+/**
+ *  @brief  Product Quantization (PQ) codebooks for compressing equi-dimensional `f32_t` vectors.
+ *
+ *  Every vector is split into `subspaces()` equal chunks, and every chunk is replaced with the
+ *  index of the closest of `centroids()` centroids, learned with k-means. So a code takes one
+ *  byte per subspace. Distances from a full-precision query to stored codes are estimated with
+ *  Asymmetric Distance Computation (ADC): a per-query lookup table of distances to every
+ *  centroid in every subspace is summed by code. Distances between two codes are computed
+ *  symmetrically, by comparing the centroids. Supports `l2sq_k`, `ip_k`, and `cos_k` metrics.
+ */
+class product_quantizer_t {
+  public:
+    using code_t = std::uint8_t;
+
+    /// @brief  Number of centroids in every subspace, addressable by a single-byte code.
+    static constexpr std::size_t centroids() noexcept { return 256; }
+
+    struct train_result_t {
+        error_t error{};
+
+        explicit operator bool() const noexcept { return !error; }
+        train_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+    };
+
+  private:
+    metric_kind_t metric_kind_ = metric_kind_t::unknown_k;
+    std::size_t dimensions_ = 0;
+    std::size_t subspaces_ = 0;
+    /// @brief  Row-major tensor of `subspaces_` x `centroids()` x `subspace_dimensions()` scalars.
+    std::vector<f32_t> centroids_;
+
+  public:
+    explicit operator bool() const noexcept { return !centroids_.empty(); }
+    metric_kind_t metric_kind() const noexcept { return metric_kind_; }
+    std::size_t dimensions() const noexcept { return dimensions_; }
+    std::size_t subspaces() const noexcept { return subspaces_; }
+    std::size_t subspace_dimensions() const noexcept { return subspaces_ ? dimensions_ / subspaces_ : 0; }
+    std::size_t bytes_per_code() const noexcept { return subspaces_ * sizeof(code_t); }
+    std::size_t lookup_table_length() const noexcept { return subspaces_ * centroids(); }
+
+    f32_t const* centroid(std::size_t subspace, std::size_t code) const noexcept {
+        return centroids_.data() + (subspace * centroids() + code) * subspace_dimensions();
+    }
+
+    /**
+     *  @brief  Learns the codebooks with k-means, independently in every subspace.
+     *
+     *  @param[in] vectors Row-major matrix of ::count training vectors of ::dimensions scalars.
+     *  @param[in] subspaces Number of chunks per vector, must divide the ::dimensions.
+     *  @param[in] iterations Number of k-means refinement rounds.
+     *  @param[in] executor Thread-pool to train different subspaces concurrently.
+     */
+    template <typename executor_at = dummy_executor_t>
+    train_result_t train(                                                                       //
+        f32_t const* vectors, std::size_t count, std::size_t dimensions, std::size_t subspaces, //
+        metric_kind_t metric_kind, std::size_t iterations = 16, executor_at&& executor = executor_at{}) {
+
+        train_result_t result;
+        if (metric_kind != metric_kind_t::l2sq_k && metric_kind != metric_kind_t::ip_k &&
+            metric_kind != metric_kind_t::cos_k)
+            return result.failed("Product quantization supports only L2, inner-product, and cosine metrics");
+        if (!subspaces || !dimensions || dimensions % subspaces)
+            return result.failed("Number of subspaces must divide the number of dimensions");
+        if (!count)
+            return result.failed("Training requires at least one vector");
+
+        metric_kind_ = metric_kind;
+        dimensions_ = dimensions;
+        subspaces_ = subspaces;
+        centroids_.resize(subspaces * centroids() * subspace_dimensions());
+
+        // Angular distances are learned over normalized vectors
+        std::vector<f32_t> normalized;
+        if (metric_kind == metric_kind_t::cos_k) {
+            normalized.resize(count * dimensions);
+            for (std::size_t i = 0; i != count; ++i) {
+                f32_t const* vector = vectors + i * dimensions;
+                f32_t inverse_norm = inverse_norm_(vector);
+                for (std::size_t j = 0; j != dimensions; ++j)
+                    normalized[i * dimensions + j] = vector[j] * inverse_norm;
+            }
+            vectors = normalized.data();
+        }
+
+        std::size_t const sub_dims = subspace_dimensions();
+        executor.fixed(subspaces, [&](std::size_t, std::size_t subspace) {
+            f32_t* subspace_centroids = centroids_.data() + subspace * centroids() * sub_dims;
+            auto subvector = [&](std::size_t i) { return vectors + i * dimensions + subspace * sub_dims; };
+
+            // Initialize with evenly spaced samples
+            for (std::size_t code = 0; code != centroids(); ++code)
+                std::memcpy(subspace_centroids + code * sub_dims, subvector(code * count / centroids()),
+                            sub_dims * sizeof(f32_t));
+
+            std::vector<code_t> assignments(count);
+            std::vector<f32_t> sums(centroids() * sub_dims);
+            std::vector<std::size_t> populations(centroids());
+            for (std::size_t iteration = 0; iteration != iterations; ++iteration) {
+                for (std::size_t i = 0; i != count; ++i)
+                    assignments[i] = closest_(subspace_centroids, subvector(i), 1);
+
+                std::fill(sums.begin(), sums.end(), 0.f);
+                std::fill(populations.begin(), populations.end(), 0);
+                for (std::size_t i = 0; i != count; ++i) {
+                    f32_t const* sub = subvector(i);
+                    f32_t* sum = sums.data() + assignments[i] * sub_dims;
+                    for (std::size_t j = 0; j != sub_dims; ++j)
+                        sum[j] += sub[j];
+                    populations[assignments[i]]++;
+                }
+
+                // Empty clusters keep their previous centroids
+                for (std::size_t code = 0; code != centroids(); ++code)
+                    if (populations[code])
+                        for (std::size_t j = 0; j != sub_dims; ++j)
+                            subspace_centroids[code * sub_dims + j] =
+                                sums[code * sub_dims + j] / static_cast<f32_t>(populations[code]);
+            }
+        });
+        return result;
+    }
+
+    /**
+     *  @brief  Replaces every chunk of the ::vector with the code of the closest centroid.
+     *  @param[out] code Buffer of `bytes_per_code()` bytes.
+     */
+    void encode(f32_t const* vector, code_t* code) const noexcept {
+        f32_t scale = metric_kind_ == metric_kind_t::cos_k ? inverse_norm_(vector) : 1.f;
+        std::size_t const sub_dims = subspace_dimensions();
+        for (std::size_t subspace = 0; subspace != subspaces_; ++subspace)
+            code[subspace] = closest_(centroid(subspace, 0), vector + subspace * sub_dims, scale);
+    }
+
+    /**
+     *  @brief  Reconstructs an approximation of the original vector from its ::code.
+     *  @param[out] vector Buffer of `dimensions()` scalars.
+     */
+    void decode(code_t const* code, f32_t* vector) const noexcept {
+        std::size_t const sub_dims = subspace_dimensions();
+        for (std::size_t subspace = 0; subspace != subspaces_; ++subspace)
+            std::memcpy(vector + subspace * sub_dims, centroid(subspace, code[subspace]), sub_dims * sizeof(f32_t));
+    }
+
+    /**
+     *  @brief  Precomputes the distances from the ::query to every centroid in every subspace.
+     *  @param[out] table Buffer of `lookup_table_length()` scalars.
+     */
+    void lookup_table(f32_t const* query, f32_t* table) const noexcept {
+        f32_t scale = metric_kind_ == metric_kind_t::cos_k ? inverse_norm_(query) : 1.f;
+        std::size_t const sub_dims = subspace_dimensions();
+        for (std::size_t subspace = 0; subspace != subspaces_; ++subspace) {
+            f32_t const* sub_query = query + subspace * sub_dims;
+            for (std::size_t code = 0; code != centroids(); ++code)
+                table[subspace * centroids() + code] = partial_distance_(sub_query, scale, centroid(subspace, code));
+        }
+    }
+
+    /// @brief  Estimates the distance from the query, described by the lookup ::table, to the ::code.
+    f32_t asymmetric_distance(f32_t const* table, code_t const* code) const noexcept {
+        f32_t distance = metric_kind_ == metric_kind_t::l2sq_k ? 0.f : 1.f;
+        for (std::size_t subspace = 0; subspace != subspaces_; ++subspace)
+            distance += table[subspace * centroids() + code[subspace]];
+        return distance;
+    }
+
+    /// @brief  Estimates the distance between two encoded vectors.
+    f32_t symmetric_distance(code_t const* a, code_t const* b) const noexcept {
+        f32_t distance = metric_kind_ == metric_kind_t::l2sq_k ? 0.f : 1.f;
+        for (std::size_t subspace = 0; subspace != subspaces_; ++subspace)
+            distance += partial_distance_(centroid(subspace, a[subspace]), 1.f, centroid(subspace, b[subspace]));
+        return distance;
+    }
+
+    std::size_t serialized_length() const noexcept {
+        return sizeof(std::uint64_t) * 3 + centroids_.size() * sizeof(f32_t);
+    }
+
+    /**
+     *  @brief  Saves the codebooks, starting with the metric kind, dimensions, and number of subspaces.
+     */
+    template <typename output_callback_at>
+    serialization_result_t save_to_stream(output_callback_at&& output) const noexcept {
+        serialization_result_t result;
+        std::uint64_t header[3];
+        header[0] = static_cast<std::uint64_t>(metric_kind_);
+        header[1] = static_cast<std::uint64_t>(dimensions_);
+        header[2] = static_cast<std::uint64_t>(subspaces_);
+        if (!output(&header, sizeof(header)))
+            return result.failed("Failed to serialize the quantizer header into stream");
+        if (!output(centroids_.data(), centroids_.size() * sizeof(f32_t)))
+            return result.failed("Failed to serialize the codebooks into stream");
+        return result;
+    }
+
+    template <typename input_callback_at>
+    serialization_result_t load_from_stream(input_callback_at&& input) noexcept(false) {
+        serialization_result_t result;
+        std::uint64_t header[3];
+        if (!input(&header, sizeof(header)))
+            return result.failed("Failed to read the quantizer header");
+        metric_kind_ = static_cast<metric_kind_t>(header[0]);
+        dimensions_ = static_cast<std::size_t>(header[1]);
+        subspaces_ = static_cast<std::size_t>(header[2]);
+        if (!subspaces_ || dimensions_ % subspaces_)
+            return result.failed("Quantizer header is corrupted");
+        centroids_.resize(subspaces_ * centroids() * subspace_dimensions());
+        if (!input(centroids_.data(), centroids_.size() * sizeof(f32_t)))
+            return result.failed("Failed to read the codebooks");
+        return result;
+    }
+
+  private:
+    f32_t inverse_norm_(f32_t const* vector) const noexcept {
+        f32_t squared_norm = 0;
+        for (std::size_t j = 0; j != dimensions_; ++j)
+            squared_norm += vector[j] * vector[j];
+        return squared_norm > 0 ? 1.f / std::sqrt(squared_norm) : 1.f;
+    }
+
+    /// @brief  Contribution of a single subspace into the distance, with the first argument scaled.
+    f32_t partial_distance_(f32_t const* a, f32_t a_scale, f32_t const* b) const noexcept {
+        std::size_t const sub_dims = subspace_dimensions();
+        f32_t result = 0;
+        if (metric_kind_ == metric_kind_t::l2sq_k)
+            for (std::size_t j = 0; j != sub_dims; ++j)
+                result += (a[j] * a_scale - b[j]) * (a[j] * a_scale - b[j]);
+        else
+            for (std::size_t j = 0; j != sub_dims; ++j)
+                result -= a[j] * a_scale * b[j];
+        return result;
+    }
+
+    /// @brief  Finds the closest centroid in Euclidean space, which is also how the codebooks are trained.
+    code_t closest_(f32_t const* subspace_centroids, f32_t const* sub_vector, f32_t scale) const noexcept {
+        std::size_t const sub_dims = subspace_dimensions();
+        code_t closest_code = 0;
+        f32_t closest_distance = std::numeric_limits<f32_t>::max();
+        for (std::size_t code = 0; code != centroids(); ++code) {
+            f32_t const* candidate = subspace_centroids + code * sub_dims;
+            f32_t distance = 0;
+            for (std::size_t j = 0; j != sub_dims; ++j)
+                distance += (sub_vector[j] * scale - candidate[j]) * (sub_vector[j] * scale - candidate[j]);
+            if (distance < closest_distance)
+                closest_distance = distance, closest_code = static_cast<code_t>(code);
+        }
+        return closest_code;
     }
 };
 
@@ -1889,12 +2681,14 @@ class flat_hash_multi_set_gt {
         // Initialize new buckets to empty
         std::memset(data_, 0, buckets_ * bytes_per_bucket());
 
-        // Copy elements and bucket headers
+        // Copy elements and bucket headers, keeping the deleted entries,
+        // so that the linear probing sequences aren't cut short
         for (std::size_t i = 0; i < capacity_slots_; ++i) {
             slot_ref_t old_slot = other.slot_ref(i);
-            if ((old_slot.header.populated & old_slot.mask) && !(old_slot.header.deleted & old_slot.mask)) {
+            if (old_slot.header.populated & old_slot.mask) {
                 slot_ref_t new_slot = slot_ref(i);
                 populate_slot(new_slot, old_slot.element);
+                new_slot.header.deleted |= old_slot.header.deleted & old_slot.mask;
             }
         }
     }
@@ -1929,12 +2723,14 @@ class flat_hash_multi_set_gt {
         // Initialize new buckets to empty
         std::memset(data_, 0, buckets_ * bytes_per_bucket());
 
-        // Copy elements and bucket headers
+        // Copy elements and bucket headers, keeping the deleted entries,
+        // so that the linear probing sequences aren't cut short
         for (std::size_t i = 0; i < capacity_slots_; ++i) {
             slot_ref_t old_slot = other.slot_ref(i);
-            if ((old_slot.header.populated & old_slot.mask) && !(old_slot.header.deleted & old_slot.mask)) {
+            if (old_slot.header.populated & old_slot.mask) {
                 slot_ref_t new_slot = slot_ref(i);
                 populate_slot(new_slot, old_slot.element);
+                new_slot.header.deleted |= old_slot.header.deleted & old_slot.mask;
             }
         }
 
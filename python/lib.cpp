@@ -14,8 +14,10 @@
 #define __cpp_exceptions 1
 #endif
 
-#include <limits> // `std::numeric_limits`
-#include <thread> // `std::thread`
+#include <limits>       // `std::numeric_limits`
+#include <mutex>        // `std::mutex`, `std::unique_lock`
+#include <shared_mutex> // `std::shared_mutex`
+#include <thread>       // `std::thread`
 
 #define _CRT_SECURE_NO_WARNINGS
 #define PY_SSIZE_T_CLEAN
@@ -39,6 +41,7 @@ using distance_t = distance_punned_t;
 using dense_key_t = typename index_dense_t::vector_key_t;
 using dense_add_result_t = typename index_dense_t::add_result_t;
 using dense_search_result_t = typename index_dense_t::search_result_t;
+using dense_range_search_result_t = typename index_dense_t::range_search_result_t;
 using dense_labeling_result_t = typename index_dense_t::labeling_result_t;
 using dense_cluster_result_t = typename index_dense_t::cluster_result_t;
 using dense_clustering_result_t = typename index_dense_t::clustering_result_t;
@@ -64,9 +67,79 @@ struct dense_index_py_t : public index_dense_t {
     using native_t::search;
     using native_t::size;
 
+    /// @brief  Taken exclusively by the batches sharing the thread contexts and by the operations replacing
+    ///         the storage or mutating the index, and shared by the readers, whether they hold the GIL or not.
+    mutable std::shared_mutex index_mutex;
+
     dense_index_py_t(native_t&& base) : index_dense_t(std::move(base)) {}
+    dense_index_py_t(dense_index_py_t&& other) : index_dense_t(std::move(other)) {}
 };
 
+/**
+ *  @brief  Releases the GIL for a long-running operation, letting the other Python threads run meanwhile,
+ *          and waits for the conflicting operations on the same index to finish. The GIL is released first,
+ *          so that the thread holding the index can re-acquire it to report the progress.
+ */
+template <typename lock_at> class gil_free_lock_gt {
+    py::gil_scoped_release release_;
+    lock_at lock_;
+
+  public:
+    explicit gil_free_lock_gt(dense_index_py_t const& index) : release_(), lock_(index.index_mutex) {}
+};
+
+/**
+ *  @brief  Locks the index for a short operation, that keeps the GIL. The GIL is only released
+ *          while waiting, for the same reason as in `gil_free_lock_gt`.
+ */
+template <typename lock_at> class gil_held_lock_gt {
+    lock_at lock_;
+
+    static lock_at acquire(std::shared_mutex& mutex) {
+        lock_at lock(mutex, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            py::gil_scoped_release release;
+            lock.lock();
+        }
+        return lock;
+    }
+
+  public:
+    explicit gil_held_lock_gt(dense_index_py_t const& index) : lock_(acquire(index.index_mutex)) {}
+};
+
+using gil_free_lock_t = gil_free_lock_gt<std::unique_lock<std::shared_mutex>>;
+using gil_free_shared_lock_t = gil_free_lock_gt<std::shared_lock<std::shared_mutex>>;
+using gil_held_lock_t = gil_held_lock_gt<std::unique_lock<std::shared_mutex>>;
+using gil_held_shared_lock_t = gil_held_lock_gt<std::shared_lock<std::shared_mutex>>;
+
+/// @brief  Binds a `const` member of the index, holding the shared index lock for the call.
+template <typename result_at, typename... args_at>
+static auto shared_locked(result_at (index_dense_t::*member)(args_at...) const) {
+    return [member](dense_index_py_t const& index, args_at... args) -> result_at {
+        gil_held_shared_lock_t lock{index};
+        return (index.*member)(args...);
+    };
+}
+
+/// @brief  Binds a `const noexcept` member of the index, holding the shared index lock for the call.
+template <typename result_at, typename... args_at>
+static auto shared_locked(result_at (index_dense_t::*member)(args_at...) const noexcept) {
+    return [member](dense_index_py_t const& index, args_at... args) -> result_at {
+        gil_held_shared_lock_t lock{index};
+        return (index.*member)(args...);
+    };
+}
+
+/// @brief  Binds a mutating member of the index, holding the exclusive index lock for the call.
+template <typename result_at, typename... args_at>
+static auto unique_locked(result_at (index_dense_t::*member)(args_at...)) {
+    return [member](dense_index_py_t& index, args_at... args) -> result_at {
+        gil_held_lock_t lock{index};
+        return (index.*member)(args...);
+    };
+}
+
 struct dense_indexes_py_t {
     std::vector<std::shared_ptr<dense_index_py_t>> shards_;
 
@@ -156,6 +229,110 @@ template <typename result_at> void forward_error(result_at&& result) {
 
 using atomic_error_t = std::atomic<char const*>;
 
+/**
+ *  @brief  Checks for signals and reports the progress from the first thread of a job, that runs with
+ *          the GIL released. Re-acquires the GIL only once every `period` calls, to let the other
+ *          Python threads run in between, and always for the last report.
+ */
+class gil_free_progress_t {
+    progress_t const& progress_;
+    std::size_t period_;
+    std::size_t calls_ = 0;
+
+  public:
+    gil_free_progress_t(progress_t const& progress, std::size_t period = 64) noexcept
+        : progress_(progress), period_(period) {}
+
+    bool operator()(std::size_t processed, std::size_t total) {
+        if (++calls_ % period_ != 0 && processed != total)
+            return true;
+        py::gil_scoped_acquire gil;
+        return PyErr_CheckSignals() == 0 && progress_(processed, total);
+    }
+};
+
+/**
+ *  @brief  Rows of a matrix exported via the Buffer Protocol, with arbitrary strides in both dimensions.
+ *          Rows with contiguous scalars are used in-place, and the others are gathered into
+ *          a per-thread scratch space, so that the transposed or sliced NumPy views aren't copied upfront.
+ */
+class strided_rows_t {
+    byte_t const* data_;
+    Py_ssize_t rows_stride_;
+    Py_ssize_t scalars_stride_;
+    Py_ssize_t scalar_bytes_;
+    Py_ssize_t scalars_;
+    std::vector<byte_t> scratch_;
+
+  public:
+    strided_rows_t(py::buffer_info const& info, std::size_t threads)
+        : data_(reinterpret_cast<byte_t const*>(info.ptr)), rows_stride_(info.strides[0]),
+          scalars_stride_(info.strides[1]), scalar_bytes_(info.itemsize), scalars_(info.shape[1]) {
+        if (!contiguous())
+            scratch_.resize(threads * static_cast<std::size_t>(scalars_ * scalar_bytes_));
+    }
+
+    /// @brief  Whether the returned rows point into the original buffer, outliving the call.
+    bool contiguous() const noexcept { return scalars_stride_ == scalar_bytes_ || scalars_ <= 1; }
+
+    byte_t const* operator()(std::size_t thread, std::size_t row) noexcept {
+        byte_t const* begin = data_ + static_cast<Py_ssize_t>(row) * rows_stride_;
+        if (contiguous())
+            return begin;
+        byte_t* gathered = scratch_.data() + thread * static_cast<std::size_t>(scalars_ * scalar_bytes_);
+        for (Py_ssize_t i = 0; i != scalars_; ++i)
+            std::memcpy(gathered + i * scalar_bytes_, begin + i * scalars_stride_, scalar_bytes_);
+        return gathered;
+    }
+};
+
+/**
+ *  @brief  Exposes a matrix exported via the Buffer Protocol as a pointer with a non-negative row stride,
+ *          copying it into ::copy only if the scalars in its rows aren't contiguous or the rows are reversed.
+ *  @return Pointer to the first row, with the ::stride between the rows.
+ */
+static byte_t const* contiguous_rows(py::buffer_info const& info, std::vector<byte_t>& copy, std::size_t& stride) {
+    Py_ssize_t const rows = info.shape[0], scalars = info.shape[1], scalar_bytes = info.itemsize;
+    if ((info.strides[1] == scalar_bytes || scalars <= 1) && info.strides[0] >= 0) {
+        stride = static_cast<std::size_t>(info.strides[0]);
+        return reinterpret_cast<byte_t const*>(info.ptr);
+    }
+
+    stride = static_cast<std::size_t>(scalars * scalar_bytes);
+    copy.resize(static_cast<std::size_t>(rows) * stride);
+    byte_t const* data = reinterpret_cast<byte_t const*>(info.ptr);
+    for (Py_ssize_t row = 0; row != rows; ++row)
+        for (Py_ssize_t i = 0; i != scalars; ++i)
+            std::memcpy(copy.data() + row * stride + i * scalar_bytes,
+                        data + row * info.strides[0] + i * info.strides[1], scalar_bytes);
+    return copy.data();
+}
+
+/**
+ *  @brief  Validates a preallocated output array, passed by the user, or allocates a new one, if it is `None`.
+ *          The rows of a matrix must be contiguous, but the rows themselves can be spread apart.
+ */
+template <typename scalar_at>
+static py::array_t<scalar_at> output_array(py::object const& out, Py_ssize_t rows, Py_ssize_t columns,
+                                           char const* name) {
+    if (out.is_none())
+        return columns ? py::array_t<scalar_at>({rows, columns}) : py::array_t<scalar_at>(rows);
+
+    if (!py::isinstance<py::array_t<scalar_at>>(out))
+        throw std::invalid_argument(std::string("Incompatible type of the output array: ") + name);
+    py::array_t<scalar_at> array = py::reinterpret_borrow<py::array_t<scalar_at>>(out);
+    if (!array.writeable())
+        throw std::invalid_argument(std::string("The output array must be writeable: ") + name);
+    bool const shape_matches = columns //
+                                   ? array.ndim() == 2 && array.shape(0) == rows && array.shape(1) == columns
+                                   : array.ndim() == 1 && array.shape(0) == rows;
+    if (!shape_matches)
+        throw std::invalid_argument(std::string("Incompatible shape of the output array: ") + name);
+    if (columns > 1 && array.strides(1) != static_cast<Py_ssize_t>(sizeof(scalar_at)))
+        throw std::invalid_argument(std::string("The rows of the output array must be contiguous: ") + name);
+    return array;
+}
+
 template <typename scalar_at>
 static void add_typed_to_index(                                            //
     dense_index_py_t& index,                                               //
@@ -164,32 +341,44 @@ static void add_typed_to_index(                                            //
     progress_func_t const& progress) {
 
     Py_ssize_t vectors_count = vectors_info.shape[0];
-    byte_t const* vectors_data = reinterpret_cast<byte_t const*>(vectors_info.ptr);
+    strided_rows_t vectors_rows(vectors_info, threads);
     byte_t const* keys_data = reinterpret_cast<byte_t const*>(keys_info.ptr);
     atomic_error_t atomic_error{nullptr};
+    if (!force_copy && !vectors_rows.contiguous())
+        throw std::invalid_argument("Vectors with non-contiguous scalars can't be added without copying!");
 
     // Progress status
     progress_t progress_{progress};
+    gil_free_progress_t gil_free_progress{progress_};
     std::atomic<std::size_t> processed{0};
 
-    executor_default_t{threads}.dynamic(vectors_count, [&](std::size_t thread_idx, std::size_t task_idx) {
-        dense_key_t key = *reinterpret_cast<dense_key_t const*>(keys_data + task_idx * keys_info.strides[0]);
-        scalar_at const* vector = reinterpret_cast<scalar_at const*>(vectors_data + task_idx * vectors_info.strides[0]);
-        dense_add_result_t result = index.add(key, vector, thread_idx, force_copy);
-        if (!result) {
-            atomic_error = result.error.release();
-            return false;
-        }
-
-        // We don't want to check for signals from multiple threads
-        ++processed;
-        if (thread_idx == 0)
-            if (PyErr_CheckSignals() != 0 || !progress_(processed.load(), vectors_count)) {
-                atomic_error.store("Operation has been terminated");
+    {
+        // Other Python threads may run meanwhile
+        gil_free_lock_t lock{index};
+        if (vectors_info.shape[1] != static_cast<Py_ssize_t>(index.scalar_words()))
+            throw std::invalid_argument("The number of vector dimensions doesn't match!");
+        if (!index.reserve(index_limits_t(ceil2(index.size() + vectors_count), threads)))
+            throw std::invalid_argument("Out of memory!");
+        executor_default_t{threads}.dynamic(vectors_count, [&](std::size_t thread_idx, std::size_t task_idx) {
+            Py_ssize_t const key_offset = static_cast<Py_ssize_t>(task_idx) * keys_info.strides[0];
+            dense_key_t key = *reinterpret_cast<dense_key_t const*>(keys_data + key_offset);
+            scalar_at const* vector = reinterpret_cast<scalar_at const*>(vectors_rows(thread_idx, task_idx));
+            dense_add_result_t result = index.add(key, vector, thread_idx, force_copy);
+            if (!result) {
+                atomic_error = result.error.release();
                 return false;
             }
-        return true;
-    });
+
+            // We don't want to check for signals from multiple threads
+            ++processed;
+            if (thread_idx == 0)
+                if (!gil_free_progress(processed.load(), vectors_count)) {
+                    atomic_error.store("Operation has been terminated");
+                    return false;
+                }
+            return true;
+        });
+    }
 
     // At the end report the latest numbers, because the reporter thread may be finished earlier
     progress_(processed.load(), vectors_count);
@@ -222,17 +411,11 @@ static void add_many_to_index(                            //
 
     Py_ssize_t keys_count = keys_info.shape[0];
     Py_ssize_t vectors_count = vectors_info.shape[0];
-    Py_ssize_t vectors_dimensions = vectors_info.shape[1];
-    if (vectors_dimensions != static_cast<Py_ssize_t>(index.scalar_words()))
-        throw std::invalid_argument("The number of vector dimensions doesn't match!");
-
     if (keys_count != vectors_count)
         throw std::invalid_argument("Number of keys and vectors must match!");
 
     if (!threads)
         threads = std::thread::hardware_concurrency();
-    if (!index.reserve(index_limits_t(ceil2(index.size() + vectors_count), threads)))
-        throw std::invalid_argument("Out of memory!");
 
     // clang-format off
     switch (numpy_string_to_kind(vectors_info.format)) {
@@ -259,41 +442,50 @@ static void search_typed(                                   //
     auto counts_py1d = counts_py.template mutable_unchecked<1>();
 
     Py_ssize_t vectors_count = vectors_info.shape[0];
-    byte_t const* vectors_data = reinterpret_cast<byte_t const*>(vectors_info.ptr);
-
+    std::size_t const requested_threads = threads;
     if (!threads)
         threads = std::thread::hardware_concurrency();
-    if (!index.reserve(index_limits_t(index.size(), threads)))
-        throw std::invalid_argument("Out of memory!");
+    strided_rows_t vectors_rows(vectors_info, threads);
 
     // Progress status
     progress_t progress_{progress};
+    gil_free_progress_t gil_free_progress{progress_};
     std::atomic<std::size_t> processed{0};
 
     atomic_error_t atomic_error{nullptr};
-    executor_default_t{threads}.dynamic(vectors_count, [&](std::size_t thread_idx, std::size_t task_idx) {
-        scalar_at const* vector = (scalar_at const*)(vectors_data + task_idx * vectors_info.strides[0]);
-        dense_search_result_t result = index.search(vector, wanted, thread_idx, exact);
-        if (!result) {
-            atomic_error = result.error.release();
-            return false;
-        }
+    {
+        // Other Python threads may run meanwhile
+        gil_free_lock_t lock{index};
+        if (index.limits().threads_search < requested_threads)
+            throw std::invalid_argument("Can't use that many threads!");
+        if (vectors_info.shape[1] != static_cast<Py_ssize_t>(index.scalar_words()))
+            throw std::invalid_argument("The number of vector dimensions doesn't match!");
+        if (!index.reserve(index_limits_t(index.size(), threads)))
+            throw std::invalid_argument("Out of memory!");
+        executor_default_t{threads}.dynamic(vectors_count, [&](std::size_t thread_idx, std::size_t task_idx) {
+            scalar_at const* vector = reinterpret_cast<scalar_at const*>(vectors_rows(thread_idx, task_idx));
+            dense_search_result_t result = index.search(vector, wanted, thread_idx, exact);
+            if (!result) {
+                atomic_error = result.error.release();
+                return false;
+            }
 
-        counts_py1d(task_idx) =
-            static_cast<Py_ssize_t>(result.dump_to(&keys_py2d(task_idx, 0), &distances_py2d(task_idx, 0)));
+            counts_py1d(task_idx) =
+                static_cast<Py_ssize_t>(result.dump_to(&keys_py2d(task_idx, 0), &distances_py2d(task_idx, 0)));
 
-        stats_visited_members += result.visited_members;
-        stats_computed_distances += result.computed_distances;
+            stats_visited_members += result.visited_members;
+            stats_computed_distances += result.computed_distances;
 
-        // We don't want to check for signals from multiple threads
-        ++processed;
-        if (thread_idx == 0)
-            if (PyErr_CheckSignals() != 0 || !progress_(processed.load(), vectors_count)) {
-                atomic_error.store("Operation has been terminated");
-                return false;
-            }
-        return true;
-    });
+            // We don't want to check for signals from multiple threads
+            ++processed;
+            if (thread_idx == 0)
+                if (!gil_free_progress(processed.load(), vectors_count)) {
+                    atomic_error.store("Operation has been terminated");
+                    return false;
+                }
+            return true;
+        });
+    }
 
     // At the end report the latest numbers, because the reporter thread may be finished earlier
     progress_(processed.load(), vectors_count);
@@ -319,12 +511,12 @@ static void search_typed(                                       //
     auto counts_py1d = counts_py.template mutable_unchecked<1>();
 
     Py_ssize_t vectors_count = vectors_info.shape[0];
-    byte_t const* vectors_data = reinterpret_cast<byte_t const*>(vectors_info.ptr);
     for (std::size_t vector_idx = 0; vector_idx != static_cast<std::size_t>(vectors_count); ++vector_idx)
         counts_py1d(vector_idx) = 0;
 
     if (!threads)
         threads = std::thread::hardware_concurrency();
+    strided_rows_t vectors_rows(vectors_info, threads);
 
     bitset_t query_mutexes(static_cast<std::size_t>(vectors_count));
     if (!query_mutexes)
@@ -332,51 +524,62 @@ static void search_typed(                                       //
 
     // Progress status
     progress_t progress_{progress};
+    gil_free_progress_t gil_free_progress{progress_, 1};
     std::atomic<std::size_t> processed{0};
 
     atomic_error_t atomic_error{nullptr};
-    executor_default_t{threads}.dynamic(indexes.shards_.size(), [&](std::size_t thread_idx, std::size_t task_idx) {
-        dense_index_py_t& index = *indexes.shards_[task_idx].get();
-
-        index_limits_t limits;
-        limits.members = index.size();
-        limits.threads_add = 0;
-        limits.threads_search = 1;
-        if (!index.reserve(limits)) {
-            atomic_error = "Out of memory!";
-            return false;
-        }
-
-        for (std::size_t vector_idx = 0; vector_idx != static_cast<std::size_t>(vectors_count); ++vector_idx) {
-            scalar_at const* vector = (scalar_at const*)(vectors_data + vector_idx * vectors_info.strides[0]);
-            dense_search_result_t result = index.search(vector, wanted, 0, exact);
-            if (!result) {
-                atomic_error = result.error.release();
+    {
+        // Other Python threads may run meanwhile, and every shard is locked while it is searched
+        py::gil_scoped_release release;
+        executor_default_t executor{threads};
+        executor.dynamic(indexes.shards_.size(), [&](std::size_t thread_idx, std::size_t task_idx) {
+            dense_index_py_t& index = *indexes.shards_[task_idx].get();
+            std::unique_lock<std::shared_mutex> shard_lock(index.index_mutex);
+            if (vectors_info.shape[1] != static_cast<Py_ssize_t>(index.scalar_words())) {
+                atomic_error = "The number of vector dimensions doesn't match!";
                 return false;
             }
 
-            {
-                auto lock = query_mutexes.lock(vector_idx);
-                counts_py1d(vector_idx) = static_cast<Py_ssize_t>(result.merge_into( //
-                    &keys_py2d(vector_idx, 0),                                       //
-                    &distances_py2d(vector_idx, 0),                                  //
-                    static_cast<std::size_t>(counts_py1d(vector_idx)),               //
-                    wanted));
+            index_limits_t limits;
+            limits.members = index.size();
+            limits.threads_add = 0;
+            limits.threads_search = 1;
+            if (!index.reserve(limits)) {
+                atomic_error = "Out of memory!";
+                return false;
             }
 
-            stats_visited_members += result.visited_members;
-            stats_computed_distances += result.computed_distances;
+            for (std::size_t vector_idx = 0; vector_idx != static_cast<std::size_t>(vectors_count); ++vector_idx) {
+                scalar_at const* vector = reinterpret_cast<scalar_at const*>(vectors_rows(thread_idx, vector_idx));
+                dense_search_result_t result = index.search(vector, wanted, 0, exact);
+                if (!result) {
+                    atomic_error = result.error.release();
+                    return false;
+                }
+
+                {
+                    auto lock = query_mutexes.lock(vector_idx);
+                    counts_py1d(vector_idx) = static_cast<Py_ssize_t>(result.merge_into( //
+                        &keys_py2d(vector_idx, 0),                                       //
+                        &distances_py2d(vector_idx, 0),                                  //
+                        static_cast<std::size_t>(counts_py1d(vector_idx)),               //
+                        wanted));
+                }
+
+                stats_visited_members += result.visited_members;
+                stats_computed_distances += result.computed_distances;
+            }
 
             // We don't want to check for signals from multiple threads
             ++processed;
             if (thread_idx == 0)
-                if (PyErr_CheckSignals() != 0 || !progress_(processed.load(), indexes.shards_.size())) {
+                if (!gil_free_progress(processed.load(), indexes.shards_.size())) {
                     atomic_error.store("Operation has been terminated");
                     return false;
                 }
-        }
-        return true;
-    });
+            return true;
+        });
+    }
 
     // At the end report the latest numbers, because the reporter thread may be finished earlier
     progress_(processed.load(), indexes.shards_.size());
@@ -390,8 +593,11 @@ static void search_typed(                                       //
 }
 
 /**
- *  @param vectors Matrix of vectors to search for.
+ *  @param vectors Matrix of vectors to search for, with any strides.
  *  @param wanted Number of matches per request.
+ *  @param keys_out Optional preallocated matrix for the neighbors, to be filled instead of allocating one.
+ *  @param distances_out Optional preallocated matrix for the distances.
+ *  @param counts_out Optional preallocated array for the match counts.
  *
  *  @return Tuple with:
  *      1. matrix of neighbors,
@@ -403,26 +609,23 @@ static void search_typed(                                       //
 template <typename index_at>
 static py::tuple search_many_in_index( //
     index_at& index, py::buffer vectors, std::size_t wanted, bool exact, std::size_t threads,
-    progress_func_t const& progress) {
+    progress_func_t const& progress, py::object const& keys_out, py::object const& distances_out,
+    py::object const& counts_out) {
 
     if (wanted == 0)
         return py::tuple(5);
 
-    if (index.limits().threads_search < threads)
-        throw std::invalid_argument("Can't use that many threads!");
-
+    // The index itself is only checked under its lock
     py::buffer_info vectors_info = vectors.request();
     if (vectors_info.ndim != 2)
         throw std::invalid_argument("Expects a matrix of vectors to add!");
 
     Py_ssize_t vectors_count = vectors_info.shape[0];
-    Py_ssize_t vectors_dimensions = vectors_info.shape[1];
-    if (vectors_dimensions != static_cast<Py_ssize_t>(index.scalar_words()))
-        throw std::invalid_argument("The number of vector dimensions doesn't match!");
-
-    py::array_t<dense_key_t> keys_py({vectors_count, static_cast<Py_ssize_t>(wanted)});
-    py::array_t<distance_t> distances_py({vectors_count, static_cast<Py_ssize_t>(wanted)});
-    py::array_t<Py_ssize_t> counts_py(vectors_count);
+    Py_ssize_t const wanted_columns = static_cast<Py_ssize_t>(wanted);
+    py::array_t<dense_key_t> keys_py = output_array<dense_key_t>(keys_out, vectors_count, wanted_columns, "keys");
+    py::array_t<distance_t> distances_py =
+        output_array<distance_t>(distances_out, vectors_count, wanted_columns, "distances");
+    py::array_t<Py_ssize_t> counts_py = output_array<Py_ssize_t>(counts_out, vectors_count, 0, "counts");
     std::atomic<std::size_t> stats_visited_members(0);
     std::atomic<std::size_t> stats_computed_distances(0);
 
@@ -446,9 +649,162 @@ static py::tuple search_many_in_index( //
     return results;
 }
 
+template <typename scalar_at>
+static void range_search_typed(                                                //
+    dense_index_py_t& index, py::buffer_info& vectors_info,                    //
+    distance_t radius, std::size_t max_count, bool exact, std::size_t threads, //
+    std::vector<std::vector<std::pair<distance_t, dense_key_t>>>& matches,     //
+    std::atomic<std::size_t>& stats_visited_members, std::atomic<std::size_t>& stats_computed_distances,
+    progress_func_t const& progress) {
+
+    Py_ssize_t vectors_count = vectors_info.shape[0];
+    std::size_t const requested_threads = threads;
+    if (!threads)
+        threads = std::thread::hardware_concurrency();
+    strided_rows_t vectors_rows(vectors_info, threads);
+
+    // Progress status
+    progress_t progress_{progress};
+    gil_free_progress_t gil_free_progress{progress_};
+    std::atomic<std::size_t> processed{0};
+
+    atomic_error_t atomic_error{nullptr};
+    {
+        // Other Python threads may run meanwhile
+        gil_free_lock_t lock{index};
+        if (index.limits().threads_search < requested_threads)
+            throw std::invalid_argument("Can't use that many threads!");
+        if (vectors_info.shape[1] != static_cast<Py_ssize_t>(index.scalar_words()))
+            throw std::invalid_argument("The number of vector dimensions doesn't match!");
+        if (!index.reserve(index_limits_t(index.size(), threads)))
+            throw std::invalid_argument("Out of memory!");
+
+        // The whole radius is traversed, keeping the closest `max_count` matches in a max-heap,
+        // preallocated if the limit is set, as the callback can't throw
+        std::size_t const heap_limit = (std::min)(max_count, index.size());
+        bool const limited = max_count != std::numeric_limits<std::size_t>::max();
+        executor_default_t{threads}.dynamic(vectors_count, [&](std::size_t thread_idx, std::size_t task_idx) {
+            scalar_at const* vector = reinterpret_cast<scalar_at const*>(vectors_rows(thread_idx, task_idx));
+            std::vector<std::pair<distance_t, dense_key_t>>& task_matches = matches[task_idx];
+            if (limited)
+                task_matches.reserve(heap_limit);
+            dense_range_search_result_t result = index.range_search(
+                vector, radius,
+                [&](dense_key_t key, distance_t distance) {
+                    if (task_matches.size() != heap_limit) {
+                        task_matches.emplace_back(distance, key);
+                        std::push_heap(task_matches.begin(), task_matches.end());
+                    } else if (heap_limit && distance < task_matches.front().first) {
+                        std::pop_heap(task_matches.begin(), task_matches.end());
+                        task_matches.back() = {distance, key};
+                        std::push_heap(task_matches.begin(), task_matches.end());
+                    }
+                },
+                std::numeric_limits<std::size_t>::max(), thread_idx, exact);
+            if (!result) {
+                atomic_error = result.error.release();
+                return false;
+            }
+
+            std::sort_heap(task_matches.begin(), task_matches.end());
+            stats_visited_members += result.visited_members;
+            stats_computed_distances += result.computed_distances;
+
+            // We don't want to check for signals from multiple threads
+            ++processed;
+            if (thread_idx == 0)
+                if (!gil_free_progress(processed.load(), vectors_count)) {
+                    atomic_error.store("Operation has been terminated");
+                    return false;
+                }
+            return true;
+        });
+    }
+
+    // At the end report the latest numbers, because the reporter thread may be finished earlier
+    progress_(processed.load(), vectors_count);
+
+    // Raise the error from a single thread
+    auto error = atomic_error.load();
+    if (error) {
+        PyErr_SetString(PyExc_RuntimeError, error);
+        throw py::error_already_set();
+    }
+}
+
+/**
+ *  @param vectors Matrix of vectors to search for.
+ *  @param radius Upper bound for the distance of the matches, inclusive.
+ *  @param max_count Upper bound for the number of matches per request, zero for unlimited.
+ *
+ *  @return Tuple with:
+ *      1. matrix of neighbors, as wide as the largest number of matches,
+ *      2. matrix of distances,
+ *      3. array with match counts,
+ *      4. number of visited nodes,
+ *      4. number of computed pairwise distances.
+ */
+static py::tuple range_search_many_in_index( //
+    dense_index_py_t& index, py::buffer vectors, distance_t radius, std::size_t max_count, bool exact,
+    std::size_t threads, progress_func_t const& progress) {
+
+    if (!max_count)
+        max_count = std::numeric_limits<std::size_t>::max();
+
+    // The index itself is only checked under its lock
+    py::buffer_info vectors_info = vectors.request();
+    if (vectors_info.ndim != 2)
+        throw std::invalid_argument("Expects a matrix of vectors to add!");
+
+    Py_ssize_t vectors_count = vectors_info.shape[0];
+
+    std::vector<std::vector<std::pair<distance_t, dense_key_t>>> matches(static_cast<std::size_t>(vectors_count));
+    std::atomic<std::size_t> stats_visited_members(0);
+    std::atomic<std::size_t> stats_computed_distances(0);
+
+    // clang-format off
+    switch (numpy_string_to_kind(vectors_info.format)) {
+    case scalar_kind_t::b1x8_k: range_search_typed<b1x8_t>(index, vectors_info, radius, max_count, exact, threads, matches, stats_visited_members, stats_computed_distances, progress); break;
+    case scalar_kind_t::i8_k: range_search_typed<i8_t>(index, vectors_info, radius, max_count, exact, threads, matches, stats_visited_members, stats_computed_distances, progress); break;
+    case scalar_kind_t::f16_k: range_search_typed<f16_t>(index, vectors_info, radius, max_count, exact, threads, matches, stats_visited_members, stats_computed_distances, progress); break;
+    case scalar_kind_t::f32_k: range_search_typed<f32_t>(index, vectors_info, radius, max_count, exact, threads, matches, stats_visited_members, stats_computed_distances, progress); break;
+    case scalar_kind_t::f64_k: range_search_typed<f64_t>(index, vectors_info, radius, max_count, exact, threads, matches, stats_visited_members, stats_computed_distances, progress); break;
+    default: throw std::invalid_argument("Incompatible scalars in the query matrix: " + vectors_info.format);
+    }
+    // clang-format on
+
+    // Pack the variable-length results into matrices, as wide as the longest of them
+    std::size_t width = 0;
+    for (auto const& task_matches : matches)
+        width = (std::max)(width, task_matches.size());
+    py::array_t<dense_key_t> keys_py({vectors_count, static_cast<Py_ssize_t>(width)});
+    py::array_t<distance_t> distances_py({vectors_count, static_cast<Py_ssize_t>(width)});
+    py::array_t<Py_ssize_t> counts_py(vectors_count);
+    auto keys_py2d = keys_py.template mutable_unchecked<2>();
+    auto distances_py2d = distances_py.template mutable_unchecked<2>();
+    auto counts_py1d = counts_py.template mutable_unchecked<1>();
+    for (Py_ssize_t task_idx = 0; task_idx != vectors_count; ++task_idx) {
+        auto const& task_matches = matches[static_cast<std::size_t>(task_idx)];
+        counts_py1d(task_idx) = static_cast<Py_ssize_t>(task_matches.size());
+        for (std::size_t i = 0; i != task_matches.size(); ++i) {
+            keys_py2d(task_idx, static_cast<Py_ssize_t>(i)) = task_matches[i].second;
+            distances_py2d(task_idx, static_cast<Py_ssize_t>(i)) = task_matches[i].first;
+        }
+    }
+
+    py::tuple results(5);
+    results[0] = keys_py;
+    results[1] = distances_py;
+    results[2] = counts_py;
+    results[3] = stats_visited_members.load();
+    results[4] = stats_computed_distances.load();
+    return results;
+}
+
 /**
  *  @brief  Brute-force exact search implementation, compatible with
  *          NumPy-like Tensors and other objects supporting Buffer Protocol.
+ *          Runs without the GIL, optionally filling the preallocated output arrays.
  */
 static py::tuple search_many_brute_force(       //
     py::buffer dataset, py::buffer queries,     //
@@ -456,7 +812,8 @@ static py::tuple search_many_brute_force(       //
     metric_kind_t metric_kind,                  //
     metric_punned_signature_t metric_signature, //
     std::uintptr_t metric_uintptr,              //
-    progress_func_t const& progress_func) {
+    progress_func_t const& progress_func,       //
+    py::object const& keys_out, py::object const& distances_out, py::object const& counts_out) {
 
     if (wanted == 0)
         return py::tuple(5);
@@ -468,8 +825,6 @@ static py::tuple search_many_brute_force(       //
 
     std::size_t dataset_count = static_cast<std::size_t>(dataset_info.shape[0]);
     std::size_t dataset_dimensions = static_cast<std::size_t>(dataset_info.shape[1]);
-    std::size_t dataset_stride = static_cast<std::size_t>(dataset_info.strides[0]);
-    std::size_t queries_stride = static_cast<std::size_t>(queries_info.strides[0]);
     std::size_t queries_count = static_cast<std::size_t>(queries_info.shape[0]);
     std::size_t queries_dimensions = static_cast<std::size_t>(queries_info.shape[1]);
 
@@ -491,44 +846,48 @@ static py::tuple search_many_brute_force(       //
     if (!metric)
         throw std::invalid_argument("Unsupported metric!");
 
-    py::array_t<dense_key_t> keys_py({static_cast<Py_ssize_t>(queries_count), static_cast<Py_ssize_t>(wanted)});
-    py::array_t<distance_t> distances_py({static_cast<Py_ssize_t>(queries_count), static_cast<Py_ssize_t>(wanted)});
-    py::array_t<Py_ssize_t> counts_py(static_cast<Py_ssize_t>(queries_count));
+    Py_ssize_t const rows = static_cast<Py_ssize_t>(queries_count), columns = static_cast<Py_ssize_t>(wanted);
+    py::array_t<dense_key_t> keys_py = output_array<dense_key_t>(keys_out, rows, columns, "keys");
+    py::array_t<distance_t> distances_py = output_array<distance_t>(distances_out, rows, columns, "distances");
+    py::array_t<Py_ssize_t> counts_py = output_array<Py_ssize_t>(counts_out, rows, 0, "counts");
 
     auto keys_py2d = keys_py.template mutable_unchecked<2>();
     auto distances_py2d = distances_py.template mutable_unchecked<2>();
     auto counts_py1d = counts_py.template mutable_unchecked<1>();
 
-    byte_t const* dataset_data = reinterpret_cast<byte_t const*>(dataset_info.ptr);
-    byte_t const* queries_data = reinterpret_cast<byte_t const*>(queries_info.ptr);
-    for (std::size_t query_idx = 0; query_idx != queries_count; ++query_idx)
-        counts_py1d(query_idx) = wanted;
-
     if (!threads)
         threads = std::thread::hardware_concurrency();
 
     // Dispatch brute-force search
     progress_t progress{progress_func};
+    gil_free_progress_t gil_free_progress{progress, 1};
     executor_default_t executor{threads};
     exact_search_t search;
-
-    exact_search_results_t offsets_and_distances = search( //
-        dataset_data, dataset_count, dataset_stride,       //
-        queries_data, queries_count, queries_stride,       //
-        wanted, metric, executor,
-        [&](std::size_t passed, std::size_t total) { return PyErr_CheckSignals() == 0 && progress(passed, total); });
-
-    if (!offsets_and_distances)
-        throw std::bad_alloc();
-
-    // Export the results
-    for (std::size_t query_idx = 0; query_idx != queries_count; ++query_idx) {
-        dense_key_t* query_keys = &keys_py2d(query_idx, 0);
-        distance_t* query_distances = &distances_py2d(query_idx, 0);
-        auto query_result = offsets_and_distances.at(query_idx);
-        for (std::size_t i = 0; i != wanted; ++i)
-            query_keys[i] = static_cast<dense_key_t>(query_result[i].offset),
-            query_distances[i] = query_result[i].distance;
+    {
+        // Other Python threads may run meanwhile
+        py::gil_scoped_release release;
+        std::vector<byte_t> dataset_copy, queries_copy;
+        std::size_t dataset_stride = 0, queries_stride = 0;
+        byte_t const* dataset_data = contiguous_rows(dataset_info, dataset_copy, dataset_stride);
+        byte_t const* queries_data = contiguous_rows(queries_info, queries_copy, queries_stride);
+
+        exact_search_results_t offsets_and_distances = search( //
+            dataset_data, dataset_count, dataset_stride,       //
+            queries_data, queries_count, queries_stride,       //
+            wanted, metric, executor, gil_free_progress);
+        if (!offsets_and_distances)
+            throw std::bad_alloc();
+
+        // Export the results
+        for (std::size_t query_idx = 0; query_idx != queries_count; ++query_idx) {
+            dense_key_t* query_keys = &keys_py2d(query_idx, 0);
+            distance_t* query_distances = &distances_py2d(query_idx, 0);
+            auto query_result = offsets_and_distances.at(query_idx);
+            for (std::size_t i = 0; i != wanted; ++i)
+                query_keys[i] = static_cast<dense_key_t>(query_result[i].offset),
+                query_distances[i] = query_result[i].distance;
+            counts_py1d(query_idx) = static_cast<Py_ssize_t>(wanted);
+        }
     }
 
     py::tuple results(5);
@@ -565,25 +924,30 @@ template <typename scalar_at> struct rows_lookup_gt {
 template <typename index_at>
 static py::tuple cluster_vectors(        //
     index_at& index, py::buffer queries, //
-    std::size_t min_count, std::size_t max_count, std::size_t threads, progress_func_t const& progress) {
-
-    if (index.limits().threads_search < threads)
-        throw std::invalid_argument("Can't use that many threads!");
+    std::size_t min_count, std::size_t max_count, std::size_t threads, progress_func_t const& progress,
+    py::object const& keys_out, py::object const& distances_out, py::object const& counts_out) {
 
+    // The index itself is only checked under its lock
     py::buffer_info queries_info = queries.request();
     if (queries_info.ndim != 2)
         throw std::invalid_argument("Expects a matrix of queries to add!");
 
     std::size_t queries_count = static_cast<std::size_t>(queries_info.shape[0]);
-    std::size_t queries_stride = static_cast<std::size_t>(queries_info.strides[0]);
     std::size_t queries_dimensions = static_cast<std::size_t>(queries_info.shape[1]);
-    if (queries_dimensions != index.scalar_words())
-        throw std::invalid_argument("The number of vector dimensions doesn't match!");
-
-    py::array_t<dense_key_t> keys_py({Py_ssize_t(queries_count), Py_ssize_t(1)});
-    py::array_t<distance_t> distances_py({Py_ssize_t(queries_count), Py_ssize_t(1)});
+    scalar_kind_t queries_kind = numpy_string_to_kind(queries_info.format);
+    if (queries_kind != scalar_kind_t::b1x8_k && queries_kind != scalar_kind_t::i8_k &&
+        queries_kind != scalar_kind_t::f16_k && queries_kind != scalar_kind_t::f32_k &&
+        queries_kind != scalar_kind_t::f64_k)
+        throw std::invalid_argument("Incompatible scalars in the query matrix: " + queries_info.format);
+
+    Py_ssize_t const rows = static_cast<Py_ssize_t>(queries_count);
+    py::array_t<dense_key_t> keys_py = output_array<dense_key_t>(keys_out, rows, 1, "keys");
+    py::array_t<distance_t> distances_py = output_array<distance_t>(distances_out, rows, 1, "distances");
+    py::array_t<Py_ssize_t> counts_py = output_array<Py_ssize_t>(counts_out, rows, 0, "counts");
     dense_clustering_result_t cluster_result;
     executor_default_t executor{threads};
+    progress_t progress_{progress};
+    gil_free_progress_t gil_free_progress{progress_};
 
     auto keys_py2d = keys_py.template mutable_unchecked<2>();
     auto distances_py2d = distances_py.template mutable_unchecked<2>();
@@ -594,24 +958,32 @@ static py::tuple cluster_vectors(        //
     config.min_clusters = min_count;
     config.max_clusters = max_count;
 
-    rows_lookup_gt<byte_t const> queries_begin(queries_info.ptr, queries_stride);
-    rows_lookup_gt<byte_t const> queries_end = queries_begin + queries_count;
-
-    // clang-format off
-    switch (numpy_string_to_kind(queries_info.format)) {
-    case scalar_kind_t::b1x8_k: cluster_result = index.cluster(queries_begin.as<b1x8_t const>(), queries_end.as<b1x8_t const>(), config, keys_ptr, distances_ptr, executor, progress_t{progress}); break;
-    case scalar_kind_t::i8_k: cluster_result = index.cluster(queries_begin.as<i8_t const>(), queries_end.as<i8_t const>(), config, keys_ptr, distances_ptr, executor, progress_t{progress}); break;
-    case scalar_kind_t::f16_k: cluster_result = index.cluster(queries_begin.as<f16_t const>(), queries_end.as<f16_t const>(), config, keys_ptr, distances_ptr, executor, progress_t{progress}); break;
-    case scalar_kind_t::f32_k: cluster_result = index.cluster(queries_begin.as<f32_t const>(), queries_end.as<f32_t const>(), config, keys_ptr, distances_ptr, executor, progress_t{progress}); break;
-    case scalar_kind_t::f64_k: cluster_result = index.cluster(queries_begin.as<f64_t const>(), queries_end.as<f64_t const>(), config, keys_ptr, distances_ptr, executor, progress_t{progress}); break;
-    default: throw std::invalid_argument("Incompatible scalars in the query matrix: " + queries_info.format);
+    {
+        gil_free_lock_t lock{index};
+        if (index.limits().threads_search < threads)
+            throw std::invalid_argument("Can't use that many threads!");
+        if (queries_dimensions != index.scalar_words())
+            throw std::invalid_argument("The number of vector dimensions doesn't match!");
+        std::vector<byte_t> queries_copy;
+        std::size_t queries_stride = 0;
+        byte_t const* queries_data = contiguous_rows(queries_info, queries_copy, queries_stride);
+        rows_lookup_gt<byte_t const> queries_begin(const_cast<byte_t*>(queries_data), queries_stride);
+        rows_lookup_gt<byte_t const> queries_end = queries_begin + queries_count;
+
+        // clang-format off
+        switch (queries_kind) {
+        case scalar_kind_t::b1x8_k: cluster_result = index.cluster(queries_begin.as<b1x8_t const>(), queries_end.as<b1x8_t const>(), config, keys_ptr, distances_ptr, executor, gil_free_progress); break;
+        case scalar_kind_t::i8_k: cluster_result = index.cluster(queries_begin.as<i8_t const>(), queries_end.as<i8_t const>(), config, keys_ptr, distances_ptr, executor, gil_free_progress); break;
+        case scalar_kind_t::f16_k: cluster_result = index.cluster(queries_begin.as<f16_t const>(), queries_end.as<f16_t const>(), config, keys_ptr, distances_ptr, executor, gil_free_progress); break;
+        case scalar_kind_t::f32_k: cluster_result = index.cluster(queries_begin.as<f32_t const>(), queries_end.as<f32_t const>(), config, keys_ptr, distances_ptr, executor, gil_free_progress); break;
+        case scalar_kind_t::f64_k: cluster_result = index.cluster(queries_begin.as<f64_t const>(), queries_end.as<f64_t const>(), config, keys_ptr, distances_ptr, executor, gil_free_progress); break;
+        default: break;
+        }
+        // clang-format on
     }
-    // clang-format on
-
     cluster_result.error.raise();
 
     // Those would be set to 1 for all entries, in case of success
-    py::array_t<Py_ssize_t> counts_py(queries_count);
     auto counts_py1d = counts_py.template mutable_unchecked<1>();
     for (std::size_t query_idx = 0; query_idx != queries_count; ++query_idx)
         counts_py1d(static_cast<Py_ssize_t>(query_idx)) = 1;
@@ -639,19 +1011,21 @@ static py::tuple cluster_vectors(        //
 template <typename index_at>
 static py::tuple cluster_keys(                            //
     index_at& index, py::array_t<dense_key_t> queries_py, //
-    std::size_t min_count, std::size_t max_count, std::size_t threads, progress_func_t const& progress) {
-
-    if (index.limits().threads_search < threads)
-        throw std::invalid_argument("Can't use that many threads!");
+    std::size_t min_count, std::size_t max_count, std::size_t threads, progress_func_t const& progress,
+    py::object const& keys_out, py::object const& distances_out, py::object const& counts_out) {
 
     std::size_t queries_count = static_cast<std::size_t>(queries_py.size());
     auto queries_py1d = queries_py.template unchecked<1>();
     dense_key_t const* queries_begin = &queries_py1d(0);
     dense_key_t const* queries_end = queries_begin + queries_count;
 
-    py::array_t<dense_key_t> keys_py({Py_ssize_t(queries_count), Py_ssize_t(1)});
-    py::array_t<distance_t> distances_py({Py_ssize_t(queries_count), Py_ssize_t(1)});
+    Py_ssize_t const rows = static_cast<Py_ssize_t>(queries_count);
+    py::array_t<dense_key_t> keys_py = output_array<dense_key_t>(keys_out, rows, 1, "keys");
+    py::array_t<distance_t> distances_py = output_array<distance_t>(distances_out, rows, 1, "distances");
+    py::array_t<Py_ssize_t> counts_py = output_array<Py_ssize_t>(counts_out, rows, 0, "counts");
     executor_default_t executor{threads};
+    progress_t progress_{progress};
+    gil_free_progress_t gil_free_progress{progress_};
 
     auto keys_py2d = keys_py.template mutable_unchecked<2>();
     auto distances_py2d = distances_py.template mutable_unchecked<2>();
@@ -662,12 +1036,17 @@ static py::tuple cluster_keys(                            //
     config.min_clusters = min_count;
     config.max_clusters = max_count;
 
-    dense_clustering_result_t cluster_result =
-        index.cluster(queries_begin, queries_end, config, keys_ptr, distances_ptr, executor, progress_t{progress});
+    dense_clustering_result_t cluster_result;
+    {
+        gil_free_lock_t lock{index};
+        if (index.limits().threads_search < threads)
+            throw std::invalid_argument("Can't use that many threads!");
+        cluster_result =
+            index.cluster(queries_begin, queries_end, config, keys_ptr, distances_ptr, executor, gil_free_progress);
+    }
     cluster_result.error.raise();
 
     // Those would be set to 1 for all entries, in case of success
-    py::array_t<Py_ssize_t> counts_py(queries_count);
     auto counts_py1d = counts_py.template mutable_unchecked<1>();
     for (std::size_t query_idx = 0; query_idx != queries_count; ++query_idx)
         counts_py1d(static_cast<Py_ssize_t>(query_idx)) = 1;
@@ -686,6 +1065,13 @@ static std::unordered_map<dense_key_t, dense_key_t> join_index( //
     std::size_t max_proposals, bool exact,                      //
     progress_func_t const& progress) {
 
+    if (&a == &b)
+        throw std::invalid_argument("Can't join with itself, consider copying");
+
+    // Lock both indexes in the same order, whichever is joined with which
+    gil_held_shared_lock_t first_lock{&a < &b ? a : b};
+    gil_held_shared_lock_t second_lock{&a < &b ? b : a};
+
     std::unordered_map<dense_key_t, dense_key_t> a_to_b;
     dummy_key_to_key_mapping_t b_to_a;
     a_to_b.reserve((std::min)(a.size(), b.size()));
@@ -707,6 +1093,7 @@ static dense_index_py_t copy_index(dense_index_py_t const& index, bool force_cop
     using copy_result_t = typename dense_index_py_t::copy_result_t;
     index_dense_copy_config_t config;
     config.force_vector_copy = force_copy;
+    gil_held_shared_lock_t lock{index};
     copy_result_t result = index.copy(config);
     forward_error(result);
     return std::move(result.index);
@@ -716,10 +1103,16 @@ static void compact_index(dense_index_py_t& index, std::size_t threads, progress
 
     if (!threads)
         threads = std::thread::hardware_concurrency();
-    if (!index.reserve(index_limits_t(index.size(), threads)))
-        throw std::invalid_argument("Out of memory!");
-
-    index.compact(executor_default_t{threads}, progress_t{progress});
+    progress_t progress_{progress};
+    gil_free_progress_t gil_free_progress{progress_};
+    typename dense_index_py_t::compaction_result_t result;
+    {
+        gil_free_lock_t lock{index};
+        if (!index.reserve(index_limits_t(index.size(), threads)))
+            throw std::invalid_argument("Out of memory!");
+        result = index.compact(executor_default_t{threads}, gil_free_progress);
+    }
+    result.error.raise();
 }
 
 static py::dict index_metadata(index_dense_metadata_result_t const& meta) {
@@ -744,16 +1137,49 @@ static py::dict index_metadata(index_dense_metadata_result_t const& meta) {
     return result;
 }
 
+template <typename index_at>
+void save_index_to_path(index_at const& index, std::string const& path, progress_func_t const& progress) {
+    progress_t progress_{progress};
+    gil_free_progress_t gil_free_progress{progress_};
+    serialization_result_t result;
+    {
+        gil_free_shared_lock_t lock{index};
+        result = index.save(path.c_str(), {}, gil_free_progress);
+    }
+    result.error.raise();
+}
+
+template <typename index_at>
+void load_index_from_path(index_at& index, std::string const& path, progress_func_t const& progress) {
+    progress_t progress_{progress};
+    gil_free_progress_t gil_free_progress{progress_};
+    serialization_result_t result;
+    {
+        gil_free_lock_t lock{index};
+        result = index.load(path.c_str(), {}, gil_free_progress);
+    }
+    result.error.raise();
+}
+
+template <typename index_at>
+void view_index_from_path(index_at& index, std::string const& path, progress_func_t const& progress) {
+    progress_t progress_{progress};
+    gil_free_progress_t gil_free_progress{progress_};
+    serialization_result_t result;
+    {
+        gil_free_lock_t lock{index};
+        result = index.view(path.c_str(), 0, {}, gil_free_progress);
+    }
+    result.error.raise();
+}
+
 // clang-format off
-template <typename index_at> void save_index_to_path(index_at const& index, std::string const& path, progress_func_t const& progress) { index.save(path.c_str(), {}, progress_t{progress}).error.raise(); }
-template <typename index_at> void load_index_from_path(index_at& index, std::string const& path, progress_func_t const& progress) { index.load(path.c_str(), {}, progress_t{progress}).error.raise(); }
-template <typename index_at> void view_index_from_path(index_at& index, std::string const& path, progress_func_t const& progress) { index.view(path.c_str(), 0, {}, progress_t{progress}).error.raise(); }
-template <typename index_at> void reset_index(index_at& index) { index.reset(); }
-template <typename index_at> void clear_index(index_at& index) { index.clear(); }
-template <typename index_at> std::size_t max_level(index_at const &index) { return index.max_level(); }
-template <typename index_at> std::size_t serialized_length(index_at const &index) { return index.serialized_length(); }
-template <typename index_at> typename index_at::stats_t compute_stats(index_at const &index) { return index.stats(); }
-template <typename index_at> typename index_at::stats_t compute_level_stats(index_at const &index, std::size_t level) { return index.stats(level); }
+template <typename index_at> void reset_index(index_at& index) { gil_free_lock_t lock{index}; index.reset(); }
+template <typename index_at> void clear_index(index_at& index) { gil_free_lock_t lock{index}; index.clear(); }
+template <typename index_at> std::size_t max_level(index_at const &index) { gil_held_shared_lock_t lock{index}; return index.max_level(); }
+template <typename index_at> std::size_t serialized_length(index_at const &index) { gil_held_shared_lock_t lock{index}; return index.serialized_length(); }
+template <typename index_at> typename index_at::stats_t compute_stats(index_at const &index) { gil_held_shared_lock_t lock{index}; return index.stats(); }
+template <typename index_at> typename index_at::stats_t compute_level_stats(index_at const &index, std::size_t level) { gil_held_shared_lock_t lock{index}; return index.stats(level); }
 // clang-format on
 
 template <typename py_bytes_at> memory_mapped_file_t memory_map_from_bytes(py_bytes_at&& bytes) {
@@ -762,6 +1188,7 @@ template <typename py_bytes_at> memory_mapped_file_t memory_map_from_bytes(py_by
 }
 
 template <typename index_at> py::object save_index_to_buffer(index_at const& index, progress_func_t const& progress) {
+    gil_held_shared_lock_t lock{index};
     std::size_t serialized_length = index.serialized_length();
 
     // Create an empty bytearray object using CPython API
@@ -777,7 +1204,14 @@ template <typename index_at> py::object save_index_to_buffer(index_at const& ind
 
     char* buffer = PyByteArray_AS_STRING(byte_array);
     memory_mapped_file_t memory_map((byte_t*)buffer, serialized_length);
-    serialization_result_t result = index.save(std::move(memory_map), {}, {}, progress_t{progress});
+    progress_t progress_{progress};
+    gil_free_progress_t gil_free_progress{progress_};
+    serialization_result_t result;
+    {
+        // The `bytearray` isn't shared with Python code yet, so it can't be resized meanwhile
+        py::gil_scoped_release release;
+        result = index.save(std::move(memory_map), {}, {}, gil_free_progress);
+    }
 
     if (!result) {
         Py_XDECREF(byte_array);
@@ -789,21 +1223,70 @@ template <typename index_at> py::object save_index_to_buffer(index_at const& ind
 
 template <typename index_at>
 void load_index_from_buffer(index_at& index, py::bytes const& buffer, progress_func_t const& progress) {
-    index.load(memory_map_from_bytes(buffer), {}, {}, progress_t{progress}).error.raise();
+    memory_mapped_file_t memory_map = memory_map_from_bytes(buffer);
+    progress_t progress_{progress};
+    gil_free_progress_t gil_free_progress{progress_};
+    serialization_result_t result;
+    {
+        gil_free_lock_t lock{index};
+        result = index.load(std::move(memory_map), {}, {}, gil_free_progress);
+    }
+    result.error.raise();
 }
 template <typename index_at>
 void view_index_from_buffer(index_at& index, py::bytes const& buffer, progress_func_t const& progress) {
-    index.view(memory_map_from_bytes(buffer), {}, {}, progress_t{progress}).error.raise();
+    memory_mapped_file_t memory_map = memory_map_from_bytes(buffer);
+    progress_t progress_{progress};
+    gil_free_progress_t gil_free_progress{progress_};
+    serialization_result_t result;
+    {
+        gil_free_lock_t lock{index};
+        result = index.view(std::move(memory_map), {}, {}, gil_free_progress);
+    }
+    result.error.raise();
 }
 
 template <typename index_at> std::vector<typename index_at::stats_t> compute_levels_stats(index_at const& index) {
     using stats_t = typename index_at::stats_t;
+    gil_held_shared_lock_t lock{index};
     std::size_t max_level = index.max_level();
     std::vector<stats_t> result(max_level + 1);
     index.stats(result.data(), max_level);
     return result;
 }
 
+static py::list histogram_buckets(log2_histogram_t const& histogram) {
+    py::list result;
+    for (std::size_t bucket = 0; bucket != log2_histogram_t::buckets(); ++bucket)
+        result.append(std::uint64_t(histogram.count(bucket)));
+    return result;
+}
+
+template <typename index_at> py::dict compute_instrumentation(index_at const& index) {
+    gil_held_shared_lock_t lock{index};
+    index_instrumentation_t instrumentation = index.instrumentation();
+    py::dict result;
+    result["enabled"] = instrumentation.enabled;
+
+    py::list hops_per_level;
+    for (std::size_t level = 0; level != index_instrumentation_t::levels(); ++level)
+        hops_per_level.append(std::uint64_t(instrumentation.hops_per_level[level]));
+    result["hops_per_level"] = hops_per_level;
+
+    result["missed_candidates"] = std::uint64_t(instrumentation.missed_candidates);
+    result["reused_candidates"] = std::uint64_t(instrumentation.reused_candidates);
+    result["distance_nanoseconds"] = std::uint64_t(instrumentation.distance_nanoseconds);
+    result["node_lock_waits"] = std::uint64_t(instrumentation.node_lock_waits);
+    result["node_lock_wait_nanoseconds"] = std::uint64_t(instrumentation.node_lock_wait_nanoseconds);
+    result["lookup_lock_waits"] = std::uint64_t(instrumentation.lookup_lock_waits);
+    result["lookup_lock_wait_nanoseconds"] = std::uint64_t(instrumentation.lookup_lock_wait_nanoseconds);
+
+    result["latency_nanoseconds"] = histogram_buckets(instrumentation.latency_nanoseconds);
+    result["hops"] = histogram_buckets(instrumentation.hops);
+    result["computed_distances"] = histogram_buckets(instrumentation.computed_distances);
+    return result;
+}
+
 template <typename internal_at, typename external_at = internal_at, typename index_at = void>
 static py::object get_typed_vectors_for_keys(index_at const& index, py::buffer keys) {
 
@@ -844,6 +1327,7 @@ static py::object get_typed_vectors_for_keys(index_at const& index, py::buffer k
 }
 
 template <typename index_at> py::object get_many(index_at const& index, py::buffer keys, scalar_kind_t scalar_kind) {
+    gil_held_shared_lock_t lock{index};
     if (scalar_kind == scalar_kind_t::f32_k)
         return get_typed_vectors_for_keys<f32_t>(index, keys);
     else if (scalar_kind == scalar_kind_t::f64_k)
@@ -934,7 +1418,10 @@ PYBIND11_MODULE(compiled, m) {
           py::arg("metric_kind") = metric_kind_t::cos_k,                          //
           py::arg("metric_signature") = metric_punned_signature_t::array_array_k, //
           py::arg("metric_pointer") = 0,                                          //
-          py::arg("progress") = nullptr                                           //
+          py::arg("progress") = nullptr,                                          //
+          py::arg("keys_out") = py::none(),                                       //
+          py::arg("distances_out") = py::none(),                                  //
+          py::arg("counts_out") = py::none()                                      //
     );
 
     m.def(
@@ -980,7 +1467,20 @@ PYBIND11_MODULE(compiled, m) {
         py::arg("count") = 10,                                  //
         py::arg("exact") = false,                               //
         py::arg("threads") = 0,                                 //
-        py::arg("progress") = nullptr                           //
+        py::arg("progress") = nullptr,                          //
+        py::arg("keys_out") = py::none(),                       //
+        py::arg("distances_out") = py::none(),                  //
+        py::arg("counts_out") = py::none()                      //
+    );
+
+    i.def(                                              //
+        "range_search_many", &range_search_many_in_index, //
+        py::arg("queries"),                               //
+        py::arg("radius"),                                //
+        py::arg("count") = 0,                             //
+        py::arg("exact") = false,                         //
+        py::arg("threads") = 0,                           //
+        py::arg("progress") = nullptr                     //
     );
 
     i.def(                                                     //
@@ -989,7 +1489,10 @@ PYBIND11_MODULE(compiled, m) {
         py::arg("min_count") = 0,                              //
         py::arg("max_count") = 0,                              //
         py::arg("threads") = 0,                                //
-        py::arg("progress") = nullptr                          //
+        py::arg("progress") = nullptr,                         //
+        py::arg("keys_out") = py::none(),                      //
+        py::arg("distances_out") = py::none(),                 //
+        py::arg("counts_out") = py::none()                     //
     );
 
     i.def(                                               //
@@ -998,12 +1501,16 @@ PYBIND11_MODULE(compiled, m) {
         py::arg("min_count") = 0,                        //
         py::arg("max_count") = 0,                        //
         py::arg("threads") = 0,                          //
-        py::arg("progress") = nullptr                    //
+        py::arg("progress") = nullptr,                   //
+        py::arg("keys_out") = py::none(),                //
+        py::arg("distances_out") = py::none(),           //
+        py::arg("counts_out") = py::none()               //
     );
 
     i.def(
         "rename_one_to_one",
         [](dense_index_py_t& index, dense_key_t from, dense_key_t to) -> bool {
+            gil_held_lock_t lock{index};
             dense_labeling_result_t result = index.rename(from, to);
             forward_error(result);
             return result.completed;
@@ -1018,6 +1525,7 @@ PYBIND11_MODULE(compiled, m) {
                 throw std::invalid_argument("Sizes of `from` and `to` arrays don't match!");
 
             std::vector<bool> results(from.size(), false);
+            gil_held_lock_t lock{index};
             for (std::size_t i = 0; i != from.size(); ++i) {
                 dense_labeling_result_t result = index.rename(from[i], to[i]);
                 results[i] = result.completed;
@@ -1031,6 +1539,7 @@ PYBIND11_MODULE(compiled, m) {
         "rename_many_to_one",
         [](dense_index_py_t& index, std::vector<dense_key_t> const& from, dense_key_t to) -> std::vector<bool> {
             std::vector<bool> results(from.size(), false);
+            gil_held_lock_t lock{index};
             for (std::size_t i = 0; i != from.size(); ++i) {
                 dense_labeling_result_t result = index.rename(from[i], to);
                 results[i] = result.completed;
@@ -1043,17 +1552,19 @@ PYBIND11_MODULE(compiled, m) {
     i.def(
         "remove_one",
         [](dense_index_py_t& index, dense_key_t key, bool compact, std::size_t threads) -> bool {
-            dense_labeling_result_t result = index.remove(key);
-            forward_error(result);
-            if (!compact)
-                return result.completed;
-
             if (!threads)
                 threads = std::thread::hardware_concurrency();
-            if (!index.reserve(index_limits_t(index.size(), threads)))
-                throw std::invalid_argument("Out of memory!");
-
-            index.isolate(executor_default_t{threads});
+            dense_labeling_result_t result;
+            {
+                gil_free_lock_t lock{index};
+                result = index.remove(key);
+                if (result && compact) {
+                    if (!index.reserve(index_limits_t(index.size(), threads)))
+                        throw std::invalid_argument("Out of memory!");
+                    index.isolate(executor_default_t{threads});
+                }
+            }
+            forward_error(result);
             return result.completed;
         },
         py::arg("key"), py::arg("compact"), py::arg("threads"));
@@ -1062,41 +1573,47 @@ PYBIND11_MODULE(compiled, m) {
         "remove_many",
         [](dense_index_py_t& index, std::vector<dense_key_t> const& keys, bool compact,
            std::size_t threads) -> std::size_t {
-            dense_labeling_result_t result = index.remove(keys.begin(), keys.end());
-            forward_error(result);
-            if (!compact)
-                return result.completed;
-
             if (!threads)
                 threads = std::thread::hardware_concurrency();
-            if (!index.reserve(index_limits_t(index.size(), threads)))
-                throw std::invalid_argument("Out of memory!");
-
-            index.isolate(executor_default_t{threads});
+            dense_labeling_result_t result;
+            {
+                gil_free_lock_t lock{index};
+                result = index.remove(keys.begin(), keys.end());
+                if (result && compact) {
+                    if (!index.reserve(index_limits_t(index.size(), threads)))
+                        throw std::invalid_argument("Out of memory!");
+                    index.isolate(executor_default_t{threads});
+                }
+            }
+            forward_error(result);
             return result.completed;
         },
         py::arg("key"), py::arg("compact"), py::arg("threads"));
 
-    i.def("__len__", &dense_index_py_t::size);
-    i.def_property_readonly("size", &dense_index_py_t::size);
-    i.def_property_readonly("multi", &dense_index_py_t::multi);
-    i.def_property_readonly("connectivity", &dense_index_py_t::connectivity);
-    i.def_property_readonly("capacity", &dense_index_py_t::capacity);
-    i.def_property_readonly("ndim",
-                            [](dense_index_py_t const& index) -> std::size_t { return index.metric().dimensions(); });
-    i.def_property_readonly( //
-        "dtype", [](dense_index_py_t const& index) -> scalar_kind_t { return index.scalar_kind(); });
+    i.def("__len__", shared_locked(&dense_index_py_t::size));
+    i.def_property_readonly("size", shared_locked(&dense_index_py_t::size));
+    i.def_property_readonly("multi", shared_locked(&dense_index_py_t::multi));
+    i.def_property_readonly("connectivity", shared_locked(&dense_index_py_t::connectivity));
+    i.def_property_readonly("capacity", shared_locked(&dense_index_py_t::capacity));
+    i.def_property_readonly("ndim", [](dense_index_py_t const& index) -> std::size_t {
+        gil_held_shared_lock_t lock{index};
+        return index.metric().dimensions();
+    });
+    i.def_property_readonly("dtype", shared_locked(&dense_index_py_t::scalar_kind));
 
-    i.def_property_readonly("serialized_length", &dense_index_py_t::serialized_length);
-    i.def_property_readonly("memory_usage", &dense_index_py_t::memory_usage);
+    i.def_property_readonly("serialized_length", &serialized_length<dense_index_py_t>);
+    i.def_property_readonly("memory_usage", shared_locked(&dense_index_py_t::memory_usage));
 
-    i.def_property("expansion_add", &dense_index_py_t::expansion_add, &dense_index_py_t::change_expansion_add);
-    i.def_property("expansion_search", &dense_index_py_t::expansion_search, &dense_index_py_t::change_expansion_search);
+    i.def_property("expansion_add", shared_locked(&dense_index_py_t::expansion_add),
+                   unique_locked(&dense_index_py_t::change_expansion_add));
+    i.def_property("expansion_search", shared_locked(&dense_index_py_t::expansion_search),
+                   unique_locked(&dense_index_py_t::change_expansion_search));
 
     i.def(
         "change_metric",
         [](dense_index_py_t& index, metric_kind_t metric_kind, metric_punned_signature_t metric_signature,
            std::uintptr_t metric_uintptr) {
+            gil_held_lock_t lock{index};
             scalar_kind_t scalar_kind = index.scalar_kind();
             std::size_t dimensions = index.dimensions();
             metric_t metric =  //
@@ -1112,11 +1629,13 @@ PYBIND11_MODULE(compiled, m) {
         py::arg("metric_pointer") = 0                                           //
     );
 
-    i.def_property_readonly("hardware_acceleration",
-                            [](dense_index_py_t const& index) -> py::str { return index.metric().isa_name(); });
+    i.def_property_readonly("hardware_acceleration", [](dense_index_py_t const& index) -> py::str {
+        gil_held_shared_lock_t lock{index};
+        return index.metric().isa_name();
+    });
 
-    i.def("contains_one", &dense_index_py_t::contains);
-    i.def("count_one", &dense_index_py_t::count);
+    i.def("contains_one", shared_locked(&dense_index_py_t::contains));
+    i.def("count_one", shared_locked(&dense_index_py_t::count));
 
     i.def( //
         "contains_many",
@@ -1124,6 +1643,7 @@ PYBIND11_MODULE(compiled, m) {
             py::array_t<bool> results_py(keys_py.size());
             auto results_py1d = results_py.template mutable_unchecked<1>();
             auto keys_py1d = keys_py.template unchecked<1>();
+            gil_held_shared_lock_t lock{index};
             for (Py_ssize_t task_idx = 0; task_idx != keys_py.size(); ++task_idx)
                 results_py1d(task_idx) = index.contains(keys_py1d(task_idx));
             return results_py;
@@ -1135,6 +1655,7 @@ PYBIND11_MODULE(compiled, m) {
             py::array_t<std::size_t> results_py(keys_py.size());
             auto results_py1d = results_py.template mutable_unchecked<1>();
             auto keys_py1d = keys_py.template unchecked<1>();
+            gil_held_shared_lock_t lock{index};
             for (Py_ssize_t task_idx = 0; task_idx != keys_py.size(); ++task_idx)
                 results_py1d(task_idx) = index.count(keys_py1d(task_idx));
             return results_py;
@@ -1148,6 +1669,7 @@ PYBIND11_MODULE(compiled, m) {
             auto results_py1d = results_py.template mutable_unchecked<1>();
             auto left_py1d = left_py.template unchecked<1>();
             auto right_py1d = right_py.template unchecked<1>();
+            gil_held_shared_lock_t lock{index};
             for (Py_ssize_t task_idx = 0; task_idx != left_py.size(); ++task_idx)
                 results_py1d(task_idx) = index.distance_between(left_py1d(task_idx), right_py1d(task_idx)).min;
             return results_py;
@@ -1155,6 +1677,7 @@ PYBIND11_MODULE(compiled, m) {
 
     i.def( //
         "pairwise_distance", [](dense_index_py_t const& index, dense_key_t left, dense_key_t right) -> distance_t {
+            gil_held_shared_lock_t lock{index};
             return index.distance_between(left, right).min;
         });
 
@@ -1163,6 +1686,7 @@ PYBIND11_MODULE(compiled, m) {
     i.def(
         "get_keys_in_slice",
         [](dense_index_py_t const& index, std::size_t offset, std::size_t limit) -> py::array_t<dense_key_t> {
+            gil_held_shared_lock_t lock{index};
             limit = std::min(index.size(), limit);
             py::array_t<dense_key_t> result_py(static_cast<Py_ssize_t>(limit));
             auto result_py1d = result_py.template mutable_unchecked<1>();
@@ -1177,6 +1701,7 @@ PYBIND11_MODULE(compiled, m) {
             py::array_t<dense_key_t> result_py(offsets_py.size());
             auto result_py1d = result_py.template mutable_unchecked<1>();
             auto offsets_py1d = offsets_py.template unchecked<1>();
+            gil_held_shared_lock_t lock{index};
             for (Py_ssize_t task_idx = 0; task_idx != offsets_py.size(); ++task_idx)
                 index.export_keys(&result_py1d(task_idx), offsets_py1d(task_idx), 1);
             return result_py;
@@ -1187,6 +1712,7 @@ PYBIND11_MODULE(compiled, m) {
         "get_key_at_offset",
         [](dense_index_py_t const& index, std::size_t offset) -> dense_key_t {
             dense_key_t result;
+            gil_held_shared_lock_t lock{index};
             index.export_keys(&result, offset, 1);
             return result;
         },
@@ -1222,6 +1748,8 @@ PYBIND11_MODULE(compiled, m) {
     i.def_property_readonly("stats", &compute_stats<dense_index_py_t>);
     i.def_property_readonly("levels_stats", &compute_levels_stats<dense_index_py_t>);
     i.def("level_stats", &compute_level_stats<dense_index_py_t>, py::arg("level"));
+    i.def_property_readonly("instrumentation", &compute_instrumentation<dense_index_py_t>);
+    i.def("reset_instrumentation", unique_locked(&dense_index_py_t::reset_instrumentation));
 
     auto is = py::class_<dense_indexes_py_t>(m, "Indexes");
     is.def(py::init());
@@ -1235,6 +1763,9 @@ PYBIND11_MODULE(compiled, m) {
         py::arg("count") = 10,                                    //
         py::arg("exact") = false,                                 //
         py::arg("threads") = 0,                                   //
-        py::arg("progress") = nullptr                             //
+        py::arg("progress") = nullptr,                            //
+        py::arg("keys_out") = py::none(),                         //
+        py::arg("distances_out") = py::none(),                    //
+        py::arg("counts_out") = py::none()                        //
     );
 }
@@ -117,6 +117,58 @@ def test_index_search(ndim, metric, quantization, dtype, batch_size):
         assert np.all(np.sort(index.keys) == np.sort(keys))
 
 
+@pytest.mark.parametrize("ndim", [3, 97])
+@pytest.mark.parametrize("batch_size", [7, 1024])
+def test_index_range_search(ndim, batch_size):
+    reset_randomness()
+
+    index = Index(ndim=ndim, metric=MetricKind.L2sq, multi=False)
+    keys = np.arange(batch_size)
+    vectors = random_vectors(count=batch_size, ndim=ndim)
+    index.add(keys, vectors, threads=threads)
+
+    # Every match must be within the radius, sorted, and only the limit can truncate them
+    radius = float(np.median(index.search(vectors, 10, threads=threads, exact=True).distances))
+    matches: BatchMatches = index.search(vectors, 0, radius=radius, threads=threads)
+    assert len(matches) == batch_size
+    for query_matches in matches:
+        assert np.all(query_matches.distances <= radius)
+        assert np.all(np.diff(query_matches.distances) >= 0)
+
+    # The limit keeps the closest matches, which are the prefixes of the unlimited results
+    for count in [1, 3]:
+        limited: BatchMatches = index.search(vectors, count, radius=radius, threads=threads)
+        assert np.all(limited.counts == np.minimum(matches.counts, count))
+        for query_matches, query_limited in zip(matches, limited):
+            kept = len(query_limited.keys)
+            assert np.all(query_limited.distances == query_matches.distances[:kept])
+            assert np.all(query_limited.keys == query_matches.keys[:kept])
+
+    # Without an explicit `count`, the range search isn't truncated
+    unlimited: BatchMatches = index.search(vectors, radius=radius, threads=threads)
+    assert np.all(unlimited.counts == matches.counts)
+
+
+def test_index_instrumentation():
+    reset_randomness()
+
+    index = Index(ndim=16, metric=MetricKind.L2sq, multi=False)
+    vectors = random_vectors(count=128, ndim=16)
+    index.add(np.arange(128), vectors, threads=threads)
+
+    # Counters are only collected if compiled in, but the histograms are always exported
+    index.reset_instrumentation()
+    index.search(vectors, 10, threads=threads)
+    instrumentation = index.instrumentation
+    assert len(instrumentation["latency_nanoseconds"]) == 64
+    assert len(instrumentation["hops_per_level"]) == 16
+    queries = sum(instrumentation["latency_nanoseconds"])
+    assert queries == (128 if instrumentation["enabled"] else 0)
+
+    index.reset_instrumentation()
+    assert sum(index.instrumentation["hops"]) == 0
+
+
 @pytest.mark.parametrize("ndim", [3, 97, 256])
 @pytest.mark.parametrize("batch_size", [1, 7, 1024])
 def test_index_self_recall(ndim: int, batch_size: int):
@@ -284,6 +336,88 @@ def test_index_oversubscribed_search(batch_size: int, threads: int):
         assert len(match.keys) == batch_size
 
 
+@pytest.mark.parametrize("batch_size", [1, 7, 1024])
+def test_index_strided_and_preallocated(batch_size: int):
+    reset_randomness()
+
+    ndim = 16
+    index = Index(ndim=ndim, multi=False)
+    keys = np.arange(batch_size)
+    vectors = random_vectors(count=batch_size, ndim=ndim)
+
+    # Transposed and sliced views are gathered row by row, instead of being copied upfront
+    strided = np.asfortranarray(vectors)
+    assert not strided.flags.c_contiguous or batch_size == 1
+    index.add(keys, strided, threads=threads)
+    assert np.allclose(index.get(keys), vectors)
+    with pytest.raises(Exception):
+        index.add(keys + batch_size, strided, copy=False)
+
+    padded = np.zeros((batch_size, ndim * 2), dtype=np.float32)
+    padded[:, ::2] = vectors
+    for queries in [strided, padded[:, ::2], vectors[::-1]]:
+        expected: BatchMatches = index.search(np.ascontiguousarray(queries), 10, threads=threads)
+        found: BatchMatches = index.search(queries, 10, threads=threads)
+        assert np.array_equal(found.keys, expected.keys)
+
+    # Preallocated outputs are filled in-place
+    count = min(10, batch_size)
+    keys_out = np.zeros((batch_size, count), dtype=np.uint64)
+    distances_out = np.zeros((batch_size, count), dtype=np.float32)
+    counts_out = np.zeros(batch_size, dtype=np.intp)
+    out = (keys_out, distances_out, counts_out)
+    found: BatchMatches = index.search(vectors, count, threads=threads, out=out)
+    assert found.keys is keys_out and found.distances is distances_out and found.counts is counts_out
+    assert np.all(counts_out == count)
+    assert np.all(keys_out[:, 0] == keys)
+
+    exact = search(vectors, vectors, count, MetricKind.L2sq, exact=True, threads=threads, out=out)
+    assert exact.keys is keys_out
+    assert np.all(keys_out[:, 0] == keys)
+
+    with pytest.raises(Exception):
+        index.search(vectors, count + 1, out=out)
+    with pytest.raises(Exception):
+        index.search(vectors, count, out=(keys_out.astype(np.int32), distances_out, counts_out))
+
+
+def test_index_concurrent_batches():
+    from threading import Thread
+
+    reset_randomness()
+
+    ndim = 32
+    batch_size = 2048
+    index = Index(ndim=ndim, multi=False)
+    vectors = random_vectors(count=batch_size, ndim=ndim)
+    index.add(np.arange(batch_size), vectors, threads=threads)
+
+    # Batches release the GIL, and the batches on the same index wait for each other,
+    # while the readers and the removals wait for the batches
+    def search_and_add(offset: int):
+        offset_keys = np.arange(batch_size) + offset * batch_size
+        index.add(offset_keys, vectors, threads=threads)
+        index.search(vectors, 10, threads=threads)
+
+    def read_and_remove():
+        for key in range(batch_size // 2):
+            assert index.contains(key)
+            assert index.get(key) is not None
+            index.remove(key, compact=key % 256 == 0)
+            assert not index.contains(key)
+
+    workers = [Thread(target=search_and_add, args=(offset,)) for offset in range(1, 5)]
+    workers.append(Thread(target=read_and_remove))
+    for worker in workers:
+        worker.start()
+    for worker in workers:
+        worker.join()
+
+    assert len(index) == batch_size * 5 - batch_size // 2
+    assert not np.any(index.contains(np.arange(batch_size // 2)))
+    assert np.all(index.contains(np.arange(batch_size // 2, batch_size * 5)))
+
+
 @pytest.mark.parametrize("ndim", [3, 97, 256])
 @pytest.mark.parametrize("metric", [MetricKind.Cos, MetricKind.L2sq])
 @pytest.mark.parametrize("batch_size", [500, 1024])
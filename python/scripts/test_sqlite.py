@@ -1,6 +1,7 @@
 import sqlite3
 import json
 import math
+import subprocess
 import sys
 
 import numpy as np
@@ -326,3 +327,178 @@ def test_sqlite_distances_in_low_dimensions(num_vectors: int):
     # Clean up
     cursor.close()
     conn.close()
+
+
+@pytest.mark.parametrize("ndim", dimensions)
+def test_sqlite_virtual_table_knn(ndim: int, tmp_path):
+    """Searching, updating, and persisting the `usearch` virtual table."""
+
+    database_path = str(tmp_path / "vectors.db")
+    conn = sqlite3.connect(database_path)
+
+    # Loading extensions isn't supported in some SQLite builds,
+    # including the default one on MacOS
+    try:
+        conn.enable_load_extension(True)
+    except AttributeError:
+        pytest.skip("SQLite extensions are not available on this platform")
+        return
+
+    conn.load_extension(usearch.sqlite_path())
+    cursor = conn.cursor()
+    cursor.execute(f"CREATE VIRTUAL TABLE vectors USING usearch(dimensions={ndim}, metric=l2sq, dtype=f32)")
+
+    # Mix JSON and BLOB inputs
+    vectors = np.random.rand(100, ndim).astype(np.float32)
+    for key, vector in enumerate(vectors):
+        value = json.dumps(vector.tolist()) if key % 2 else vector.tobytes()
+        cursor.execute("INSERT INTO vectors(rowid, vector) VALUES (?, ?)", (key, value))
+    conn.commit()
+    assert cursor.execute("SELECT count(*) FROM vectors").fetchone()[0] == len(vectors)
+
+    def search(key: int, count: int, condition: str = ""):
+        query = vectors[key].tobytes()
+        cursor.execute(
+            f"SELECT rowid, distance FROM vectors WHERE vector MATCH ? AND k = ? {condition}",
+            (query, count),
+        )
+        return cursor.fetchall()
+
+    # Every vector must find itself, and the `LIMIT` can replace the `k`
+    for key in range(len(vectors)):
+        assert search(key, 3)[0] == (key, 0.0)
+    limited = cursor.execute(
+        "SELECT rowid FROM vectors WHERE vector MATCH ? ORDER BY distance LIMIT 5",
+        (vectors[7].tobytes(),),
+    ).fetchall()
+    assert len(limited) == 5 and limited[0][0] == 7
+
+    # Filter by the primary key during the search
+    assert [key for key, _ in search(7, 2, "AND rowid IN (3, 5, 9)")] == sorted(
+        [3, 5, 9], key=lambda key: np.sum((vectors[key] - vectors[7]) ** 2)
+    )[:2]
+    assert all(key > 50 for key, _ in search(7, 5, "AND rowid > 50"))
+
+    # Deletions and updates are reflected in the index, and rolled back with the transactions
+    cursor.execute("DELETE FROM vectors WHERE rowid = 7")
+    conn.commit()
+    assert 7 not in [key for key, _ in search(7, 3)]
+    cursor.execute("UPDATE vectors SET vector = ? WHERE rowid = 8", (vectors[9].tobytes(),))
+    conn.rollback()
+    assert search(8, 1)[0] == (8, 0.0)
+
+    # Invalid vectors are rejected
+    with pytest.raises(sqlite3.Error):
+        cursor.execute("INSERT INTO vectors(rowid, vector) VALUES (1000, '[1, 2]')")
+    with pytest.raises(sqlite3.Error):
+        cursor.execute("SELECT rowid FROM vectors WHERE vector MATCH ?", (vectors[0].tobytes(),)).fetchall()
+
+    # The index is saved next to the database and reused after reopening
+    conn.close()
+    conn = sqlite3.connect(database_path)
+    conn.enable_load_extension(True)
+    conn.load_extension(usearch.sqlite_path())
+    cursor = conn.cursor()
+    assert search(11, 3)[0] == (11, 0.0)
+    assert 7 not in [key for key, _ in search(7, 3)]
+
+    cursor.execute("DROP TABLE vectors")
+    cursor.close()
+    conn.close()
+
+
+def test_sqlite_virtual_table_conflicts(tmp_path):
+    """Resolving the `ON CONFLICT` clauses, keeping the index in sync with the shadow table."""
+
+    conn = sqlite3.connect(str(tmp_path / "conflicts.db"))
+    try:
+        conn.enable_load_extension(True)
+    except AttributeError:
+        pytest.skip("SQLite extensions are not available on this platform")
+        return
+
+    conn.load_extension(usearch.sqlite_path())
+    cursor = conn.cursor()
+    cursor.execute("CREATE VIRTUAL TABLE vectors USING usearch(dimensions=4, metric=l2sq, dtype=f32)")
+    vectors = np.eye(4, dtype=np.float32)
+    for key in range(3):
+        cursor.execute("INSERT INTO vectors(rowid, vector) VALUES (?, ?)", (key, vectors[key].tobytes()))
+    conn.commit()
+
+    def exact_matches(vector: np.ndarray):
+        cursor.execute("SELECT rowid, distance FROM vectors WHERE vector MATCH ? AND k = 4", (vector.tobytes(),))
+        return sorted(key for key, distance in cursor.fetchall() if distance == 0)
+
+    # Duplicate keys are rejected by default, and skipped with `OR IGNORE`
+    with pytest.raises(sqlite3.IntegrityError):
+        cursor.execute("INSERT INTO vectors(rowid, vector) VALUES (1, ?)", (vectors[3].tobytes(),))
+    cursor.execute("INSERT OR IGNORE INTO vectors(rowid, vector) VALUES (1, ?)", (vectors[3].tobytes(),))
+    assert exact_matches(vectors[1]) == [1]
+    assert exact_matches(vectors[3]) == []
+
+    # With `OR REPLACE` the old vector is dropped from the index, and the new one is searchable
+    cursor.execute("INSERT OR REPLACE INTO vectors(rowid, vector) VALUES (1, ?)", (vectors[3].tobytes(),))
+    conn.commit()
+    assert cursor.execute("SELECT count(*) FROM vectors").fetchone()[0] == 3
+    assert exact_matches(vectors[1]) == []
+    assert exact_matches(vectors[3]) == [1]
+
+    # Moving a row onto an existing key replaces that row, leaving a single entry for it
+    cursor.execute("UPDATE OR REPLACE vectors SET rowid = 2 WHERE rowid = 0")
+    conn.commit()
+    assert [key for key, in cursor.execute("SELECT rowid FROM vectors ORDER BY rowid")] == [1, 2]
+    assert exact_matches(vectors[0]) == [2]
+    assert exact_matches(vectors[2]) == []
+
+    # A failed update leaves both the shadow table and the index untouched
+    with pytest.raises(sqlite3.Error):
+        cursor.execute("UPDATE vectors SET vector = '[1, 2]' WHERE rowid = 2")
+    assert exact_matches(vectors[0]) == [2]
+
+    cursor.execute("DROP TABLE vectors")
+    cursor.close()
+    conn.close()
+
+
+def test_sqlite_virtual_table_outdated_file(tmp_path):
+    """The saved index isn't reused, if the vectors changed after it was saved, even with the same keys."""
+
+    database_path = str(tmp_path / "outdated.db")
+    conn = sqlite3.connect(database_path)
+    try:
+        conn.enable_load_extension(True)
+    except AttributeError:
+        pytest.skip("SQLite extensions are not available on this platform")
+        return
+
+    conn.load_extension(usearch.sqlite_path())
+    cursor = conn.cursor()
+    cursor.execute("CREATE VIRTUAL TABLE vectors USING usearch(dimensions=4, metric=l2sq, dtype=f32)")
+    vectors = np.random.rand(3, 4).astype(np.float32)
+    for key in range(2):
+        cursor.execute("INSERT INTO vectors(rowid, vector) VALUES (?, ?)", (key, vectors[key].tobytes()))
+    conn.commit()
+    conn.close()
+
+    # Another process updates a vector, and exits without closing the connection and saving the index
+    script = f"""
+import os, sqlite3
+conn = sqlite3.connect({database_path!r})
+conn.enable_load_extension(True)
+conn.load_extension({usearch.sqlite_path()!r})
+conn.execute("UPDATE vectors SET vector = ? WHERE rowid = 0", (bytes.fromhex({vectors[2].tobytes().hex()!r}),))
+conn.commit()
+os._exit(0)
+"""
+    subprocess.run([sys.executable, "-c", script], check=True)
+
+    conn = sqlite3.connect(database_path)
+    conn.enable_load_extension(True)
+    conn.load_extension(usearch.sqlite_path())
+    cursor = conn.cursor()
+    cursor.execute("SELECT rowid, distance FROM vectors WHERE vector MATCH ? AND k = 1", (vectors[2].tobytes(),))
+    assert cursor.fetchall() == [(0, 0.0)]
+
+    cursor.execute("DROP TABLE vectors")
+    cursor.close()
+    conn.close()
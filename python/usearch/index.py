@@ -167,12 +167,16 @@ def _search_in_compiled(
     *,
     log: Union[str, bool],
     progress: Optional[ProgressCallback],
+    out: Optional[Tuple[np.ndarray, np.ndarray, np.ndarray]] = None,
     **kwargs,
 ) -> Union[Matches, BatchMatches]:
     #
     assert isinstance(vectors, np.ndarray), "Expects a NumPy array"
     assert vectors.ndim == 1 or vectors.ndim == 2, "Expects a matrix or vector"
     assert not progress or _match_signature(progress, [int, int], bool), "Invalid callback"
+    if out is not None:
+        assert len(out) == 3, "Expects preallocated keys, distances, and counts arrays"
+        kwargs["keys_out"], kwargs["distances_out"], kwargs["counts_out"] = out
 
     if vectors.ndim == 1:
         vectors = vectors.reshape(1, len(vectors))
@@ -661,21 +665,27 @@ class Index:
     def search(
         self,
         vectors: VectorOrVectorsLike,
-        count: int = 10,
+        count: Optional[int] = None,
         radius: float = math.inf,
         *,
         threads: int = 0,
         exact: bool = False,
         log: Union[str, bool] = False,
         progress: Optional[ProgressCallback] = None,
+        out: Optional[Tuple[np.ndarray, np.ndarray, np.ndarray]] = None,
     ) -> Union[Matches, BatchMatches]:
         """
         Performs approximate nearest neighbors search for one or more queries.
+        The queries can be any NumPy matrix, including transposed or sliced views, that aren't copied.
+        The index is searched without the Global Interpreter Lock, so other Python threads keep running.
 
         :param vectors: Query vector or vectors.
         :type vectors: VectorOrVectorsLike
-        :param count: Upper count on the number of matches to find
-        :type count: int, defaults to 10
+        :param count: Upper count on the number of matches to find, keeping the closest ones
+        :type count: Optional[int], defaults to 10, or to zero for unlimited in range search
+        :param radius: Upper bound on the distance to the matches, switching to a range search,
+            that finds all of them in a single traversal, with `count` of zero lifting the limit
+        :type radius: float, defaults to math.inf
         :param threads: Optimal number of cores to use
         :type threads: int, defaults to 0
         :param exact: Perform exhaustive linear-time exact search
@@ -684,20 +694,39 @@ class Index:
         :type log: Union[str, bool], optional
         :param progress: Callback to report stats of the progress and control it
         :type progress: Optional[ProgressCallback], defaults to None
+        :param out: Preallocated keys and distances matrices with `count` columns, and a counts vector,
+            to be filled in-place instead of allocating new ones, not supported for range search
+        :type out: Optional[Tuple[np.ndarray, np.ndarray, np.ndarray]], defaults to None
         :return: Matches for one or more queries
         :rtype: Union[Matches, BatchMatches]
         """
 
+        if math.isfinite(radius):
+            assert out is None, "Range search results have variable lengths and can't be preallocated"
+            return _search_in_compiled(
+                self._compiled.range_search_many,
+                vectors,
+                # Batch scheduling:
+                log=log,
+                # Search constraints:
+                radius=radius,
+                count=0 if count is None else count,
+                exact=exact,
+                threads=threads,
+                progress=progress,
+            )
+
         return _search_in_compiled(
             self._compiled.search_many,
             vectors,
             # Batch scheduling:
             log=log,
             # Search constraints:
-            count=count,
+            count=10 if count is None else count,
             exact=exact,
             threads=threads,
             progress=progress,
+            out=out,
         )
 
     def contains(self, keys: KeyOrKeysLike) -> Union[bool, np.ndarray]:
@@ -1042,6 +1071,7 @@ class Index:
         threads: int = 0,
         log: Union[str, bool] = False,
         progress: Optional[ProgressCallback] = None,
+        out: Optional[Tuple[np.ndarray, np.ndarray, np.ndarray]] = None,
     ) -> Clustering:
         """
         Clusters already indexed or provided `vectors`, mapping them to various centroids.
@@ -1057,10 +1087,15 @@ class Index:
         :type log: Union[str, bool], defaults to False
         :param progress: Callback to report stats of the progress and control it
         :type progress: Optional[ProgressCallback], defaults to None
+        :param out: Preallocated single-column keys and distances matrices, and a counts vector
+        :type out: Optional[Tuple[np.ndarray, np.ndarray, np.ndarray]], defaults to None
         :return: Matches for one or more queries
         :rtype: Union[Matches, BatchMatches]
         """
         assert not progress or _match_signature(progress, [int, int], bool), "Invalid callback signature"
+        outputs = {}
+        if out is not None:
+            outputs["keys_out"], outputs["distances_out"], outputs["counts_out"] = out
 
         if min_count is None:
             min_count = 0
@@ -1075,6 +1110,7 @@ class Index:
                 max_count=max_count,
                 threads=threads,
                 progress=progress,
+                **outputs,
             )
         else:
             if keys is None:
@@ -1088,6 +1124,7 @@ class Index:
                 max_count=max_count,
                 threads=threads,
                 progress=progress,
+                **outputs,
             )
 
         batch_matches = BatchMatches(*results)
@@ -1167,6 +1204,29 @@ class Index:
         """
         return self._compiled.level_stats(level)
 
+    @property
+    def instrumentation(self) -> dict:
+        """Get the search counters and latency histograms, if the library was compiled
+        with ``USEARCH_USE_INSTRUMENTATION``, otherwise all of them are zeroed.
+
+        :return: Counters, with histograms as lists of 64 power-of-two buckets.
+        :rtype: dict
+
+        Counters:
+            - ``enabled`` (bool): Whether the instrumentation was compiled in.
+            - ``hops_per_level`` (List[int]): Expanded nodes on every graph level.
+            - ``missed_candidates`` (int): Neighbors visited for the first time.
+            - ``reused_candidates`` (int): Neighbors skipped, as already visited.
+            - ``distance_nanoseconds`` (int): Time spent in distance kernels.
+            - ``latency_nanoseconds``, ``hops``, ``computed_distances`` (List[int]):
+              Per-query distributions, where bucket ``i`` counts values in ``[2^(i-1), 2^i)``.
+        """
+        return self._compiled.instrumentation
+
+    def reset_instrumentation(self) -> None:
+        """Zeroes the instrumentation counters, while no searches are running."""
+        self._compiled.reset_instrumentation()
+
     @property
     def specs(self) -> Dict[str, Union[str, int, bool]]:
         if not hasattr(self, "_compiled"):
@@ -1269,6 +1329,7 @@ class Indexes:
         threads: int = 0,
         exact: bool = False,
         progress: Optional[ProgressCallback] = None,
+        out: Optional[Tuple[np.ndarray, np.ndarray, np.ndarray]] = None,
     ):
         return _search_in_compiled(
             self._compiled.search_many,
@@ -1280,6 +1341,7 @@ class Indexes:
             exact=exact,
             threads=threads,
             progress=progress,
+            out=out,
         )
 
 
@@ -1293,6 +1355,7 @@ def search(
     threads: int = 0,
     log: Union[str, bool] = False,
     progress: Optional[ProgressCallback] = None,
+    out: Optional[Tuple[np.ndarray, np.ndarray, np.ndarray]] = None,
 ) -> Union[Matches, BatchMatches]:
     """Shortcut for search, that can avoid index construction. Particularly useful for
     tiny datasets, where brute-force exact search works fast enough.
@@ -1319,6 +1382,8 @@ def search(
     :type log: Union[str, bool], optional
     :param progress: Callback to report stats of the progress and control it
     :type progress: Optional[ProgressCallback], defaults to None
+    :param out: Preallocated keys and distances matrices with `count` columns, and a counts vector
+    :type out: Optional[Tuple[np.ndarray, np.ndarray, np.ndarray]], defaults to None
     :return: Matches for one or more queries
     :rtype: Union[Matches, BatchMatches]
     """
@@ -1344,6 +1409,7 @@ def search(
             threads=threads,
             log=log,
             progress=progress,
+            out=out,
         )
 
     metric = _normalize_metric(metric)
@@ -1381,4 +1447,5 @@ def search(
         count=count,
         threads=threads,
         progress=progress,
+        out=out,
     )
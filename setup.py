@@ -47,12 +47,14 @@ prefer_openmp: bool = is_linux and is_gcc
 use_simsimd: bool = get_bool_env("USEARCH_USE_SIMSIMD", prefer_simsimd)
 use_fp16lib: bool = get_bool_env("USEARCH_USE_FP16LIB", prefer_fp16lib)
 use_openmp: bool = get_bool_env("USEARCH_USE_OPENMP", prefer_openmp)
+use_instrumentation: bool = get_bool_env("USEARCH_USE_INSTRUMENTATION", False)
 
 
 # Common arguments for all platforms
 macros_args.append(("USEARCH_USE_OPENMP", "1" if use_openmp else "0"))
 macros_args.append(("USEARCH_USE_SIMSIMD", "1" if use_simsimd else "0"))
 macros_args.append(("USEARCH_USE_FP16LIB", "1" if use_fp16lib else "0"))
+macros_args.append(("USEARCH_USE_INSTRUMENTATION", "1" if use_instrumentation else "0"))
 
 if is_linux:
     compile_args.append("-std=c++17")
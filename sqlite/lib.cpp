@@ -6,8 +6,18 @@
  *  @copyright  Copyright (c) 2023
  */
 
-#include <charconv> // `std::from_chars`
-#include <cstdlib>  // `std::strtod`
+#include <algorithm>     // `std::sort`, `std::binary_search`
+#include <atomic>        // `std::atomic`
+#include <cctype>        // `std::isspace`
+#include <cmath>         // `std::ceil`, `std::floor`
+#include <charconv>      // `std::from_chars`
+#include <cstdio>        // `std::rename`, `std::remove`
+#include <cstdlib>       // `std::strtod`
+#include <cstring>       // `std::strchr`, `std::strcmp`
+#include <limits>        // `std::numeric_limits`
+#include <string>        // `std::string`
+#include <unordered_set> // `std::unordered_set`
+#include <vector>        // `std::vector`
 
 #include <sqlite3ext.h>
 SQLITE_EXTENSION_INIT1
@@ -266,6 +276,1110 @@ static void sqlite_strings(sqlite3_context* context, int argc, sqlite3_value** a
     sqlite3_result_int64(context, (std::int64_t)result);
 }
 
+/**
+ *  @brief  Virtual table module, answering KNN queries with an HNSW index instead of full table scans.
+ *
+ *  The vectors are kept in a "shadow" table of the same database, that is the source of truth and follows
+ *  the transactions. Every connection keeps an `index_dense_t` over them in memory, updated on every
+ *  INSERT, UPDATE, and DELETE, and persisted into a file next to the database, when the connection is closed.
+ *  The next connection loads that file, rebuilding the index from the shadow table only if it is missing
+ *  or doesn't match the table. Writes through other connections are detected with a version counter.
+ *
+ *  @code{.sql}
+ *  CREATE VIRTUAL TABLE images USING usearch(dimensions=256, metric=cos, dtype=f16);
+ *  INSERT INTO images(rowid, vector) VALUES (42, '[0.1, 0.2, ...]');
+ *  SELECT rowid, distance FROM images WHERE vector MATCH '[0.1, 0.2, ...]' AND k = 10;
+ *  SELECT rowid, distance FROM images WHERE vector MATCH ? AND rowid IN (1, 2, 3) ORDER BY distance LIMIT 10;
+ *  @endcode
+ */
+struct vtab_t : public sqlite3_vtab {
+    sqlite3* db{};
+    std::string schema;
+    std::string name;
+    std::string path;
+    index_dense_t index;
+
+    /// @brief  Whether the index was loaded or rebuilt from the shadow table.
+    bool loaded{};
+    /// @brief  Whether the index has changed since it was loaded, and has to be saved.
+    bool dirty{};
+    /// @brief  Value of the version counter in the shadow table, that the index corresponds to.
+    sqlite3_int64 version{};
+    /// @brief  Whether the version counter was already incremented in the current transaction.
+    bool version_bumped{};
+    /// @brief  Keys modified in the current transaction, to be reverted on rollback.
+    std::unordered_set<sqlite3_int64> touched;
+    /// @brief  Keys modified in the rolled back transactions or savepoints, to be re-read from the shadow table.
+    std::unordered_set<sqlite3_int64> rolled_back;
+
+    sqlite3_stmt* select_version{};
+    sqlite3_stmt* select_saved_version{};
+    sqlite3_stmt* bump_version{};
+    sqlite3_stmt* select_vector{};
+    sqlite3_stmt* insert_vector{};
+    sqlite3_stmt* replace_vector{};
+    sqlite3_stmt* update_vector{};
+    sqlite3_stmt* update_or_replace_vector{};
+    sqlite3_stmt* delete_vector{};
+
+    vtab_t() noexcept : sqlite3_vtab{} {}
+    ~vtab_t() noexcept { finalize(); }
+
+    void finalize() noexcept {
+        for (sqlite3_stmt** statement : {&select_version, &select_saved_version, &bump_version, &select_vector,
+                                         &insert_vector, &replace_vector, &update_vector, &update_or_replace_vector,
+                                         &delete_vector})
+            sqlite3_finalize(*statement), *statement = nullptr;
+    }
+
+    int fail(char const* message) noexcept {
+        sqlite3_free(zErrMsg);
+        zErrMsg = sqlite3_mprintf("%s", message);
+        return SQLITE_ERROR;
+    }
+
+    int fail_with_db() noexcept { return fail(sqlite3_errmsg(db)); }
+
+    /// @brief  Lazily prepares a statement over the shadow tables, with `%w` placeholders for the schema and name.
+    sqlite3_stmt* statement(sqlite3_stmt*& cached, char const* format) noexcept {
+        if (cached)
+            return cached;
+        char* sql = sqlite3_mprintf(format, schema.c_str(), name.c_str());
+        if (sql)
+            sqlite3_prepare_v3(db, sql, -1, SQLITE_PREPARE_PERSISTENT, &cached, nullptr);
+        sqlite3_free(sql);
+        return cached;
+    }
+};
+
+enum vtab_column_t {
+    vtab_column_vector_k = 0,
+    vtab_column_distance_k = 1,
+    vtab_column_k_k = 2,
+};
+
+/// @brief  Query plans, addressed by `idxNum`, with the arguments passed to `xFilter` in the same order.
+enum vtab_plan_t {
+    vtab_plan_scan_k = 0,
+    vtab_plan_rowid_k = 1 << 0,
+    vtab_plan_knn_k = 1 << 1,
+    vtab_plan_k_k = 1 << 2,
+    vtab_plan_limit_k = 1 << 3,
+    vtab_plan_offset_k = 1 << 4,
+    vtab_plan_rowid_in_k = 1 << 5,
+    vtab_plan_rowid_ge_k = 1 << 6,
+    vtab_plan_rowid_gt_k = 1 << 7,
+    vtab_plan_rowid_le_k = 1 << 8,
+    vtab_plan_rowid_lt_k = 1 << 9,
+};
+
+struct vtab_cursor_t : public sqlite3_vtab_cursor {
+    int plan{};
+    sqlite3_stmt* rows{};
+    bool eof{};
+    sqlite3_int64 wanted{};
+    std::vector<default_key_t> keys;
+    std::vector<distance_t> distances;
+    std::size_t position{};
+
+    vtab_cursor_t() noexcept : sqlite3_vtab_cursor{} {}
+    ~vtab_cursor_t() noexcept { sqlite3_finalize(rows); }
+};
+
+/**
+ *  @brief  Parses a JSON array of numbers or comma-separated values.
+ *  @return True if exactly `dimensions` numbers were parsed.
+ */
+static bool parse_vector(char const* text, std::size_t bytes, f64_t* parsed, std::size_t dimensions) noexcept {
+    char const* end = text + bytes;
+    std::size_t count = 0;
+    while (true) {
+        while (text != end && (*text == ' ' || *text == ',' || *text == '[' || *text == '\n' || *text == '\t'))
+            ++text;
+        if (text == end || *text == ']')
+            break;
+        if (count == dimensions)
+            return false;
+#if __cpp_lib_to_chars
+        std::from_chars_result result = std::from_chars(text, end, parsed[count]);
+        if (result.ec != std::errc())
+            return false;
+        text = result.ptr;
+#else
+        char* parsed_end = nullptr;
+        parsed[count] = std::strtod(text, &parsed_end);
+        if (parsed_end == text)
+            return false;
+        text = parsed_end;
+#endif
+        ++count;
+    }
+    return count == dimensions;
+}
+
+/**
+ *  @brief  Decodes a vector, passed either as a BLOB of scalars of the table type, or as a JSON TEXT.
+ *  @param[out] parsed Buffer for the numbers parsed from the TEXT.
+ *  @return Error message or `nullptr`, exporting the vector and the kind of its scalars.
+ */
+static char const* decode_vector(                                     //
+    index_dense_t const& index, int type, void const* data, int bytes, //
+    std::vector<f64_t>& parsed, byte_t const*& vector, scalar_kind_t& kind) noexcept {
+
+    if (type == SQLITE_BLOB) {
+        if (static_cast<std::size_t>(bytes) != index.bytes_per_vector())
+            return "The BLOB size doesn't match the number of dimensions and the type of the table";
+        vector = reinterpret_cast<byte_t const*>(data);
+        kind = index.scalar_kind();
+        return nullptr;
+    }
+    if (type != SQLITE_TEXT)
+        return "Vectors must be passed as BLOBs or JSON arrays";
+    if (index.scalar_kind() == scalar_kind_t::b1x8_k)
+        return "Binary vectors must be passed as BLOBs";
+
+    parsed.resize(index.dimensions());
+    if (!parse_vector(reinterpret_cast<char const*>(data), static_cast<std::size_t>(bytes), parsed.data(),
+                      parsed.size()))
+        return "The JSON array can't be parsed or doesn't match the number of dimensions";
+    vector = reinterpret_cast<byte_t const*>(parsed.data());
+    kind = scalar_kind_t::f64_k;
+    return nullptr;
+}
+
+static char const* decode_vector(index_dense_t const& index, sqlite3_value* value, std::vector<f64_t>& parsed,
+                                 byte_t const*& vector, scalar_kind_t& kind) noexcept {
+    // The pointer obtained from `sqlite3_value_text` or `sqlite3_value_blob` can
+    // be invalidated by the next call to `sqlite3_value_bytes` according to docs, so read it first.
+    int type = sqlite3_value_type(value);
+    void const* data = type == SQLITE_BLOB ? sqlite3_value_blob(value) : (void const*)sqlite3_value_text(value);
+    return decode_vector(index, type, data, sqlite3_value_bytes(value), parsed, vector, kind);
+}
+
+static index_dense_t::add_result_t vtab_add(index_dense_t& index, default_key_t key, byte_t const* vector,
+                                            scalar_kind_t kind, std::size_t thread) {
+    switch (kind) {
+    case scalar_kind_t::b1x8_k: return index.add(key, (b1x8_t const*)vector, thread);
+    case scalar_kind_t::i8_k: return index.add(key, (i8_t const*)vector, thread);
+    case scalar_kind_t::f16_k: return index.add(key, (f16_t const*)vector, thread);
+    case scalar_kind_t::f32_k: return index.add(key, (f32_t const*)vector, thread);
+    case scalar_kind_t::f64_k: return index.add(key, (f64_t const*)vector, thread);
+    default: return index_dense_t::add_result_t{}.failed("Unknown scalar kind!");
+    }
+}
+
+template <typename predicate_at>
+static index_dense_t::search_result_t vtab_search(index_dense_t const& index, byte_t const* vector,
+                                                  scalar_kind_t kind, std::size_t wanted, predicate_at&& predicate) {
+    switch (kind) {
+    case scalar_kind_t::b1x8_k: return index.filtered_search((b1x8_t const*)vector, wanted, predicate, 0);
+    case scalar_kind_t::i8_k: return index.filtered_search((i8_t const*)vector, wanted, predicate, 0);
+    case scalar_kind_t::f16_k: return index.filtered_search((f16_t const*)vector, wanted, predicate, 0);
+    case scalar_kind_t::f32_k: return index.filtered_search((f32_t const*)vector, wanted, predicate, 0);
+    case scalar_kind_t::f64_k: return index.filtered_search((f64_t const*)vector, wanted, predicate, 0);
+    default: return index_dense_t::search_result_t{}.failed("Unknown scalar kind!");
+    }
+}
+
+/// @brief  Grows the index, if it is full, to fit one more entry.
+static bool vtab_reserve(index_dense_t& index) {
+    if (index.size() < index.capacity())
+        return true;
+    return index.reserve(index_limits_t(ceil2(index.size() + 1), (std::max)(index.limits().threads(), std::size_t(1))));
+}
+
+static sqlite3_int64 vtab_version(vtab_t& table) {
+    sqlite3_stmt* select = table.statement( //
+        table.select_version, "SELECT value FROM \"%w\".\"%w_info\" WHERE key = 'version'");
+    if (!select)
+        return -1;
+    sqlite3_int64 version = sqlite3_step(select) == SQLITE_ROW ? sqlite3_column_int64(select, 0) : -1;
+    sqlite3_reset(select);
+    return version;
+}
+
+/// @brief  Version of the shadow table, that the index file next to the database was saved at, or -1.
+static sqlite3_int64 vtab_saved_version(vtab_t& table) {
+    sqlite3_stmt* select = table.statement( //
+        table.select_saved_version, "SELECT value FROM \"%w\".\"%w_info\" WHERE key = 'saved_version'");
+    if (!select)
+        return -1;
+    sqlite3_int64 version = sqlite3_step(select) == SQLITE_ROW ? sqlite3_column_int64(select, 0) : -1;
+    sqlite3_reset(select);
+    return version;
+}
+
+/**
+ *  @brief  Saves the index next to the database and records the version of the shadow table it matches,
+ *          holding the write lock, so that no other connection can change the vectors meanwhile.
+ *  @return False if the file may be outdated, and must be removed.
+ */
+static bool vtab_save(vtab_t& table) {
+    if (!table.rolled_back.empty() || !sqlite3_get_autocommit(table.db))
+        return false;
+    if (sqlite3_exec(table.db, "BEGIN IMMEDIATE", nullptr, nullptr, nullptr) != SQLITE_OK)
+        return false;
+
+    // Save into a temporary file first, not to corrupt the previous one, if the disk is full
+    bool saved = vtab_version(table) == table.version;
+    if (saved) {
+        std::string temporary_path = table.path + "-tmp";
+        saved = !table.index.save(temporary_path.c_str()).error.release() &&
+                std::rename(temporary_path.c_str(), table.path.c_str()) == 0;
+        if (!saved)
+            std::remove(temporary_path.c_str());
+    }
+    if (saved) {
+        char* sql = sqlite3_mprintf( //
+            "INSERT OR REPLACE INTO \"%w\".\"%w_info\"(key, value) VALUES ('saved_version', %lld)",
+            table.schema.c_str(), table.name.c_str(), table.version);
+        saved = sql && sqlite3_exec(table.db, sql, nullptr, nullptr, nullptr) == SQLITE_OK;
+        sqlite3_free(sql);
+    }
+    int rc = sqlite3_exec(table.db, saved ? "COMMIT" : "ROLLBACK", nullptr, nullptr, nullptr);
+    return saved && rc == SQLITE_OK;
+}
+
+/// @brief  Checks if the index loaded from a file has the same keys as the shadow table.
+static bool vtab_matches_table(vtab_t& table) {
+    char* sql = sqlite3_mprintf("SELECT rowid FROM \"%w\".\"%w_vectors\"", table.schema.c_str(), table.name.c_str());
+    sqlite3_stmt* rows = nullptr;
+    int rc = sql ? sqlite3_prepare_v2(table.db, sql, -1, &rows, nullptr) : SQLITE_NOMEM;
+    sqlite3_free(sql);
+    std::size_t count = 0;
+    bool matches = rc == SQLITE_OK;
+    while (matches && (rc = sqlite3_step(rows)) == SQLITE_ROW)
+        matches = table.index.contains(static_cast<default_key_t>(sqlite3_column_int64(rows, 0))), ++count;
+    sqlite3_finalize(rows);
+    return matches && rc == SQLITE_DONE && count == table.index.size();
+}
+
+/// @brief  Rebuilds the index from the shadow table, decoding and inserting the vectors in parallel batches.
+static int vtab_rebuild(vtab_t& table) {
+    table.index.clear();
+    char* sql = sqlite3_mprintf( //
+        "SELECT rowid, vector FROM \"%w\".\"%w_vectors\"", table.schema.c_str(), table.name.c_str());
+    sqlite3_stmt* rows = nullptr;
+    int rc = sql ? sqlite3_prepare_v2(table.db, sql, -1, &rows, nullptr) : SQLITE_NOMEM;
+    sqlite3_free(sql);
+    if (rc != SQLITE_OK)
+        return table.fail_with_db();
+
+    std::size_t const threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+    std::size_t const batch_size = threads * 1024;
+    executor_default_t executor{threads};
+    std::vector<std::vector<f64_t>> parsed(threads);
+
+    // Every row is copied into the `arena`, as the pointers don't outlive the next step
+    std::vector<default_key_t> keys;
+    std::vector<int> types;
+    std::vector<std::size_t> offsets;
+    std::vector<char> arena;
+    char const* error = nullptr;
+    bool reading = true;
+    while (reading && !error) {
+        keys.clear(), types.clear(), offsets.clear(), arena.clear();
+        offsets.push_back(0);
+        while (keys.size() != batch_size && (reading = (rc = sqlite3_step(rows)) == SQLITE_ROW)) {
+            int type = sqlite3_column_type(rows, 1);
+            char const* data = type == SQLITE_BLOB ? (char const*)sqlite3_column_blob(rows, 1)
+                                                   : (char const*)sqlite3_column_text(rows, 1);
+            int bytes = sqlite3_column_bytes(rows, 1);
+            keys.push_back(static_cast<default_key_t>(sqlite3_column_int64(rows, 0)));
+            types.push_back(type);
+            arena.insert(arena.end(), data, data + bytes);
+            arena.push_back('\0');
+            offsets.push_back(arena.size());
+        }
+        if (!reading && rc != SQLITE_DONE)
+            break;
+        if (keys.empty() || !table.index.reserve(index_limits_t(table.index.size() + keys.size(), threads))) {
+            error = keys.empty() ? nullptr : "Out of memory!";
+            continue;
+        }
+
+        std::atomic<char const*> atomic_error{nullptr};
+        executor.dynamic(keys.size(), [&](std::size_t thread, std::size_t task) {
+            byte_t const* vector = nullptr;
+            scalar_kind_t kind = scalar_kind_t::unknown_k;
+            int bytes = static_cast<int>(offsets[task + 1] - offsets[task] - 1);
+            char const* decoding_error = decode_vector( //
+                table.index, types[task], arena.data() + offsets[task], bytes, parsed[thread], vector, kind);
+            if (decoding_error) {
+                atomic_error = decoding_error;
+                return false;
+            }
+            index_dense_t::add_result_t added = vtab_add(table.index, keys[task], vector, kind, thread);
+            if (!added) {
+                atomic_error = added.error.release();
+                return false;
+            }
+            return true;
+        });
+        error = atomic_error.load();
+    }
+    sqlite3_finalize(rows);
+    if (error)
+        return table.fail(error);
+    if (rc != SQLITE_DONE)
+        return table.fail_with_db();
+    return SQLITE_OK;
+}
+
+/**
+ *  @brief  Brings the index in sync with the shadow table: loads or rebuilds it on first use,
+ *          after writes through other connections, and re-reads the keys touched by rolled back transactions.
+ */
+static int vtab_sync(vtab_t& table) {
+    sqlite3_int64 version = vtab_version(table);
+    if (version < 0)
+        return table.fail_with_db();
+
+    if (table.loaded && version == table.version && table.rolled_back.empty())
+        return SQLITE_OK;
+
+    // Revert just the keys changed by the rolled back transactions or savepoints
+    if (table.loaded && version == table.version) {
+        sqlite3_stmt* select = table.statement( //
+            table.select_vector, "SELECT vector FROM \"%w\".\"%w_vectors\" WHERE rowid = ?");
+        if (!select)
+            return table.fail_with_db();
+        std::vector<f64_t> parsed;
+        for (sqlite3_int64 key : table.rolled_back) {
+            table.index.remove(static_cast<default_key_t>(key)).error.release();
+            sqlite3_bind_int64(select, 1, key);
+            int rc = sqlite3_step(select);
+            char const* error = nullptr;
+            if (rc == SQLITE_ROW) {
+                byte_t const* vector = nullptr;
+                scalar_kind_t kind = scalar_kind_t::unknown_k;
+                error = decode_vector(table.index, sqlite3_column_value(select, 0), parsed, vector, kind);
+                if (!error && !vtab_reserve(table.index))
+                    error = "Out of memory!";
+                if (!error)
+                    error = vtab_add(table.index, static_cast<default_key_t>(key), vector, kind, 0).error.release();
+            }
+            sqlite3_reset(select);
+            if (rc != SQLITE_ROW && rc != SQLITE_DONE)
+                return table.fail_with_db();
+            if (error)
+                return table.fail(error);
+        }
+        table.rolled_back.clear();
+        table.dirty = true;
+        return SQLITE_OK;
+    }
+
+    // Try the file left by the previous connection, if no writes happened since, before rebuilding from scratch
+    bool reused = false;
+    if (!table.loaded && !table.path.empty() && vtab_saved_version(table) == version) {
+        index_dense_t loaded = index_dense_t::make(table.index.metric(), table.index.config());
+        serialization_result_t result = loaded.load(table.path.c_str());
+        reused = result && loaded.dimensions() == table.index.dimensions() &&
+                 loaded.scalar_kind() == table.index.scalar_kind() &&
+                 loaded.metric().metric_kind() == table.index.metric().metric_kind();
+        result.error.release();
+        if (reused) {
+            std::swap(table.index, loaded);
+            reused = vtab_matches_table(table);
+            if (!reused)
+                std::swap(table.index, loaded);
+        }
+    }
+    if (!reused) {
+        int rc = vtab_rebuild(table);
+        if (rc != SQLITE_OK)
+            return rc;
+    }
+
+    table.loaded = true;
+    table.dirty = !reused;
+    table.version = version;
+    table.rolled_back.clear();
+    table.touched.clear();
+    return SQLITE_OK;
+}
+
+/// @brief  Index files are kept next to the database by default, and not persisted for in-memory databases.
+static std::string vtab_default_path(sqlite3* db, char const* schema, char const* name) {
+    char const* database_path = sqlite3_db_filename(db, schema);
+    return database_path && *database_path ? std::string(database_path) + "-" + name + ".usearch" : std::string();
+}
+
+static char const* vtab_trim(char const*& begin, char const* end) noexcept {
+    while (begin != end && std::isspace(static_cast<unsigned char>(*begin)))
+        ++begin;
+    while (end != begin && std::isspace(static_cast<unsigned char>(end[-1])))
+        --end;
+    if (end - begin >= 2 && (*begin == '\'' || *begin == '"') && end[-1] == *begin)
+        ++begin, --end;
+    return end;
+}
+
+/**
+ *  @brief  Shared implementation of `xCreate` and `xConnect`, parsing the `key=value` arguments
+ *          following the module name: `dimensions`, `metric`, `dtype`, `connectivity`,
+ *          `expansion_add`, `expansion_search`, and `path`.
+ */
+static int vtab_init(sqlite3* db, int argc, char const* const* argv, sqlite3_vtab** vtab, char** error_message,
+                     bool create) {
+
+    std::size_t dimensions = 0;
+    metric_kind_t metric_kind = metric_kind_t::cos_k;
+    scalar_kind_t scalar_kind = scalar_kind_t::f32_k;
+    index_dense_config_t config;
+    std::string path = vtab_default_path(db, argv[1], argv[2]);
+
+    for (int i = 3; i != argc; ++i) {
+        char const* key = argv[i];
+        char const* separator = std::strchr(key, '=');
+        if (!separator) {
+            *error_message = sqlite3_mprintf("Expected a `key=value` argument, got: %s", key);
+            return SQLITE_ERROR;
+        }
+        char const* key_end = vtab_trim(key, separator);
+        char const* value = separator + 1;
+        char const* value_end = vtab_trim(value, value + std::strlen(value));
+        std::string value_str(value, value_end);
+        std::size_t key_length = static_cast<std::size_t>(key_end - key);
+        char* number_end = nullptr;
+        std::size_t number = std::strtoul(value_str.c_str(), &number_end, 10);
+        bool is_number = !value_str.empty() && *number_end == '\0';
+
+        if (str_equals(key, key_length, "dimensions") && is_number)
+            dimensions = number;
+        else if (str_equals(key, key_length, "connectivity") && is_number)
+            config.connectivity = number;
+        else if (str_equals(key, key_length, "expansion_add") && is_number)
+            config.expansion_add = number;
+        else if (str_equals(key, key_length, "expansion_search") && is_number)
+            config.expansion_search = number;
+        else if (str_equals(key, key_length, "path"))
+            path = value_str;
+        else if (str_equals(key, key_length, "metric")) {
+            expected_gt<metric_kind_t> parsed = metric_from_name(value_str.c_str());
+            if (!parsed) {
+                *error_message = sqlite3_mprintf("%s", parsed.error.release());
+                return SQLITE_ERROR;
+            }
+            metric_kind = parsed.result;
+        } else if (str_equals(key, key_length, "dtype")) {
+            if (value_str == "b1" || value_str == "b1x8") {
+                scalar_kind = scalar_kind_t::b1x8_k;
+                continue;
+            }
+            expected_gt<scalar_kind_t> parsed = scalar_kind_from_name(value_str.c_str());
+            if (!parsed) {
+                *error_message = sqlite3_mprintf("%s", parsed.error.release());
+                return SQLITE_ERROR;
+            }
+            scalar_kind = parsed.result;
+        } else {
+            *error_message = sqlite3_mprintf("Unknown or invalid argument: %s", argv[i]);
+            return SQLITE_ERROR;
+        }
+    }
+    if (!dimensions) {
+        *error_message = sqlite3_mprintf("The number of `dimensions` must be specified");
+        return SQLITE_ERROR;
+    }
+
+    metric_t metric = metric_t::builtin(dimensions, metric_kind, scalar_kind);
+    if (metric.missing()) {
+        *error_message = sqlite3_mprintf("Unsupported combination of the metric and the scalar type");
+        return SQLITE_ERROR;
+    }
+
+    int rc = sqlite3_declare_vtab(db, "CREATE TABLE x(vector, distance HIDDEN, k HIDDEN)");
+    if (rc != SQLITE_OK)
+        return rc;
+    if (create) {
+        char* sql = sqlite3_mprintf(                                                           //
+            "CREATE TABLE \"%w\".\"%w_vectors\"(rowid INTEGER PRIMARY KEY, vector NOT NULL);" //
+            "CREATE TABLE \"%w\".\"%w_info\"(key TEXT PRIMARY KEY, value);"                   //
+            "INSERT INTO \"%w\".\"%w_info\"(key, value) VALUES ('version', 0);",              //
+            argv[1], argv[2], argv[1], argv[2], argv[1], argv[2]);
+        rc = sql ? sqlite3_exec(db, sql, nullptr, nullptr, error_message) : SQLITE_NOMEM;
+        sqlite3_free(sql);
+        if (rc != SQLITE_OK)
+            return rc;
+    }
+
+    vtab_t* table = new (std::nothrow) vtab_t();
+    if (!table)
+        return SQLITE_NOMEM;
+    table->db = db;
+    table->schema = argv[1];
+    table->name = argv[2];
+    table->path = path;
+    table->index = index_dense_t::make(metric, config);
+    if (!table->index || !table->index.reserve(index_limits_t(0, 1))) {
+        delete table;
+        return SQLITE_NOMEM;
+    }
+
+    // A new table has no vectors, and the stale file of a previous one with the same name must be ignored
+    if (create) {
+        table->loaded = true;
+        table->dirty = true;
+    }
+    sqlite3_vtab_config(db, SQLITE_VTAB_CONSTRAINT_SUPPORT, 1);
+    *vtab = table;
+    return SQLITE_OK;
+}
+
+static int vtab_create(sqlite3* db, void*, int argc, char const* const* argv, sqlite3_vtab** vtab, char** error) {
+    return vtab_init(db, argc, argv, vtab, error, true);
+}
+
+static int vtab_connect(sqlite3* db, void*, int argc, char const* const* argv, sqlite3_vtab** vtab, char** error) {
+    return vtab_init(db, argc, argv, vtab, error, false);
+}
+
+static int vtab_disconnect(sqlite3_vtab* vtab) {
+    vtab_t* table = static_cast<vtab_t*>(vtab);
+
+    // An index, that missed the writes of other connections or rolled back transactions, is dropped
+    if (table->loaded && table->dirty && !table->path.empty() && !vtab_save(*table))
+        std::remove(table->path.c_str());
+    delete table;
+    return SQLITE_OK;
+}
+
+static int vtab_destroy(sqlite3_vtab* vtab) {
+    vtab_t* table = static_cast<vtab_t*>(vtab);
+    char* sql = sqlite3_mprintf("DROP TABLE \"%w\".\"%w_vectors\"; DROP TABLE \"%w\".\"%w_info\";",
+                                table->schema.c_str(), table->name.c_str(), table->schema.c_str(),
+                                table->name.c_str());
+    int rc = sql ? sqlite3_exec(table->db, sql, nullptr, nullptr, nullptr) : SQLITE_NOMEM;
+    sqlite3_free(sql);
+    if (rc != SQLITE_OK)
+        return rc;
+    if (!table->path.empty())
+        std::remove(table->path.c_str());
+    delete table;
+    return SQLITE_OK;
+}
+
+static int vtab_best_index(sqlite3_vtab*, sqlite3_index_info* info) {
+    int match = -1, k = -1, limit = -1, offset = -1, rowid_eq = -1, rowid_lower = -1, rowid_upper = -1;
+    bool match_unusable = false;
+    for (int i = 0; i != info->nConstraint; ++i) {
+        auto const& constraint = info->aConstraint[i];
+        if (constraint.iColumn == vtab_column_vector_k && constraint.op == SQLITE_INDEX_CONSTRAINT_MATCH) {
+            match_unusable |= !constraint.usable;
+            match = constraint.usable && match < 0 ? i : match;
+            continue;
+        }
+        if (!constraint.usable)
+            continue;
+        if (constraint.iColumn == vtab_column_k_k && constraint.op == SQLITE_INDEX_CONSTRAINT_EQ && k < 0)
+            k = i;
+#if SQLITE_VERSION_NUMBER >= 3038000
+        else if (constraint.op == SQLITE_INDEX_CONSTRAINT_LIMIT && limit < 0)
+            limit = i;
+        else if (constraint.op == SQLITE_INDEX_CONSTRAINT_OFFSET && offset < 0)
+            offset = i;
+#endif
+        else if (constraint.iColumn == -1 && constraint.op == SQLITE_INDEX_CONSTRAINT_EQ && rowid_eq < 0)
+            rowid_eq = i;
+        else if (constraint.iColumn == -1 && rowid_lower < 0 &&
+                 (constraint.op == SQLITE_INDEX_CONSTRAINT_GE || constraint.op == SQLITE_INDEX_CONSTRAINT_GT))
+            rowid_lower = i;
+        else if (constraint.iColumn == -1 && rowid_upper < 0 &&
+                 (constraint.op == SQLITE_INDEX_CONSTRAINT_LE || constraint.op == SQLITE_INDEX_CONSTRAINT_LT))
+            rowid_upper = i;
+    }
+
+    // The `MATCH` operator can't be evaluated by SQLite itself
+    if (match < 0 && match_unusable)
+        return SQLITE_CONSTRAINT;
+
+    int argument = 0;
+    auto use = [&](int i, bool omit) {
+        info->aConstraintUsage[i].argvIndex = ++argument;
+        info->aConstraintUsage[i].omit = omit;
+    };
+
+    if (match < 0) {
+        if (rowid_eq >= 0) {
+            use(rowid_eq, true);
+            info->idxNum = vtab_plan_rowid_k;
+            info->estimatedCost = 1;
+            info->estimatedRows = 1;
+            info->idxFlags = SQLITE_INDEX_SCAN_UNIQUE;
+        } else {
+            info->idxNum = vtab_plan_scan_k;
+            info->estimatedCost = 1e7;
+        }
+        return SQLITE_OK;
+    }
+
+    // KNN queries with optional filters, all evaluated here, so that SQLite can push down the LIMIT
+    int plan = vtab_plan_knn_k;
+    bool ordered = true;
+    use(match, true);
+    if (k >= 0)
+        use(k, true), plan |= vtab_plan_k_k;
+    if (limit >= 0)
+        use(limit, false), plan |= vtab_plan_limit_k;
+    if (offset >= 0)
+        use(offset, false), plan |= vtab_plan_offset_k;
+    if (rowid_eq >= 0) {
+        use(rowid_eq, true), plan |= vtab_plan_rowid_in_k;
+        // Collect all the values of the `rowid IN (...)` list at once, or the results of separate
+        // calls for every value won't be ordered by distance
+        ordered = false;
+#if SQLITE_VERSION_NUMBER >= 3038000
+        if (sqlite3_libversion_number() >= 3038000)
+            ordered = !sqlite3_vtab_in(info, rowid_eq, -1) || sqlite3_vtab_in(info, rowid_eq, 1);
+#endif
+    }
+    if (rowid_lower >= 0) {
+        use(rowid_lower, true);
+        plan |= info->aConstraint[rowid_lower].op == SQLITE_INDEX_CONSTRAINT_GE ? vtab_plan_rowid_ge_k
+                                                                                 : vtab_plan_rowid_gt_k;
+    }
+    if (rowid_upper >= 0) {
+        use(rowid_upper, true);
+        plan |= info->aConstraint[rowid_upper].op == SQLITE_INDEX_CONSTRAINT_LE ? vtab_plan_rowid_le_k
+                                                                                 : vtab_plan_rowid_lt_k;
+    }
+    if (ordered && info->nOrderBy == 1 && info->aOrderBy[0].iColumn == vtab_column_distance_k &&
+        !info->aOrderBy[0].desc)
+        info->orderByConsumed = 1;
+    info->idxNum = plan;
+    info->estimatedCost = 100;
+    info->estimatedRows = 10;
+    return SQLITE_OK;
+}
+
+static int vtab_open(sqlite3_vtab*, sqlite3_vtab_cursor** cursor) {
+    vtab_cursor_t* result = new (std::nothrow) vtab_cursor_t();
+    if (!result)
+        return SQLITE_NOMEM;
+    *cursor = result;
+    return SQLITE_OK;
+}
+
+static int vtab_close(sqlite3_vtab_cursor* cursor) {
+    delete static_cast<vtab_cursor_t*>(cursor);
+    return SQLITE_OK;
+}
+
+/**
+ *  @brief  Narrows the set of allowed keys with a `rowid` constraint, following the SQLite comparison rules,
+ *          where NULLs match nothing, and numbers are smaller than any TEXT or BLOB.
+ *  @param[inout] allowed Keys matching the `rowid = ...` and `rowid IN (...)` constraints.
+ *  @param[inout] lower Smallest key matching the range constraints.
+ *  @param[inout] upper Largest key matching the range constraints.
+ */
+static void vtab_narrow(sqlite3_value* value, int op, std::vector<sqlite3_int64>& allowed, sqlite3_int64& lower,
+                        sqlite3_int64& upper) noexcept {
+    constexpr sqlite3_int64 min_k = std::numeric_limits<sqlite3_int64>::min();
+    constexpr sqlite3_int64 max_k = std::numeric_limits<sqlite3_int64>::max();
+    constexpr double limit_k = 9223372036854775808.0; // 2^63
+    bool const is_lower = op == SQLITE_INDEX_CONSTRAINT_GT || op == SQLITE_INDEX_CONSTRAINT_GE;
+    bool const is_upper = op == SQLITE_INDEX_CONSTRAINT_LT || op == SQLITE_INDEX_CONSTRAINT_LE;
+    bool const is_strict = op == SQLITE_INDEX_CONSTRAINT_GT || op == SQLITE_INDEX_CONSTRAINT_LT;
+    auto match_nothing = [&] { lower = max_k, upper = min_k; };
+
+    int type = sqlite3_value_numeric_type(value);
+    if (type == SQLITE_NULL || ((type == SQLITE_TEXT || type == SQLITE_BLOB) && !is_upper)) {
+        if (op != SQLITE_INDEX_CONSTRAINT_EQ)
+            match_nothing();
+        return;
+    }
+    if (type == SQLITE_TEXT || type == SQLITE_BLOB)
+        return;
+
+    // Round the bounds to the closest integers within the range, or just skip fractional keys
+    double real = sqlite3_value_double(value);
+    double rounded = is_lower ? std::ceil(real) : std::floor(real);
+    if (type == SQLITE_FLOAT && (rounded >= limit_k || rounded < -limit_k)) {
+        if (op == SQLITE_INDEX_CONSTRAINT_EQ)
+            return;
+        if ((rounded >= limit_k) == is_lower)
+            match_nothing();
+        return;
+    }
+    sqlite3_int64 bound = type == SQLITE_INTEGER ? sqlite3_value_int64(value) : static_cast<sqlite3_int64>(rounded);
+    bool const is_exact = type == SQLITE_INTEGER || rounded == real;
+    if (op == SQLITE_INDEX_CONSTRAINT_EQ) {
+        if (is_exact)
+            allowed.push_back(bound);
+        return;
+    }
+    if (is_strict && is_exact && bound == (is_lower ? max_k : min_k))
+        return match_nothing();
+    if (is_strict && is_exact)
+        bound += is_lower ? 1 : -1;
+    if (is_lower)
+        lower = (std::max)(lower, bound);
+    else
+        upper = (std::min)(upper, bound);
+}
+
+static int vtab_filter(sqlite3_vtab_cursor* base, int plan, char const*, int, sqlite3_value** argv) {
+    vtab_cursor_t* cursor = static_cast<vtab_cursor_t*>(base);
+    vtab_t& table = *static_cast<vtab_t*>(cursor->pVtab);
+    sqlite3_finalize(cursor->rows);
+    cursor->rows = nullptr;
+    cursor->plan = plan;
+    cursor->eof = false;
+    cursor->keys.clear();
+    cursor->distances.clear();
+    cursor->position = 0;
+
+    // Scans and point lookups are served straight from the shadow table
+    if (!(plan & vtab_plan_knn_k)) {
+        char* sql = sqlite3_mprintf(plan & vtab_plan_rowid_k
+                                        ? "SELECT rowid, vector FROM \"%w\".\"%w_vectors\" WHERE rowid = ?"
+                                        : "SELECT rowid, vector FROM \"%w\".\"%w_vectors\"",
+                                    table.schema.c_str(), table.name.c_str());
+        int rc = sql ? sqlite3_prepare_v2(table.db, sql, -1, &cursor->rows, nullptr) : SQLITE_NOMEM;
+        sqlite3_free(sql);
+        if (rc != SQLITE_OK)
+            return table.fail_with_db();
+        if (plan & vtab_plan_rowid_k)
+            sqlite3_bind_value(cursor->rows, 1, argv[0]);
+        rc = sqlite3_step(cursor->rows);
+        cursor->eof = rc != SQLITE_ROW;
+        return rc == SQLITE_ROW || rc == SQLITE_DONE ? SQLITE_OK : table.fail_with_db();
+    }
+
+    int rc = vtab_sync(table);
+    if (rc != SQLITE_OK)
+        return rc;
+
+    std::vector<f64_t> parsed;
+    byte_t const* vector = nullptr;
+    scalar_kind_t kind = scalar_kind_t::unknown_k;
+    int argument = 0;
+    if (char const* error = decode_vector(table.index, argv[argument++], parsed, vector, kind))
+        return table.fail(error);
+
+    sqlite3_int64 wanted = std::numeric_limits<sqlite3_int64>::max();
+    if (plan & vtab_plan_k_k)
+        cursor->wanted = sqlite3_value_int64(argv[argument++]), wanted = cursor->wanted;
+    if (plan & vtab_plan_limit_k)
+        wanted = (std::min)(wanted, sqlite3_value_int64(argv[argument++]));
+    if (plan & vtab_plan_offset_k)
+        wanted = wanted == std::numeric_limits<sqlite3_int64>::max() ? wanted
+                                                                      : wanted + sqlite3_value_int64(argv[argument++]);
+    if (wanted == std::numeric_limits<sqlite3_int64>::max())
+        return table.fail("KNN queries require a `k = ...` constraint or a LIMIT");
+    wanted = (std::min)(wanted, static_cast<sqlite3_int64>(table.index.size()));
+    if (wanted <= 0) {
+        cursor->eof = true;
+        return SQLITE_OK;
+    }
+
+    // Collect the `rowid` filters, to be checked during the graph traversal
+    bool filtered = false;
+    std::vector<sqlite3_int64> allowed;
+    sqlite3_int64 lower = std::numeric_limits<sqlite3_int64>::min();
+    sqlite3_int64 upper = std::numeric_limits<sqlite3_int64>::max();
+    if (plan & vtab_plan_rowid_in_k) {
+        sqlite3_value* list = argv[argument++];
+        sqlite3_value* value = nullptr;
+        filtered = true;
+#if SQLITE_VERSION_NUMBER >= 3038000
+        if (sqlite3_libversion_number() >= 3038000 && sqlite3_vtab_in_first(list, &value) == SQLITE_OK) {
+            for (; value; sqlite3_vtab_in_next(list, &value))
+                vtab_narrow(value, SQLITE_INDEX_CONSTRAINT_EQ, allowed, lower, upper);
+        } else
+#endif
+            vtab_narrow(list, SQLITE_INDEX_CONSTRAINT_EQ, allowed, lower, upper);
+        (void)value;
+        std::sort(allowed.begin(), allowed.end());
+    }
+    for (int bound : {vtab_plan_rowid_ge_k, vtab_plan_rowid_gt_k, vtab_plan_rowid_le_k, vtab_plan_rowid_lt_k}) {
+        if (!(plan & bound))
+            continue;
+        int op = bound == vtab_plan_rowid_ge_k   ? SQLITE_INDEX_CONSTRAINT_GE
+                 : bound == vtab_plan_rowid_gt_k ? SQLITE_INDEX_CONSTRAINT_GT
+                 : bound == vtab_plan_rowid_le_k ? SQLITE_INDEX_CONSTRAINT_LE
+                                                 : SQLITE_INDEX_CONSTRAINT_LT;
+        vtab_narrow(argv[argument++], op, allowed, lower, upper);
+        filtered = true;
+    }
+    if (lower > upper || ((plan & vtab_plan_rowid_in_k) && allowed.empty())) {
+        cursor->eof = true;
+        return SQLITE_OK;
+    }
+    if (filtered && !allowed.empty())
+        wanted = (std::min)(wanted, static_cast<sqlite3_int64>(allowed.size()));
+
+    index_dense_t::search_result_t result =
+        filtered ? vtab_search(table.index, vector, kind, static_cast<std::size_t>(wanted), //
+                               [&](default_key_t key) noexcept {
+                                   sqlite3_int64 rowid = static_cast<sqlite3_int64>(key);
+                                   return rowid >= lower && rowid <= upper &&
+                                          (!(plan & vtab_plan_rowid_in_k) ||
+                                           std::binary_search(allowed.begin(), allowed.end(), rowid));
+                               })
+                 : vtab_search(table.index, vector, kind, static_cast<std::size_t>(wanted), dummy_predicate_t{});
+    if (!result)
+        return table.fail(result.error.release());
+
+    cursor->keys.resize(result.size());
+    cursor->distances.resize(result.size());
+    result.dump_to(cursor->keys.data(), cursor->distances.data());
+    cursor->eof = cursor->keys.empty();
+    return SQLITE_OK;
+}
+
+static int vtab_next(sqlite3_vtab_cursor* base) {
+    vtab_cursor_t* cursor = static_cast<vtab_cursor_t*>(base);
+    if (cursor->rows) {
+        int rc = sqlite3_step(cursor->rows);
+        cursor->eof = rc != SQLITE_ROW;
+        return rc == SQLITE_ROW || rc == SQLITE_DONE ? SQLITE_OK : static_cast<vtab_t*>(base->pVtab)->fail_with_db();
+    }
+    cursor->eof = ++cursor->position >= cursor->keys.size();
+    return SQLITE_OK;
+}
+
+static int vtab_eof(sqlite3_vtab_cursor* cursor) { return static_cast<vtab_cursor_t*>(cursor)->eof; }
+
+static int vtab_rowid(sqlite3_vtab_cursor* base, sqlite3_int64* rowid) {
+    vtab_cursor_t* cursor = static_cast<vtab_cursor_t*>(base);
+    *rowid = cursor->rows ? sqlite3_column_int64(cursor->rows, 0)
+                          : static_cast<sqlite3_int64>(cursor->keys[cursor->position]);
+    return SQLITE_OK;
+}
+
+static int vtab_column(sqlite3_vtab_cursor* base, sqlite3_context* context, int column) {
+    vtab_cursor_t* cursor = static_cast<vtab_cursor_t*>(base);
+    vtab_t& table = *static_cast<vtab_t*>(base->pVtab);
+    switch (column) {
+    case vtab_column_vector_k: {
+        if (cursor->rows) {
+            sqlite3_result_value(context, sqlite3_column_value(cursor->rows, 1));
+            return SQLITE_OK;
+        }
+        sqlite3_stmt* select = table.statement( //
+            table.select_vector, "SELECT vector FROM \"%w\".\"%w_vectors\" WHERE rowid = ?");
+        if (!select)
+            return table.fail_with_db();
+        sqlite3_bind_int64(select, 1, static_cast<sqlite3_int64>(cursor->keys[cursor->position]));
+        if (sqlite3_step(select) == SQLITE_ROW)
+            sqlite3_result_value(context, sqlite3_column_value(select, 0));
+        sqlite3_reset(select);
+        return SQLITE_OK;
+    }
+    case vtab_column_distance_k:
+        if (!cursor->rows)
+            sqlite3_result_double(context, cursor->distances[cursor->position]);
+        return SQLITE_OK;
+    case vtab_column_k_k:
+        if (cursor->plan & vtab_plan_k_k)
+            sqlite3_result_int64(context, cursor->wanted);
+        return SQLITE_OK;
+    default: return SQLITE_OK;
+    }
+}
+
+static int vtab_update(sqlite3_vtab* vtab, int argc, sqlite3_value** argv, sqlite3_int64* new_rowid) {
+    vtab_t& table = *static_cast<vtab_t*>(vtab);
+    int rc = vtab_sync(table);
+    if (rc != SQLITE_OK)
+        return rc;
+
+    bool const removes = sqlite3_value_type(argv[0]) != SQLITE_NULL;
+    bool const adds = argc > 1;
+    sqlite3_int64 old_key = removes ? sqlite3_value_int64(argv[0]) : 0;
+
+    // Validate the new vector, before changing anything
+    std::vector<f64_t> parsed;
+    byte_t const* vector = nullptr;
+    scalar_kind_t kind = scalar_kind_t::unknown_k;
+    if (adds) {
+        if (sqlite3_value_type(argv[2 + vtab_column_distance_k]) != SQLITE_NULL ||
+            sqlite3_value_type(argv[2 + vtab_column_k_k]) != SQLITE_NULL)
+            return table.fail("The `distance` and `k` columns are read-only");
+        if (char const* error = decode_vector(table.index, argv[2 + vtab_column_vector_k], parsed, vector, kind))
+            return table.fail(error);
+    }
+
+    // Let other connections know, that their indexes are outdated, once per transaction
+    if (!table.version_bumped) {
+        sqlite3_stmt* bump = table.statement( //
+            table.bump_version, "UPDATE \"%w\".\"%w_info\" SET value = value + 1 WHERE key = 'version'");
+        if (!bump)
+            return table.fail_with_db();
+        rc = sqlite3_step(bump);
+        sqlite3_reset(bump);
+        if (rc != SQLITE_DONE)
+            return table.fail_with_db();
+        table.version_bumped = true;
+        table.version++;
+    }
+
+    // Update the source of truth first, relying on its constraints for duplicate keys.
+    // With `OR REPLACE` the conflicting rows are replaced, and with `OR IGNORE` SQLite skips the failed ones.
+    bool const replaces = sqlite3_vtab_on_conflict(table.db) == SQLITE_REPLACE;
+    sqlite3_stmt* statement = nullptr;
+    if (removes && adds) {
+        statement = replaces ? table.statement(table.update_or_replace_vector,
+                                               "UPDATE OR REPLACE \"%w\".\"%w_vectors\" "
+                                               "SET rowid = ?1, vector = ?2 WHERE rowid = ?3")
+                             : table.statement(table.update_vector, "UPDATE \"%w\".\"%w_vectors\" "
+                                                                    "SET rowid = ?1, vector = ?2 WHERE rowid = ?3");
+        if (statement) {
+            sqlite3_bind_value(statement, 1, argv[1]);
+            sqlite3_bind_int64(statement, 3, old_key);
+        }
+    } else if (adds) {
+        statement = replaces ? table.statement(table.replace_vector, "INSERT OR REPLACE INTO \"%w\".\"%w_vectors\""
+                                                                     "(rowid, vector) VALUES (?1, ?2)")
+                             : table.statement(table.insert_vector, "INSERT INTO \"%w\".\"%w_vectors\""
+                                                                    "(rowid, vector) VALUES (?1, ?2)");
+        if (statement)
+            sqlite3_bind_value(statement, 1, argv[1]);
+    } else {
+        statement = table.statement(table.delete_vector, "DELETE FROM \"%w\".\"%w_vectors\" WHERE rowid = ?1");
+        if (statement)
+            sqlite3_bind_int64(statement, 1, old_key);
+    }
+    if (!statement)
+        return table.fail_with_db();
+    if (adds)
+        sqlite3_bind_value(statement, 2, argv[2 + vtab_column_vector_k]);
+    rc = sqlite3_step(statement);
+    sqlite3_reset(statement);
+    sqlite3_clear_bindings(statement);
+    if (rc != SQLITE_DONE) {
+        // Constraint violations are reported as such, for SQLite to apply the `ON CONFLICT` resolution
+        int const failed = table.fail_with_db();
+        return (rc & 0xFF) == SQLITE_CONSTRAINT ? SQLITE_CONSTRAINT : failed;
+    }
+
+    // Mirror the change in the index, including the row replaced by the new key
+    sqlite3_int64 new_key = old_key;
+    if (adds)
+        new_key = sqlite3_value_type(argv[1]) == SQLITE_NULL ? sqlite3_last_insert_rowid(table.db)
+                                                            : sqlite3_value_int64(argv[1]);
+    bool const displaces = adds && replaces && (!removes || new_key != old_key);
+    table.dirty = true;
+    if (removes)
+        table.touched.insert(old_key);
+    if (adds)
+        table.touched.insert(new_key);
+    char const* error = nullptr;
+    if (removes)
+        error = table.index.remove(static_cast<default_key_t>(old_key)).error.release();
+    if (!error && displaces)
+        error = table.index.remove(static_cast<default_key_t>(new_key)).error.release();
+    if (!error && adds && !vtab_reserve(table.index))
+        error = "Out of memory!";
+    if (!error && adds)
+        error = vtab_add(table.index, static_cast<default_key_t>(new_key), vector, kind, 0).error.release();
+
+    // The shadow table has already changed, so the keys are re-read from it on the next use
+    if (error) {
+        if (removes)
+            table.rolled_back.insert(old_key);
+        if (adds)
+            table.rolled_back.insert(new_key);
+        return table.fail(error);
+    }
+    if (adds)
+        *new_rowid = new_key;
+    return SQLITE_OK;
+}
+
+static int vtab_begin(sqlite3_vtab* vtab) {
+    static_cast<vtab_t*>(vtab)->version_bumped = false;
+    return SQLITE_OK;
+}
+
+static int vtab_commit(sqlite3_vtab* vtab) {
+    vtab_t& table = *static_cast<vtab_t*>(vtab);
+    table.touched.clear();
+    table.version_bumped = false;
+    return SQLITE_OK;
+}
+
+static int vtab_rollback(sqlite3_vtab* vtab) {
+    vtab_t& table = *static_cast<vtab_t*>(vtab);
+    table.rolled_back.insert(table.touched.begin(), table.touched.end());
+    table.touched.clear();
+    table.version -= table.version_bumped;
+    table.version_bumped = false;
+    return SQLITE_OK;
+}
+
+static int vtab_savepoint(sqlite3_vtab*, int) { return SQLITE_OK; }
+
+static int vtab_rollback_to(sqlite3_vtab* vtab, int) {
+    // The keys changed since the savepoint are a subset of the touched ones, so we re-read them all.
+    // If the version increment was reverted as well, the mismatch will trigger a full reload.
+    vtab_t& table = *static_cast<vtab_t*>(vtab);
+    table.rolled_back.insert(table.touched.begin(), table.touched.end());
+    table.version_bumped = false;
+    return SQLITE_OK;
+}
+
+static int vtab_rename(sqlite3_vtab* vtab, char const* new_name) {
+    vtab_t& table = *static_cast<vtab_t*>(vtab);
+    char const* schema = table.schema.c_str();
+    char const* old_name = table.name.c_str();
+    char* sql = sqlite3_mprintf(                                       //
+        "ALTER TABLE \"%w\".\"%w_vectors\" RENAME TO \"%w_vectors\";" //
+        "ALTER TABLE \"%w\".\"%w_info\" RENAME TO \"%w_info\";",      //
+        schema, old_name, new_name, schema, old_name, new_name);
+    table.finalize();
+    int rc = sql ? sqlite3_exec(table.db, sql, nullptr, nullptr, nullptr) : SQLITE_NOMEM;
+    sqlite3_free(sql);
+    if (rc != SQLITE_OK)
+        return rc;
+
+    // Move the default file along with the table, while explicit paths stay in the schema
+    std::string new_path = vtab_default_path(table.db, schema, new_name);
+    if (!table.path.empty() && table.path == vtab_default_path(table.db, schema, old_name)) {
+        std::rename(table.path.c_str(), new_path.c_str());
+        table.path = new_path;
+    }
+    table.name = new_name;
+    return SQLITE_OK;
+}
+
+static int vtab_shadow_name(char const* suffix) {
+    return std::strcmp(suffix, "vectors") == 0 || std::strcmp(suffix, "info") == 0;
+}
+
+static sqlite3_module const* vtab_module() {
+    static sqlite3_module module = [] {
+        sqlite3_module result{};
+        result.iVersion = 3;
+        result.xCreate = vtab_create;
+        result.xConnect = vtab_connect;
+        result.xBestIndex = vtab_best_index;
+        result.xDisconnect = vtab_disconnect;
+        result.xDestroy = vtab_destroy;
+        result.xOpen = vtab_open;
+        result.xClose = vtab_close;
+        result.xFilter = vtab_filter;
+        result.xNext = vtab_next;
+        result.xEof = vtab_eof;
+        result.xColumn = vtab_column;
+        result.xRowid = vtab_rowid;
+        result.xUpdate = vtab_update;
+        result.xBegin = vtab_begin;
+        result.xCommit = vtab_commit;
+        result.xRollback = vtab_rollback;
+        result.xRename = vtab_rename;
+        result.xSavepoint = vtab_savepoint;
+        result.xRelease = vtab_savepoint;
+        result.xRollbackTo = vtab_rollback_to;
+        result.xShadowName = vtab_shadow_name;
+        return result;
+    }();
+    return &module;
+}
+
 int init_sqlite(sqlite3* db, char** error_message, sqlite3_api_routines const* api) {
     SQLITE_EXTENSION_INIT2(api)
 
@@ -331,7 +1445,8 @@ int init_sqlite(sqlite3* db, char** error_message, sqlite3_api_routines const* a
     sqlite3_create_function(db, "distance_divergence_i8", num_params, flags, NULL,
                             sqlite_dense<scalar_kind_t::i8_k, metric_kind_t::divergence_k>, NULL, NULL);
 
-    return SQLITE_OK;
+    // Virtual tables backed by an index
+    return sqlite3_create_module_v2(db, "usearch", vtab_module(), NULL, NULL);
 }
 
 #ifndef USEARCH_EXPORT